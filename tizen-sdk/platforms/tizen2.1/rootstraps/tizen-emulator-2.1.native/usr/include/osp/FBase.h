@@ -56,6 +56,7 @@
 #include <FBaseBuffer.h>
 #include <FBaseByteBuffer.h>
 #include <FBaseUuId.h>
+#include <FBaseStringInternPool.h>
 
 // Collection
 #include <FBaseCol.h>
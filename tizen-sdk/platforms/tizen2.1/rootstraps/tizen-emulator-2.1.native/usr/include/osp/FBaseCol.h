@@ -41,6 +41,7 @@
 #include <FBaseColQueueT.h>
 #include <FBaseColStackT.h>
 #include <FBaseColHashMapT.h>
+#include <FBaseColFlatHashMapT.h>
 #include <FBaseColMultiHashMapT.h>
 #include <FBaseColMapEntryT.h>
 #include <FBaseColAllElementsDeleter.h>
@@ -48,6 +49,8 @@
 #include <FBaseColIteratorT.h>
 #include <FBaseColPairIteratorT.h>
 #include <FBaseColRandomIteratorT.h>
+#include <FBaseColStlListViewT.h>
+#include <FBaseColStlMapViewT.h>
 
 /**
  * @namespace	Tizen::Base::Collection
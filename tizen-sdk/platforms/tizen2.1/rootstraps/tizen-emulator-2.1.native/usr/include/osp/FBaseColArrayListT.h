@@ -23,15 +23,23 @@
 #ifndef _FBASE_COL_ARRAY_LIST_T_H_
 #define _FBASE_COL_ARRAY_LIST_T_H_
 
+#include <iterator>
 #include <FBaseResult.h>
+#include <FBaseLog.h>
 #include <FBaseColIListT.h>
 #include <FBaseColIComparerT.h>
+#include <FBaseColTypes.h>
 
 
 namespace Tizen { namespace Base { namespace Collection
 {
 
 template< class Type > class __ArrayListEnumeratorT;
+template< class Type > class __ArrayListIteratorT;
+template< class Type, class Comparer, bool isComparer > class __ArrayListLessT;
+template< class Type, class Less > class __ArrayListSorterT;
+template< class Type, class Less > class __ArrayListParallelSorterT;
+template< class Type, class Comparer > struct __IsComparerT;
 
 /**
  * @class ArrayListT
@@ -113,7 +121,7 @@ public:
 		, __count(0)
 		, __pObjArray(null)
 		, __modCount(0)
-		, __pComparer(null)
+		, __growthPolicy(GROWTH_POLICY_LINEAR)
 	{
 	}
 
@@ -158,6 +166,37 @@ public:
 		return r;
 	}
 
+	/**
+	 * Initializes this instance of %ArrayListT with the specified capacity and growth policy.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	capacity		The initial capacity of the class
+	 * @param[in]	policy			The policy used to increase the capacity when the list is full
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
+	 *								  the specified @c capacity is negative.
+	 * @remarks		With the default ::GROWTH_POLICY_LINEAR policy, the capacity grows by a fixed number of elements
+	 *				and appending @c N elements costs O(N^2) element copies.
+	 *				::GROWTH_POLICY_ONE_AND_HALF and ::GROWTH_POLICY_DOUBLE grow the capacity geometrically,
+	 *				which makes Add() amortized O(1). Under these policies, removing elements does not shrink the capacity;
+	 *				call Trim() explicitly to release the unused memory.
+	 * @see			ArrayListT()
+	 */
+	result Construct(int capacity, GrowthPolicy policy)
+	{
+		TryReturn(policy >= GROWTH_POLICY_LINEAR && policy <= GROWTH_POLICY_DOUBLE, E_INVALID_ARG,
+			"[%s] The policy(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), policy);
+
+		result r = Construct(capacity);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__growthPolicy = policy;
+
+		return r;
+	}
+
 	/**
 	 * Initializes this instance of %ArrayListT with the specified parameter. @n
 	 * The capacity of the list is the same as the number of elements copied to it.
@@ -200,7 +239,7 @@ CATCH:
 	{
 		if (__count >= __capacity)
 		{
-			result r = SetCapacity(__capacity + DEFAULT_CAPACITY);
+			result r = EnsureCapacity(__count + 1);
 			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
 		}
 
@@ -211,6 +250,46 @@ CATCH:
 		return E_SUCCESS;
 	}
 
+	/**
+	 * Adds the specified number of elements from an array to the end of the list.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pItems	A pointer to the first element to add
+	 * @param[in]	count	The number of elements to add
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
+	 *								the @c count is negative, or @c pItems is @c null while @c count is greater than @c 0.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The capacity is increased at most once, and the elements are copied in a single pass.
+	 * @see			AddItems()
+	 */
+	result AddRange(const Type* pItems, int count)
+	{
+		TryReturn(count >= 0, E_INVALID_ARG, "[%s] The count(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), count);
+		TryReturn(pItems != null || count == 0, E_INVALID_ARG, "[%s] The pItems is null.", GetErrorMessage(E_INVALID_ARG));
+
+		if (count == 0)
+		{
+			return E_SUCCESS;
+		}
+
+		result r = EnsureCapacity(__count + count);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		Type* pDest = __pObjArray + __count;
+		for (int i = 0; i < count; i++)
+		{
+			pDest[i] = pItems[i];
+		}
+
+		__count += count;
+		__modCount++;
+
+		return E_SUCCESS;
+	}
+
 	/**
 	 * Adds the elements of the specified collection to the end of the list.
 	 *
@@ -231,11 +310,8 @@ CATCH:
 		int count = collection.GetCount();
 		if (count > 0)
 		{
-			if (count > (__capacity - __count))
-			{
-				r = SetCapacity(__count + count);
-				TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
-			}
+			r = EnsureCapacity(__count + count);
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
 
 			ICollectionT< Type >* pCol = const_cast< ICollectionT< Type >* >(&collection);
 			pEnum = pCol->GetEnumeratorN();
@@ -319,6 +395,44 @@ CATCH:
 		return null;
 	}
 
+	/**
+	 * The type of the forward iterator returned by begin() and end().
+	 *
+	 * @since 2.1
+	 */
+	typedef __ArrayListIteratorT< Type > ConstIterator;
+
+	/**
+	 * Gets an iterator that points to the first element of the list.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points to the first element, @n
+	 *				or end() if the list is empty
+	 * @remarks		Unlike GetEnumeratorN(), this method does not allocate memory and the iterator is accessed without virtual calls,
+	 *				so that the list can be traversed by a range-based for loop or a standard algorithm. @n
+	 *				The elements are accessed through constant references. @n
+	 *				The iterator is invalidated when the list is modified. In debug builds, using an invalidated iterator causes an assertion failure.
+	 * @see			end()
+	 */
+	ConstIterator begin(void) const
+	{
+		return ConstIterator(*this, 0);
+	}
+
+	/**
+	 * Gets an iterator that points past the last element of the list.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points past the last element
+	 * @see			begin()
+	 */
+	ConstIterator end(void) const
+	{
+		return ConstIterator(*this, __count);
+	}
+
 	/**
 	 * Gets the object at the specified @c index of the list.
 	 *
@@ -528,7 +642,7 @@ CATCH:
 
 		if (__count >= __capacity)
 		{
-			r = SetCapacity(__capacity + DEFAULT_CAPACITY);
+			r = EnsureCapacity(__count + 1);
 			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
 		}
 
@@ -576,11 +690,8 @@ CATCH:
 
 		if (count > 0)
 		{
-			if (count > (__capacity - __count))
-			{
-				r = SetCapacity(__count + count);
-				TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
-			}
+			r = EnsureCapacity(__count + count);
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
 
 			__count += count;
 			for (int i = (__count - 1); i >= (startIndex + count); i--)
@@ -704,7 +815,7 @@ CATCH:
 			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
 		}
 
-		if (__count < oldCount)
+		if (__count < oldCount && __growthPolicy == GROWTH_POLICY_LINEAR)
 		{
 			Trim();
 		}
@@ -745,7 +856,10 @@ CATCH:
 			__pObjArray[i] = __pObjArray[i + 1];
 		}
 
-		Trim();
+		if (__growthPolicy == GROWTH_POLICY_LINEAR)
+		{
+			Trim();
+		}
 
 		return E_SUCCESS;
 	}
@@ -915,23 +1029,112 @@ CATCH:
 	 * @exception	E_SUCCESS		The method is successful.
 	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
 	 *								the @c comparer is not valid.
+	 * @remarks		This method uses an introsort, which is a quicksort with median-of-three pivots
+	 *				that switches to an insertion sort for short ranges and to a heapsort when the recursion becomes too deep.
+	 *				Therefore, it takes O(N log N) time even if the list is already sorted. @n
+	 *				The relative order of equal elements is not preserved. Use StableSort() to preserve it.
+	 * @see			StableSort()
 	 */
 	virtual result Sort(const IComparerT< Type >& comparer)
 	{
-		if (0 == __count)
-			return E_SUCCESS;
+		__ArrayListLessT< Type, IComparerT< Type >, true > less(comparer);
 
-		__pComparer = const_cast< IComparerT< Type >* >(&comparer);
-		result r = QuickSort(0, (__count - 1));
-		if (IsFailed(r))
-		{
-			AppLogException("[%s] Propagating.", GetErrorMessage(r));
-			__pComparer = null;
+		result r = SortBy(less);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return r;
+	}
+
+	/**
+	 * Sorts the elements in the list using the specified comparer or comparison function object.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	comparer	An instance of the IComparerT derived class, or
+	 *							a function object or a function that returns @c true if its first argument is less than its second argument
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
+	 *								the @c comparer is not valid.
+	 * @remarks		The function object must provide <tt>bool operator ()(const Type&, const Type&) const</tt>.
+	 *				Its calls are not dispatched through a virtual function, so they can be inlined.
+	 * @see			Sort(const IComparerT< Type >&)
+	 */
+	template< class Comparer >
+	result Sort(const Comparer& comparer)
+	{
+		__ArrayListLessT< Type, Comparer, __IsComparerT< Type, Comparer >::VALUE > less(comparer);
+
+		result r = SortBy(less);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return r;
+	}
 
-			return r;
+	/**
+	 * Sorts the elements in the list using a comparer, preserving the relative order of equal elements.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	comparer	An instance of the IComparerT derived class, or
+	 *							a function object or a function that returns @c true if its first argument is less than its second argument
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
+	 *								the @c comparer is not valid.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		This method uses a merge sort, which takes O(N log N) time and a temporary buffer of N elements.
+	 * @see			Sort()
+	 */
+	template< class Comparer >
+	result StableSort(const Comparer& comparer)
+	{
+		__ArrayListLessT< Type, Comparer, __IsComparerT< Type, Comparer >::VALUE > less(comparer);
+
+		result r = StableSortBy(less);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return r;
+	}
+
+	/**
+	 * Sorts the elements in the list on multiple threads, preserving the relative order of equal elements.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	comparer	An instance of the IComparerT derived class, or
+	 *							a function object or a function that returns @c true if its first argument is less than its second argument
+	 * @param[in]	threadCount	The maximum number of threads to sort with, including the calling thread
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
+	 *								the @c comparer is not valid, or the @c threadCount is less than @c 1.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The list is split into @c threadCount runs. Each run is sorted on its own Tizen::Base::Runtime::Thread,
+	 *				and the sorted runs are merged on the calling thread.
+	 *				The @c comparer is called from several threads at the same time, so it must be thread-safe. @n
+	 *				Fewer threads are used if the list is too short to benefit from them.
+	 *				If a thread cannot be started, its run is sorted on the calling thread. @n
+	 *				The threads are defined in the Runtime namespace, so that FBaseColParallel.h must be included to call this method.
+	 * @see			StableSort()
+	 */
+	template< class Comparer >
+	result ParallelSort(const Comparer& comparer, int threadCount)
+	{
+		TryReturn(threadCount > 0, E_INVALID_ARG, "[%s] The threadCount(%d) MUST be greater than 0.", GetErrorMessage(E_INVALID_ARG), threadCount);
+
+		typedef __ArrayListLessT< Type, Comparer, __IsComparerT< Type, Comparer >::VALUE > Less;
+		Less less(comparer);
+
+		if (threadCount > __count / MIN_PARALLEL_SORT_RUN)
+		{
+			threadCount = __count / MIN_PARALLEL_SORT_RUN;
 		}
 
-		return E_SUCCESS;
+		result r = (threadCount > 1) ? __ArrayListParallelSorterT< Type, Less >::Sort(__pObjArray, __count, threadCount, less) : StableSortBy(less);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return r;
 	}
 
 	/**
@@ -972,6 +1175,19 @@ CATCH:
 		return __capacity;
 	}
 
+	/**
+	 * Gets the growth policy of the list.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The policy used to increase the capacity of the list
+	 * @see			Construct(int, GrowthPolicy)
+	 */
+	GrowthPolicy GetGrowthPolicy(void) const
+	{
+		return __growthPolicy;
+	}
+
 	/**
 	 * Gets the number of objects currently stored in the list.
 	 *
@@ -1149,75 +1365,112 @@ private:
 	ArrayListT< Type >& operator =(const ArrayListT< Type >& list);
 
 	/**
-	 * Sorts a section of a list using a comparer.
+	 * Increases the capacity so that it can hold at least the specified number of elements.
 	 *
 	 * @return		An error code
-	 * @param[in]	startIndex The start index of the section of the list
-	 * @param[in]	endIndex The end index of the section of the list
+	 * @param[in]	minCapacity The number of elements the list must be able to hold
 	 * @exception	E_SUCCESS		The method is successful.
-	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
-	 *								the comparer has failed to compare the elements.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
 	 */
-	result QuickSort(int startIndex, int endIndex)
+	result EnsureCapacity(int minCapacity)
 	{
-		result r = E_SUCCESS;
+		if (minCapacity <= __capacity)
+		{
+			return E_SUCCESS;
+		}
 
-		if (startIndex < endIndex)
+		int newCapacity = 0;
+		switch (__growthPolicy)
 		{
-			int middleIndex;
-			int i = startIndex - 1;
-			int j = endIndex + 1;
-			while (true)
-			{
-				int compareResult = 1;
-				while ((compareResult > 0) && (j > static_cast< int >(startIndex)))
-				{
-					j--;
+		case GROWTH_POLICY_DOUBLE:
+			newCapacity = __capacity * 2;
+			break;
 
-					r = __pComparer->Compare(__pObjArray[j], __pObjArray[startIndex], compareResult);
-					TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
-				}
+		case GROWTH_POLICY_ONE_AND_HALF:
+			newCapacity = __capacity + (__capacity >> 1);
+			break;
 
-				compareResult = -1;
-				while ((compareResult < 0) && (i < static_cast< int >(endIndex)))
-				{
-					i++;
+		default:
+			newCapacity = __capacity + DEFAULT_CAPACITY;
+			break;
+		}
 
-					r = __pComparer->Compare(__pObjArray[i], __pObjArray[startIndex], compareResult);
-					TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
-				}
+		if (newCapacity < DEFAULT_CAPACITY)
+		{
+			newCapacity = DEFAULT_CAPACITY;
+		}
 
-				if (i < j)
-				{
-					Type temp = __pObjArray[j];
-					__pObjArray[j] = __pObjArray[i];
-					__pObjArray[i] = temp;
-				}
-				else
-				{
-					middleIndex = j;
-					break;
-				}
+		// Also covers the overflow of the geometric growth
+		if (newCapacity < minCapacity)
+		{
+			newCapacity = minCapacity;
+		}
+
+		return SetCapacity(newCapacity);
+	}
+
+	/**
+	 * Sorts the list with an introsort.
+	 *
+	 * @return		An error code
+	 * @param[in]	less	The function object that compares the elements
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	The comparer has failed to compare the elements.
+	 */
+	template< class Less >
+	result SortBy(Less& less)
+	{
+		if (__count > 1)
+		{
+			int depthLimit = 0;
+			for (int n = __count; n > 1; n >>= 1)
+			{
+				depthLimit += 2;
 			}
 
-			r = QuickSort(startIndex, middleIndex);
-			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+			__ArrayListSorterT< Type, Less >::IntroSort(__pObjArray, 0, __count, depthLimit, less);
+		}
 
-			r = QuickSort(middleIndex + 1, endIndex);
-			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		return less.GetResult();
+	}
+
+	/**
+	 * Sorts the list with a merge sort.
+	 *
+	 * @return		An error code
+	 * @param[in]	less	The function object that compares the elements
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	The comparer has failed to compare the elements.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 */
+	template< class Less >
+	result StableSortBy(Less& less)
+	{
+		if (__count < 2)
+		{
+			return E_SUCCESS;
 		}
 
-		return r;
+		Type* pBuffer = new Type[__count];
+		TryReturn(pBuffer != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__ArrayListSorterT< Type, Less >::MergeSort(__pObjArray, 0, __count, pBuffer, less);
+
+		delete[] pBuffer;
+
+		return less.GetResult();
 	}
 
 	int __capacity;
 	int __count;
 	Type* __pObjArray;
 	int __modCount;
-	IComparerT< Type >* __pComparer;
+	GrowthPolicy __growthPolicy;
 	static const int DEFAULT_CAPACITY = 10;
+	static const int MIN_PARALLEL_SORT_RUN = 4096;
 
 	friend class __ArrayListEnumeratorT< Type >;
+	friend class __ArrayListIteratorT< Type >;
 
 }; // ArrayListT
 
@@ -1308,6 +1561,372 @@ private:
 
 }; //__ArrayListEnumeratorT
 
+//
+// @class	__ArrayListIteratorT
+// @brief	This class is a forward iterator over the elements of the %ArrayListT class.
+// @since 2.1
+//
+// The iterator is a plain value that points into the element array.
+// It also records the modification count of the list, which debug builds check to detect invalidation.
+//
+template< class Type >
+class __ArrayListIteratorT
+	: public std::iterator< std::forward_iterator_tag, Type, int, const Type*, const Type& >
+{
+public:
+	__ArrayListIteratorT(void)
+		: __pCurrent(null)
+		, __pList(null)
+		, __modCount(0)
+	{
+	}
+
+	__ArrayListIteratorT(const ArrayListT< Type >& list, int position)
+		: __pCurrent(list.__pObjArray + position)
+		, __pList(&list)
+		, __modCount(list.__modCount)
+	{
+	}
+
+	const Type& operator *(void) const
+	{
+		CheckModCount();
+		return *__pCurrent;
+	}
+
+	const Type* operator ->(void) const
+	{
+		CheckModCount();
+		return __pCurrent;
+	}
+
+	__ArrayListIteratorT< Type >& operator ++(void)
+	{
+		CheckModCount();
+		++__pCurrent;
+		return *this;
+	}
+
+	__ArrayListIteratorT< Type > operator ++(int)
+	{
+		__ArrayListIteratorT< Type > tempIter = *this;
+		operator ++();
+		return tempIter;
+	}
+
+	bool operator ==(const __ArrayListIteratorT< Type >& rhs) const
+	{
+		return __pCurrent == rhs.__pCurrent;
+	}
+
+	bool operator !=(const __ArrayListIteratorT< Type >& rhs) const
+	{
+		return __pCurrent != rhs.__pCurrent;
+	}
+
+private:
+	void CheckModCount(void) const
+	{
+#if defined(_APP_LOG) || defined(_OSP_DEBUG_) || defined(_DEBUG)
+		AppAssertf(__pList != null && __modCount == __pList->__modCount, "The source collection is modified after the creation of this iterator.");
+#endif
+	}
+
+	const Type* __pCurrent;
+	const ArrayListT< Type >* __pList;
+	int __modCount;
+
+}; // __ArrayListIteratorT
+
+//
+// @struct	__IsComparerT
+// @brief	This struct checks whether the Comparer type is derived from the IComparerT interface.
+// @since 2.1
+//
+template< class Type, class Comparer >
+struct __IsComparerT
+{
+	static char Test(const IComparerT< Type >*);
+	static long Test(...);
+
+	static const bool VALUE = (sizeof(Test(static_cast< const Comparer* >(null))) == sizeof(char));
+
+}; // __IsComparerT
+
+//
+// @class	__ArrayListLessT
+// @brief	This class adapts a comparison function object to the less-than predicate used by the sort algorithms of the %ArrayListT class.
+// @since 2.1
+//
+template< class Type, class Comparer, bool isComparer >
+class __ArrayListLessT
+{
+public:
+	explicit __ArrayListLessT(const Comparer& comparer)
+		: __comparer(comparer)
+	{
+	}
+
+	bool operator ()(const Type& obj1, const Type& obj2)
+	{
+		return __comparer(obj1, obj2);
+	}
+
+	result GetResult(void) const
+	{
+		return E_SUCCESS;
+	}
+
+private:
+	const Comparer& __comparer;
+
+}; // __ArrayListLessT
+
+//
+// @class	__ArrayListLessT
+// @brief	This class adapts an IComparerT instance to the less-than predicate used by the sort algorithms of the %ArrayListT class.
+// @since 2.1
+//
+template< class Type, class Comparer >
+class __ArrayListLessT< Type, Comparer, true >
+{
+public:
+	explicit __ArrayListLessT(const IComparerT< Type >& comparer)
+		: __comparer(comparer)
+		, __result(E_SUCCESS)
+	{
+	}
+
+	// Once the comparer fails, every comparison returns false so that the sort finishes without touching the elements further.
+	bool operator ()(const Type& obj1, const Type& obj2)
+	{
+		if (__result != E_SUCCESS)
+		{
+			return false;
+		}
+
+		int cmp = 0;
+		__result = __comparer.Compare(obj1, obj2, cmp);
+
+		return (__result == E_SUCCESS) && (cmp < 0);
+	}
+
+	result GetResult(void) const
+	{
+		return __result;
+	}
+
+private:
+	const IComparerT< Type >& __comparer;
+	result __result;
+
+}; // __ArrayListLessT< Type, Comparer, true >
+
+//
+// @class	__ArrayListSorterT
+// @brief	This class implements the sort algorithms of the %ArrayListT class on the ranges of an array.
+// @since 2.1
+//
+template< class Type, class Less >
+class __ArrayListSorterT
+{
+public:
+	//
+	// Sorts [first, last) with a median-of-three quicksort, falling back to a heapsort after depthLimit partitions.
+	//
+	static void IntroSort(Type* pArray, int first, int last, int depthLimit, Less& less)
+	{
+		while (last - first > INSERTION_SORT_THRESHOLD)
+		{
+			if (depthLimit == 0)
+			{
+				HeapSort(pArray + first, last - first, less);
+				return;
+			}
+			depthLimit--;
+
+			int middle = first + ((last - first) >> 1);
+			SortThree(pArray, first, middle, last - 1, less);
+
+			Type pivot = pArray[middle];
+			int i = first;
+			int j = last - 1;
+			while (i <= j)
+			{
+				while (i < last && less(pArray[i], pivot))
+				{
+					i++;
+				}
+				while (j >= first && less(pivot, pArray[j]))
+				{
+					j--;
+				}
+				if (i <= j)
+				{
+					Swap(pArray[i], pArray[j]);
+					i++;
+					j--;
+				}
+			}
+
+			// Recurses into the smaller part so that the stack depth stays logarithmic
+			if ((j + 1 - first) < (last - i))
+			{
+				IntroSort(pArray, first, j + 1, depthLimit, less);
+				first = i;
+			}
+			else
+			{
+				IntroSort(pArray, i, last, depthLimit, less);
+				last = j + 1;
+			}
+		}
+
+		InsertionSort(pArray, first, last, less);
+	}
+
+	//
+	// Sorts [first, last) stably. pBuffer must be addressable with the same indices as pArray.
+	//
+	static void MergeSort(Type* pArray, int first, int last, Type* pBuffer, Less& less)
+	{
+		for (int i = first; i < last; i += INSERTION_SORT_THRESHOLD)
+		{
+			InsertionSort(pArray, i, (last - i > INSERTION_SORT_THRESHOLD) ? (i + INSERTION_SORT_THRESHOLD) : last, less);
+		}
+
+		for (int width = INSERTION_SORT_THRESHOLD; width < last - first; width *= 2)
+		{
+			for (int i = first; last - i > width; i += 2 * width)
+			{
+				Merge(pArray, i, i + width, (last - i > 2 * width) ? (i + 2 * width) : last, pBuffer, less);
+			}
+		}
+	}
+
+	//
+	// Merges the sorted ranges [first, middle) and [middle, last) stably.
+	//
+	static void Merge(Type* pArray, int first, int middle, int last, Type* pBuffer, Less& less)
+	{
+		if (first == middle || middle == last || !less(pArray[middle], pArray[middle - 1]))
+		{
+			return;
+		}
+
+		for (int i = first; i < middle; i++)
+		{
+			pBuffer[i] = pArray[i];
+		}
+
+		int left = first;
+		int right = middle;
+		int dest = first;
+		while (left < middle && right < last)
+		{
+			if (less(pArray[right], pBuffer[left]))
+			{
+				pArray[dest++] = pArray[right++];
+			}
+			else
+			{
+				pArray[dest++] = pBuffer[left++];
+			}
+		}
+
+		while (left < middle)
+		{
+			pArray[dest++] = pBuffer[left++];
+		}
+	}
+
+private:
+	static void InsertionSort(Type* pArray, int first, int last, Less& less)
+	{
+		for (int i = first + 1; i < last; i++)
+		{
+			if (less(pArray[i], pArray[i - 1]))
+			{
+				Type value = pArray[i];
+				int j = i;
+				do
+				{
+					pArray[j] = pArray[j - 1];
+					j--;
+				}
+				while (j > first && less(value, pArray[j - 1]));
+
+				pArray[j] = value;
+			}
+		}
+	}
+
+	static void HeapSort(Type* pArray, int count, Less& less)
+	{
+		for (int i = (count >> 1) - 1; i >= 0; i--)
+		{
+			SiftDown(pArray, i, count, less);
+		}
+
+		for (int end = count - 1; end > 0; end--)
+		{
+			Swap(pArray[0], pArray[end]);
+			SiftDown(pArray, 0, end, less);
+		}
+	}
+
+	static void SiftDown(Type* pArray, int root, int count, Less& less)
+	{
+		Type value = pArray[root];
+
+		int child = 2 * root + 1;
+		while (child < count)
+		{
+			if (child + 1 < count && less(pArray[child], pArray[child + 1]))
+			{
+				child++;
+			}
+
+			if (!less(value, pArray[child]))
+			{
+				break;
+			}
+
+			pArray[root] = pArray[child];
+			root = child;
+			child = 2 * root + 1;
+		}
+
+		pArray[root] = value;
+	}
+
+	static void SortThree(Type* pArray, int a, int b, int c, Less& less)
+	{
+		if (less(pArray[b], pArray[a]))
+		{
+			Swap(pArray[a], pArray[b]);
+		}
+		if (less(pArray[c], pArray[b]))
+		{
+			Swap(pArray[b], pArray[c]);
+			if (less(pArray[b], pArray[a]))
+			{
+				Swap(pArray[a], pArray[b]);
+			}
+		}
+	}
+
+	static void Swap(Type& obj1, Type& obj2)
+	{
+		Type temp = obj1;
+		obj1 = obj2;
+		obj2 = temp;
+	}
+
+	static const int INSERTION_SORT_THRESHOLD = 16;
+
+}; // __ArrayListSorterT
+
 } } } // Tizen::Base::Collection
 
 #endif // _FBASE_COL_ARRAY_LIST_T_H_
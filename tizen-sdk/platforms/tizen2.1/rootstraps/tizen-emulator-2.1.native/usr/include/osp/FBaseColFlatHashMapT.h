@@ -0,0 +1,1182 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColFlatHashMapT.h
+ * @brief		This is the header file for the %FlatHashMapT class.
+ *
+ * This header file contains the declarations of the %FlatHashMapT class.
+ */
+#ifndef _FBASE_COL_FLAT_HASH_MAP_T_H_
+#define _FBASE_COL_FLAT_HASH_MAP_T_H_
+
+#include <iterator>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseString.h>
+#include <FBaseColIListT.h>
+#include <FBaseColIMapT.h>
+#include <FBaseColArrayListT.h>
+#include <FBaseColMapEntryT.h>
+#include <FBaseFloat.h>
+
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+template< class KeyType, class ValueType > struct __FlatHashMapSlotT;
+template< class KeyType, class ValueType, class HashFunc, class EqualFunc > class __FlatHashMapEnumeratorT;
+template< class KeyType, class ValueType, class HashFunc, class EqualFunc > class __FlatHashMapIteratorT;
+
+//
+// @class	__FlatHashMapDefaultHashT
+// @brief	This is the default hash function object for the %FlatHashMapT class.
+// @since 2.1
+//
+template< class KeyType >
+struct __FlatHashMapDefaultHashT
+{
+	int operator ()(const KeyType& obj) const
+	{
+		return (int) obj;
+	}
+}; // __FlatHashMapDefaultHashT
+
+template<>
+struct __FlatHashMapDefaultHashT< Tizen::Base::String >
+{
+	int operator ()(const Tizen::Base::String& obj) const
+	{
+		return obj.GetHashCode();
+	}
+}; // __FlatHashMapDefaultHashT< Tizen::Base::String >
+
+//
+// @class	__FlatHashMapDefaultEqualT
+// @brief	This is the default equality function object for the %FlatHashMapT class.
+// @since 2.1
+//
+template< class KeyType >
+struct __FlatHashMapDefaultEqualT
+{
+	bool operator ()(const KeyType& obj1, const KeyType& obj2) const
+	{
+		return obj1 == obj2;
+	}
+}; // __FlatHashMapDefaultEqualT
+
+/**
+ * @class FlatHashMapT
+ * @brief This class provides a template-based collection of associated keys and values
+ * that are stored inline in a single open-addressing table.
+ *
+ * @since 2.1
+ *
+ * The %FlatHashMapT class provides a template-based collection of associated keys and values
+ * that are organized based on the hash code of the key.
+ * It contains unique keys and each key maps to one single value.
+ * Unlike HashMapT, the entries are stored in one contiguous table using Robin Hood hashing, so adding an entry does not allocate memory
+ * unless the table is resized, and a lookup touches only a few adjacent slots.
+ * The hash and equality functions are template parameters, so the calls can be inlined instead of being dispatched
+ * through the IHashCodeProviderT and IComparerT interfaces. @n
+ * The @c HashFunc type must provide <tt>int operator ()(const KeyType&) const</tt>, and
+ * the @c EqualFunc type must provide <tt>bool operator ()(const KeyType&, const KeyType&) const</tt>.
+ * By default, @c int-convertible keys are hashed by their value, Tizen::Base::String keys by String::GetHashCode(),
+ * and keys are compared using the equality (==) operator. @n
+ * KeyType and ValueType need default constructors and assignment (=) operators.
+ *
+ * The following example demonstrates how to use the %FlatHashMapT class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Collection;
+ *
+ *	void
+ *	MyClass::FlatHashMapTSample(void)
+ *	{
+ *		FlatHashMapT< int, int > map;
+ *
+ *		// Constructs a %FlatHashMapT instance with default capacity and load factor
+ *		map.Construct();
+ *
+ *		map.Add(1, 100);	// map.GetCount() : 1
+ *		map.Add(2, 200);	// map.GetCount() : 2
+ *		map.Add(3, 300);	// map.GetCount() : 3
+ *
+ *		int key;
+ *		int value;
+ *
+ *		// Gets a value with the specified key
+ *		key = 1;
+ *		map.GetValue(key, value);	// value : 100
+ *
+ *		// Removes the value with the specified key
+ *		map.Remove(key);
+ *
+ *		// Uses an enumerator to access elements in the map
+ *		IMapEnumeratorT< int, int >*	pMapEnum = map.GetMapEnumeratorN();
+ *		while (pMapEnum->MoveNext() == E_SUCCESS)
+ *		{
+ *			pMapEnum->GetKey(key);
+ *			pMapEnum->GetValue(value);
+ *		}
+ *
+ *		delete pMapEnum;
+ *	}
+ * @endcode
+ */
+template< class KeyType, class ValueType, class HashFunc = __FlatHashMapDefaultHashT< KeyType >, class EqualFunc = __FlatHashMapDefaultEqualT< KeyType > >
+class FlatHashMapT
+	: public IMapT< KeyType, ValueType >
+	, public Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since 2.1
+	 */
+	FlatHashMapT(void)
+		: __pSlots(null)
+		, __count(0)
+		, __capacity(0)
+		, __loadFactor(0)
+		, __threshold(0)
+		, __hashFunc()
+		, __equalFunc()
+		, __modCount(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~FlatHashMapT(void)
+	{
+		delete[] __pSlots;
+	}
+
+	/**
+	 * Initializes this instance of %FlatHashMapT with the specified parameters.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	capacity		The number of slots to allocate initially @n
+	 *								It is rounded up to a power of two.
+	 * @param[in]	loadFactor		The maximum ratio of entries to slots before the table is resized @n
+	 *								If it is @c 0, the default load factor (0.75) is used.
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	Either of the following conditions has occurred: @n
+	 *								- A specified input parameter is invalid. @n
+	 *								- The specified @c capacity is negative. @n
+	 *								- The @c loadFactor is negative, or greater than or equal to @c 1.0.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @see			FlatHashMapT()
+	 */
+	result Construct(int capacity = DEFAULT_CAPACITY, float loadFactor = 0.75)
+	{
+		TryReturn(capacity >= 0, E_INVALID_ARG, "[%s] The capacity(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), capacity);
+		TryReturn(loadFactor >= 0 && loadFactor < 1.0f, E_INVALID_ARG,
+			"[%s] The loadFactor(%f) MUST be greater than or equal to 0.0 and less than 1.0.", GetErrorMessage(E_INVALID_ARG), loadFactor);
+
+		if (Float::Compare(loadFactor, 0) == 0)
+		{
+			__loadFactor = DEFAULT_LOAD_FACTOR;
+		}
+		else
+		{
+			__loadFactor = loadFactor;
+		}
+
+		int newCapacity = 1;
+		while (newCapacity < capacity || newCapacity < MIN_CAPACITY)
+		{
+			newCapacity <<= 1;
+		}
+
+		result r = Resize(newCapacity);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Initializes this instance of %FlatHashMapT by copying the elements of the specified map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	map				A map to copy
+	 * @param[in]	loadFactor		The maximum ratio of entries to slots before the table is resized
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_ARG		A specified input parameter is invalid, or
+	 *									the @c loadFactor is negative, or greater than or equal to @c 1.0.
+	 * @exception	E_INVALID_OPERATION	The current state of the instance prohibits the execution of the specified operation, or
+	 *									the @c map is modified during the operation of this method.
+	 * @see			FlatHashMapT()
+	 */
+	result Construct(const IMapT< KeyType, ValueType >& map, float loadFactor = 0.75)
+	{
+		TryReturn(loadFactor >= 0 && loadFactor < 1.0f, E_INVALID_ARG,
+			"[%s] The loadFactor(%f) MUST be greater than or equal to 0.0 and less than 1.0.", GetErrorMessage(E_INVALID_ARG), loadFactor);
+
+		if (Float::Compare(loadFactor, 0) == 0)
+		{
+			loadFactor = DEFAULT_LOAD_FACTOR;
+		}
+
+		int capacity = static_cast< int >(map.GetCount() / loadFactor) + 1;
+
+		result r = Construct(capacity, loadFactor);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = AddAll(map);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		return r;
+
+CATCH:
+		delete[] __pSlots;
+		__pSlots = null;
+		__capacity = 0;
+		__count = 0;
+
+		return r;
+	}
+
+	/**
+	 * Initializes this instance of %FlatHashMapT with the specified parameters and function objects.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	capacity		The number of slots to allocate initially
+	 * @param[in]	loadFactor		The maximum ratio of entries to slots before the table is resized
+	 * @param[in]	hashFunc		The function object used to get the hash code of a key
+	 * @param[in]	equalFunc		The function object used to check whether two keys are equal
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_INVALID_ARG	Either of the following conditions has occurred: @n
+	 *								- A specified input parameter is invalid. @n
+	 *								- The specified @c capacity is negative. @n
+	 *								- The @c loadFactor is negative, or greater than or equal to @c 1.0.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The function objects are copied into this map.
+	 * @see			FlatHashMapT()
+	 */
+	result Construct(int capacity, float loadFactor, const HashFunc& hashFunc, const EqualFunc& equalFunc)
+	{
+		__hashFunc = hashFunc;
+		__equalFunc = equalFunc;
+
+		return Construct(capacity, loadFactor);
+	}
+
+	/**
+	 * Adds the specified key-value pair to the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	key		The key to add
+	 * @param[in]	value	The corresponding value to add
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_ALREADY_EXIST	The specified @c key already exists.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @see			Remove()
+	 */
+	virtual result Add(const KeyType& key, const ValueType& value)
+	{
+		int hash = Hash(key);
+
+		TryReturn(Find(key, hash) < 0, E_OBJ_ALREADY_EXIST, "[%s] The key is already exist in this collection.", GetErrorMessage(E_OBJ_ALREADY_EXIST));
+
+		if (__count >= __threshold)
+		{
+			result r = Resize(__capacity * 2);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		Insert(key, value, hash);
+		__count++;
+		__modCount++;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets an enumerator of this map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An instance of the IEnumeratorT derived class, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 * @see			Tizen::Base::Collection::IEnumeratorT
+	 */
+	virtual IEnumeratorT< MapEntryT< KeyType, ValueType > >* GetEnumeratorN(void) const
+	{
+		result r = E_SUCCESS;
+
+		__FlatHashMapEnumeratorT< KeyType, ValueType, HashFunc, EqualFunc >* pEnum =
+			new __FlatHashMapEnumeratorT< KeyType, ValueType, HashFunc, EqualFunc >(*this, __modCount);
+		TryCatch(pEnum != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return pEnum;
+
+CATCH:
+		SetLastResult(r);
+		return null;
+	}
+
+	/**
+	 * Gets the elements of the map in an instance of the IMapEnumeratorT class.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An instance of the IMapEnumeratorT class, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 * @see			Tizen::Base::Collection::IEnumerator
+	 * @see			Tizen::Base::Collection::IMapEnumeratorT
+	 */
+	virtual IMapEnumeratorT< KeyType, ValueType >* GetMapEnumeratorN(void) const
+	{
+		return dynamic_cast< IMapEnumeratorT< KeyType, ValueType >* >(GetEnumeratorN());
+	}
+
+	/**
+	 * The type of the forward iterator returned by begin() and end().
+	 *
+	 * @since 2.1
+	 */
+	typedef __FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc > ConstIterator;
+
+	/**
+	 * Gets an iterator that points to the first entry of the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points to the first entry, @n
+	 *				or end() if the map is empty
+	 * @remarks		Unlike GetEnumeratorN(), this method does not allocate memory and the iterator is accessed without virtual calls,
+	 *				so that the map can be traversed by a range-based for loop or a standard algorithm. @n
+	 *				The key and the value of an entry are accessed through GetKey() and GetValue() of the entry, without copying. @n
+	 *				The iterator is invalidated when the map is modified. In debug builds, using an invalidated iterator causes an assertion failure.
+	 * @see			end()
+	 */
+	ConstIterator begin(void) const
+	{
+		return ConstIterator(*this, 0);
+	}
+
+	/**
+	 * Gets an iterator that points past the last entry of the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points past the last entry
+	 * @see			begin()
+	 */
+	ConstIterator end(void) const
+	{
+		return ConstIterator(*this, __capacity);
+	}
+
+	/**
+	 * Gets the value associated with the specified key.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	key		The key to find the associated value
+	 * @param[out]	value	The value associated with the key
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c key is not found in the map.
+	 * @see			SetValue()
+	 */
+	virtual result GetValue(const KeyType& key, ValueType& value) const
+	{
+		int index = Find(key, Hash(key));
+		if (index < 0)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		value = __pSlots[index].value;
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the value associated with the specified key.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	key		The key to find the associated value
+	 * @param[out]	value	The value associated with the key
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c key is not found in the map.
+	 * @see			SetValue()
+	 */
+	virtual result GetValue(const KeyType& key, ValueType& value)
+	{
+		return (static_cast< const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >* >(this))->GetValue(key, value);
+	}
+
+	/**
+	 * Gets a list of all the keys in the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A pointer to a list of all the keys in the map, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The order of the keys is the same as the corresponding values in the IListT interface returned by the GetValuesN() method.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 * @see			GetValuesN()
+	 */
+	virtual IListT< KeyType >* GetKeysN(void) const
+	{
+		result r = E_SUCCESS;
+
+		ArrayListT< KeyType >* pList = new ArrayListT< KeyType >();
+		TryCatch(pList != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pList->Construct(__count);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int i = 0; i < __capacity; i++)
+		{
+			if (__pSlots[i].probe != 0)
+			{
+				r = pList->Add(__pSlots[i].key);
+				TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+			}
+		}
+
+		SetLastResult(E_SUCCESS);
+		return pList;
+
+CATCH:
+		delete pList;
+
+		SetLastResult(r);
+		return null;
+	}
+
+	/**
+	 * Gets a list of all the values in the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A pointer to a list of all the values in the map, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 * @see			GetKeysN()
+	 */
+	virtual IListT< ValueType >* GetValuesN(void) const
+	{
+		result r = E_SUCCESS;
+
+		ArrayListT< ValueType >* pList = new ArrayListT< ValueType >();
+		TryCatch(pList != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pList->Construct(__count);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int i = 0; i < __capacity; i++)
+		{
+			if (__pSlots[i].probe != 0)
+			{
+				r = pList->Add(__pSlots[i].value);
+				TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+			}
+		}
+
+		SetLastResult(E_SUCCESS);
+		return pList;
+
+CATCH:
+		delete pList;
+
+		SetLastResult(r);
+		return null;
+	}
+
+	/**
+	 * Removes the values associated with the specified key.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	key The key to remove
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c key is not found in the map.
+	 * @remarks		The following entries are shifted back into the freed slot, so no tombstones are left in the table.
+	 * @see			Add()
+	 */
+	virtual result Remove(const KeyType& key)
+	{
+		int index = Find(key, Hash(key));
+		if (index < 0)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		int mask = __capacity - 1;
+		int next = (index + 1) & mask;
+		while (__pSlots[next].probe > 1)
+		{
+			__pSlots[index].key = __pSlots[next].key;
+			__pSlots[index].value = __pSlots[next].value;
+			__pSlots[index].hash = __pSlots[next].hash;
+			__pSlots[index].probe = __pSlots[next].probe - 1;
+
+			index = next;
+			next = (next + 1) & mask;
+		}
+
+		__pSlots[index].key = KeyType();
+		__pSlots[index].value = ValueType();
+		__pSlots[index].probe = 0;
+
+		__count--;
+		__modCount++;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Removes all key-value pairs in the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		The capacity of the table is retained.
+	 */
+	virtual void RemoveAll(void)
+	{
+		if (__count > 0)
+		{
+			for (int i = 0; i < __capacity; i++)
+			{
+				if (__pSlots[i].probe != 0)
+				{
+					__pSlots[i].key = KeyType();
+					__pSlots[i].value = ValueType();
+					__pSlots[i].probe = 0;
+				}
+			}
+
+			__count = 0;
+			__modCount++;
+		}
+	}
+
+	/**
+	 * Replaces the value associated with the specified key with the specified value.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	key		The key for which the value is to replace
+	 * @param[in]	value	The new value to replace
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c key is not found in the map.
+	 * @remarks		Use the Add() method to add a new key-value pair.
+	 * @see			Add()
+	 * @see			GetValue()
+	 */
+	virtual result SetValue(const KeyType& key, const ValueType& value)
+	{
+		int index = Find(key, Hash(key));
+		if (index < 0)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		__pSlots[index].value = value;
+		__modCount++;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the number of pairs currently stored in the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The pairs stored in the map
+	 */
+	virtual int GetCount(void) const
+	{
+		return __count;
+	}
+
+	/**
+	 * Gets the number of slots in the table.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The current number of slots in the table
+	 */
+	int GetCapacity(void) const
+	{
+		return __capacity;
+	}
+
+	/**
+	 * Checks whether the map contains the specified key.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	key	The key to locate
+	 * @param[out]	out	@c true if the map contains the specified key, @n
+	 *					else @c false
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @see			ContainsValue()
+	 */
+	virtual result ContainsKey(const KeyType& key, bool& out) const
+	{
+		out = (Find(key, Hash(key)) >= 0);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Checks whether the map contains the specified value.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if the map contains the specified value, @n
+	 *				else @c false
+	 * @param[in]	value	The value to locate
+	 * @see			ContainsKey()
+	 */
+	virtual bool ContainsValue(const ValueType& value) const
+	{
+		for (int i = 0; i < __capacity; i++)
+		{
+			if (__pSlots[i].probe != 0 && value == __pSlots[i].value)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Compares the specified instance to the current instance for equality.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if the two instances are equal, @n
+	 *				else @c false
+	 * @param[in]	obj The object to compare with the current instance
+	 * @remarks		This method returns @c true if and only if the two instances contain the same number of elements and all the elements contained in each other.
+	 */
+	virtual bool Equals(const Object& obj) const
+	{
+		const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >* other = dynamic_cast< const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >* >(&obj);
+		if (null == other)
+		{
+			return false;
+		}
+		else if (other == this)
+		{
+			return true;
+		}
+		else if (__count != other->__count)
+		{
+			return false;
+		}
+		else
+		{
+			for (int i = 0; i < __capacity; i++)
+			{
+				if (__pSlots[i].probe != 0)
+				{
+					ValueType otherValue;
+					result r = other->GetValue(__pSlots[i].key, otherValue);
+					if (IsFailed(r))
+					{
+						return false;
+					}
+					if (__pSlots[i].value != otherValue)
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Gets the hash value of the current instance.
+	 *
+	 * @since 2.1
+	 *
+	 * @return	The hash value of the current instance
+	 * @remarks	The two Tizen::Base::Object::Equals() instances must return the same hash value. For better performance, @n
+	 *			the used hash function must generate a random distribution for all inputs.
+	 */
+	virtual int GetHashCode(void) const
+	{
+		int hash = 0;
+		for (int i = 0; i < __capacity; i++)
+		{
+			if (__pSlots[i].probe != 0)
+			{
+				hash += __pSlots[i].hash;
+			}
+		}
+		return hash;
+	}
+
+private:
+	/**
+	 * The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	 *
+	 * @param[in]	map The instance of the %FlatHashMapT class to copy from
+	 */
+	FlatHashMapT(const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >& map);
+
+	/**
+	 * The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	 *
+	 * @param[in]	map An instance of %FlatHashMapT
+	 */
+	FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >& operator =(const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >& map);
+
+	/**
+	 * Copies all the pairs of the specified map to this map.
+	 *
+	 * @return		An error code
+	 * @param[in]	map		The map to copy
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	The current state of the instance prohibits the execution of the specified operation, or
+	 *									the @c map is modified during the operation of this method.
+	 */
+	result AddAll(const IMapT< KeyType, ValueType >& map)
+	{
+		result r = E_SUCCESS;
+
+		IMapT< KeyType, ValueType >* pMap = const_cast< IMapT< KeyType, ValueType >* >(&map);
+		IMapEnumeratorT< KeyType, ValueType >* pMapEnum = pMap->GetMapEnumeratorN();
+		TryCatch(pMapEnum != null, r = GetLastResult(), "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+
+		while ((r = pMapEnum->MoveNext()) != E_OUT_OF_RANGE)
+		{
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+			KeyType key;
+			ValueType value;
+
+			r = pMapEnum->GetKey(key);
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+			r = pMapEnum->GetValue(value);
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+			r = Add(key, value);
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		delete pMapEnum;
+		return E_SUCCESS;
+
+CATCH:
+		delete pMapEnum;
+		return r;
+	}
+
+	/**
+	 * Gets the hash code of the specified key, with the low bits mixed.
+	 *
+	 * @return		The hash code
+	 * @param[in]	key	The key
+	 */
+	int Hash(const KeyType& key) const
+	{
+		int h = __hashFunc(key);
+
+		h ^= (h >> 20) ^ (h >> 12);
+
+		return h ^ (h >> 7) ^ (h >> 4);
+	}
+
+	/**
+	 * Finds the slot that holds the specified key.
+	 *
+	 * @return		The index of the slot, @n
+	 *				else @c -1 if the key is not found
+	 * @param[in]	key		The key to locate
+	 * @param[in]	hash	The hash code of the key
+	 */
+	int Find(const KeyType& key, int hash) const
+	{
+		if (__count == 0)
+		{
+			return -1;
+		}
+
+		int mask = __capacity - 1;
+		int index = hash & mask;
+
+		// A slot whose entry is closer to its home than this probe ends the search
+		for (int probe = 1; __pSlots[index].probe >= probe; probe++)
+		{
+			if (__pSlots[index].hash == hash && __equalFunc(__pSlots[index].key, key))
+			{
+				return index;
+			}
+			index = (index + 1) & mask;
+		}
+
+		return -1;
+	}
+
+	/**
+	 * Inserts the specified pair, displacing the entries that are closer to their home slot.
+	 *
+	 * @param[in]	key		The key to insert
+	 * @param[in]	value	The value to insert
+	 * @param[in]	hash	The hash code of the key
+	 * @remarks		The key must not exist in the table and there must be at least one free slot.
+	 */
+	void Insert(const KeyType& key, const ValueType& value, int hash)
+	{
+		int mask = __capacity - 1;
+		int index = hash & mask;
+		int probe = 1;
+
+		KeyType carriedKey = key;
+		ValueType carriedValue = value;
+
+		while (__pSlots[index].probe != 0)
+		{
+			if (__pSlots[index].probe < probe)
+			{
+				KeyType tempKey = __pSlots[index].key;
+				ValueType tempValue = __pSlots[index].value;
+				int tempHash = __pSlots[index].hash;
+				int tempProbe = __pSlots[index].probe;
+
+				__pSlots[index].key = carriedKey;
+				__pSlots[index].value = carriedValue;
+				__pSlots[index].hash = hash;
+				__pSlots[index].probe = probe;
+
+				carriedKey = tempKey;
+				carriedValue = tempValue;
+				hash = tempHash;
+				probe = tempProbe;
+			}
+
+			index = (index + 1) & mask;
+			probe++;
+		}
+
+		__pSlots[index].key = carriedKey;
+		__pSlots[index].value = carriedValue;
+		__pSlots[index].hash = hash;
+		__pSlots[index].probe = probe;
+	}
+
+	/**
+	 * Reallocates the table with the specified number of slots.
+	 *
+	 * @return		An error code
+	 * @param[in]	newCapacity	The new number of slots, which must be a power of two
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 */
+	result Resize(int newCapacity)
+	{
+		__FlatHashMapSlotT< KeyType, ValueType >* pOldSlots = __pSlots;
+		int oldCapacity = __capacity;
+
+		__FlatHashMapSlotT< KeyType, ValueType >* pNewSlots = new __FlatHashMapSlotT< KeyType, ValueType >[newCapacity];
+		TryReturn(pNewSlots != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__pSlots = pNewSlots;
+		__capacity = newCapacity;
+		__threshold = static_cast< int >(__capacity * __loadFactor);
+
+		for (int i = 0; i < oldCapacity; i++)
+		{
+			if (pOldSlots[i].probe != 0)
+			{
+				Insert(pOldSlots[i].key, pOldSlots[i].value, pOldSlots[i].hash);
+			}
+		}
+
+		delete[] pOldSlots;
+
+		return E_SUCCESS;
+	}
+
+	__FlatHashMapSlotT< KeyType, ValueType >* __pSlots;
+	int __count;
+	int __capacity;
+	float __loadFactor;
+	int __threshold;
+	HashFunc __hashFunc;
+	EqualFunc __equalFunc;
+	int __modCount;
+
+	static const int DEFAULT_CAPACITY = 16;
+	static const int MIN_CAPACITY = 8;
+	static const float DEFAULT_LOAD_FACTOR;
+
+	friend class __FlatHashMapEnumeratorT< KeyType, ValueType, HashFunc, EqualFunc >;
+	friend class __FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc >;
+
+}; // FlatHashMapT
+
+//
+// @struct	__FlatHashMapSlotT
+// @brief	This is a slot of the table of the %FlatHashMapT class.
+// @since 2.1
+//
+template< class KeyType, class ValueType >
+struct __FlatHashMapSlotT
+{
+	__FlatHashMapSlotT(void)
+		: key()
+		, value()
+		, hash(0)
+		, probe(0)
+	{
+	}
+
+	const KeyType& GetKey(void) const
+	{
+		return key;
+	}
+
+	const ValueType& GetValue(void) const
+	{
+		return value;
+	}
+
+	KeyType key;
+	ValueType value;
+	int hash;
+
+	// The distance from the home slot plus one, or 0 if the slot is empty
+	int probe;
+
+}; // __FlatHashMapSlotT
+
+//
+// @class	__FlatHashMapEnumeratorT
+// @brief	This is an implementation of the IMapEnumeratorT interface for the %FlatHashMapT class.
+// @since 2.1
+//
+template< class KeyType, class ValueType, class HashFunc, class EqualFunc >
+class __FlatHashMapEnumeratorT
+	: public IMapEnumeratorT< KeyType, ValueType >
+	, public Object
+{
+public:
+	__FlatHashMapEnumeratorT(const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >& map, int modCount)
+		: __map(map)
+		, __modCount(modCount)
+		, __index(-1)
+	{
+	}
+
+	virtual ~__FlatHashMapEnumeratorT(void)
+	{
+	}
+
+	virtual result GetCurrent(MapEntryT< KeyType, ValueType >& obj) const
+	{
+		TryReturn((__modCount == __map.__modCount), E_INVALID_OPERATION,
+			"[%s] The source collection is modified after the creation of this enumerator.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn((__index >= 0 && __index < __map.__capacity), E_INVALID_OPERATION,
+			"[%s] Current position(%d) is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION), __index);
+
+		obj = MapEntryT< KeyType, ValueType >(__map.__pSlots[__index].key, __map.__pSlots[__index].value);
+		return E_SUCCESS;
+	}
+
+	virtual result MoveNext(void)
+	{
+		TryReturn((__modCount == __map.__modCount), E_INVALID_OPERATION,
+			"[%s] The source collection is modified after the creation of this enumerator.", GetErrorMessage(E_INVALID_OPERATION));
+
+		while (++__index < __map.__capacity)
+		{
+			if (__map.__pSlots[__index].probe != 0)
+			{
+				return E_SUCCESS;
+			}
+		}
+
+		return E_OUT_OF_RANGE;
+	}
+
+	virtual result Reset(void)
+	{
+		TryReturn((__modCount == __map.__modCount), E_INVALID_OPERATION,
+			"[%s] The source collection is modified after the creation of this enumerator.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__index = -1;
+		return E_SUCCESS;
+	}
+
+	virtual result GetKey(KeyType& key) const
+	{
+		TryReturn((__modCount == __map.__modCount), E_INVALID_OPERATION,
+			"[%s] The source collection is modified after the creation of this enumerator.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn((__index >= 0 && __index < __map.__capacity), E_INVALID_OPERATION,
+			"[%s] Current position(%d) is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION), __index);
+
+		key = __map.__pSlots[__index].key;
+		return E_SUCCESS;
+	}
+
+	virtual result GetValue(ValueType& value) const
+	{
+		TryReturn((__modCount == __map.__modCount), E_INVALID_OPERATION,
+			"[%s] The source collection is modified after the creation of this enumerator.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn((__index >= 0 && __index < __map.__capacity), E_INVALID_OPERATION,
+			"[%s] Current position(%d) is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION), __index);
+
+		value = __map.__pSlots[__index].value;
+		return E_SUCCESS;
+	}
+
+private:
+	const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >& __map;
+	int __modCount;
+	int __index;
+
+}; // __FlatHashMapEnumeratorT
+
+//
+// @class	__FlatHashMapIteratorT
+// @brief	This class is a forward iterator over the entries of the %FlatHashMapT class.
+// @since 2.1
+//
+// The iterator is a plain value that holds the index of an occupied slot.
+// It also records the modification count of the map, which debug builds check to detect invalidation.
+//
+template< class KeyType, class ValueType, class HashFunc, class EqualFunc >
+class __FlatHashMapIteratorT
+	: public std::iterator< std::forward_iterator_tag, __FlatHashMapSlotT< KeyType, ValueType >, int, const __FlatHashMapSlotT< KeyType, ValueType >*, const __FlatHashMapSlotT< KeyType, ValueType >& >
+{
+public:
+	__FlatHashMapIteratorT(void)
+		: __pMap(null)
+		, __index(0)
+		, __modCount(0)
+	{
+	}
+
+	__FlatHashMapIteratorT(const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >& map, int index)
+		: __pMap(&map)
+		, __index(index)
+		, __modCount(map.__modCount)
+	{
+		SkipEmptySlots();
+	}
+
+	const __FlatHashMapSlotT< KeyType, ValueType >& operator *(void) const
+	{
+		CheckModCount();
+		return __pMap->__pSlots[__index];
+	}
+
+	const __FlatHashMapSlotT< KeyType, ValueType >* operator ->(void) const
+	{
+		CheckModCount();
+		return &__pMap->__pSlots[__index];
+	}
+
+	__FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc >& operator ++(void)
+	{
+		CheckModCount();
+		__index++;
+		SkipEmptySlots();
+		return *this;
+	}
+
+	__FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc > operator ++(int)
+	{
+		__FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc > tempIter = *this;
+		operator ++();
+		return tempIter;
+	}
+
+	bool operator ==(const __FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc >& rhs) const
+	{
+		return __index == rhs.__index;
+	}
+
+	bool operator !=(const __FlatHashMapIteratorT< KeyType, ValueType, HashFunc, EqualFunc >& rhs) const
+	{
+		return !operator ==(rhs);
+	}
+
+private:
+	void SkipEmptySlots(void)
+	{
+		while (__index < __pMap->__capacity && __pMap->__pSlots[__index].probe == 0)
+		{
+			__index++;
+		}
+	}
+
+	void CheckModCount(void) const
+	{
+#if defined(_APP_LOG) || defined(_OSP_DEBUG_) || defined(_DEBUG)
+		AppAssertf(__pMap != null && __modCount == __pMap->__modCount, "The source collection is modified after the creation of this iterator.");
+#endif
+	}
+
+	const FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >* __pMap;
+	int __index;
+	int __modCount;
+
+}; // __FlatHashMapIteratorT
+
+template< class KeyType, class ValueType, class HashFunc, class EqualFunc >
+const float FlatHashMapT< KeyType, ValueType, HashFunc, EqualFunc >::DEFAULT_LOAD_FACTOR = 0.75;
+
+}}} // Tizen::Base::Collection
+
+#endif //_FBASE_COL_FLAT_HASH_MAP_T_H_
@@ -23,14 +23,18 @@
 #ifndef _FBASE_COL_HASH_MAP_T_H_
 #define _FBASE_COL_HASH_MAP_T_H_
 
+#include <iterator>
 #include <FBaseObject.h>
 #include <FBaseResult.h>
+#include <FBaseLog.h>
 #include <FBaseColIComparerT.h>
 #include <FBaseColIHashCodeProviderT.h>
 #include <FBaseColIListT.h>
 #include <FBaseColIMapT.h>
 #include <FBaseColArrayListT.h>
 #include <FBaseColMapEntryT.h>
+#include <FBaseColNodePool.h>
+#include <FBaseColTypes.h>
 #include <FBaseComparerT.h>
 #include <FBaseFloat.h>
 
@@ -40,6 +44,7 @@ namespace Tizen { namespace Base { namespace Collection
 
 template< class KeyType, class ValueType > class __HashMapEntryT;
 template< class KeyType, class ValueType > class __HashMapEnumeratorT;
+template< class KeyType, class ValueType > class __HashMapIteratorT;
 template< class KeyType > class __HashMapDefaultProviderT;
 
 /**
@@ -120,6 +125,7 @@ public:
 		, __pComparer(null)
 		, __defaultConstruct(false)
 		, __modCount(0)
+		, __pNodePool(null)
 	{
 	}
 
@@ -142,6 +148,7 @@ public:
 			delete __pComparer;
 		}
 
+		delete __pNodePool;
 	}
 
 	/**
@@ -152,16 +159,21 @@ public:
 	 * @return		An error code
 	 * @param[in]	capacity	The initial capacity
 	 * @param[in]	loadFactor	The maximum ratio of elements to buckets
+	 * @param[in]	policy		The policy used to allocate the entries of the map @n
+	 *							With ::NODE_ALLOCATION_POLICY_POOLED, the entries are taken from slabs owned by this map and
+	 *							the entries of removed keys are reused. The slabs are released all at once by RemoveAll().
 	 * @exception	E_SUCCESS		The method is successful.
-	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
-	 *								the @c capacity or the @c loadFactor is negative.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid,
+	 *								the @c capacity or the @c loadFactor is negative, or the @c policy is invalid.
 	 * @remarks		To work properly, the key type must be of a primitive number type.
 	 * @see			HashMapT()
 	 */
-	result Construct(int capacity = 16, float loadFactor = 0.75)
+	result Construct(int capacity = 16, float loadFactor = 0.75, NodeAllocationPolicy policy = NODE_ALLOCATION_POLICY_HEAP)
 	{
 		TryReturn(capacity >= 0, E_INVALID_ARG, "[%s] The capacity(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), capacity);
 		TryReturn(loadFactor >= 0, E_INVALID_ARG, "[%s] The loadFactor(%f) MUST be greater than or equal to 0.0.", GetErrorMessage(E_INVALID_ARG), loadFactor);
+		TryReturn(policy == NODE_ALLOCATION_POLICY_HEAP || policy == NODE_ALLOCATION_POLICY_POOLED, E_INVALID_ARG,
+			"[%s] The policy(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), policy);
 
 		result r = E_SUCCESS;
 
@@ -197,6 +209,12 @@ public:
 
 		__defaultConstruct = true;
 
+		if (policy == NODE_ALLOCATION_POLICY_POOLED && __pNodePool == null)
+		{
+			__pNodePool = new __NodePool(sizeof(__HashMapEntryT< KeyType, ValueType >));
+			TryCatch(__pNodePool != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+
 		__pTable = new __HashMapEntryT< KeyType, ValueType >*[__capacity];
 		TryCatch(__pTable != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
@@ -277,19 +295,25 @@ CATCH:
 	 * @param[in]	provider	An instance of the IHashCodeProviderT-derived class that supplies the hash codes
 	 *							for all keys in this map
 	 * @param[in]	comparer	An instance of the IComparerT-derived class to use when comparing keys
+	 * @param[in]	policy		The policy used to allocate the entries of the map @n
+	 *							With ::NODE_ALLOCATION_POLICY_POOLED, the entries are taken from slabs owned by this map and
+	 *							the entries of removed keys are reused. The slabs are released all at once by RemoveAll().
 	 * @exception	E_SUCCESS		The method is successful.
 	 * @exception	E_INVALID_ARG	Either of the following conditions has occurred: @n
 	 *								- A specified input parameter is invalid. @n
 	 *								- The specified @c capacity is negative. @n
-	 *								- The @c loadFactor is negative.
+	 *								- The @c loadFactor is negative. @n
+	 *								- The specified @c policy is invalid.
 	 * @remarks		The instances of hash code provider and comparer will not be deallocated later from this map.
 	 * @see			HashMapT()
 	 */
 	result Construct(int capacity, float loadFactor, const IHashCodeProviderT< KeyType >& provider,
-					 const IComparerT< KeyType >& comparer)
+					 const IComparerT< KeyType >& comparer, NodeAllocationPolicy policy = NODE_ALLOCATION_POLICY_HEAP)
 	{
 		TryReturn(capacity >= 0, E_INVALID_ARG, "[%s] The capacity(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), capacity);
 		TryReturn(loadFactor >= 0, E_INVALID_ARG, "[%s] The loadFactor(%f) MUST be greater than or equal to 0.0.", GetErrorMessage(E_INVALID_ARG), loadFactor);
+		TryReturn(policy == NODE_ALLOCATION_POLICY_HEAP || policy == NODE_ALLOCATION_POLICY_POOLED, E_INVALID_ARG,
+			"[%s] The policy(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), policy);
 
 		result r = E_SUCCESS;
 
@@ -321,6 +345,12 @@ CATCH:
 
 		__pComparer = const_cast< IComparerT< KeyType >* >(&comparer);
 
+		if (policy == NODE_ALLOCATION_POLICY_POOLED && __pNodePool == null)
+		{
+			__pNodePool = new __NodePool(sizeof(__HashMapEntryT< KeyType, ValueType >));
+			TryCatch(__pNodePool != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+
 		__pTable = new __HashMapEntryT< KeyType, ValueType >*[__capacity];
 		TryCatch(__pTable != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
@@ -419,7 +449,7 @@ CATCH:
 		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
 
 		r = E_SUCCESS;
-		pNewEntry = new __HashMapEntryT< KeyType, ValueType >(key, value, __pTable[i], hash);
+		pNewEntry = CreateEntry(key, value, __pTable[i], hash);
 		TryReturn(pNewEntry != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 		__pTable[i] = pNewEntry;
 		__modCount++;
@@ -479,6 +509,44 @@ CATCH:
 		return dynamic_cast< IMapEnumeratorT< KeyType, ValueType >* >(GetEnumeratorN());
 	}
 
+	/**
+	 * The type of the forward iterator returned by begin() and end().
+	 *
+	 * @since 2.1
+	 */
+	typedef __HashMapIteratorT< KeyType, ValueType > ConstIterator;
+
+	/**
+	 * Gets an iterator that points to the first entry of the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points to the first entry, @n
+	 *				or end() if the map is empty
+	 * @remarks		Unlike GetEnumeratorN(), this method does not allocate memory and the iterator is accessed without virtual calls,
+	 *				so that the map can be traversed by a range-based for loop or a standard algorithm. @n
+	 *				The key and the value of an entry are accessed through GetKey() and GetValue() of the entry, without copying. @n
+	 *				The iterator is invalidated when the map is modified. In debug builds, using an invalidated iterator causes an assertion failure.
+	 * @see			end()
+	 */
+	ConstIterator begin(void) const
+	{
+		return ConstIterator(*this, 0);
+	}
+
+	/**
+	 * Gets an iterator that points past the last entry of the map.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points past the last entry
+	 * @see			begin()
+	 */
+	ConstIterator end(void) const
+	{
+		return ConstIterator(*this, __capacity);
+	}
+
 	/**
 	 * Gets the value associated with the specified @c key.
 	 *
@@ -663,7 +731,7 @@ CATCH:
 						pPrev->pNext = pEntry->pNext;
 					}
 
-					delete pEntry;
+					DeleteEntry(pEntry);
 					__count--;
 
 					return E_SUCCESS;
@@ -936,7 +1004,7 @@ private:
 
 			int hash = Hash(key);
 			int i = hash & (__capacity - 1);
-			__HashMapEntryT< KeyType, ValueType >* pNewEntry = new __HashMapEntryT< KeyType, ValueType >(key, value, __pTable[i], hash);
+			__HashMapEntryT< KeyType, ValueType >* pNewEntry = CreateEntry(key, value, __pTable[i], hash);
 
 			TryCatch(pNewEntry != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 			__pTable[i] = pNewEntry;
@@ -1024,11 +1092,59 @@ CATCH:
 			while (null != pEntry)
 			{
 				__HashMapEntryT< KeyType, ValueType >* pNext = pEntry->pNext;
-				delete pEntry;
+				DeleteEntry(pEntry);
 				pEntry = pNext;
 			}
 			__pTable[i] = null;
 		}
+
+		if (__pNodePool != null)
+		{
+			__pNodePool->Release();
+		}
+	}
+
+	/**
+	 * Creates an entry with the specified key and value.
+	 *
+	 * @return		The new entry, @n
+	 *				else @c null if the memory is insufficient
+	 * @param[in]	key		The key of the entry
+	 * @param[in]	value	The value of the entry
+	 * @param[in]	pNext	The next entry in the bucket
+	 * @param[in]	hash	The hash value of the key
+	 */
+	__HashMapEntryT< KeyType, ValueType >* CreateEntry(const KeyType& key, const ValueType& value, __HashMapEntryT< KeyType, ValueType >* pNext, int hash)
+	{
+		if (__pNodePool == null)
+		{
+			return new __HashMapEntryT< KeyType, ValueType >(key, value, pNext, hash);
+		}
+
+		void* pMemory = __pNodePool->Allocate();
+		if (pMemory == null)
+		{
+			return null;
+		}
+
+		return new (pMemory) __HashMapEntryT< KeyType, ValueType >(key, value, pNext, hash);
+	}
+
+	/**
+	 * Deletes the specified entry.
+	 *
+	 * @param[in]	pEntry	The entry to delete
+	 */
+	void DeleteEntry(__HashMapEntryT< KeyType, ValueType >* pEntry)
+	{
+		if (__pNodePool == null)
+		{
+			delete pEntry;
+		}
+		else
+		{
+			__pNodePool->Delete(pEntry);
+		}
 	}
 
 	__HashMapEntryT< KeyType, ValueType >** __pTable;
@@ -1040,11 +1156,13 @@ CATCH:
 	IComparerT< KeyType >* __pComparer;
 	bool __defaultConstruct;
 	int __modCount;
+	__NodePool* __pNodePool;
 
 	static const int DEFAULT_CAPACITY = 16;
 	static const float DEFAULT_LOAD_FACTOR;
 
 	friend class __HashMapEnumeratorT< KeyType, ValueType >;
+	friend class __HashMapIteratorT< KeyType, ValueType >;
 
 }; // HashMapT
 
@@ -1085,6 +1203,30 @@ public:
 	{
 	}
 
+	/**
+	 * Gets the key of this entry.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The key of this entry
+	 */
+	const KeyType& GetKey(void) const
+	{
+		return key;
+	}
+
+	/**
+	 * Gets the value of this entry.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The value of this entry
+	 */
+	const ValueType& GetValue(void) const
+	{
+		return value;
+	}
+
 	/**
 	 * Internal variable.
 	 *
@@ -1285,6 +1427,100 @@ private:
 
 }; // __HashMapEnumeratorT
 
+//
+// @class	__HashMapIteratorT
+// @brief	This class is a forward iterator over the entries of the %HashMapT class.
+// @since 2.1
+//
+// The iterator is a plain value that holds a bucket index and an entry of the bucket chain.
+// It also records the modification count of the map, which debug builds check to detect invalidation.
+//
+template< class KeyType, class ValueType >
+class __HashMapIteratorT
+	: public std::iterator< std::forward_iterator_tag, __HashMapEntryT< KeyType, ValueType >, int, const __HashMapEntryT< KeyType, ValueType >*, const __HashMapEntryT< KeyType, ValueType >& >
+{
+public:
+	__HashMapIteratorT(void)
+		: __pMap(null)
+		, __pEntry(null)
+		, __index(0)
+		, __modCount(0)
+	{
+	}
+
+	__HashMapIteratorT(const HashMapT< KeyType, ValueType >& map, int index)
+		: __pMap(&map)
+		, __pEntry(null)
+		, __index(index)
+		, __modCount(map.__modCount)
+	{
+		if (__index < map.__capacity)
+		{
+			__pEntry = map.__pTable[__index];
+			MoveToNextBucket();
+		}
+	}
+
+	const __HashMapEntryT< KeyType, ValueType >& operator *(void) const
+	{
+		CheckModCount();
+		return *__pEntry;
+	}
+
+	const __HashMapEntryT< KeyType, ValueType >* operator ->(void) const
+	{
+		CheckModCount();
+		return &*__pEntry;
+	}
+
+	__HashMapIteratorT< KeyType, ValueType >& operator ++(void)
+	{
+		CheckModCount();
+		__pEntry = __pEntry->pNext;
+		MoveToNextBucket();
+		return *this;
+	}
+
+	__HashMapIteratorT< KeyType, ValueType > operator ++(int)
+	{
+		__HashMapIteratorT< KeyType, ValueType > tempIter = *this;
+		operator ++();
+		return tempIter;
+	}
+
+	bool operator ==(const __HashMapIteratorT< KeyType, ValueType >& rhs) const
+	{
+		return __pEntry == rhs.__pEntry;
+	}
+
+	bool operator !=(const __HashMapIteratorT< KeyType, ValueType >& rhs) const
+	{
+		return !operator ==(rhs);
+	}
+
+private:
+	void MoveToNextBucket(void)
+	{
+		while (__pEntry == null && ++__index < __pMap->__capacity)
+		{
+			__pEntry = __pMap->__pTable[__index];
+		}
+	}
+
+	void CheckModCount(void) const
+	{
+#if defined(_APP_LOG) || defined(_OSP_DEBUG_) || defined(_DEBUG)
+		AppAssertf(__pMap != null && __modCount == __pMap->__modCount, "The source collection is modified after the creation of this iterator.");
+#endif
+	}
+
+	const HashMapT< KeyType, ValueType >* __pMap;
+	__HashMapEntryT< KeyType, ValueType >* __pEntry;
+	int __index;
+	int __modCount;
+
+}; // __HashMapIteratorT
+
 //
 // @class	__HashMapDefaultProviderT
 // @brief	This is an implementation of the IHashCodeProviderT interface for the HashMap class.
@@ -23,15 +23,20 @@
 #ifndef _FCOL_LINKED_LIST_T_H_
 #define _FCOL_LINKED_LIST_T_H_
 
+#include <iterator>
 #include <FBaseResult.h>
+#include <FBaseLog.h>
 #include <FBaseColIComparerT.h>
 #include <FBaseColIListT.h>
+#include <FBaseColNodePool.h>
+#include <FBaseColTypes.h>
 
 
 namespace Tizen { namespace Base { namespace Collection
 {
 
 template< class Type > class __LinkedListEnumeratorT;
+template< class Type > class __LinkedListIteratorT;
 template< class Type > class __LinkedListNodeT;
 
 /**
@@ -110,6 +115,7 @@ public:
 		, __pListTail(null)
 		, __count(0)
 		, __modCount(0)
+		, __pNodePool(null)
 	{
 	}
 
@@ -123,6 +129,43 @@ public:
 		__modCount++;
 
 		RemoveAll();
+
+		delete __pNodePool;
+	}
+
+	/**
+	 * Initializes this instance of %LinkedListT with the specified node allocation policy.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	policy	The policy used to allocate the nodes of the list
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_ARG		The specified @c policy is invalid.
+	 * @exception	E_INVALID_OPERATION	The list is not empty.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		Calling this method is optional; a list that is not initialized with this method allocates each node individually. @n
+	 *				With ::NODE_ALLOCATION_POLICY_POOLED, the nodes are taken from slabs owned by this list and
+	 *				the nodes of removed elements are reused. The slabs are released all at once by RemoveAll().
+	 */
+	result Construct(NodeAllocationPolicy policy)
+	{
+		TryReturn(policy == NODE_ALLOCATION_POLICY_HEAP || policy == NODE_ALLOCATION_POLICY_POOLED, E_INVALID_ARG,
+			"[%s] The policy(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), policy);
+		TryReturn(__count == 0, E_INVALID_OPERATION, "[%s] The list MUST be empty.", GetErrorMessage(E_INVALID_OPERATION));
+
+		if (policy == NODE_ALLOCATION_POLICY_POOLED && __pNodePool == null)
+		{
+			__pNodePool = new __NodePool(sizeof(__LinkedListNodeT< Type >));
+			TryReturn(__pNodePool != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+		else if (policy == NODE_ALLOCATION_POLICY_HEAP)
+		{
+			delete __pNodePool;
+			__pNodePool = null;
+		}
+
+		return E_SUCCESS;
 	}
 
 	/**
@@ -237,6 +280,44 @@ CATCH:
 		return null;
 	}
 
+	/**
+	 * The type of the forward iterator returned by begin() and end().
+	 *
+	 * @since 2.1
+	 */
+	typedef __LinkedListIteratorT< Type > ConstIterator;
+
+	/**
+	 * Gets an iterator that points to the first element of the list.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points to the first element, @n
+	 *				or end() if the list is empty
+	 * @remarks		Unlike GetEnumeratorN(), this method does not allocate memory and the iterator is accessed without virtual calls,
+	 *				so that the list can be traversed by a range-based for loop or a standard algorithm. @n
+	 *				The elements are accessed through constant references. @n
+	 *				The iterator is invalidated when the list is modified. In debug builds, using an invalidated iterator causes an assertion failure.
+	 * @see			end()
+	 */
+	ConstIterator begin(void) const
+	{
+		return ConstIterator(*this, __pListHead);
+	}
+
+	/**
+	 * Gets an iterator that points past the last element of the list.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points past the last element of the list
+	 * @see			begin()
+	 */
+	ConstIterator end(void) const
+	{
+		return ConstIterator(*this, null);
+	}
+
 	/**
 	 * Gets the object at the specified index of this list.
 	 *
@@ -795,12 +876,17 @@ CATCH:
 			while (null != pNode)
 			{
 				pTemp = pNode->pNext;
-				delete pNode;
+				DeleteNode(pNode);
 				pNode = pTemp;
 				__count--;
 			}
 			__pListHead = null;
 			__pListTail = null;
+
+			if (__pNodePool != null)
+			{
+				__pNodePool->Release();
+			}
 		}
 	}
 
@@ -1094,7 +1180,7 @@ private:
 	result InsertFirst(const Type& obj)
 	{
 		result r = E_SUCCESS;
-		__LinkedListNodeT< Type >* pNode = new __LinkedListNodeT< Type >(obj);
+		__LinkedListNodeT< Type >* pNode = CreateNode(obj);
 		TryCatch(pNode != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
 		__modCount++;
@@ -1150,7 +1236,7 @@ CATCH:
 	{
 		ClearLastResult();
 		result r = E_SUCCESS;
-		__LinkedListNodeT< Type >* pNode = new __LinkedListNodeT< Type >(obj);
+		__LinkedListNodeT< Type >* pNode = CreateNode(obj);
 		TryCatch(pNode != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
 		__modCount++;
@@ -1181,7 +1267,7 @@ CATCH:
 		SetLastResult(r);
 		if (pNode != null)
 		{
-			delete pNode;
+			DeleteNode(pNode);
 			pNode = null;
 		}
 
@@ -1220,7 +1306,47 @@ CATCH:
 			pNode->pNext->pPrev = pNode->pPrev;
 			pNode->pPrev->pNext = pNode->pNext;
 		}
-		delete pNode;
+		DeleteNode(pNode);
+	}
+
+	/**
+	 * Creates a node that holds the specified object.
+	 *
+	 * @return		The new node, @n
+	 *				else @c null if the memory is insufficient
+	 * @param[in]	obj     The object to hold
+	 */
+	__LinkedListNodeT< Type >* CreateNode(const Type& obj)
+	{
+		if (__pNodePool == null)
+		{
+			return new __LinkedListNodeT< Type >(obj);
+		}
+
+		void* pMemory = __pNodePool->Allocate();
+		if (pMemory == null)
+		{
+			return null;
+		}
+
+		return new (pMemory) __LinkedListNodeT< Type >(obj);
+	}
+
+	/**
+	 * Deletes the specified node.
+	 *
+	 * @param[in]	pNode The node to delete
+	 */
+	void DeleteNode(__LinkedListNodeT< Type >* pNode)
+	{
+		if (__pNodePool == null)
+		{
+			delete pNode;
+		}
+		else
+		{
+			__pNodePool->Delete(pNode);
+		}
 	}
 
 	/**
@@ -1308,7 +1434,9 @@ CATCH:
 	__LinkedListNodeT< Type >* __pListTail;
 	int __count;
 	int __modCount;
+	__NodePool* __pNodePool;
 	friend class __LinkedListEnumeratorT< Type >;
+	friend class __LinkedListIteratorT< Type >;
 
 }; // LinkedListT
 
@@ -1523,6 +1651,83 @@ private:
 
 }; // __LinkedListEnumeratorT
 
+//
+// @class	__LinkedListIteratorT
+// @brief	This class is a forward iterator over the elements of the %LinkedListT class.
+// @since 2.1
+//
+// The iterator is a plain value that points to a node of the list.
+// It also records the modification count of the list, which debug builds check to detect invalidation.
+//
+template< class Type >
+class __LinkedListIteratorT
+	: public std::iterator< std::forward_iterator_tag, Type, int, const Type*, const Type& >
+{
+public:
+	__LinkedListIteratorT(void)
+		: __pNode(null)
+		, __pList(null)
+		, __modCount(0)
+	{
+	}
+
+	__LinkedListIteratorT(const LinkedListT< Type >& list, __LinkedListNodeT< Type >* pNode)
+		: __pNode(pNode)
+		, __pList(&list)
+		, __modCount(list.__modCount)
+	{
+	}
+
+	const Type& operator *(void) const
+	{
+		CheckModCount();
+		return __pNode->pObj;
+	}
+
+	const Type* operator ->(void) const
+	{
+		CheckModCount();
+		return &__pNode->pObj;
+	}
+
+	__LinkedListIteratorT< Type >& operator ++(void)
+	{
+		CheckModCount();
+		__pNode = __pNode->pNext;
+		return *this;
+	}
+
+	__LinkedListIteratorT< Type > operator ++(int)
+	{
+		__LinkedListIteratorT< Type > tempIter = *this;
+		operator ++();
+		return tempIter;
+	}
+
+	bool operator ==(const __LinkedListIteratorT< Type >& rhs) const
+	{
+		return __pNode == rhs.__pNode;
+	}
+
+	bool operator !=(const __LinkedListIteratorT< Type >& rhs) const
+	{
+		return !operator ==(rhs);
+	}
+
+private:
+	void CheckModCount(void) const
+	{
+#if defined(_APP_LOG) || defined(_OSP_DEBUG_) || defined(_DEBUG)
+		AppAssertf(__pList != null && __modCount == __pList->__modCount, "The source collection is modified after the creation of this iterator.");
+#endif
+	}
+
+	__LinkedListNodeT< Type >* __pNode;
+	const LinkedListT< Type >* __pList;
+	int __modCount;
+
+}; // __LinkedListIteratorT
+
 }}} // Tizen::Base::Collection
 
 #endif // _FCOL_LINKED_LIST_T_H_
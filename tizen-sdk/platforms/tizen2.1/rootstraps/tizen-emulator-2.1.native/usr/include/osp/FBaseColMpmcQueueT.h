@@ -0,0 +1,364 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColMpmcQueueT.h
+ * @brief		This is the header file for the %MpmcQueueT class.
+ *
+ * This header file contains the declarations of the %MpmcQueueT class.
+ */
+#ifndef _FBASE_COL_MPMC_QUEUE_T_H_
+#define _FBASE_COL_MPMC_QUEUE_T_H_
+
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseDataType.h>
+#include <FBaseColQueueWaiter.h>
+
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+//
+// @class	__MpmcQueueCellT
+// @brief	This class is a slot of %MpmcQueueT with the sequence number which tells whether it is free or filled.
+// @since 2.1
+//
+template< class Type >
+struct __MpmcQueueCellT
+{
+	volatile unsigned int sequence;
+	Type value;
+
+}; // __MpmcQueueCellT
+
+/**
+ * @class	MpmcQueueT
+ * @brief	This class represents a bounded lock-free queue for multiple producer threads and multiple consumer threads.
+ *
+ * @since 2.1
+ *
+ * The %MpmcQueueT class represents a bounded first-in-first-out queue, which any number of threads can enqueue to and dequeue from
+ * without a lock. Each slot has a sequence number, so that a thread claims a slot with a single compare-and-swap
+ * and the producers and the consumers do not wait for each other. @n
+ * Enqueue() and Dequeue() never block. EnqueueWait() and DequeueWait() sleep on a futex until the queue is not full or not empty.
+ * Use SpscQueueT if there is only one producer and one consumer. @n
+ * The @c Type must have a default constructor and an assignment operator.
+ *
+ * This header is not included from FBaseCol.h, because it needs the system call numbers of sys/syscall.h,
+ * which the SDK does not provide. The application must include this header directly, and must be built with them.
+ *
+ * The following example demonstrates how to use the %MpmcQueueT class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *	#include <FBaseColMpmcQueueT.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Collection;
+ *
+ *	// Called on any of the decoder threads
+ *	void
+ *	MyPipeline::OnFrameDecoded(Frame* pFrame)
+ *	{
+ *		__frames.EnqueueWait(pFrame);
+ *	}
+ *
+ *	// Called on any of the renderer threads
+ *	void
+ *	MyPipeline::RenderFrames(void)
+ *	{
+ *		Frame* pFrame = null;
+ *		while (__frames.DequeueWait(pFrame, 100) == E_SUCCESS)
+ *		{
+ *			// Renders and deletes the frame ...
+ *		}
+ *	}
+ * @endcode
+ */
+template< class Type >
+class MpmcQueueT
+	: public Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since 2.1
+	 */
+	MpmcQueueT(void)
+		: __pCells(null)
+		, __mask(0)
+		, __enqueuePosition(0)
+		, __dequeuePosition(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~MpmcQueueT(void)
+	{
+		delete[] __pCells;
+	}
+
+	/**
+	 * Initializes this instance of %MpmcQueueT with the specified capacity.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	capacity			The maximum number of elements in the queue @n
+	 *									It is rounded up to a power of two, which is at least @c 2.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c capacity is less than @c 1 or greater than @c 2^30.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result Construct(int capacity)
+	{
+		TryReturn(__pCells == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(capacity > 0 && capacity <= MAX_CAPACITY, E_INVALID_ARG,
+			"[%s] The capacity(%d) MUST be between 1 and %d.", GetErrorMessage(E_INVALID_ARG), capacity, MAX_CAPACITY);
+
+		// A single cell cannot tell a filled slot from the next free one
+		unsigned int roundedCapacity = 2;
+		while (roundedCapacity < static_cast< unsigned int >(capacity))
+		{
+			roundedCapacity <<= 1;
+		}
+
+		__pCells = new (std::nothrow) __MpmcQueueCellT< Type >[roundedCapacity];
+		TryReturn(__pCells != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		for (unsigned int i = 0; i < roundedCapacity; i++)
+		{
+			__pCells[i].sequence = i;
+		}
+		__mask = roundedCapacity - 1;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Inserts a copy of the specified object at the end of this queue without blocking.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj				The object to add to this queue
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OVERFLOW		This queue is full, or has not been constructed.
+	 * @see			Dequeue()
+	 */
+	result Enqueue(const Type& obj)
+	{
+		if (__pCells == null)
+		{
+			return E_OVERFLOW;
+		}
+
+		__MpmcQueueCellT< Type >* pCell = null;
+		unsigned int position = __enqueuePosition;
+
+		while (true)
+		{
+			pCell = &__pCells[position & __mask];
+			int difference = static_cast< int >(pCell->sequence - position);
+
+			if (difference == 0)
+			{
+				// The compare-and-swap is a full barrier, so the value is written after the slot is claimed
+				if (__sync_bool_compare_and_swap(&__enqueuePosition, position, position + 1))
+				{
+					break;
+				}
+				position = __enqueuePosition;
+			}
+			else if (difference < 0)
+			{
+				return E_OVERFLOW;
+			}
+			else
+			{
+				position = __enqueuePosition;
+			}
+		}
+
+		pCell->value = obj;
+
+		// Publishes the value before the sequence
+		__sync_synchronize();
+		pCell->sequence = position + 1;
+
+		__notEmpty.Notify();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Reads and removes the element at the beginning of this queue without blocking.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	obj				The element at the beginning of this queue
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_UNDERFLOW		This queue is empty, or has not been constructed.
+	 * @see			Enqueue()
+	 */
+	result Dequeue(Type& obj)
+	{
+		if (__pCells == null)
+		{
+			return E_UNDERFLOW;
+		}
+
+		__MpmcQueueCellT< Type >* pCell = null;
+		unsigned int position = __dequeuePosition;
+
+		while (true)
+		{
+			pCell = &__pCells[position & __mask];
+			int difference = static_cast< int >(pCell->sequence - (position + 1));
+
+			if (difference == 0)
+			{
+				if (__sync_bool_compare_and_swap(&__dequeuePosition, position, position + 1))
+				{
+					break;
+				}
+				position = __dequeuePosition;
+			}
+			else if (difference < 0)
+			{
+				return E_UNDERFLOW;
+			}
+			else
+			{
+				position = __dequeuePosition;
+			}
+		}
+
+		obj = pCell->value;
+
+		// Frees the slot for the producer of the next round after the value has been read
+		__sync_synchronize();
+		pCell->sequence = position + __mask + 1;
+
+		__notFull.Notify();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Inserts a copy of the specified object at the end of this queue, and waits while this queue is full.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj				The object to add to this queue
+	 * @param[in]	timeout			The maximum time to wait in milliseconds, or @c INFINITE
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_TIMEOUT		This queue has remained full for the specified time.
+	 * @exception	E_OVERFLOW		This instance has not been constructed.
+	 */
+	result EnqueueWait(const Type& obj, long timeout = INFINITE)
+	{
+		TryReturn(__pCells != null, E_OVERFLOW, "[%s] This instance has not been constructed.", GetErrorMessage(E_OVERFLOW));
+
+		return __notFull.WaitFor< MpmcQueueT< Type >, const Type& >(*this, &MpmcQueueT< Type >::Enqueue, obj, E_OVERFLOW, timeout);
+	}
+
+	/**
+	 * Reads and removes the element at the beginning of this queue, and waits while this queue is empty.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	obj				The element at the beginning of this queue
+	 * @param[in]	timeout			The maximum time to wait in milliseconds, or @c INFINITE
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_TIMEOUT		This queue has remained empty for the specified time.
+	 * @exception	E_UNDERFLOW		This instance has not been constructed.
+	 */
+	result DequeueWait(Type& obj, long timeout = INFINITE)
+	{
+		TryReturn(__pCells != null, E_UNDERFLOW, "[%s] This instance has not been constructed.", GetErrorMessage(E_UNDERFLOW));
+
+		return __notEmpty.WaitFor< MpmcQueueT< Type >, Type& >(*this, &MpmcQueueT< Type >::Dequeue, obj, E_UNDERFLOW, timeout);
+	}
+
+	/**
+	 * Gets the number of elements in this queue.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of elements
+	 * @remarks		The value can be outdated when it is returned if other threads change this queue.
+	 */
+	int GetCount(void) const
+	{
+		unsigned int dequeuePosition = __dequeuePosition;
+		unsigned int enqueuePosition = __enqueuePosition;
+		int count = static_cast< int >(enqueuePosition - dequeuePosition);
+
+		return (count > 0) ? count : 0;
+	}
+
+	/**
+	 * Gets the maximum number of elements in this queue.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The capacity rounded up to a power of two
+	 */
+	int GetCapacity(void) const
+	{
+		return (__pCells != null) ? static_cast< int >(__mask + 1) : 0;
+	}
+
+private:
+	MpmcQueueT(const MpmcQueueT< Type >& rhs);
+	MpmcQueueT< Type >& operator =(const MpmcQueueT< Type >& rhs);
+
+	static const int MAX_CAPACITY = 1 << 30;
+	static const int CACHE_LINE_SIZE = 64;
+
+	__MpmcQueueCellT< Type >* __pCells;
+	unsigned int __mask;
+
+	// The producers and the consumers claim the slots on separate cache lines
+	char __enqueuePadding[CACHE_LINE_SIZE];
+	volatile unsigned int __enqueuePosition;
+
+	char __dequeuePadding[CACHE_LINE_SIZE];
+	volatile unsigned int __dequeuePosition;
+
+	char __waiterPadding[CACHE_LINE_SIZE];
+	__QueueWaiter __notEmpty;
+	__QueueWaiter __notFull;
+
+}; // MpmcQueueT
+
+}}} // Tizen::Base::Collection
+
+#endif // _FBASE_COL_MPMC_QUEUE_T_H_
@@ -30,6 +30,8 @@
 #include <FBaseColIListT.h>
 #include <FBaseColIMultiMapT.h>
 #include <FBaseColMapEntryT.h>
+#include <FBaseColNodePool.h>
+#include <FBaseColTypes.h>
 #include <FBaseComparerT.h>
 #include <FBaseFloat.h>
 
@@ -131,6 +133,7 @@ public:
 		, __pComparer(null)
 		, __defaultConstruct(false)
 		, __modCount(0)
+		, __pNodePool(null)
 	{
 	}
 
@@ -153,6 +156,7 @@ public:
 			delete __pComparer;
 		}
 
+		delete __pNodePool;
 	}
 
 	/**
@@ -163,16 +167,21 @@ public:
 	 * @return		An error code
 	 * @param[in]	capacity	The initial capacity
 	 * @param[in]	loadFactor	The maximum ratio of elements to buckets
+	 * @param[in]	policy		The policy used to allocate the entries and value nodes of the map @n
+	 *							With ::NODE_ALLOCATION_POLICY_POOLED, they are taken from slabs owned by this map and
+	 *							the memory of removed pairs is reused. The slabs are released all at once by RemoveAll().
 	 * @exception	E_SUCCESS		The method is successful.
-	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
-	 *								  the specified @c capacity or the @c loadFactor is negative.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid,
+	 *								  the specified @c capacity or the @c loadFactor is negative, or the @c policy is invalid.
 	 * @remarks		The key type must be a primitive data type.
 	 * @see			MultiHashMapT()
 	 */
-	result Construct(int capacity = 16, float loadFactor = 0.75)
+	result Construct(int capacity = 16, float loadFactor = 0.75, NodeAllocationPolicy policy = NODE_ALLOCATION_POLICY_HEAP)
 	{
 		TryReturn(capacity >= 0, E_INVALID_ARG, "[%s] The capacity(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), capacity);
 		TryReturn(loadFactor >= 0, E_INVALID_ARG, "[%s] The loadFactor(%f) MUST be greater than or equal to 0.0.", GetErrorMessage(E_INVALID_ARG), loadFactor);
+		TryReturn(policy == NODE_ALLOCATION_POLICY_HEAP || policy == NODE_ALLOCATION_POLICY_POOLED, E_INVALID_ARG,
+			"[%s] The policy(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), policy);
 
 		result r = E_SUCCESS;
 
@@ -213,6 +222,12 @@ public:
 
 		__defaultConstruct = true;
 
+		if (policy == NODE_ALLOCATION_POLICY_POOLED && __pNodePool == null)
+		{
+			__pNodePool = new __NodePool((sizeof(__MultiHashMapEntryT< KeyType, ValueType >) > sizeof(__ValueNodeT< ValueType >)) ? sizeof(__MultiHashMapEntryT< KeyType, ValueType >) : sizeof(__ValueNodeT< ValueType >));
+			TryCatch(__pNodePool != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+
 		__pTable = new __MultiHashMapEntryT< KeyType, ValueType >*[__capacity];
 		TryCatch(__pTable != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
@@ -294,17 +309,22 @@ CATCH:
 	 * @param[in]	provider	An instance of the IHashCodeProvider derived class that supplies the hash codes
 	 *							for all keys in this map
 	 * @param[in]	comparer	An instance of the IComparer derived class to use when comparing keys
+	 * @param[in]	policy		The policy used to allocate the entries and value nodes of the map @n
+	 *							With ::NODE_ALLOCATION_POLICY_POOLED, they are taken from slabs owned by this map and
+	 *							the memory of removed pairs is reused. The slabs are released all at once by RemoveAll().
 	 * @exception	E_SUCCESS		The method is successful.
-	 * @exception	E_INVALID_ARG	A specified input parameter is invalid, or
-	 *								  the specified @c capacity or the @c loadFactor is negative.
+	 * @exception	E_INVALID_ARG	A specified input parameter is invalid,
+	 *								  the specified @c capacity or the @c loadFactor is negative, or the @c policy is invalid.
 	 * @remarks		The instances of hash code provider and comparer will not be deallocated later from this map.
 	 * @see			MultiHashMapT()
 	 */
 	result Construct(int capacity, float loadFactor, const IHashCodeProviderT< KeyType >& provider,
-					 const IComparerT< KeyType >& comparer)
+					 const IComparerT< KeyType >& comparer, NodeAllocationPolicy policy = NODE_ALLOCATION_POLICY_HEAP)
 	{
 		TryReturn(capacity >= 0, E_INVALID_ARG, "[%s] The capacity(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), capacity);
 		TryReturn(loadFactor >= 0, E_INVALID_ARG, "[%s] The loadFactor(%f) MUST be greater than or equal to 0.0.", GetErrorMessage(E_INVALID_ARG), loadFactor);
+		TryReturn(policy == NODE_ALLOCATION_POLICY_HEAP || policy == NODE_ALLOCATION_POLICY_POOLED, E_INVALID_ARG,
+			"[%s] The policy(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), policy);
 
 		result r = E_SUCCESS;
 		// set capacity
@@ -340,6 +360,12 @@ CATCH:
 		// set comparer
 		__pComparer = const_cast< IComparerT< KeyType >* >(&comparer);
 
+		if (policy == NODE_ALLOCATION_POLICY_POOLED && __pNodePool == null)
+		{
+			__pNodePool = new __NodePool((sizeof(__MultiHashMapEntryT< KeyType, ValueType >) > sizeof(__ValueNodeT< ValueType >)) ? sizeof(__MultiHashMapEntryT< KeyType, ValueType >) : sizeof(__ValueNodeT< ValueType >));
+			TryCatch(__pNodePool != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+
 		__pTable = new __MultiHashMapEntryT< KeyType, ValueType >*[__capacity];
 		TryCatch(__pTable != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
@@ -468,14 +494,13 @@ CATCH:
 			pEntry = pEntry->pNext;
 		}
 
-		__ValueNodeT< ValueType >* pNewNode = new __ValueNodeT< ValueType >(value);
+		__ValueNodeT< ValueType >* pNewNode = CreateValueNode(value);
 		TryReturn(pNewNode != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 
 		// key is not exist in this map.
 		if (pEntry == null)
 		{
-			__MultiHashMapEntryT< KeyType, ValueType >* pNewEntry = new __MultiHashMapEntryT< KeyType, ValueType >(key, pNewNode, __pTable[i],
-																												   hash);
+			__MultiHashMapEntryT< KeyType, ValueType >* pNewEntry = CreateEntry(key, pNewNode, __pTable[i], hash);
 			TryReturn(pNewEntry != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
 			__pTable[i] = pNewEntry;
 		}
@@ -728,10 +753,10 @@ CATCH:
 					{
 						__ValueNodeT< ValueType >* pTemp = pNode;
 						pNode = pNode->pNext;
-						delete pTemp;
+						DeleteNode(pTemp);
 						__count--;
 					}
-					delete pEntry;
+					DeleteNode(pEntry);
 					r = E_SUCCESS;
 					break;
 				}
@@ -791,7 +816,7 @@ CATCH:
 								pPrevNode->pNext = pNode->pNext;
 							}
 
-							delete pNode;
+							DeleteNode(pNode);
 
 							pEntry->modCount++;
 
@@ -805,7 +830,7 @@ CATCH:
 								{
 									pPrev->pNext = pEntry->pNext;
 								}
-								delete pEntry;
+								DeleteNode(pEntry);
 							}
 							r = E_SUCCESS;
 							break;
@@ -1335,13 +1360,85 @@ CATCH:
 				{
 					__ValueNodeT< ValueType >* pTemp = pNode;
 					pNode = pNode->pNext;
-					delete pTemp;
+					DeleteNode(pTemp);
 				}
-				delete pEntry;
+				DeleteNode(pEntry);
 				pEntry = pNext;
 			}
 			__pTable[i] = null;
 		}
+
+		if (__pNodePool != null)
+		{
+			__pNodePool->Release();
+		}
+	}
+
+	/**
+	 * Creates a value node that holds the specified value.
+	 *
+	 * @return		The new node, @n
+	 *				else @c null if the memory is insufficient
+	 * @param[in]	value	The value to hold
+	 */
+	__ValueNodeT< ValueType >* CreateValueNode(const ValueType& value)
+	{
+		if (__pNodePool == null)
+		{
+			return new __ValueNodeT< ValueType >(value);
+		}
+
+		void* pMemory = __pNodePool->Allocate();
+		if (pMemory == null)
+		{
+			return null;
+		}
+
+		return new (pMemory) __ValueNodeT< ValueType >(value);
+	}
+
+	/**
+	 * Creates an entry with the specified key and values.
+	 *
+	 * @return		The new entry, @n
+	 *				else @c null if the memory is insufficient
+	 * @param[in]	key		The key of the entry
+	 * @param[in]	pList	The first value node of the entry
+	 * @param[in]	pNext	The next entry in the bucket
+	 * @param[in]	hash	The hash value of the key
+	 */
+	__MultiHashMapEntryT< KeyType, ValueType >* CreateEntry(const KeyType& key, __ValueNodeT< ValueType >* pList, __MultiHashMapEntryT< KeyType, ValueType >* pNext, int hash)
+	{
+		if (__pNodePool == null)
+		{
+			return new __MultiHashMapEntryT< KeyType, ValueType >(key, pList, pNext, hash);
+		}
+
+		void* pMemory = __pNodePool->Allocate();
+		if (pMemory == null)
+		{
+			return null;
+		}
+
+		return new (pMemory) __MultiHashMapEntryT< KeyType, ValueType >(key, pList, pNext, hash);
+	}
+
+	/**
+	 * Deletes the specified entry or value node.
+	 *
+	 * @param[in]	pNode	The entry or value node to delete
+	 */
+	template< class NodeType >
+	void DeleteNode(NodeType* pNode)
+	{
+		if (__pNodePool == null)
+		{
+			delete pNode;
+		}
+		else
+		{
+			__pNodePool->Delete(pNode);
+		}
 	}
 
 	__MultiHashMapEntryT< KeyType, ValueType >** __pTable;
@@ -1353,6 +1450,7 @@ CATCH:
 	IComparerT< KeyType >* __pComparer;
 	bool __defaultConstruct;
 	int __modCount;
+	__NodePool* __pNodePool;
 
 	static const int DEFAULT_CAPACITY = 16;
 	static const float DEFAULT_LOAD_FACTOR;
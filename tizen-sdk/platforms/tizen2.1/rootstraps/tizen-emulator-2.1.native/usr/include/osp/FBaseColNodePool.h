@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColNodePool.h
+ * @brief		This is the header file for the %__NodePool class.
+ *
+ * This header file contains the declarations of the %__NodePool class,
+ * which is used by the template-based node collections when ::NODE_ALLOCATION_POLICY_POOLED is selected.
+ */
+#ifndef _FBASE_COL_NODE_POOL_H_
+#define _FBASE_COL_NODE_POOL_H_
+
+#include <new>
+#include <FBaseTypes.h>
+
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+//
+// @class	__NodePool
+// @brief	This class hands out fixed-size node memory from slabs and recycles it through a free list.
+// @since 2.1
+//
+// A pool belongs to a single collection instance and is not thread-safe.
+// Slabs grow geometrically, so a collection that holds N nodes owns O(log N) slabs.
+// Release() frees all the slabs at once; the nodes must have been destroyed before.
+//
+class __NodePool
+{
+public:
+	explicit __NodePool(int nodeSize)
+		: __slotSize(RoundUp(nodeSize > static_cast< int >(sizeof(__FreeSlot)) ? nodeSize : static_cast< int >(sizeof(__FreeSlot))))
+		, __nextSlabCount(MIN_SLAB_COUNT)
+		, __pSlabs(null)
+		, __pFreeList(null)
+	{
+	}
+
+	~__NodePool(void)
+	{
+		Release();
+	}
+
+	// Returns uninitialized memory for one node, or null if the memory is insufficient.
+	void* Allocate(void)
+	{
+		if (__pFreeList == null && !Grow())
+		{
+			return null;
+		}
+
+		__FreeSlot* pSlot = __pFreeList;
+		__pFreeList = pSlot->pNext;
+
+		return pSlot;
+	}
+
+	// Returns the memory of a destroyed node to the free list.
+	void Free(void* pMemory)
+	{
+		__FreeSlot* pSlot = static_cast< __FreeSlot* >(pMemory);
+		pSlot->pNext = __pFreeList;
+		__pFreeList = pSlot;
+	}
+
+	// Destroys the node and returns its memory to the free list.
+	template< class NodeType >
+	void Delete(NodeType* pNode)
+	{
+		if (pNode != null)
+		{
+			pNode->~NodeType();
+			Free(pNode);
+		}
+	}
+
+	// Frees all the slabs.
+	void Release(void)
+	{
+		while (__pSlabs != null)
+		{
+			__Slab* pNext = __pSlabs->pNext;
+			delete[] reinterpret_cast< char* >(__pSlabs);
+			__pSlabs = pNext;
+		}
+
+		__pFreeList = null;
+		__nextSlabCount = MIN_SLAB_COUNT;
+	}
+
+private:
+	struct __FreeSlot
+	{
+		__FreeSlot* pNext;
+	};
+
+	struct __Slab
+	{
+		__Slab* pNext;
+	};
+
+	__NodePool(const __NodePool& pool);
+	__NodePool& operator =(const __NodePool& pool);
+
+	static int RoundUp(int size)
+	{
+		return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	}
+
+	bool Grow(void)
+	{
+		int headerSize = RoundUp(sizeof(__Slab));
+		char* pMemory = new char[headerSize + __slotSize * __nextSlabCount];
+		if (pMemory == null)
+		{
+			return false;
+		}
+
+		__Slab* pSlab = reinterpret_cast< __Slab* >(pMemory);
+		pSlab->pNext = __pSlabs;
+		__pSlabs = pSlab;
+
+		// Links the slots backwards so that they are handed out in address order
+		char* pSlots = pMemory + headerSize;
+		for (int i = __nextSlabCount - 1; i >= 0; i--)
+		{
+			Free(pSlots + i * __slotSize);
+		}
+
+		if (__nextSlabCount < MAX_SLAB_COUNT)
+		{
+			__nextSlabCount <<= 1;
+		}
+
+		return true;
+	}
+
+	int __slotSize;
+	int __nextSlabCount;
+	__Slab* __pSlabs;
+	__FreeSlot* __pFreeList;
+
+	static const int ALIGNMENT = 8;
+	static const int MIN_SLAB_COUNT = 16;
+	static const int MAX_SLAB_COUNT = 4096;
+
+}; // __NodePool
+
+}}} // Tizen::Base::Collection
+
+#endif // _FBASE_COL_NODE_POOL_H_
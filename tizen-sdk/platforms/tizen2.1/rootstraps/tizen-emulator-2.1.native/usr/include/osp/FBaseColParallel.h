@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColParallel.h
+ * @brief		This is the header file for the parallel algorithms of the template collections.
+ *
+ * This header file contains the declarations of the classes which run the algorithms of the template collections on multiple threads,
+ * such as ArrayListT::ParallelSort(). @n
+ * It is separate from the headers of the collections, so that only the callers of these algorithms depend on the Runtime namespace.
+ */
+#ifndef _FBASE_COL_PARALLEL_H_
+#define _FBASE_COL_PARALLEL_H_
+
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayListT.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtThread.h>
+
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+//
+// @class	__ArrayListSortWorkerT
+// @brief	This class sorts one run of an %ArrayListT instance on a worker thread.
+// @since 2.1
+//
+template< class Type, class Less >
+class __ArrayListSortWorkerT
+	: public Tizen::Base::Runtime::IRunnable
+	, public Tizen::Base::Object
+{
+public:
+	__ArrayListSortWorkerT(Type* pArray, int first, int last, Type* pBuffer, const Less& less)
+		: __pArray(pArray)
+		, __first(first)
+		, __last(last)
+		, __pBuffer(pBuffer)
+		, __less(less)
+	{
+	}
+
+	virtual ~__ArrayListSortWorkerT(void)
+	{
+	}
+
+	virtual Tizen::Base::Object* Run(void)
+	{
+		__ArrayListSorterT< Type, Less >::MergeSort(__pArray, __first, __last, __pBuffer, __less);
+		return null;
+	}
+
+	result GetResult(void) const
+	{
+		return __less.GetResult();
+	}
+
+private:
+	Type* __pArray;
+	int __first;
+	int __last;
+	Type* __pBuffer;
+	Less __less;
+
+}; // __ArrayListSortWorkerT
+
+//
+// @class	__ArrayListParallelSorterT
+// @brief	This class sorts runs of an %ArrayListT instance on worker threads and merges them, for ArrayListT::ParallelSort().
+// @since 2.1
+//
+template< class Type, class Less >
+class __ArrayListParallelSorterT
+{
+public:
+	//
+	// Sorts the array with a merge sort of threadCount runs, which is greater than 1.
+	// Returns E_INVALID_ARG if the comparer has failed to compare the elements, or E_OUT_OF_MEMORY.
+	//
+	static result Sort(Type* pArray, int count, int threadCount, Less& less)
+	{
+		result r = E_SUCCESS;
+		Type* pBuffer = null;
+		int* pBounds = null;
+		__ArrayListSortWorkerT< Type, Less >** ppWorkers = null;
+		Tizen::Base::Runtime::Thread** ppThreads = null;
+
+		pBuffer = new Type[count];
+		TryCatch(pBuffer != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		pBounds = new int[threadCount + 1];
+		TryCatch(pBounds != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		ppWorkers = new __ArrayListSortWorkerT< Type, Less >*[threadCount];
+		TryCatch(ppWorkers != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		ppThreads = new Tizen::Base::Runtime::Thread*[threadCount];
+		TryCatch(ppThreads != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		for (int i = 0; i <= threadCount; i++)
+		{
+			pBounds[i] = static_cast< int >(static_cast< long long >(count) * i / threadCount);
+		}
+
+		for (int i = 0; i < threadCount; i++)
+		{
+			ppWorkers[i] = new __ArrayListSortWorkerT< Type, Less >(pArray, pBounds[i], pBounds[i + 1], pBuffer, less);
+			ppThreads[i] = null;
+		}
+
+		// The first run is sorted on the calling thread
+		for (int i = 1; i < threadCount; i++)
+		{
+			if (ppWorkers[i] == null)
+			{
+				continue;
+			}
+
+			ppThreads[i] = new Tizen::Base::Runtime::Thread();
+			if (ppThreads[i] != null)
+			{
+				result threadResult = ppThreads[i]->Construct(*ppWorkers[i]);
+				if (threadResult == E_SUCCESS)
+				{
+					threadResult = ppThreads[i]->Start();
+				}
+
+				if (IsFailed(threadResult))
+				{
+					delete ppThreads[i];
+					ppThreads[i] = null;
+				}
+			}
+		}
+
+		for (int i = 0; i < threadCount; i++)
+		{
+			if (ppWorkers[i] == null)
+			{
+				__ArrayListSorterT< Type, Less >::MergeSort(pArray, pBounds[i], pBounds[i + 1], pBuffer, less);
+			}
+			else if (ppThreads[i] == null)
+			{
+				ppWorkers[i]->Run();
+			}
+		}
+
+		for (int i = 0; i < threadCount; i++)
+		{
+			if (ppThreads[i] != null)
+			{
+				ppThreads[i]->Join();
+				delete ppThreads[i];
+			}
+
+			if (ppWorkers[i] != null)
+			{
+				if (IsFailed(ppWorkers[i]->GetResult()))
+				{
+					r = ppWorkers[i]->GetResult();
+				}
+				delete ppWorkers[i];
+			}
+		}
+
+		for (int width = 1; width < threadCount; width *= 2)
+		{
+			for (int i = 0; i + width < threadCount; i += 2 * width)
+			{
+				int last = (i + 2 * width < threadCount) ? (i + 2 * width) : threadCount;
+				__ArrayListSorterT< Type, Less >::Merge(pArray, pBounds[i], pBounds[i + width], pBounds[last], pBuffer, less);
+			}
+		}
+
+		if (r == E_SUCCESS)
+		{
+			r = less.GetResult();
+		}
+
+		// Fall through
+
+CATCH:
+		delete[] ppThreads;
+		delete[] ppWorkers;
+		delete[] pBounds;
+		delete[] pBuffer;
+
+		return r;
+	}
+
+}; // __ArrayListParallelSorterT
+
+} } } // Tizen::Base::Collection
+
+#endif // _FBASE_COL_PARALLEL_H_
@@ -24,8 +24,10 @@
 #ifndef _FBASE_COL_QUEUE_T_H_
 #define _FBASE_COL_QUEUE_T_H_
 
+#include <iterator>
 #include <FBaseObject.h>
 #include <FBaseResult.h>
+#include <FBaseLog.h>
 #include <FBaseColICollectionT.h>
 
 
@@ -33,6 +35,7 @@ namespace Tizen { namespace Base { namespace Collection
 {
 
 template< class Type > class __QueueEnumeratorT;
+template< class Type > class __QueueIteratorT;
 
 /**
  * @class	QueueT
@@ -312,6 +315,44 @@ CATCH:
 		return null;
 	}
 
+	/**
+	 * The type of the forward iterator returned by begin() and end().
+	 *
+	 * @since 2.1
+	 */
+	typedef __QueueIteratorT< Type > ConstIterator;
+
+	/**
+	 * Gets an iterator that points to the first element to be dequeued.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points to the first element to be dequeued, @n
+	 *				or end() if the queue is empty
+	 * @remarks		Unlike GetEnumeratorN(), this method does not allocate memory and the iterator is accessed without virtual calls,
+	 *				so that the queue can be traversed by a range-based for loop or a standard algorithm. @n
+	 *				The elements are accessed through constant references. @n
+	 *				The iterator is invalidated when the queue is modified. In debug builds, using an invalidated iterator causes an assertion failure.
+	 * @see			end()
+	 */
+	ConstIterator begin(void) const
+	{
+		return ConstIterator(*this, __tail);
+	}
+
+	/**
+	 * Gets an iterator that points past the last element of the queue.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points past the last element of the queue
+	 * @see			begin()
+	 */
+	ConstIterator end(void) const
+	{
+		return ConstIterator(*this, __head);
+	}
+
 	/**
 	 * Reads the element at the beginning of this queue without removing it.
 	 *
@@ -520,6 +561,7 @@ private:
 	static const int DEFAULT_CAPACITY = 10;
 
 	friend class __QueueEnumeratorT< Type >;
+	friend class __QueueIteratorT< Type >;
 
 }; // QueueT
 
@@ -649,6 +691,89 @@ private:
 
 }; // __QueueEnumeratorT
 
+//
+// @class	__QueueIteratorT
+// @brief	This class is a forward iterator over the elements of the %QueueT class, in the order of dequeuing.
+// @since 2.1
+//
+// The iterator is a plain value that holds a position in the circular element array.
+// It also records the modification count of the queue, which debug builds check to detect invalidation.
+//
+template< class Type >
+class __QueueIteratorT
+	: public std::iterator< std::forward_iterator_tag, Type, int, const Type*, const Type& >
+{
+public:
+	__QueueIteratorT(void)
+		: __pObjArray(null)
+		, __capacity(0)
+		, __position(0)
+		, __pQueue(null)
+		, __modCount(0)
+	{
+	}
+
+	__QueueIteratorT(const QueueT< Type >& queue, int position)
+		: __pObjArray(queue.__pObjArray)
+		, __capacity(queue.__capacity)
+		, __position(position)
+		, __pQueue(&queue)
+		, __modCount(queue.__modCount)
+	{
+	}
+
+	const Type& operator *(void) const
+	{
+		CheckModCount();
+		return __pObjArray[__position % __capacity];
+	}
+
+	const Type* operator ->(void) const
+	{
+		CheckModCount();
+		return &__pObjArray[__position % __capacity];
+	}
+
+	__QueueIteratorT< Type >& operator ++(void)
+	{
+		CheckModCount();
+		__position++;
+		return *this;
+	}
+
+	__QueueIteratorT< Type > operator ++(int)
+	{
+		__QueueIteratorT< Type > tempIter = *this;
+		operator ++();
+		return tempIter;
+	}
+
+	bool operator ==(const __QueueIteratorT< Type >& rhs) const
+	{
+		return __position == rhs.__position;
+	}
+
+	bool operator !=(const __QueueIteratorT< Type >& rhs) const
+	{
+		return !operator ==(rhs);
+	}
+
+private:
+	void CheckModCount(void) const
+	{
+#if defined(_APP_LOG) || defined(_OSP_DEBUG_) || defined(_DEBUG)
+		AppAssertf(__pQueue != null && __modCount == __pQueue->__modCount, "The source collection is modified after the creation of this iterator.");
+#endif
+	}
+
+	const Type* __pObjArray;
+	int __capacity;
+	int __position;
+	const QueueT< Type >* __pQueue;
+	int __modCount;
+
+}; // __QueueIteratorT
+
 }}} // Tizen::Base::Collection
 
 #endif //_FBASE_COL_QUEUE_T_H_
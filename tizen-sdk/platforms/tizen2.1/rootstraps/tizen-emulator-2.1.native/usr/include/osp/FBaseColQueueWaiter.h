@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColQueueWaiter.h
+ * @brief		This is the header file for the %__QueueWaiter class.
+ *
+ * This header file contains the declarations of the %__QueueWaiter class,
+ * which is used by the SpscQueueT and MpmcQueueT classes.
+ */
+#ifndef _FBASE_COL_QUEUE_WAITER_H_
+#define _FBASE_COL_QUEUE_WAITER_H_
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <FBaseTypes.h>
+#include <FBaseResult.h>
+#include <FBaseDataType.h>
+
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+//
+// @class	__QueueWaiter
+// @brief	This class blocks the threads waiting for a condition of a lock-free queue on a futex.
+// @since 2.1
+//
+// A waiter registers itself and reads the sequence before it retries the operation, and sleeps only if the sequence is unchanged.
+// Notify() costs a barrier and a load while no thread waits, so that the non-blocking operations stay free of system calls.
+//
+class __QueueWaiter
+{
+public:
+	__QueueWaiter(void)
+		: __sequence(0)
+		, __waiterCount(0)
+	{
+	}
+
+	// Retries the operation until it does not return the retry result, or the specified time in milliseconds elapses
+	template< class Queue, class Arg >
+	result WaitFor(Queue& queue, result (Queue::*pOperation)(Arg), Arg arg, result retryResult, long timeout)
+	{
+		result r = (queue.*pOperation)(arg);
+		if (r != retryResult)
+		{
+			return r;
+		}
+
+		bool isInfinite = (static_cast< unsigned long >(timeout) == INFINITE);
+		long long deadline = isInfinite ? 0 : GetTickCount() + timeout;
+
+		while (true)
+		{
+			__sync_add_and_fetch(&__waiterCount, 1);
+			int sequence = __sequence;
+
+			r = (queue.*pOperation)(arg);
+			if (r != retryResult)
+			{
+				__sync_sub_and_fetch(&__waiterCount, 1);
+				return r;
+			}
+
+			struct timespec duration;
+			struct timespec* pDuration = null;
+			if (!isInfinite)
+			{
+				long long remaining = deadline - GetTickCount();
+				if (remaining <= 0)
+				{
+					__sync_sub_and_fetch(&__waiterCount, 1);
+					return E_TIMEOUT;
+				}
+
+				duration.tv_sec = static_cast< time_t >(remaining / 1000);
+				duration.tv_nsec = static_cast< long >(remaining % 1000) * 1000000;
+				pDuration = &duration;
+			}
+
+			// Returns at once if a notification has changed the sequence since it was read
+			syscall(SYS_futex, &__sequence, WAIT_PRIVATE_OPERATION, sequence, pDuration, null, 0);
+			__sync_sub_and_fetch(&__waiterCount, 1);
+		}
+	}
+
+	// The caller has published the change of the condition before this method
+	void Notify(void)
+	{
+		__sync_synchronize();
+		if (__waiterCount > 0)
+		{
+			__sync_add_and_fetch(&__sequence, 1);
+			syscall(SYS_futex, &__sequence, WAKE_PRIVATE_OPERATION, MAX_WAKE_COUNT, null, null, 0);
+		}
+	}
+
+private:
+	static long long GetTickCount(void)
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		return static_cast< long long >(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+	}
+
+	__QueueWaiter(const __QueueWaiter& rhs);
+	__QueueWaiter& operator =(const __QueueWaiter& rhs);
+
+	// FUTEX_WAIT and FUTEX_WAKE with FUTEX_PRIVATE_FLAG
+	static const int WAIT_PRIVATE_OPERATION = 128;
+	static const int WAKE_PRIVATE_OPERATION = 129;
+	static const int MAX_WAKE_COUNT = 0x7FFFFFFF;
+
+	volatile int __sequence;
+	volatile int __waiterCount;
+
+}; // __QueueWaiter
+
+}}} // Tizen::Base::Collection
+
+#endif // _FBASE_COL_QUEUE_WAITER_H_
@@ -26,6 +26,8 @@
 
 #include <algorithm>	// std::swap (Before C++11)
 #include <iterator>
+#include <typeinfo>
+#include <FBaseColArrayList.h>
 #include <FBaseColIList.h>
 #include <FBaseLog.h>
 #include <FBaseObject.h>
@@ -63,8 +65,9 @@ public:
 	 */
 	explicit RandomIteratorT(const IList& list, int index = 0)
 		: __pList(&list)
+		, __pArrayList((typeid(list) == typeid(ArrayList)) ? static_cast< const ArrayList* >(&list) : null)
 		, __index(index)
-		, __currentObj(static_cast< T >(const_cast< Object* >(__pList->GetAt(__index))))
+		, __currentObj(static_cast< T >(const_cast< Object* >(GetObjectAt(__index))))
 	{
 		AppAssertf(list.IsRandomAccessible(), "The list is not randomly accessible. RandomIteratorT only supports random accessible collection.");
 	}
@@ -78,6 +81,7 @@ public:
 	 */
 	RandomIteratorT(const RandomIteratorT< T >& rhs)
 		: __pList(rhs.__pList)
+		, __pArrayList(rhs.__pArrayList)
 		, __index(rhs.__index)
 		, __currentObj(rhs.__currentObj)
 	{
@@ -139,7 +143,7 @@ public:
 		++__index;
 
 		// GetAt() will return null if __index is out of range.
-		__currentObj = static_cast< T >(const_cast< Object* >(__pList->GetAt(__index)));
+		__currentObj = static_cast< T >(const_cast< Object* >(GetObjectAt(__index)));
 		TryReturnResult(__currentObj != null, *this, GetLastResult(), "[%s] It is out of range.", GetErrorMessage(GetLastResult()));
 		return *this;
 	}
@@ -178,7 +182,7 @@ public:
 		--__index;
 
 		// GetAt() will return null if __index is out of range.
-		__currentObj = static_cast< T >(const_cast< Object* >(__pList->GetAt(__index)));
+		__currentObj = static_cast< T >(const_cast< Object* >(GetObjectAt(__index)));
 		TryReturnResult(__currentObj != null, *this, GetLastResult(), "[%s] It is out of range.", GetErrorMessage(GetLastResult()));
 		return *this;
 	}
@@ -275,7 +279,7 @@ public:
 		tempIter.__index += diff;
 
 		// GetAt() will return null if __index is out of range.
-		tempIter.__currentObj = static_cast< T >(const_cast< Object* >(tempIter.__pList->GetAt(tempIter.__index)));
+		tempIter.__currentObj = static_cast< T >(const_cast< Object* >(tempIter.GetObjectAt(tempIter.__index)));
 		TryReturnResult(tempIter.__currentObj != null, tempIter, GetLastResult(), "[%s] It is out of range.", GetErrorMessage(GetLastResult()));
 		return tempIter;
 	}
@@ -298,7 +302,7 @@ public:
 		tempIter.__index -= diff;
 
 		// GetAt() will return null if __index is out of range.
-		tempIter.__currentObj = static_cast< T >(const_cast< Object* >(tempIter.__pList->GetAt(tempIter.__index)));
+		tempIter.__currentObj = static_cast< T >(const_cast< Object* >(tempIter.GetObjectAt(tempIter.__index)));
 		TryReturnResult(tempIter.__currentObj != null, tempIter, GetLastResult(), "[%s] It is out of range.", GetErrorMessage(GetLastResult()));
 		return tempIter;
 	}
@@ -323,7 +327,7 @@ public:
 	T& operator[](int index) const
 	{
 		// GetAt() will return null if __index is out of range.
-		const T& tempObj = static_cast< T >(const_cast< Object* >(__pList->GetAt(index)));
+		const T& tempObj = static_cast< T >(const_cast< Object* >(GetObjectAt(index)));
 		TryReturnResult(tempObj != null, const_cast< T& >(tempObj), GetLastResult(), "[%s] It is out of range.", GetErrorMessage(GetLastResult()));
 		return const_cast< T& >(tempObj);
 	}
@@ -338,12 +342,28 @@ public:
 	void swap(RandomIteratorT< T >& rhs)
 	{
 		std::swap(__pList, rhs.__pList);
+		std::swap(__pArrayList, rhs.__pArrayList);
 		std::swap(__index, rhs.__index);
 		std::swap(__currentObj, rhs.__currentObj);
 	}
 
 private:
+	//
+	// Gets the object at the specified index.
+	// If the concrete type of the list is ArrayList, ArrayList::GetAt() is called directly without the virtual dispatch.
+	//
+	const Object* GetObjectAt(int index) const
+	{
+		if (__pArrayList != null)
+		{
+			return __pArrayList->ArrayList::GetAt(index);
+		}
+
+		return __pList->GetAt(index);
+	}
+
 	const IList* __pList;
+	const ArrayList* __pArrayList;
 	int __index;
 	T __currentObj;
 }; // RandomIteratorT
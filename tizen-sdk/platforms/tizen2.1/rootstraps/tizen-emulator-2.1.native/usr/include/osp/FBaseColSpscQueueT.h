@@ -0,0 +1,319 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColSpscQueueT.h
+ * @brief		This is the header file for the %SpscQueueT class.
+ *
+ * This header file contains the declarations of the %SpscQueueT class.
+ */
+#ifndef _FBASE_COL_SPSC_QUEUE_T_H_
+#define _FBASE_COL_SPSC_QUEUE_T_H_
+
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseDataType.h>
+#include <FBaseColQueueWaiter.h>
+
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+/**
+ * @class	SpscQueueT
+ * @brief	This class represents a bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * @since 2.1
+ *
+ * The %SpscQueueT class represents a bounded first-in-first-out queue, which passes elements from one producer thread
+ * to one consumer thread without a lock. Each side keeps a cached copy of the index of the other side,
+ * so that the two threads touch the cache line of each other only when the cached index says the queue is full or empty. @n
+ * Enqueue() and Dequeue() never block. EnqueueWait() and DequeueWait() sleep on a futex until the queue is not full or not empty.
+ * Only one thread may call the enqueue methods, and only one thread may call the dequeue methods, at the same time.
+ * Use MpmcQueueT for multiple producers or consumers. @n
+ * The @c Type must have a default constructor and an assignment operator.
+ *
+ * This header is not included from FBaseCol.h, because it needs the system call numbers of sys/syscall.h,
+ * which the SDK does not provide. The application must include this header directly, and must be built with them.
+ *
+ * The following example demonstrates how to use the %SpscQueueT class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *	#include <FBaseColSpscQueueT.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Collection;
+ *
+ *	// Called on the sensor thread
+ *	void
+ *	MyPipeline::OnSampleReceived(const Sample& sample)
+ *	{
+ *		if (__samples.Enqueue(sample) == E_OVERFLOW)
+ *		{
+ *			// Drops the sample ...
+ *		}
+ *	}
+ *
+ *	// Called on the processing thread
+ *	void
+ *	MyPipeline::ProcessSamples(void)
+ *	{
+ *		Sample sample;
+ *		while (__samples.DequeueWait(sample) == E_SUCCESS)
+ *		{
+ *			// Processes the sample ...
+ *		}
+ *	}
+ * @endcode
+ */
+template< class Type >
+class SpscQueueT
+	: public Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since 2.1
+	 */
+	SpscQueueT(void)
+		: __pSlots(null)
+		, __capacity(0)
+		, __mask(0)
+		, __head(0)
+		, __cachedTail(0)
+		, __tail(0)
+		, __cachedHead(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~SpscQueueT(void)
+	{
+		delete[] __pSlots;
+	}
+
+	/**
+	 * Initializes this instance of %SpscQueueT with the specified capacity.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	capacity			The maximum number of elements in the queue @n
+	 *									It is rounded up to a power of two.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c capacity is less than @c 1 or greater than @c 2^30.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result Construct(int capacity)
+	{
+		TryReturn(__pSlots == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(capacity > 0 && capacity <= MAX_CAPACITY, E_INVALID_ARG,
+			"[%s] The capacity(%d) MUST be between 1 and %d.", GetErrorMessage(E_INVALID_ARG), capacity, MAX_CAPACITY);
+
+		unsigned int roundedCapacity = 1;
+		while (roundedCapacity < static_cast< unsigned int >(capacity))
+		{
+			roundedCapacity <<= 1;
+		}
+
+		__pSlots = new (std::nothrow) Type[roundedCapacity];
+		TryReturn(__pSlots != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__capacity = roundedCapacity;
+		__mask = roundedCapacity - 1;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Inserts a copy of the specified object at the end of this queue without blocking. @n
+	 * Only the producer thread can call this method.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj				The object to add to this queue
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OVERFLOW		This queue is full, or has not been constructed.
+	 * @see			Dequeue()
+	 */
+	result Enqueue(const Type& obj)
+	{
+		unsigned int tail = __tail;
+		if (tail - __cachedHead >= __capacity)
+		{
+			__cachedHead = __head;
+			if (tail - __cachedHead >= __capacity)
+			{
+				return E_OVERFLOW;
+			}
+		}
+
+		__pSlots[tail & __mask] = obj;
+
+		// Publishes the element before the index
+		__sync_synchronize();
+		__tail = tail + 1;
+
+		__notEmpty.Notify();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Reads and removes the element at the beginning of this queue without blocking. @n
+	 * Only the consumer thread can call this method.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	obj				The element at the beginning of this queue
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_UNDERFLOW		This queue is empty.
+	 * @see			Enqueue()
+	 */
+	result Dequeue(Type& obj)
+	{
+		unsigned int head = __head;
+		if (head == __cachedTail)
+		{
+			__cachedTail = __tail;
+			if (head == __cachedTail)
+			{
+				return E_UNDERFLOW;
+			}
+		}
+
+		// Reads the element after the index which has published it
+		__sync_synchronize();
+		obj = __pSlots[head & __mask];
+
+		// Releases the slot after the element has been read
+		__sync_synchronize();
+		__head = head + 1;
+
+		__notFull.Notify();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Inserts a copy of the specified object at the end of this queue, and waits while this queue is full. @n
+	 * Only the producer thread can call this method.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj				The object to add to this queue
+	 * @param[in]	timeout			The maximum time to wait in milliseconds, or @c INFINITE
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_TIMEOUT		This queue has remained full for the specified time.
+	 * @exception	E_OVERFLOW		This instance has not been constructed.
+	 */
+	result EnqueueWait(const Type& obj, long timeout = INFINITE)
+	{
+		TryReturn(__pSlots != null, E_OVERFLOW, "[%s] This instance has not been constructed.", GetErrorMessage(E_OVERFLOW));
+
+		return __notFull.WaitFor< SpscQueueT< Type >, const Type& >(*this, &SpscQueueT< Type >::Enqueue, obj, E_OVERFLOW, timeout);
+	}
+
+	/**
+	 * Reads and removes the element at the beginning of this queue, and waits while this queue is empty. @n
+	 * Only the consumer thread can call this method.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	obj				The element at the beginning of this queue
+	 * @param[in]	timeout			The maximum time to wait in milliseconds, or @c INFINITE
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_TIMEOUT		This queue has remained empty for the specified time.
+	 * @exception	E_UNDERFLOW		This instance has not been constructed.
+	 */
+	result DequeueWait(Type& obj, long timeout = INFINITE)
+	{
+		TryReturn(__pSlots != null, E_UNDERFLOW, "[%s] This instance has not been constructed.", GetErrorMessage(E_UNDERFLOW));
+
+		return __notEmpty.WaitFor< SpscQueueT< Type >, Type& >(*this, &SpscQueueT< Type >::Dequeue, obj, E_UNDERFLOW, timeout);
+	}
+
+	/**
+	 * Gets the number of elements in this queue.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of elements
+	 * @remarks		The value can be outdated when it is returned if the other thread changes this queue.
+	 */
+	int GetCount(void) const
+	{
+		unsigned int head = __head;
+		unsigned int tail = __tail;
+
+		return static_cast< int >(tail - head);
+	}
+
+	/**
+	 * Gets the maximum number of elements in this queue.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The capacity rounded up to a power of two
+	 */
+	int GetCapacity(void) const
+	{
+		return static_cast< int >(__capacity);
+	}
+
+private:
+	SpscQueueT(const SpscQueueT< Type >& rhs);
+	SpscQueueT< Type >& operator =(const SpscQueueT< Type >& rhs);
+
+	static const int MAX_CAPACITY = 1 << 30;
+	static const int CACHE_LINE_SIZE = 64;
+
+	Type* __pSlots;
+	unsigned int __capacity;
+	unsigned int __mask;
+
+	// The consumer and the producer write to separate cache lines
+	char __consumerPadding[CACHE_LINE_SIZE];
+	volatile unsigned int __head;
+	unsigned int __cachedTail;
+
+	char __producerPadding[CACHE_LINE_SIZE];
+	volatile unsigned int __tail;
+	unsigned int __cachedHead;
+
+	char __waiterPadding[CACHE_LINE_SIZE];
+	__QueueWaiter __notEmpty;
+	__QueueWaiter __notFull;
+
+}; // SpscQueueT
+
+}}} // Tizen::Base::Collection
+
+#endif // _FBASE_COL_SPSC_QUEUE_T_H_
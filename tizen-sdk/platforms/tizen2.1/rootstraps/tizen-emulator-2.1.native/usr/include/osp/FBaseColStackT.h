@@ -24,8 +24,10 @@
 #ifndef _FBASE_COL_STACK_T_H_
 #define _FBASE_COL_STACK_T_H_
 
+#include <iterator>
 #include <FBaseObject.h>
 #include <FBaseResult.h>
+#include <FBaseLog.h>
 #include <FBaseColICollectionT.h>
 
 
@@ -33,6 +35,7 @@ namespace Tizen { namespace Base { namespace Collection
 {
 
 template< class Type > class __StackEnumeratorT;
+template< class Type > class __StackIteratorT;
 
 /**
  * @class	StackT
@@ -221,6 +224,44 @@ CATCH:
 		return null;
 	}
 
+	/**
+	 * The type of the forward iterator returned by begin() and end().
+	 *
+	 * @since 2.1
+	 */
+	typedef __StackIteratorT< Type > ConstIterator;
+
+	/**
+	 * Gets an iterator that points to the bottom element of the stack.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points to the bottom element of the stack, @n
+	 *				or end() if the stack is empty
+	 * @remarks		Unlike GetEnumeratorN(), this method does not allocate memory and the iterator is accessed without virtual calls,
+	 *				so that the stack can be traversed by a range-based for loop or a standard algorithm. @n
+	 *				The elements are visited from the bottom to the top, in the same order as GetEnumeratorN(), and are accessed through constant references. @n
+	 *				The iterator is invalidated when the stack is modified. In debug builds, using an invalidated iterator causes an assertion failure.
+	 * @see			end()
+	 */
+	ConstIterator begin(void) const
+	{
+		return ConstIterator(*this, 0);
+	}
+
+	/**
+	 * Gets an iterator that points past the top element of the stack.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A forward iterator that points past the top element of the stack
+	 * @see			begin()
+	 */
+	ConstIterator end(void) const
+	{
+		return ConstIterator(*this, __index + 1);
+	}
+
 	/**
 	 * Reads the element at the beginning of this stack without removing it.
 	 *
@@ -525,6 +566,7 @@ private:
 	static const int DEFAULT_CAPACITY = 10;
 
 	friend class __StackEnumeratorT< Type >;
+	friend class __StackIteratorT< Type >;
 
 }; // StackT
 
@@ -649,6 +691,83 @@ private:
 
 }; // __StackEnumeratorT
 
+//
+// @class	__StackIteratorT
+// @brief	This class is a forward iterator over the elements of the %StackT class, from the bottom to the top.
+// @since 2.1
+//
+// The iterator is a plain value that points into the element array.
+// It also records the modification count of the stack, which debug builds check to detect invalidation.
+//
+template< class Type >
+class __StackIteratorT
+	: public std::iterator< std::forward_iterator_tag, Type, int, const Type*, const Type& >
+{
+public:
+	__StackIteratorT(void)
+		: __pCurrent(null)
+		, __pStack(null)
+		, __modCount(0)
+	{
+	}
+
+	__StackIteratorT(const StackT< Type >& stack, int position)
+		: __pCurrent(stack.__pObjArray + position)
+		, __pStack(&stack)
+		, __modCount(stack.__modCount)
+	{
+	}
+
+	const Type& operator *(void) const
+	{
+		CheckModCount();
+		return *__pCurrent;
+	}
+
+	const Type* operator ->(void) const
+	{
+		CheckModCount();
+		return __pCurrent;
+	}
+
+	__StackIteratorT< Type >& operator ++(void)
+	{
+		CheckModCount();
+		++__pCurrent;
+		return *this;
+	}
+
+	__StackIteratorT< Type > operator ++(int)
+	{
+		__StackIteratorT< Type > tempIter = *this;
+		operator ++();
+		return tempIter;
+	}
+
+	bool operator ==(const __StackIteratorT< Type >& rhs) const
+	{
+		return __pCurrent == rhs.__pCurrent;
+	}
+
+	bool operator !=(const __StackIteratorT< Type >& rhs) const
+	{
+		return !operator ==(rhs);
+	}
+
+private:
+	void CheckModCount(void) const
+	{
+#if defined(_APP_LOG) || defined(_OSP_DEBUG_) || defined(_DEBUG)
+		AppAssertf(__pStack != null && __modCount == __pStack->__modCount, "The source collection is modified after the creation of this iterator.");
+#endif
+	}
+
+	const Type* __pCurrent;
+	const StackT< Type >* __pStack;
+	int __modCount;
+
+}; // __StackIteratorT
+
 }}} // Tizen::Base::Collection
 
 #endif //_FBASE_COL_STACK_T_H_
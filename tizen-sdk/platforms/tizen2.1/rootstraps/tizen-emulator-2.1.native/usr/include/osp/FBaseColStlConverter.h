@@ -33,6 +33,8 @@
 #include <FBaseColIteratorT.h>
 #include <FBaseColPairIteratorT.h>
 #include <FBaseColRandomIteratorT.h>
+#include <FBaseColStlListViewT.h>
+#include <FBaseColStlMapViewT.h>
 #include <FBaseColTypes.h>
 
 namespace Tizen { namespace Base { namespace Collection
@@ -378,6 +380,59 @@ public:
 		return std::move(pMultiMap);
 	}
 
+	/**
+	 * Gets a read-only IList view of the range of STL container without copying the elements.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		A std::unique_ptr to the IList instance, @n
+	 *				else @c std::unique_ptr< IList >() if error occurs
+	 * @param[in]	begin		begin() of STL container
+	 * @param[in]	end			end() of STL container
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		Unlike GetArrayListN(), this method does not copy the elements and the view does not own them.
+	 *				The range must remain valid and must not be modified while the view is in use. @n
+	 *				The elements must be pointers to Object or its derived classes.
+	 * @remarks		The specific error code can be accessed using GetLastResult() method.
+	 * @see			StlListViewT
+	 */
+	template < typename RandomIter >
+	static std::unique_ptr< IList > GetListViewN(RandomIter begin, RandomIter end)
+	{
+		std::unique_ptr< IList > pView(new (std::nothrow) StlListViewT< RandomIter >(begin, end));
+		TryReturnResult(pView, std::unique_ptr< IList >(), E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return std::move(pView);
+	}
+
+	/**
+	 * Gets a read-only IMap view of STL associative container without copying the entries.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		A std::unique_ptr to the IMap instance, @n
+	 *				else @c std::unique_ptr< IMap >() if error occurs
+	 * @param[in]	map			The STL associative container, such as std::map or std::unordered_map
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OUT_OF_MEMORY	The memory is insufficient.
+	 * @remarks		Unlike GetHashMapN(), this method does not copy the entries and the view does not own them.
+	 *				The container must remain valid and must not be modified while the view is in use. @n
+	 *				The keys and the values must be pointers to Object or its derived classes.
+	 * @remarks		The specific error code can be accessed using GetLastResult() method.
+	 * @see			StlMapViewT
+	 */
+	template < typename StlMap >
+	static std::unique_ptr< IMap > GetMapViewN(const StlMap& map)
+	{
+		std::unique_ptr< IMap > pView(new (std::nothrow) StlMapViewT< StlMap >(map));
+		TryReturnResult(pView, std::unique_ptr< IMap >(), E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return std::move(pView);
+	}
+
 private:
 	//
 	// This default constructor is intentionally declared as private because this class is not constructible.
@@ -0,0 +1,655 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColStlListViewT.h
+ * @brief		This is the header file for the %StlListViewT class.
+ *
+ * This header file contains the declarations of the %StlListViewT class.
+ */
+
+#ifndef _FBASE_COL_STL_LIST_VIEW_T_H_
+#define _FBASE_COL_STL_LIST_VIEW_T_H_
+
+#include <iterator>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseColIList.h>
+#include <FBaseColIBidirectionalEnumerator.h>
+#include <FBaseColTypes.h>
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+template< typename RandomIter > class __StlListViewEnumeratorT;
+
+/**
+ * @class	StlListViewT
+ * @brief	This class provides a read-only IList view of a range of STL container without copying the elements.
+ *
+ * @since	2.1
+ *
+ * The %StlListViewT class provides a read-only IList view of a range of STL container, such as std::vector< Integer* >.
+ * The view does not copy the elements and does not own them. Each element is accessed directly through the random access iterator of the range. @n
+ * StlConverter provides a static method to get this view.
+ *
+ * @remarks	The elements of the range must be pointers to Object or its derived classes.
+ *			The range must remain valid and must not be modified while the view is in use.
+ *			All methods that modify the list return E_INVALID_OPERATION.
+ *
+ * The following example demonstrates how to use the %StlListViewT class.
+ *
+ * @code
+ *	#include <vector>
+ *	#include <FBase.h>
+ *	#include <FBaseCol.h>
+ *
+ *	using namespace std;
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Collection;
+ *
+ *	void
+ *	MyClass::StlListViewSample(const vector< Integer* >& vec)
+ *	{
+ *		StlListViewT< vector< Integer* >::const_iterator > view(vec.begin(), vec.end());
+ *
+ *		// call SomeNativeAPI(&view);
+ *	}
+ * @endcode
+ */
+template< typename RandomIter >
+class StlListViewT
+	: public IList
+	, public Object
+{
+public:
+	/**
+	 * Initializes an instance of %StlListViewT with the specified range.
+	 *
+	 * @since		2.1
+	 *
+	 * @param[in]	begin		begin() of STL container
+	 * @param[in]	end			end() of STL container
+	 */
+	StlListViewT(RandomIter begin, RandomIter end)
+		: __begin(begin)
+		, __count(static_cast< int >(end - begin))
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since		2.1
+	 *
+	 * @remarks		The elements are not removed, because the view does not own them.
+	 */
+	virtual ~StlListViewT(void)
+	{
+	}
+
+	/**
+	 * Gets the number of elements in the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		The number of elements in the view
+	 */
+	virtual int GetCount(void) const
+	{
+		return __count;
+	}
+
+	/**
+	 * Gets an enumerator of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An instance of the IEnumerator derived class, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual IEnumerator* GetEnumeratorN(void) const
+	{
+		return GetBidirectionalEnumeratorN();
+	}
+
+	/**
+	 * Gets a bidirectional enumerator of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An instance of the IBidirectionalEnumerator derived class, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual IBidirectionalEnumerator* GetBidirectionalEnumeratorN(void) const
+	{
+		__StlListViewEnumeratorT< RandomIter >* pEnum = new (std::nothrow) __StlListViewEnumeratorT< RandomIter >(*this);
+		TryReturnResult(pEnum != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return pEnum;
+	}
+
+	/**
+	 * Gets the object at the specified @c index of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		The object at the specified @c index, @n
+	 *				else @c null if the index is not valid
+	 * @param[in]	index	The index of the object to read
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is either equal to or greater than the number of elements or less than @c 0.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual const Object* GetAt(int index) const
+	{
+		TryReturnResult(index >= 0 && index < __count, null, E_OUT_OF_RANGE,
+			"[%s] The index(%d) MUST be greater than or equal to 0 and less than the number of elements(%d).",
+			GetErrorMessage(E_OUT_OF_RANGE), index, __count);
+
+		SetLastResult(E_SUCCESS);
+		return GetObjectAt(index);
+	}
+
+	/**
+	 * Gets the object at the specified @c index of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		The object at the specified @c index, @n
+	 *				else @c null if the index is not valid
+	 * @param[in]	index	The index of the object to read
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is either equal to or greater than the number of elements or less than @c 0.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual Object* GetAt(int index)
+	{
+		return const_cast< Object* >(static_cast< const StlListViewT< RandomIter >* >(this)->GetAt(index));
+	}
+
+	/**
+	 * Gets a view of the specified range of this view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		A pointer to IList, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	startIndex	The starting index of the range
+	 * @param[in]	count		The number of elements to read
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c startIndex or @c count is outside the bounds of the view.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The returned list is also a read-only view of the same STL container, so that the elements are not copied. @n
+	 *				The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual IList* GetItemsN(int startIndex, int count) const
+	{
+		TryReturnResult(startIndex >= 0 && count >= 0 && startIndex <= __count - count, null, E_OUT_OF_RANGE,
+			"[%s] The startIndex(%d) and count(%d) MUST be within the bounds of the view(%d).",
+			GetErrorMessage(E_OUT_OF_RANGE), startIndex, count, __count);
+
+		StlListViewT< RandomIter >* pView = new (std::nothrow) StlListViewT< RandomIter >(__begin + startIndex, __begin + (startIndex + count));
+		TryReturnResult(pView != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return pView;
+	}
+
+	/**
+	 * Searches for an object in the view. @n
+	 * Gets the index of the object if found.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj			The object to locate
+	 * @param[out]	index		The index of the object
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c obj is not found.
+	 */
+	virtual result IndexOf(const Object& obj, int& index) const
+	{
+		return IndexOf(obj, 0, __count, index);
+	}
+
+	/**
+	 * Searches for an object starting from the specified index. @n
+	 * Gets the index of the object if found.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj			The object to locate
+	 * @param[in]	startIndex	The starting index for the search
+	 * @param[out]	index		The index of the object
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c startIndex is either equal to or greater than the number of elements or less than @c 0.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c obj is not found.
+	 */
+	virtual result IndexOf(const Object& obj, int startIndex, int& index) const
+	{
+		TryReturn(startIndex >= 0 && startIndex < __count, E_OUT_OF_RANGE,
+			"[%s] The startIndex(%d) MUST be greater than or equal to 0 and less than the number of elements(%d).",
+			GetErrorMessage(E_OUT_OF_RANGE), startIndex, __count);
+
+		return IndexOf(obj, startIndex, __count - startIndex, index);
+	}
+
+	/**
+	 * Searches for an object within the specified range. @n
+	 * Gets the index of the object if found.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj			The object to locate
+	 * @param[in]	startIndex	The starting index of the range
+	 * @param[in]	count		The number of elements to read
+	 * @param[out]	index		The index of the object
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c startIndex or @c count is outside the bounds of the view.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c obj is not found.
+	 */
+	virtual result IndexOf(const Object& obj, int startIndex, int count, int& index) const
+	{
+		TryReturn(startIndex >= 0 && count >= 0 && startIndex <= __count - count, E_OUT_OF_RANGE,
+			"[%s] The startIndex(%d) and count(%d) MUST be within the bounds of the view(%d).",
+			GetErrorMessage(E_OUT_OF_RANGE), startIndex, count, __count);
+
+		for (int i = startIndex; i < startIndex + count; i++)
+		{
+			const Object* pObj = GetObjectAt(i);
+			if (pObj != null && obj.Equals(*pObj))
+			{
+				index = i;
+				return E_SUCCESS;
+			}
+		}
+
+		return E_OBJ_NOT_FOUND;
+	}
+
+	/**
+	 * Searches for the last occurrence of an object in the view. @n
+	 * Gets the index of the object if found.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	obj			The object to locate
+	 * @param[out]	index		The index of the last occurrence of the specified object
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c obj is not found.
+	 */
+	virtual result LastIndexOf(const Object& obj, int& index) const
+	{
+		for (int i = __count - 1; i >= 0; i--)
+		{
+			const Object* pObj = GetObjectAt(i);
+			if (pObj != null && obj.Equals(*pObj))
+			{
+				index = i;
+				return E_SUCCESS;
+			}
+		}
+
+		return E_OBJ_NOT_FOUND;
+	}
+
+	/**
+	 * Checks whether the view contains the specified object.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		@c true if the view contains the specified object, @n
+	 *				else @c false
+	 * @param[in]	obj		The object to locate
+	 */
+	virtual bool Contains(const Object& obj) const
+	{
+		int index = 0;
+		return IndexOf(obj, 0, __count, index) == E_SUCCESS;
+	}
+
+	/**
+	 * Checks whether the view contains all the elements of the specified @c collection.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		@c true if the view contains all the elements of the specified @c collection, @n
+	 *				else @c false
+	 * @param[in]	collection	The collection to locate
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	The current state of the instance prohibits the execution of the specified operation, or
+	 *									the @c collection is modified during the operation of this method.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual bool ContainsAll(const ICollection& collection) const
+	{
+		result r = E_SUCCESS;
+		bool isContained = true;
+
+		IEnumerator* pEnum = collection.GetEnumeratorN();
+		TryCatch(pEnum != null, r = GetLastResult(), "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+
+		while ((r = pEnum->MoveNext()) == E_SUCCESS)
+		{
+			const Object* pObj = pEnum->GetCurrent();
+			if (pObj == null || !Contains(*pObj))
+			{
+				isContained = false;
+				break;
+			}
+		}
+
+		delete pEnum;
+
+		if (r == E_OUT_OF_RANGE || !isContained)
+		{
+			r = E_SUCCESS;
+		}
+
+		SetLastResult(r);
+		return (r == E_SUCCESS) && isContained;
+
+CATCH:
+		SetLastResult(r);
+		return false;
+	}
+
+	/**
+	 * Checks whether the view can be accessed randomly.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		@c true, because the view is accessed through a random access iterator
+	 */
+	virtual bool IsRandomAccessible(void) const
+	{
+		return true;
+	}
+
+	/**
+	 * Gets the element deleter of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		NoOpDeleter(), because the view does not own the elements
+	 */
+	virtual DeleterFunctionType GetDeleter(void) const
+	{
+		return NoOpDeleter;
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result Add(Object*)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result AddItems(const ICollection&)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result InsertAt(Object*, int)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result InsertItemsFrom(const ICollection&, int)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result Remove(const Object&)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result RemoveAt(int)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result RemoveItems(int, int)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result RemoveItems(const ICollection&)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @exception	E_INVALID_OPERATION	The view is read-only.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual void RemoveAll(void)
+	{
+		SetLastResult(RejectModification());
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result SetAt(Object*, int)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result Sort(const IComparer&)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view does not own the elements.
+	 *
+	 * @since		2.1
+	 *
+	 * @exception	E_INVALID_OPERATION	The view does not own the elements.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual void SetDeleter(DeleterFunctionType)
+	{
+		SetLastResult(RejectModification());
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	// @since		2.1
+	//
+	StlListViewT(const StlListViewT< RandomIter >& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	// @since		2.1
+	//
+	StlListViewT< RandomIter >& operator =(const StlListViewT< RandomIter >& rhs);
+
+	const Object* GetObjectAt(int index) const
+	{
+		return __begin[index];
+	}
+
+	result RejectModification(void) const
+	{
+		AppLogException("[%s] The view of STL container is read-only.", GetErrorMessage(E_INVALID_OPERATION));
+		return E_INVALID_OPERATION;
+	}
+
+	RandomIter __begin;
+	int __count;
+
+	friend class __StlListViewEnumeratorT< RandomIter >;
+
+}; // StlListViewT
+
+//
+// @class	__StlListViewEnumeratorT
+// @brief	This class is an implementation of the IBidirectionalEnumerator interface for the %StlListViewT class.
+// @since 2.1
+//
+template< typename RandomIter >
+class __StlListViewEnumeratorT
+	: public IBidirectionalEnumerator
+	, public Object
+{
+public:
+	__StlListViewEnumeratorT(const StlListViewT< RandomIter >& view)
+		: __view(view)
+		, __position(-1)
+	{
+	}
+
+	virtual ~__StlListViewEnumeratorT(void)
+	{
+	}
+
+	virtual Object* GetCurrent(void) const
+	{
+		TryReturnResult((__position > -1) && (__position < __view.__count), null, E_INVALID_OPERATION,
+			"[%s] Current position(%d) is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION), __position);
+
+		SetLastResult(E_SUCCESS);
+		return const_cast< Object* >(__view.GetObjectAt(__position));
+	}
+
+	virtual result MoveNext(void)
+	{
+		if ((__position + 1) >= __view.__count)
+		{
+			return E_OUT_OF_RANGE;
+		}
+
+		__position++;
+		return E_SUCCESS;
+	}
+
+	virtual result Reset(void)
+	{
+		__position = -1;
+		return E_SUCCESS;
+	}
+
+	virtual result MovePrevious(void)
+	{
+		TryReturn(__position > 0, E_OUT_OF_RANGE, "[%s] Reached start of the list, no previous element", GetErrorMessage(E_OUT_OF_RANGE));
+
+		__position--;
+		return E_SUCCESS;
+	}
+
+	virtual result ResetLast(void)
+	{
+		__position = __view.__count;
+		return E_SUCCESS;
+	}
+
+private:
+	const StlListViewT< RandomIter >& __view;
+	int __position;
+
+}; // __StlListViewEnumeratorT
+
+}}} // Tizen::Base::Collection
+
+#endif // _FBASE_COL_STL_LIST_VIEW_T_H_
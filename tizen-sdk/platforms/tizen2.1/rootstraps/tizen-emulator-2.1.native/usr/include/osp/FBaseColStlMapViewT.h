@@ -0,0 +1,482 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseColStlMapViewT.h
+ * @brief		This is the header file for the %StlMapViewT class.
+ *
+ * This header file contains the declarations of the %StlMapViewT class.
+ */
+
+#ifndef _FBASE_COL_STL_MAP_VIEW_T_H_
+#define _FBASE_COL_STL_MAP_VIEW_T_H_
+
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayList.h>
+#include <FBaseColIMap.h>
+#include <FBaseColIMapEnumerator.h>
+#include <FBaseColMapEntry.h>
+#include <FBaseColTypes.h>
+
+namespace Tizen { namespace Base { namespace Collection
+{
+
+template< typename StlMap > class __StlMapViewEnumeratorT;
+
+/**
+ * @class	StlMapViewT
+ * @brief	This class provides a read-only IMap view of STL associative container without copying the entries.
+ *
+ * @since	2.1
+ *
+ * The %StlMapViewT class provides a read-only IMap view of STL associative container, such as std::map< String*, Integer*, Compare >.
+ * The view does not copy the entries and does not own them. The keys are looked up through the find() method of the container,
+ * so that the comparison or the hashing of the container is used instead of Object::Equals(). @n
+ * StlConverter provides a static method to get this view.
+ *
+ * @remarks	The keys and the values of the container must be pointers to Object or its derived classes.
+ *			The container must remain valid and must not be modified while the view is in use.
+ *			All methods that modify the map return E_INVALID_OPERATION.
+ */
+template< typename StlMap >
+class StlMapViewT
+	: public IMap
+	, public Object
+{
+public:
+	/**
+	 * Initializes an instance of %StlMapViewT with the specified STL container.
+	 *
+	 * @since		2.1
+	 *
+	 * @param[in]	map		The STL container to view
+	 */
+	explicit StlMapViewT(const StlMap& map)
+		: __map(map)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since		2.1
+	 *
+	 * @remarks		The entries are not removed, because the view does not own them.
+	 */
+	virtual ~StlMapViewT(void)
+	{
+	}
+
+	/**
+	 * Gets the number of entries in the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		The number of entries in the view
+	 */
+	virtual int GetCount(void) const
+	{
+		return static_cast< int >(__map.size());
+	}
+
+	/**
+	 * Gets an enumerator of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An instance of the IEnumerator derived class, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual IEnumerator* GetEnumeratorN(void) const
+	{
+		return GetMapEnumeratorN();
+	}
+
+	/**
+	 * Gets a map enumerator of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		An instance of the IMapEnumerator derived class, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		GetKey() and GetValue() of the enumerator do not allocate memory. @n
+	 *				The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual IMapEnumerator* GetMapEnumeratorN(void) const
+	{
+		__StlMapViewEnumeratorT< StlMap >* pEnum = new (std::nothrow) __StlMapViewEnumeratorT< StlMap >(__map);
+		TryReturnResult(pEnum != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return pEnum;
+	}
+
+	/**
+	 * Gets the value associated with the specified key.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		The value associated with the specified key, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	key		The key to find the associated value
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c key is not found in the map.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual const Object* GetValue(const Object& key) const
+	{
+		typename StlMap::const_iterator iter = Find(key);
+		TryReturnResult(iter != __map.end(), null, E_OBJ_NOT_FOUND, "[%s] The key is not found in the map.", GetErrorMessage(E_OBJ_NOT_FOUND));
+
+		SetLastResult(E_SUCCESS);
+		return iter->second;
+	}
+
+	/**
+	 * Gets the value associated with the specified key.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		The value associated with the specified key, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	key		The key to find the associated value
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The specified @c key is not found in the map.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual Object* GetValue(const Object& key)
+	{
+		return const_cast< Object* >(static_cast< const StlMapViewT< StlMap >* >(this)->GetValue(key));
+	}
+
+	/**
+	 * Gets a list of all the keys in the map.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		A pointer to a list of all the keys in the map, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The list stores just the pointers to the keys, not the keys themselves. @n
+	 *				The specific error code can be accessed using the GetLastResult() method.
+	 * @see			GetValuesN()
+	 */
+	virtual IList* GetKeysN(void) const
+	{
+		return GetItemsN(true);
+	}
+
+	/**
+	 * Gets a list of all the values in the map.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		A pointer to a list of all the values in the map, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The list stores just the pointers to the values, not the values themselves. @n
+	 *				The specific error code can be accessed using the GetLastResult() method.
+	 * @see			GetKeysN()
+	 */
+	virtual IList* GetValuesN(void) const
+	{
+		return GetItemsN(false);
+	}
+
+	/**
+	 * Checks whether the map contains the specified key.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		@c true if the map contains the specified key, @n
+	 *				else @c false
+	 * @param[in]	key		The key to locate
+	 */
+	virtual bool ContainsKey(const Object& key) const
+	{
+		return Find(key) != __map.end();
+	}
+
+	/**
+	 * Checks whether the map contains the specified value.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		@c true if the map contains the specified value, @n
+	 *				else @c false
+	 * @param[in]	value	The value to locate
+	 */
+	virtual bool ContainsValue(const Object& value) const
+	{
+		for (typename StlMap::const_iterator iter = __map.begin(); iter != __map.end(); ++iter)
+		{
+			const Object* pValue = iter->second;
+			if (pValue != null && value.Equals(*pValue))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Gets the element deleter of the view.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		NoOpDeleter(), because the view does not own the entries
+	 */
+	virtual DeleterFunctionType GetDeleter(void) const
+	{
+		return NoOpDeleter;
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result Add(Object*, Object*)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result Remove(const Object&)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @exception	E_INVALID_OPERATION	The view is read-only.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual void RemoveAll(void)
+	{
+		SetLastResult(RejectModification());
+	}
+
+	/**
+	 * This method is not supported, because the view is read-only.
+	 *
+	 * @since		2.1
+	 *
+	 * @return		E_INVALID_OPERATION
+	 */
+	virtual result SetValue(const Object&, Object*)
+	{
+		return RejectModification();
+	}
+
+	/**
+	 * This method is not supported, because the view does not own the entries.
+	 *
+	 * @since		2.1
+	 *
+	 * @exception	E_INVALID_OPERATION	The view does not own the entries.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	virtual void SetDeleter(DeleterFunctionType)
+	{
+		SetLastResult(RejectModification());
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	// @since		2.1
+	//
+	StlMapViewT(const StlMapViewT< StlMap >& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	// @since		2.1
+	//
+	StlMapViewT< StlMap >& operator =(const StlMapViewT< StlMap >& rhs);
+
+	typename StlMap::const_iterator Find(const Object& key) const
+	{
+		// A key of another type cannot be in the container
+		typename StlMap::key_type pKey = dynamic_cast< typename StlMap::key_type >(const_cast< Object* >(&key));
+		if (pKey == null)
+		{
+			return __map.end();
+		}
+
+		return __map.find(pKey);
+	}
+
+	IList* GetItemsN(bool isKey) const
+	{
+		result r = E_SUCCESS;
+
+		ArrayList* pList = new (std::nothrow) ArrayList();
+		TryReturnResult(pList != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pList->Construct(GetCount());
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		for (typename StlMap::const_iterator iter = __map.begin(); iter != __map.end(); ++iter)
+		{
+			const Object* pObj = isKey ? static_cast< const Object* >(iter->first) : static_cast< const Object* >(iter->second);
+
+			r = pList->Add(const_cast< Object* >(pObj));
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		SetLastResult(E_SUCCESS);
+		return pList;
+
+CATCH:
+		delete pList;
+		SetLastResult(r);
+		return null;
+	}
+
+	result RejectModification(void) const
+	{
+		AppLogException("[%s] The view of STL container is read-only.", GetErrorMessage(E_INVALID_OPERATION));
+		return E_INVALID_OPERATION;
+	}
+
+	const StlMap& __map;
+
+}; // StlMapViewT
+
+//
+// @class	__StlMapViewEnumeratorT
+// @brief	This class is an implementation of the IMapEnumerator interface for the %StlMapViewT class.
+// @since 2.1
+//
+template< typename StlMap >
+class __StlMapViewEnumeratorT
+	: public IMapEnumerator
+	, public Object
+{
+public:
+	__StlMapViewEnumeratorT(const StlMap& map)
+		: __map(map)
+		, __iter(map.end())
+		, __isStarted(false)
+		, __pEntry(null)
+	{
+	}
+
+	virtual ~__StlMapViewEnumeratorT(void)
+	{
+		delete __pEntry;
+	}
+
+	virtual Object* GetCurrent(void) const
+	{
+		TryReturnResult(__isStarted && __iter != __map.end(), null, E_INVALID_OPERATION,
+			"[%s] Current position is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION));
+
+		// MapEntry is created only on demand, so that GetKey() and GetValue() do not allocate memory
+		delete __pEntry;
+		__pEntry = new (std::nothrow) MapEntry(*GetCurrentKey(), *GetCurrentValue());
+		TryReturnResult(__pEntry != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return __pEntry;
+	}
+
+	virtual result MoveNext(void)
+	{
+		if (!__isStarted)
+		{
+			__iter = __map.begin();
+			__isStarted = true;
+		}
+		else if (__iter != __map.end())
+		{
+			++__iter;
+		}
+
+		return (__iter != __map.end()) ? E_SUCCESS : E_OUT_OF_RANGE;
+	}
+
+	virtual result Reset(void)
+	{
+		__iter = __map.end();
+		__isStarted = false;
+		return E_SUCCESS;
+	}
+
+	virtual Object* GetKey(void) const
+	{
+		TryReturnResult(__isStarted && __iter != __map.end(), null, E_INVALID_OPERATION,
+			"[%s] Current position is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION));
+
+		SetLastResult(E_SUCCESS);
+		return GetCurrentKey();
+	}
+
+	virtual Object* GetValue(void) const
+	{
+		TryReturnResult(__isStarted && __iter != __map.end(), null, E_INVALID_OPERATION,
+			"[%s] Current position is before the first element or past the last element.", GetErrorMessage(E_INVALID_OPERATION));
+
+		SetLastResult(E_SUCCESS);
+		return GetCurrentValue();
+	}
+
+private:
+	Object* GetCurrentKey(void) const
+	{
+		return const_cast< Object* >(static_cast< const Object* >(__iter->first));
+	}
+
+	Object* GetCurrentValue(void) const
+	{
+		return const_cast< Object* >(static_cast< const Object* >(__iter->second));
+	}
+
+	const StlMap& __map;
+	typename StlMap::const_iterator __iter;
+	bool __isStarted;
+	mutable MapEntry* __pEntry;
+
+}; // __StlMapViewEnumeratorT
+
+}}} // Tizen::Base::Collection
+
+#endif // _FBASE_COL_STL_MAP_VIEW_T_H_
@@ -58,6 +58,33 @@ _OSP_EXPORT_ void SingleObjectDeleter(Object* pObj);
  */
 _OSP_EXPORT_ void ArrayDeleter(Object* pObj);
 
+/**
+ *	@enum	GrowthPolicy
+ *
+ *	Defines how an array-based collection increases its capacity when it runs out of space.
+ *
+ *	@since 2.1
+ */
+enum GrowthPolicy
+{
+	GROWTH_POLICY_LINEAR = 0,           /**< The capacity grows by a fixed number of elements */
+	GROWTH_POLICY_ONE_AND_HALF,         /**< The capacity grows by half of the current capacity */
+	GROWTH_POLICY_DOUBLE                /**< The capacity doubles */
+};
+
+/**
+ *	@enum	NodeAllocationPolicy
+ *
+ *	Defines how a node-based collection allocates its internal nodes.
+ *
+ *	@since 2.1
+ */
+enum NodeAllocationPolicy
+{
+	NODE_ALLOCATION_POLICY_HEAP = 0,    /**< Each node is allocated and deallocated individually */
+	NODE_ALLOCATION_POLICY_POOLED       /**< The nodes are taken from slabs owned by the collection and are recycled */
+};
+
 }}} // Tizen::Base::Collection
 
 #endif  // _FBASE_COL_TYPES_H_
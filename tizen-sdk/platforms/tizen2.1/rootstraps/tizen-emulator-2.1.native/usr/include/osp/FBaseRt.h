@@ -31,16 +31,21 @@
 #include <FBaseRtIEventListener.h>
 #include <FBaseRtITimerEventListener.h>
 #include <FBaseRtLibrary.h>
+#include <FBaseRtLockStatistics.h>
 #include <FBaseRtMemoryManager.h>
 #include <FBaseRtMonitor.h>
 #include <FBaseRtMonitorGuard.h>
 #include <FBaseRtMutex.h>
 #include <FBaseRtMutexGuard.h>
+#include <FBaseRtReadLockGuard.h>
+#include <FBaseRtReadWriteLock.h>
 #include <FBaseRtSemaphore.h>
 #include <FBaseRtSemaphoreGuard.h>
 #include <FBaseRtThread.h>
+#include <FBaseRtThreadPool.h>
 #include <FBaseRtTimer.h>
 #include <FBaseRtTypes.h>
+#include <FBaseRtWriteLockGuard.h>
 
 /**
  * @namespace	Tizen::Base::Runtime
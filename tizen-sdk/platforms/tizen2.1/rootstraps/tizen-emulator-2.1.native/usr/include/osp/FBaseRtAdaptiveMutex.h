@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtAdaptiveMutex.h
+ * @brief		This is the header file for the %AdaptiveMutex class.
+ *
+ * This header file contains the declarations of the %AdaptiveMutex class.
+ */
+#ifndef _FBASE_RT_ADAPTIVE_MUTEX_H_
+#define _FBASE_RT_ADAPTIVE_MUTEX_H_
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseRtLockStatistics.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+/**
+ * @class	AdaptiveMutex
+ * @brief	This class represents a non-recursive mutex that spins for a while before it puts the waiting thread to sleep.
+ *
+ * @since 2.1
+ *
+ * The %AdaptiveMutex class represents a non-recursive mutex for critical sections that are held for a short time.
+ * A thread that finds the mutex locked spins for a while, expecting the holder to release it soon,
+ * and sleeps on a futex only if it is still locked. Acquire() and Release() do not make a system call unless a thread sleeps. @n
+ * On a single processor the waiting thread sleeps at once, because the holder cannot run while it spins. @n
+ * AdaptiveMutexGuard releases the mutex when it goes out of scope.
+ *
+ * This header is not included from FBaseRt.h, because it needs the system call numbers of sys/syscall.h,
+ * which the SDK does not provide. The application must include this header directly, and must be built with them.
+ *
+ * @see	Mutex
+ */
+class AdaptiveMutex
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Create() method must be called explicitly to initialize this instance.
+	 */
+	AdaptiveMutex(void)
+		: __state(STATE_UNLOCKED)
+		, __spinCount(-1)
+		, __lockTime(0)
+		, __pProfile(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~AdaptiveMutex(void)
+	{
+		delete __pProfile;
+	}
+
+	/**
+	 * Creates the mutex with the default spin count.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	The mutex has already been created.
+	 */
+	result Create(void)
+	{
+		long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+		return Create((processorCount > 1) ? DEFAULT_SPIN_COUNT : 0);
+	}
+
+	/**
+	 * Creates the mutex with the specified spin count.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	spinCount			The number of times to check the mutex before sleeping @n
+	 *									If it is @c 0, the waiting thread sleeps at once.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	The mutex has already been created.
+	 * @exception	E_INVALID_ARG		The specified @c spinCount is negative.
+	 */
+	result Create(int spinCount)
+	{
+		TryReturn(__spinCount < 0, E_INVALID_OPERATION, "[%s] The mutex has already been created.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(spinCount >= 0, E_INVALID_ARG, "[%s] The spinCount(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), spinCount);
+
+		__spinCount = spinCount;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Acquires the mutex. @n
+	 * If the mutex is held by another thread, the current thread spins and then is blocked until the mutex is released.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The mutex has not been created.
+	 * @remarks		Acquiring the mutex again on the thread that holds it deadlocks.
+	 */
+	result Acquire(void)
+	{
+		TryReturn(__spinCount >= 0, E_INVALID_STATE, "[%s] The mutex has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		if (__sync_bool_compare_and_swap(&__state, STATE_UNLOCKED, STATE_LOCKED))
+		{
+			if (__pProfile != null)
+			{
+				__lockTime = __LockProfile::GetTime();
+				__pProfile->RecordAcquire(0, false);
+			}
+			return E_SUCCESS;
+		}
+
+		long long startTime = (__pProfile != null) ? __LockProfile::GetTime() : 0;
+
+		AcquireContended();
+
+		if (__pProfile != null)
+		{
+			__lockTime = __LockProfile::GetTime();
+			__pProfile->RecordAcquire(__lockTime - startTime, true);
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Acquires the mutex if it is not held by any thread.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The mutex has not been created.
+	 * @exception	E_OBJECT_LOCKED		The mutex is held by a thread.
+	 */
+	result TryToAcquire(void)
+	{
+		TryReturn(__spinCount >= 0, E_INVALID_STATE, "[%s] The mutex has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		if (!__sync_bool_compare_and_swap(&__state, STATE_UNLOCKED, STATE_LOCKED))
+		{
+			return E_OBJECT_LOCKED;
+		}
+
+		if (__pProfile != null)
+		{
+			__lockTime = __LockProfile::GetTime();
+			__pProfile->RecordAcquire(0, false);
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Releases the mutex.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The mutex has not been created, or is not held.
+	 * @remarks		The mutex must be released by the thread that holds it.
+	 */
+	result Release(void)
+	{
+		TryReturn(__spinCount >= 0 && __state != STATE_UNLOCKED, E_INVALID_STATE,
+			"[%s] The mutex has not been created, or is not held.", GetErrorMessage(E_INVALID_STATE));
+
+		if (__pProfile != null)
+		{
+			__pProfile->RecordHold(__LockProfile::GetTime() - __lockTime);
+		}
+
+		// Wakes a sleeping thread only if one may have slept
+		if (__sync_fetch_and_sub(&__state, 1) != STATE_LOCKED)
+		{
+			__state = STATE_UNLOCKED;
+			syscall(SYS_futex, &__state, WAKE_PRIVATE_OPERATION, 1, null, null, 0);
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Starts recording the contention statistics of this mutex.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	name				The name of the mutex in the log
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The mutex has not been created.
+	 * @exception	E_INVALID_OPERATION	The profiling has already been enabled.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		This method must be called before the mutex is shared by other threads. @n
+	 *				The profiling adds two clock reads to each acquisition.
+	 */
+	result EnableProfiling(const Tizen::Base::String& name)
+	{
+		TryReturn(__spinCount >= 0, E_INVALID_STATE, "[%s] The mutex has not been created.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__pProfile == null, E_INVALID_OPERATION, "[%s] The profiling has already been enabled.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__pProfile = new (std::nothrow) __LockProfile(name);
+		TryReturn(__pProfile != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the contention statistics of this mutex.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	statistics			The statistics recorded since EnableProfiling() was called
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The profiling has not been enabled.
+	 */
+	result GetStatistics(LockStatistics& statistics) const
+	{
+		TryReturn(__pProfile != null, E_INVALID_STATE, "[%s] The profiling has not been enabled.", GetErrorMessage(E_INVALID_STATE));
+
+		__pProfile->GetStatistics(statistics);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Writes the contention statistics of this mutex to the log with AppLog().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		Nothing is written if the profiling has not been enabled.
+	 */
+	void LogStatistics(void) const
+	{
+		if (__pProfile != null)
+		{
+			__pProfile->Log();
+		}
+	}
+
+private:
+	AdaptiveMutex(const AdaptiveMutex& rhs);
+	AdaptiveMutex& operator =(const AdaptiveMutex& rhs);
+
+	void AcquireContended(void)
+	{
+		for (int i = 0; i < __spinCount; i++)
+		{
+			if (__state == STATE_UNLOCKED && __sync_bool_compare_and_swap(&__state, STATE_UNLOCKED, STATE_LOCKED))
+			{
+				return;
+			}
+			Pause();
+		}
+
+		// Marks the mutex as having sleepers, so that Release() wakes one
+		int state = __sync_lock_test_and_set(&__state, STATE_LOCKED_WITH_WAITERS);
+		while (state != STATE_UNLOCKED)
+		{
+			syscall(SYS_futex, &__state, WAIT_PRIVATE_OPERATION, STATE_LOCKED_WITH_WAITERS, null, null, 0);
+			state = __sync_lock_test_and_set(&__state, STATE_LOCKED_WITH_WAITERS);
+		}
+	}
+
+	static void Pause(void)
+	{
+#if defined(__i386__) || defined(__x86_64__)
+		__asm__ __volatile__("pause" : : : "memory");
+#else
+		__asm__ __volatile__("" : : : "memory");
+#endif
+	}
+
+	static const int STATE_UNLOCKED = 0;
+	static const int STATE_LOCKED = 1;
+	static const int STATE_LOCKED_WITH_WAITERS = 2;
+	static const int DEFAULT_SPIN_COUNT = 100;
+
+	// FUTEX_WAIT and FUTEX_WAKE with FUTEX_PRIVATE_FLAG
+	static const int WAIT_PRIVATE_OPERATION = 128;
+	static const int WAKE_PRIVATE_OPERATION = 129;
+
+	volatile int __state;
+	int __spinCount;
+	long long __lockTime;
+	__LockProfile* __pProfile;
+
+}; // AdaptiveMutex
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_ADAPTIVE_MUTEX_H_
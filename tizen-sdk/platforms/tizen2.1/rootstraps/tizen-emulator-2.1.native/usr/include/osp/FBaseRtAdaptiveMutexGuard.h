@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+* @file		FBaseRtAdaptiveMutexGuard.h
+* @brief	This is the header file for the %AdaptiveMutexGuard class.
+*
+* This header file contains the declarations of the %AdaptiveMutexGuard class.
+*/
+
+#ifndef _FBASE_RT_ADAPTIVE_MUTEX_GUARD_H_
+#define _FBASE_RT_ADAPTIVE_MUTEX_GUARD_H_
+
+#include <FBaseRtAdaptiveMutex.h>
+#include <FBaseRtTypes.h>
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+/**
+* @class	AdaptiveMutexGuard
+* @brief	This class is the RAII style class for %AdaptiveMutex class.
+*
+* @since 2.1
+*
+* The %AdaptiveMutexGuard class acquires the specified AdaptiveMutex when it is constructed, and releases it when it goes out of scope. @n
+* Like FBaseRtAdaptiveMutex.h, this header is not included from FBaseRt.h, and the application must include it directly.
+*
+* @see		AdaptiveMutex
+*/
+class AdaptiveMutexGuard
+{
+public:
+	/**
+	* This constructor acquires the lock in a blocking way.
+	*
+	* @since 2.1
+	*
+	* @param[in]	m	The %AdaptiveMutex instance to be manipulated
+	* @remarks		The specific error code can be accessed using the GetLastResult() method.
+	* @see			AdaptiveMutex::Acquire() for detailed exceptions
+	*/
+	AdaptiveMutexGuard(AdaptiveMutex& m)
+		: __m(m)
+		, __locked(false)
+	{
+		SetLastResult(Lock());
+	}
+
+	/**
+	* This constructor acquires the lock in a non-blocking way.
+	*
+	* @since 2.1
+	*
+	* @param[in]	m	The %AdaptiveMutex instance to be manipulated
+	* @remarks		The specific error code can be accessed using the GetLastResult() method.
+	* @see			AdaptiveMutex::TryToAcquire() for detailed exceptions
+	*/
+	AdaptiveMutexGuard(AdaptiveMutex& m, TryTag)
+		: __m(m)
+		, __locked(false)
+	{
+		SetLastResult(TryToLock());
+	}
+
+	/**
+	* This destructor releases the lock if acquired when going out of a scope
+	*
+	* @since 2.1
+	*
+	* @remarks	The specific error code can be accessed using the GetLastResult() method.
+	* @see		AdaptiveMutex::Release() for detailed exceptions
+	*/
+	~AdaptiveMutexGuard(void)
+	{
+		SetLastResult(Unlock());
+	}
+
+	/**
+	* Returns whether this instance owns the lock on the given mutex at constructor.
+	*
+	* @since 2.1
+	*
+	* @return	true if the lock is owned, @n
+	*			false otherwise.
+	*/
+	bool IsLocked(void) const
+	{
+		return __locked;
+	}
+
+	/**
+	* Returns whether this instance owns the lock on the given mutex at constructor. @n
+	* Have same effects to calling IsLocked().
+	*
+	* @since 2.1
+	*/
+	operator bool() const
+	{
+		return IsLocked();
+	}
+
+	/**
+	* Acquires the lock manually on the given mutex at constructor in a blocking way
+	*
+	* @since 2.1
+	*
+	* @return	An error code.
+	* @see		AdaptiveMutex::Acquire() for detailed exceptions
+	*/
+	result Lock(void)
+	{
+		return SetLockedAndReturn(__m.Acquire());
+	}
+
+	/**
+	* Acquires the lock manually on the given mutex at constructor in a non-blocking way
+	*
+	* @since 2.1
+	*
+	* @return	An error code.
+	* @see		AdaptiveMutex::TryToAcquire() for detailed exceptions
+	*/
+	result TryToLock(void)
+	{
+		return SetLockedAndReturn(__m.TryToAcquire());
+	}
+
+	/**
+	* Releases the lock manually
+	*
+	* @since 2.1
+	*
+	* @return	An error code.
+	* @see		AdaptiveMutex::Release() for detailed exceptions
+	*/
+	result Unlock(void)
+	{
+		result r = E_SUCCESS;
+		if (__locked)
+		{
+			r = __m.Release();
+			__locked = false;
+		}
+		return r;
+	}
+
+private:
+	/**
+	* The implementation of this copy constructor is intentionally blank and declared as private 
+	* to prohibit copying of objects.
+	*
+	* @since 2.1
+	*/
+	AdaptiveMutexGuard(const AdaptiveMutexGuard& rhs);
+
+	/**
+	* The implementation of this copy assignment operator is intentionally blank and declared as private
+	* to prohibit copying of objects.
+	*
+	* @since 2.1
+	*/
+	AdaptiveMutexGuard& operator =(const AdaptiveMutexGuard& rhs);
+
+	// helper function
+	result SetLockedAndReturn(result r)
+	{
+		__locked = (r == E_SUCCESS);
+		return r;
+	}
+
+private:
+	AdaptiveMutex& __m;
+	bool __locked;
+}; // AdaptiveMutexGuard
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_ADAPTIVE_MUTEX_GUARD_H_
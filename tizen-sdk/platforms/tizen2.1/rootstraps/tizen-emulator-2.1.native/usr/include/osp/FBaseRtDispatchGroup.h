@@ -0,0 +1,269 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtDispatchGroup.h
+ * @brief		This is the header file for the %DispatchGroup class.
+ *
+ * This header file contains the declarations of the %DispatchGroup class.
+ */
+#ifndef _FBASE_RT_DISPATCH_GROUP_H_
+#define _FBASE_RT_DISPATCH_GROUP_H_
+
+#include <new>
+#include <dispatch/dispatch.h>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtDispatchQueue.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+/**
+ * @class	DispatchGroup
+ * @brief	This class tracks a set of tasks submitted to dispatch queues, and waits for or is notified of their completion.
+ *
+ * @since 2.1
+ *
+ * The %DispatchGroup class tracks a set of tasks submitted to one or more DispatchQueue instances.
+ * A thread can wait until all the tasks complete, or a task can be submitted to run when they complete,
+ * for example to a caller thread queue of the main thread, so that the main thread is never blocked.
+ *
+ * The following example demonstrates how to use the %DispatchGroup class.
+ *
+ * @code
+ *	#include <FBaseRtDispatchGroup.h>
+ *
+ *	using namespace Tizen::Base::Runtime;
+ *
+ *	result
+ *	MyForm::LoadThumbnails(void)
+ *	{
+ *		// __group is constructed, __backgroundQueue is constructed with DISPATCH_PRIORITY_DEFAULT,
+ *		// and __mainQueue is constructed on the main thread with ConstructForCallerThread().
+ *		for (int i = 0; i < __thumbnailCount; i++)
+ *		{
+ *			__group.Async(__backgroundQueue, *__pDecodeTasks[i]);
+ *		}
+ *
+ *		// ShowThumbnailsTask runs on the main thread when all the thumbnails are decoded.
+ *		return __group.Notify(__mainQueue, __showThumbnailsTask);
+ *	}
+ * @endcode
+ */
+class DispatchGroup
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	DispatchGroup(void)
+		: __group(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		The tasks of the group still run after this instance is deleted.
+	 */
+	virtual ~DispatchGroup(void)
+	{
+		if (__group != null)
+		{
+			dispatch_release(__group);
+		}
+	}
+
+	/**
+	 * Initializes this instance of %DispatchGroup.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(void)
+	{
+		TryReturn(__group == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__group = dispatch_group_create();
+		TryReturn(__group != null, E_SYSTEM, "[%s] Failed to create the dispatch group.", GetErrorMessage(E_SYSTEM));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Submits the specified task to the specified queue as a member of this group.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	queue				The queue to run the task
+	 * @param[in]	task				The task to run @n
+	 *									It must be valid until it completes.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance or the specified @c queue has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The object returned by IRunnable::Run() is deleted.
+	 */
+	result Async(DispatchQueue& queue, IRunnable& task)
+	{
+		TryReturn(__group != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		return queue.Post(&task, false, __group);
+	}
+
+	/**
+	 * Submits a copy of the specified functor to the specified queue as a member of this group.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	queue				The queue to run the functor
+	 * @param[in]	functor				The functor to call with no argument @n
+	 *									Its return value is ignored.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance or the specified @c queue has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	template< class Functor >
+	result AsyncFunctor(DispatchQueue& queue, const Functor& functor)
+	{
+		TryReturn(__group != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__DispatchFunctorTaskT< Functor >* pTask = new (std::nothrow) __DispatchFunctorTaskT< Functor >(functor);
+		TryReturn(pTask != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return queue.Post(pTask, true, __group);
+	}
+
+	/**
+	 * Waits until all the tasks of this group complete.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	timeout				The maximum time to wait in milliseconds, or @c INFINITE
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_TIMEOUT			The tasks have not completed within the specified time.
+	 * @remarks		Waiting on the thread of a caller thread queue for the tasks of that queue deadlocks.
+	 */
+	result Wait(long timeout = INFINITE)
+	{
+		TryReturn(__group != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		dispatch_time_t when = DISPATCH_TIME_FOREVER;
+		if (static_cast< unsigned long >(timeout) != INFINITE)
+		{
+			when = dispatch_time(DISPATCH_TIME_NOW, static_cast< int64_t >(timeout) * static_cast< int64_t >(NSEC_PER_MSEC));
+		}
+
+		if (dispatch_group_wait(__group, when) != 0)
+		{
+			return E_TIMEOUT;
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Submits the specified task to the specified queue when all the current tasks of this group complete.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	queue				The queue to run the task @n
+	 *									A caller thread queue must be valid until the task runs.
+	 * @param[in]	task				The task to run @n
+	 *									It must be valid until it completes.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance or the specified @c queue has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		If this group has no task, the task is submitted immediately.
+	 */
+	result Notify(DispatchQueue& queue, IRunnable& task)
+	{
+		return NotifyImpl(queue, &task, false);
+	}
+
+	/**
+	 * Submits a copy of the specified functor to the specified queue when all the current tasks of this group complete.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	queue				The queue to run the functor @n
+	 *									A caller thread queue must be valid until the functor is called.
+	 * @param[in]	functor				The functor to call with no argument @n
+	 *									Its return value is ignored.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance or the specified @c queue has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	template< class Functor >
+	result NotifyFunctor(DispatchQueue& queue, const Functor& functor)
+	{
+		__DispatchFunctorTaskT< Functor >* pTask = new (std::nothrow) __DispatchFunctorTaskT< Functor >(functor);
+		TryReturn(pTask != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return NotifyImpl(queue, pTask, true);
+	}
+
+private:
+	DispatchGroup(const DispatchGroup& rhs);
+	DispatchGroup& operator =(const DispatchGroup& rhs);
+
+	result NotifyImpl(DispatchQueue& queue, IRunnable* pRunnable, bool ownsRunnable)
+	{
+		if (__group == null || !queue.IsConstructed())
+		{
+			if (ownsRunnable)
+			{
+				delete pRunnable;
+			}
+			AppLogException("[%s] This instance or the queue has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+			return E_INVALID_STATE;
+		}
+
+		__DispatchWork* pWork = __DispatchWork::CreateN(pRunnable, ownsRunnable);
+		TryReturn(pWork != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		dispatch_group_notify_f(__group, queue.GetTargetQueue(pWork), pWork, __DispatchWork::Invoke);
+
+		return E_SUCCESS;
+	}
+
+	dispatch_group_t __group;
+
+}; // DispatchGroup
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_DISPATCH_GROUP_H_
@@ -0,0 +1,745 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtDispatchQueue.h
+ * @brief		This is the header file for the %DispatchQueue class.
+ *
+ * This header file contains the declarations of the %DispatchQueue class.
+ */
+#ifndef _FBASE_RT_DISPATCH_QUEUE_H_
+#define _FBASE_RT_DISPATCH_QUEUE_H_
+
+#include <new>
+#include <dispatch/dispatch.h>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseString.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseUtilStringUtil.h>
+#include <FBaseRtEvent.h>
+#include <FBaseRtIEventArg.h>
+#include <FBaseRtIEventListener.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtMutex.h>
+#include <FBaseRtMutexGuard.h>
+#include <FBaseRtTypes.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+class DispatchGroup;
+class DispatchSource;
+class __DispatchForwarder;
+
+//
+// @class	__DispatchWork
+// @brief	This class is the context of a task passed to the libdispatch functions.
+// @since 2.1
+//
+// If pForwarder is not null, the work is posted to the event loop of the caller thread queue instead of being run.
+// If group is not null, the work leaves the group after it is run or discarded.
+//
+class __DispatchWork
+{
+public:
+	static __DispatchWork* CreateN(IRunnable* pRunnable, bool ownsRunnable)
+	{
+		__DispatchWork* pWork = new (std::nothrow) __DispatchWork;
+		if (pWork == null)
+		{
+			if (ownsRunnable)
+			{
+				delete pRunnable;
+			}
+			return null;
+		}
+
+		pWork->pRunnable = pRunnable;
+		pWork->ownsRunnable = ownsRunnable;
+		pWork->group = null;
+		pWork->pForwarder = null;
+
+		return pWork;
+	}
+
+	static void Invoke(void* pContext);
+
+	// Runs the task on the current thread and deletes the object returned by the task
+	static void Run(void* pContext)
+	{
+		IRunnable* pRunnable = static_cast< IRunnable* >(pContext);
+		delete pRunnable->Run();
+	}
+
+	static void Destroy(__DispatchWork* pWork);
+
+	IRunnable* pRunnable;
+	bool ownsRunnable;
+	dispatch_group_t group;
+	__DispatchForwarder* pForwarder;
+
+}; // __DispatchWork
+
+//
+// @class	__DispatchEventArg
+// @brief	This class carries a %__DispatchWork to the event loop of the caller thread.
+// @since 2.1
+//
+class __DispatchEventArg
+	: public IEventArg
+{
+public:
+	explicit __DispatchEventArg(__DispatchWork* pWork)
+		: __pWork(pWork)
+	{
+	}
+
+	// The work which has not been delivered is discarded, so that its group is not left waiting
+	virtual ~__DispatchEventArg(void)
+	{
+		if (__pWork != null)
+		{
+			__DispatchWork::Destroy(__pWork);
+		}
+	}
+
+	void Invoke(void) const
+	{
+		__DispatchWork* pWork = __pWork;
+		__pWork = null;
+
+		__DispatchWork::Invoke(pWork);
+	}
+
+private:
+	__DispatchEventArg(const __DispatchEventArg& rhs);
+	__DispatchEventArg& operator =(const __DispatchEventArg& rhs);
+
+	mutable __DispatchWork* __pWork;
+
+}; // __DispatchEventArg
+
+//
+// @class	__DispatchCallerThreadEvent
+// @brief	This class runs the tasks posted by other threads on the event loop of the thread which constructs it.
+// @since 2.1
+//
+class __DispatchCallerThreadEvent
+	: public Event
+	, public IEventListener
+{
+public:
+	__DispatchCallerThreadEvent(void)
+	{
+	}
+
+	virtual ~__DispatchCallerThreadEvent(void)
+	{
+	}
+
+	result Construct(void)
+	{
+		return AddListener(*this, true);
+	}
+
+	// Takes the ownership of the work
+	result Post(__DispatchWork* pWork)
+	{
+		__DispatchEventArg* pArg = new (std::nothrow) __DispatchEventArg(pWork);
+		if (pArg == null)
+		{
+			__DispatchWork::Destroy(pWork);
+			return E_OUT_OF_MEMORY;
+		}
+
+		result r = Fire(*pArg);
+		if (r != E_SUCCESS)
+		{
+			// Deleting the undelivered argument discards the work, which leaves its group
+			delete pArg;
+		}
+
+		return r;
+	}
+
+protected:
+	virtual void FireImpl(IEventListener&, const IEventArg& arg)
+	{
+		const __DispatchEventArg* pArg = dynamic_cast< const __DispatchEventArg* >(&arg);
+		if (pArg != null)
+		{
+			pArg->Invoke();
+		}
+	}
+
+private:
+	__DispatchCallerThreadEvent(const __DispatchCallerThreadEvent& rhs);
+	__DispatchCallerThreadEvent& operator =(const __DispatchCallerThreadEvent& rhs);
+
+}; // __DispatchCallerThreadEvent
+
+//
+// @class	__DispatchForwarder
+// @brief	This class forwards the works from the libdispatch threads to a %__DispatchCallerThreadEvent.
+// @since 2.1
+//
+// The caller thread queue and each work on the way to it hold a reference.
+// The queue detaches the event before deleting it, and the works forwarded after that are discarded.
+//
+class __DispatchForwarder
+{
+public:
+	static __DispatchForwarder* CreateN(__DispatchCallerThreadEvent& event)
+	{
+		__DispatchForwarder* pForwarder = new (std::nothrow) __DispatchForwarder(event);
+		TryReturnResult(pForwarder != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pForwarder->__mutex.Create();
+		if (r != E_SUCCESS)
+		{
+			delete pForwarder;
+			SetLastResult(r);
+			return null;
+		}
+
+		SetLastResult(E_SUCCESS);
+		return pForwarder;
+	}
+
+	void AddRef(void)
+	{
+		__sync_add_and_fetch(&__refCount, 1);
+	}
+
+	void Release(void)
+	{
+		if (__sync_sub_and_fetch(&__refCount, 1) == 0)
+		{
+			delete this;
+		}
+	}
+
+	// Takes the ownership of the work
+	result Post(__DispatchWork* pWork)
+	{
+		MutexGuard lock(__mutex);
+
+		if (__pEvent == null)
+		{
+			__DispatchWork::Destroy(pWork);
+			return E_INVALID_STATE;
+		}
+
+		return __pEvent->Post(pWork);
+	}
+
+	// Called by the queue before it deletes the event
+	void Detach(void)
+	{
+		MutexGuard lock(__mutex);
+
+		__pEvent = null;
+	}
+
+private:
+	explicit __DispatchForwarder(__DispatchCallerThreadEvent& event)
+		: __pEvent(&event)
+		, __refCount(1)
+	{
+	}
+
+	~__DispatchForwarder(void)
+	{
+	}
+
+	__DispatchForwarder(const __DispatchForwarder& rhs);
+	__DispatchForwarder& operator =(const __DispatchForwarder& rhs);
+
+	Mutex __mutex;
+	__DispatchCallerThreadEvent* __pEvent;
+	volatile int __refCount;
+
+}; // __DispatchForwarder
+
+inline void
+__DispatchWork::Invoke(void* pContext)
+{
+	__DispatchWork* pWork = static_cast< __DispatchWork* >(pContext);
+
+	if (pWork->pForwarder != null)
+	{
+		__DispatchForwarder* pForwarder = pWork->pForwarder;
+		pWork->pForwarder = null;
+
+		pForwarder->Post(pWork);
+		pForwarder->Release();
+		return;
+	}
+
+	delete pWork->pRunnable->Run();
+
+	__DispatchWork::Destroy(pWork);
+}
+
+inline void
+__DispatchWork::Destroy(__DispatchWork* pWork)
+{
+	if (pWork->ownsRunnable)
+	{
+		delete pWork->pRunnable;
+	}
+
+	if (pWork->pForwarder != null)
+	{
+		pWork->pForwarder->Release();
+	}
+
+	if (pWork->group != null)
+	{
+		dispatch_group_leave(pWork->group);
+	}
+
+	delete pWork;
+}
+
+//
+// @class	__DispatchFunctorTaskT
+// @brief	This class adapts a functor to IRunnable.
+// @since 2.1
+//
+template< class Functor >
+class __DispatchFunctorTaskT
+	: public IRunnable
+{
+public:
+	explicit __DispatchFunctorTaskT(const Functor& functor)
+		: __functor(functor)
+	{
+	}
+
+	virtual ~__DispatchFunctorTaskT(void)
+	{
+	}
+
+	virtual Object* Run(void)
+	{
+		__functor();
+		return null;
+	}
+
+private:
+	__DispatchFunctorTaskT(const __DispatchFunctorTaskT& rhs);
+	__DispatchFunctorTaskT& operator =(const __DispatchFunctorTaskT& rhs);
+
+	Functor __functor;
+
+}; // __DispatchFunctorTaskT
+
+//
+// @class	__DispatchApplyT
+// @brief	This class calls a functor with the iteration index passed by dispatch_apply_f().
+// @since 2.1
+//
+template< class Functor >
+class __DispatchApplyT
+{
+public:
+	static void Invoke(void* pContext, size_t index)
+	{
+		const Functor* pFunctor = static_cast< const Functor* >(pContext);
+		(*pFunctor)(static_cast< int >(index));
+	}
+
+}; // __DispatchApplyT
+
+/**
+ * @class	DispatchQueue
+ * @brief	This class submits tasks to a libdispatch queue, or to the event loop of the thread that constructs it.
+ *
+ * @since 2.1
+ *
+ * The %DispatchQueue class submits IRunnable tasks and functors to a queue of libdispatch,
+ * which runs them on a pool of threads shared by the whole process and sized to the number of processors.
+ * An instance is one of the following kinds:
+ * - A serial queue, which runs its tasks one at a time in the submitted order.
+ * - A concurrent queue of a DispatchPriority, which runs its tasks in parallel.
+ * - A caller thread queue, which runs its tasks on the event loop of the thread that constructs it.
+ *   It is used to deliver the completion of background work to the main thread of a UiApp without a lock.
+ *
+ * The application must be linked with libdispatch.
+ *
+ * The following example demonstrates how to use the %DispatchQueue class.
+ *
+ * @code
+ *	#include <FBaseRtDispatchQueue.h>
+ *
+ *	using namespace Tizen::Base::Runtime;
+ *
+ *	struct ScaleRow
+ *	{
+ *		void operator ()(int row) const
+ *		{
+ *			// Scales the row ...
+ *		}
+ *	};
+ *
+ *	struct UpdateView
+ *	{
+ *		void operator ()(void) const
+ *		{
+ *			// Updates the controls with the scaled image ...
+ *		}
+ *	};
+ *
+ *	result
+ *	MyForm::ScaleImage(int height)
+ *	{
+ *		// __pBackgroundQueue is constructed with DISPATCH_PRIORITY_DEFAULT,
+ *		// and __pMainQueue is constructed on the main thread with ConstructForCallerThread().
+ *		result r = __pBackgroundQueue->ApplyFunctor(height, ScaleRow());
+ *		if (r == E_SUCCESS)
+ *		{
+ *			r = __pMainQueue->AsyncFunctor(UpdateView());
+ *		}
+ *		return r;
+ *	}
+ * @endcode
+ */
+class DispatchQueue
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, one of the Construct() methods must be called explicitly to initialize this instance.
+	 */
+	DispatchQueue(void)
+		: __queue(null)
+		, __pCallerThreadEvent(null)
+		, __pForwarder(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		The tasks that have already been submitted to a serial or concurrent queue still run after this instance is deleted.
+	 *				The tasks that have not been run by a caller thread queue are discarded.
+	 */
+	virtual ~DispatchQueue(void)
+	{
+		if (__queue != null)
+		{
+			dispatch_release(__queue);
+		}
+
+		// The works that are still on a libdispatch thread are discarded when they are forwarded
+		if (__pForwarder != null)
+		{
+			__pForwarder->Detach();
+			__pForwarder->Release();
+		}
+		delete __pCallerThreadEvent;
+	}
+
+	/**
+	 * Initializes this instance of %DispatchQueue as a serial queue.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	label				The label of the queue for debugging
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(const Tizen::Base::String& label)
+	{
+		TryReturn(!IsConstructed(), E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		Tizen::Base::ByteBuffer* pLabel = Tizen::Base::Utility::StringUtil::StringToUtf8N(label);
+		TryReturn(pLabel != null, GetLastResult(), "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+
+		__queue = dispatch_queue_create(reinterpret_cast< const char* >(pLabel->GetPointer()), null);
+		delete pLabel;
+		TryReturn(__queue != null, E_SYSTEM, "[%s] Failed to create the dispatch queue.", GetErrorMessage(E_SYSTEM));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Initializes this instance of %DispatchQueue as the concurrent queue of the specified priority.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	priority			The priority of the tasks
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		All the instances of the same priority share the same libdispatch queue.
+	 */
+	result Construct(DispatchPriority priority)
+	{
+		TryReturn(!IsConstructed(), E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		long dispatchPriority = DISPATCH_QUEUE_PRIORITY_DEFAULT;
+		if (priority == DISPATCH_PRIORITY_HIGH)
+		{
+			dispatchPriority = DISPATCH_QUEUE_PRIORITY_HIGH;
+		}
+		else if (priority == DISPATCH_PRIORITY_LOW)
+		{
+			dispatchPriority = DISPATCH_QUEUE_PRIORITY_LOW;
+		}
+
+		dispatch_queue_t queue = dispatch_get_global_queue(dispatchPriority, 0);
+		TryReturn(queue != null, E_SYSTEM, "[%s] Failed to get the global dispatch queue.", GetErrorMessage(E_SYSTEM));
+
+		dispatch_retain(queue);
+		__queue = queue;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Initializes this instance of %DispatchQueue as a queue that runs the tasks on the event loop of the calling thread.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed, or the calling thread is a worker thread.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		This method must be called on the main thread or an event-driven thread.
+	 *				Sync() and ApplyFunctor() are not supported by the caller thread queue.
+	 */
+	result ConstructForCallerThread(void)
+	{
+		TryReturn(!IsConstructed(), E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__DispatchCallerThreadEvent* pEvent = new (std::nothrow) __DispatchCallerThreadEvent;
+		TryReturn(pEvent != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pEvent->Construct();
+		if (r != E_SUCCESS)
+		{
+			delete pEvent;
+			AppLogException("[%s] Propagating.", GetErrorMessage(r));
+			return r;
+		}
+
+		__DispatchForwarder* pForwarder = __DispatchForwarder::CreateN(*pEvent);
+		if (pForwarder == null)
+		{
+			r = GetLastResult();
+			delete pEvent;
+			AppLogException("[%s] Propagating.", GetErrorMessage(r));
+			return r;
+		}
+
+		__pCallerThreadEvent = pEvent;
+		__pForwarder = pForwarder;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Submits the specified task and returns without waiting for it.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	task				The task to run @n
+	 *									It must be valid until it completes.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The object returned by IRunnable::Run() is deleted.
+	 */
+	result Async(IRunnable& task)
+	{
+		return Post(&task, false, null);
+	}
+
+	/**
+	 * Submits a copy of the specified functor and returns without waiting for it.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	functor				The functor to call with no argument @n
+	 *									Its return value is ignored.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	template< class Functor >
+	result AsyncFunctor(const Functor& functor)
+	{
+		__DispatchFunctorTaskT< Functor >* pTask = new (std::nothrow) __DispatchFunctorTaskT< Functor >(functor);
+		TryReturn(pTask != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return Post(pTask, true, null);
+	}
+
+	/**
+	 * Submits the specified task and waits until it completes.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	task				The task to run
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_OPERATION	This instance is a caller thread queue.
+	 * @remarks		The object returned by IRunnable::Run() is deleted. @n
+	 *				Calling this method from a task of the same serial queue deadlocks.
+	 */
+	result Sync(IRunnable& task)
+	{
+		TryReturn(IsConstructed(), E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__queue != null, E_INVALID_OPERATION, "[%s] The caller thread queue cannot run a task synchronously.", GetErrorMessage(E_INVALID_OPERATION));
+
+		dispatch_sync_f(__queue, &task, __DispatchWork::Run);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Calls the specified functor on this queue and waits until it returns.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	functor				The functor to call with no argument @n
+	 *									Its return value is ignored.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_OPERATION	This instance is a caller thread queue.
+	 * @remarks		Calling this method from a task of the same serial queue deadlocks.
+	 */
+	template< class Functor >
+	result SyncFunctor(const Functor& functor)
+	{
+		__DispatchFunctorTaskT< Functor > task(functor);
+
+		return Sync(task);
+	}
+
+	/**
+	 * Calls the specified functor once for each index from @c 0 to @c iterations - 1, and waits until all the calls return.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	iterations			The number of calls
+	 * @param[in]	functor				The functor to call with the index as an @c int argument @n
+	 *									It is called in parallel on a concurrent queue, and must be safe to call from multiple threads.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_OPERATION	This instance is a caller thread queue.
+	 * @exception	E_INVALID_ARG		The specified @c iterations is negative.
+	 */
+	template< class Functor >
+	result ApplyFunctor(int iterations, const Functor& functor)
+	{
+		TryReturn(IsConstructed(), E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__queue != null, E_INVALID_OPERATION, "[%s] The caller thread queue cannot run a task synchronously.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(iterations >= 0, E_INVALID_ARG, "[%s] The iterations(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), iterations);
+
+		dispatch_apply_f(iterations, __queue, const_cast< Functor* >(&functor), __DispatchApplyT< Functor >::Invoke);
+
+		return E_SUCCESS;
+	}
+
+private:
+	DispatchQueue(const DispatchQueue& rhs);
+	DispatchQueue& operator =(const DispatchQueue& rhs);
+
+	bool IsConstructed(void) const
+	{
+		return __queue != null || __pCallerThreadEvent != null;
+	}
+
+	// Submits the task which leaves the specified group when it completes, and takes the ownership of an owned task even on failure
+	result Post(IRunnable* pRunnable, bool ownsRunnable, dispatch_group_t group)
+	{
+		if (!IsConstructed())
+		{
+			if (ownsRunnable)
+			{
+				delete pRunnable;
+			}
+			AppLogException("[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+			return E_INVALID_STATE;
+		}
+
+		__DispatchWork* pWork = __DispatchWork::CreateN(pRunnable, ownsRunnable);
+		TryReturn(pWork != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		if (group != null)
+		{
+			dispatch_group_enter(group);
+			pWork->group = group;
+		}
+
+		if (__queue != null)
+		{
+			dispatch_async_f(__queue, pWork, __DispatchWork::Invoke);
+			return E_SUCCESS;
+		}
+
+		result r = __pCallerThreadEvent->Post(pWork);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	// Gets the libdispatch queue on which a callback is called, and sets the event to which the callback forwards the work
+	dispatch_queue_t GetTargetQueue(__DispatchWork* pWork) const
+	{
+		if (__queue != null)
+		{
+			return __queue;
+		}
+
+		__pForwarder->AddRef();
+		pWork->pForwarder = __pForwarder;
+		return dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+	}
+
+	dispatch_queue_t __queue;
+	__DispatchCallerThreadEvent* __pCallerThreadEvent;
+	__DispatchForwarder* __pForwarder;
+
+	friend class DispatchGroup;
+	friend class DispatchSource;
+
+}; // DispatchQueue
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_DISPATCH_QUEUE_H_
@@ -0,0 +1,346 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtDispatchSource.h
+ * @brief		This is the header file for the %DispatchSource class.
+ *
+ * This header file contains the declarations of the %DispatchSource class.
+ */
+#ifndef _FBASE_RT_DISPATCH_SOURCE_H_
+#define _FBASE_RT_DISPATCH_SOURCE_H_
+
+#include <dispatch/dispatch.h>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseRtDispatchQueue.h>
+#include <FBaseRtIDispatchSourceEventListener.h>
+#include <FBaseRtTypes.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+/**
+ * @class	DispatchSource
+ * @brief	This class delivers timer and file descriptor events to a listener on a dispatch queue.
+ *
+ * @since 2.1
+ *
+ * The %DispatchSource class delivers timer expirations, and the readiness of a file descriptor for reading or writing,
+ * to an IDispatchSourceEventListener on a serial or concurrent DispatchQueue, without a thread that polls.
+ * Unlike Timer, the listener is not called on the thread that constructs the instance,
+ * so that a periodic job does not occupy the main thread. @n
+ * A source is stopped when it is constructed. It must be started by Start() after SetTimer() for a timer.
+ *
+ * The following example demonstrates how to use the %DispatchSource class.
+ *
+ * @code
+ *	#include <FBaseRtDispatchSource.h>
+ *
+ *	using namespace Tizen::Base::Runtime;
+ *
+ *	class SyncListener
+ *		: public IDispatchSourceEventListener
+ *	{
+ *	public:
+ *		virtual void OnDispatchSourceEvent(DispatchSource& source, unsigned long data)
+ *		{
+ *			// Synchronizes the data with the server ...
+ *		}
+ *	};
+ *
+ *	result
+ *	MyClass::StartSync(void)
+ *	{
+ *		// __queue is constructed with DISPATCH_PRIORITY_LOW.
+ *		result r = __timer.Construct(__listener, __queue);
+ *		if (r == E_SUCCESS)
+ *		{
+ *			r = __timer.SetTimer(0, 60000, 5000);
+ *		}
+ *		if (r == E_SUCCESS)
+ *		{
+ *			r = __timer.Start();
+ *		}
+ *		return r;
+ *	}
+ * @endcode
+ */
+class DispatchSource
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, one of the Construct() methods must be called explicitly to initialize this instance.
+	 */
+	DispatchSource(void)
+		: __source(null)
+		, __cancelSemaphore(null)
+		, __pListener(null)
+		, __type(DISPATCH_SOURCE_TIMER)
+		, __fd(-1)
+		, __isStarted(false)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		The destructor waits until the listener returns if it is being called. @n
+	 *				The file descriptor is not closed.
+	 */
+	virtual ~DispatchSource(void)
+	{
+		if (__source != null)
+		{
+			dispatch_source_cancel(__source);
+
+			// The cancel handler is not called while the source is suspended
+			if (!__isStarted)
+			{
+				dispatch_resume(__source);
+			}
+
+			dispatch_semaphore_wait(__cancelSemaphore, DISPATCH_TIME_FOREVER);
+			dispatch_release(__source);
+		}
+
+		if (__cancelSemaphore != null)
+		{
+			dispatch_release(__cancelSemaphore);
+		}
+	}
+
+	/**
+	 * Initializes this instance of %DispatchSource as a timer.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	listener			The listener to call when the timer expires
+	 * @param[in]	queue				The serial or concurrent queue on which the listener is called
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c queue is a caller thread queue or has not been constructed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(IDispatchSourceEventListener& listener, DispatchQueue& queue)
+	{
+		return ConstructImpl(listener, queue, DISPATCH_SOURCE_TIMER, -1);
+	}
+
+	/**
+	 * Initializes this instance of %DispatchSource to monitor the specified file descriptor.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	listener			The listener to call when the file descriptor is ready
+	 * @param[in]	queue				The serial or concurrent queue on which the listener is called
+	 * @param[in]	fd					The file descriptor to monitor @n
+	 *									It must be valid until this instance is deleted.
+	 * @param[in]	type				DISPATCH_SOURCE_READ or DISPATCH_SOURCE_WRITE
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c queue is a caller thread queue or has not been constructed, @n
+	 *									the specified @c fd is negative, or the specified @c type is DISPATCH_SOURCE_TIMER.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(IDispatchSourceEventListener& listener, DispatchQueue& queue, int fd, DispatchSourceType type)
+	{
+		TryReturn(fd >= 0, E_INVALID_ARG, "[%s] The fd(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), fd);
+		TryReturn(type == DISPATCH_SOURCE_READ || type == DISPATCH_SOURCE_WRITE, E_INVALID_ARG,
+			"[%s] The type(%d) MUST be DISPATCH_SOURCE_READ or DISPATCH_SOURCE_WRITE.", GetErrorMessage(E_INVALID_ARG), type);
+
+		return ConstructImpl(listener, queue, type, fd);
+	}
+
+	/**
+	 * Sets the schedule of the timer.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	delay				The time until the first expiration in milliseconds
+	 * @param[in]	interval			The interval between the expirations in milliseconds @n
+	 *									If it is @c 0, the timer expires once.
+	 * @param[in]	leeway				The time in milliseconds by which the system can defer an expiration to save power
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed as a timer.
+	 * @exception	E_INVALID_ARG		A specified value is negative.
+	 * @remarks		The schedule can be changed while the timer is started.
+	 */
+	result SetTimer(long delay, long interval, long leeway = 0)
+	{
+		TryReturn(__source != null && __type == DISPATCH_SOURCE_TIMER, E_INVALID_STATE,
+			"[%s] This instance has not been constructed as a timer.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(delay >= 0 && interval >= 0 && leeway >= 0, E_INVALID_ARG,
+			"[%s] The delay(%ld), interval(%ld) and leeway(%ld) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), delay, interval, leeway);
+
+		dispatch_time_t start = dispatch_time(DISPATCH_TIME_NOW, static_cast< int64_t >(delay) * static_cast< int64_t >(NSEC_PER_MSEC));
+		uint64_t period = (interval > 0) ? static_cast< uint64_t >(interval) * NSEC_PER_MSEC : DISPATCH_TIME_FOREVER;
+
+		dispatch_source_set_timer(__source, start, period, static_cast< uint64_t >(leeway) * NSEC_PER_MSEC);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Starts the delivery of the events.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or has already been started.
+	 */
+	result Start(void)
+	{
+		TryReturn(__source != null && !__isStarted, E_INVALID_STATE,
+			"[%s] This instance has not been constructed, or has already been started.", GetErrorMessage(E_INVALID_STATE));
+
+		__isStarted = true;
+		dispatch_resume(__source);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Stops the delivery of the events until Start() is called again.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been started.
+	 * @remarks		The listener that is being called is not interrupted. @n
+	 *				The timer expirations and the file descriptor events while stopped are delivered at once after Start().
+	 */
+	result Stop(void)
+	{
+		TryReturn(__source != null && __isStarted, E_INVALID_STATE, "[%s] This instance has not been started.", GetErrorMessage(E_INVALID_STATE));
+
+		dispatch_suspend(__source);
+		__isStarted = false;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the type of the events.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The type of the events
+	 */
+	DispatchSourceType GetType(void) const
+	{
+		return __type;
+	}
+
+	/**
+	 * Gets the monitored file descriptor.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The file descriptor, @n
+	 *				else @c -1 if this instance is a timer
+	 */
+	int GetFileDescriptor(void) const
+	{
+		return __fd;
+	}
+
+private:
+	DispatchSource(const DispatchSource& rhs);
+	DispatchSource& operator =(const DispatchSource& rhs);
+
+	result ConstructImpl(IDispatchSourceEventListener& listener, DispatchQueue& queue, DispatchSourceType type, int fd)
+	{
+		TryReturn(__source == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(queue.__queue != null, E_INVALID_ARG,
+			"[%s] The queue MUST be a constructed serial or concurrent queue.", GetErrorMessage(E_INVALID_ARG));
+
+		result r = E_SUCCESS;
+		dispatch_source_type_t sourceType = DISPATCH_SOURCE_TYPE_TIMER;
+		if (type == DISPATCH_SOURCE_READ)
+		{
+			sourceType = DISPATCH_SOURCE_TYPE_READ;
+		}
+		else if (type == DISPATCH_SOURCE_WRITE)
+		{
+			sourceType = DISPATCH_SOURCE_TYPE_WRITE;
+		}
+
+		__cancelSemaphore = dispatch_semaphore_create(0);
+		TryCatch(__cancelSemaphore != null, r = E_SYSTEM, "[%s] Failed to create the semaphore.", GetErrorMessage(E_SYSTEM));
+
+		__source = dispatch_source_create(sourceType, (fd >= 0) ? static_cast< uintptr_t >(fd) : 0, 0, queue.__queue);
+		TryCatch(__source != null, r = E_SYSTEM, "[%s] Failed to create the dispatch source.", GetErrorMessage(E_SYSTEM));
+
+		__pListener = &listener;
+		__type = type;
+		__fd = fd;
+
+		dispatch_set_context(__source, this);
+		dispatch_source_set_event_handler_f(__source, OnEvent);
+		dispatch_source_set_cancel_handler_f(__source, OnCancel);
+
+		return E_SUCCESS;
+
+CATCH:
+		if (__cancelSemaphore != null)
+		{
+			dispatch_release(__cancelSemaphore);
+			__cancelSemaphore = null;
+		}
+
+		return r;
+	}
+
+	static void OnEvent(void* pContext)
+	{
+		DispatchSource* pSource = static_cast< DispatchSource* >(pContext);
+		pSource->__pListener->OnDispatchSourceEvent(*pSource, dispatch_source_get_data(pSource->__source));
+	}
+
+	// Called after the last call of the listener, so that the destructor can return safely
+	static void OnCancel(void* pContext)
+	{
+		DispatchSource* pSource = static_cast< DispatchSource* >(pContext);
+		dispatch_semaphore_signal(pSource->__cancelSemaphore);
+	}
+
+	dispatch_source_t __source;
+	dispatch_semaphore_t __cancelSemaphore;
+	IDispatchSourceEventListener* __pListener;
+	DispatchSourceType __type;
+	int __fd;
+	bool __isStarted;
+
+}; // DispatchSource
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_DISPATCH_SOURCE_H_
@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtIDispatchSourceEventListener.h
+ * @brief		This is the header file for the %IDispatchSourceEventListener interface.
+ *
+ */
+#ifndef _FBASE_RT_I_DISPATCH_SOURCE_EVENT_LISTENER_H_
+#define _FBASE_RT_I_DISPATCH_SOURCE_EVENT_LISTENER_H_
+
+
+#include <FBaseResult.h>
+#include <FBaseRtIEventListener.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+class DispatchSource;
+
+/**
+ * @interface IDispatchSourceEventListener
+ * @brief     This interface is the listener of the events delivered by a DispatchSource.
+ *
+ * @since 2.1
+ *
+ * The %IDispatchSourceEventListener interface is the listener of the timer and file descriptor events delivered by a DispatchSource.
+ *
+ * @see		    DispatchSource
+ */
+class IDispatchSourceEventListener
+	: virtual public IEventListener
+{
+public:
+	/**
+	 * This is the destructor for this class.
+	 *
+	 * @since 2.1
+	 */
+	virtual ~IDispatchSourceEventListener(void) {}
+
+	/**
+	 *	Called on the queue of the source when the event occurs.
+	 *
+	 *  @since 2.1
+	 *
+	 *	@param[in]	source	The source that delivers the event
+	 *	@param[in]	data	The number of the timer expirations since the last call for DISPATCH_SOURCE_TIMER, @n
+	 *						the estimated number of bytes available to read for DISPATCH_SOURCE_READ, or @n
+	 *						the estimated buffer space available to write for DISPATCH_SOURCE_WRITE
+	 *	@remarks	The source must not be deleted in this method.
+	 */
+	virtual void OnDispatchSourceEvent(DispatchSource& source, unsigned long data) = 0;
+
+}; // IDispatchSourceEventListener
+
+} } } // Tizen::Runtime
+
+
+#endif // _FBASE_RT_I_DISPATCH_SOURCE_EVENT_LISTENER_H_
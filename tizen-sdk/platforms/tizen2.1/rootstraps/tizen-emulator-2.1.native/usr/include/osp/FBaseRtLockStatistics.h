@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtLockStatistics.h
+ * @brief		This is the header file for the %LockStatistics class.
+ *
+ * This header file contains the declarations of the %LockStatistics class.
+ */
+#ifndef _FBASE_RT_LOCK_STATISTICS_H_
+#define _FBASE_RT_LOCK_STATISTICS_H_
+
+#include <time.h>
+#include <FBaseTypes.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+class __LockProfile;
+
+/**
+ * @class	LockStatistics
+ * @brief	This class holds the contention statistics of a ReadWriteLock or an AdaptiveMutex.
+ *
+ * @since 2.1
+ *
+ * The %LockStatistics class holds a snapshot of the contention statistics of a lock, which records them after EnableProfiling() is called.
+ * An acquisition is contended if the lock is not available at once. The times are in microseconds.
+ *
+ * @see	ReadWriteLock::GetStatistics()
+ * @see	AdaptiveMutex::GetStatistics()
+ */
+class LockStatistics
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 */
+	LockStatistics(void)
+		: __acquireCount(0)
+		, __contentionCount(0)
+		, __totalWaitTime(0)
+		, __maxWaitTime(0)
+		, __totalHoldTime(0)
+		, __maxHoldTime(0)
+	{
+	}
+
+	/**
+	 * Gets the number of acquisitions.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of acquisitions
+	 */
+	long long GetAcquireCount(void) const
+	{
+		return __acquireCount;
+	}
+
+	/**
+	 * Gets the number of acquisitions that have waited for another thread.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of contended acquisitions
+	 */
+	long long GetContentionCount(void) const
+	{
+		return __contentionCount;
+	}
+
+	/**
+	 * Gets the total time that the threads have waited to acquire the lock.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The total wait time in microseconds
+	 */
+	long long GetTotalWaitTime(void) const
+	{
+		return __totalWaitTime;
+	}
+
+	/**
+	 * Gets the longest time that a thread has waited to acquire the lock.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The longest wait time in microseconds
+	 */
+	long long GetMaxWaitTime(void) const
+	{
+		return __maxWaitTime;
+	}
+
+	/**
+	 * Gets the total time that the lock has been held exclusively.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The total hold time in microseconds
+	 * @remarks		The time that ReadWriteLock is held for reading is not included.
+	 */
+	long long GetTotalHoldTime(void) const
+	{
+		return __totalHoldTime;
+	}
+
+	/**
+	 * Gets the longest time that the lock has been held exclusively.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The longest hold time in microseconds
+	 * @remarks		The time that ReadWriteLock is held for reading is not included.
+	 */
+	long long GetMaxHoldTime(void) const
+	{
+		return __maxHoldTime;
+	}
+
+private:
+	long long __acquireCount;
+	long long __contentionCount;
+	long long __totalWaitTime;
+	long long __maxWaitTime;
+	long long __totalHoldTime;
+	long long __maxHoldTime;
+
+	friend class __LockProfile;
+
+}; // LockStatistics
+
+//
+// @class	__LockProfile
+// @brief	This class records the contention statistics of a lock.
+// @since 2.1
+//
+// The counters are updated with atomic operations, because the readers of a ReadWriteLock record them concurrently.
+//
+class __LockProfile
+{
+public:
+	explicit __LockProfile(const Tizen::Base::String& name)
+		: __name(name)
+		, __acquireCount(0)
+		, __contentionCount(0)
+		, __totalWaitTime(0)
+		, __maxWaitTime(0)
+		, __totalHoldTime(0)
+		, __maxHoldTime(0)
+	{
+	}
+
+	// Gets the monotonic time in nanoseconds
+	static long long GetTime(void)
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		return static_cast< long long >(now.tv_sec) * NANOSECONDS_PER_SECOND + now.tv_nsec;
+	}
+
+	void RecordAcquire(long long waitTime, bool isContended)
+	{
+		__sync_add_and_fetch(&__acquireCount, 1);
+		if (isContended)
+		{
+			__sync_add_and_fetch(&__contentionCount, 1);
+			__sync_add_and_fetch(&__totalWaitTime, waitTime);
+			UpdateMax(__maxWaitTime, waitTime);
+		}
+	}
+
+	void RecordHold(long long holdTime)
+	{
+		__sync_add_and_fetch(&__totalHoldTime, holdTime);
+		UpdateMax(__maxHoldTime, holdTime);
+	}
+
+	void GetStatistics(LockStatistics& statistics) const
+	{
+		statistics.__acquireCount = Load(__acquireCount);
+		statistics.__contentionCount = Load(__contentionCount);
+		statistics.__totalWaitTime = Load(__totalWaitTime) / NANOSECONDS_PER_MICROSECOND;
+		statistics.__maxWaitTime = Load(__maxWaitTime) / NANOSECONDS_PER_MICROSECOND;
+		statistics.__totalHoldTime = Load(__totalHoldTime) / NANOSECONDS_PER_MICROSECOND;
+		statistics.__maxHoldTime = Load(__maxHoldTime) / NANOSECONDS_PER_MICROSECOND;
+	}
+
+	void Log(void) const
+	{
+		LockStatistics statistics;
+		GetStatistics(statistics);
+
+		AppLog("[Lock %ls] acquired %lld times, contended %lld times, wait %lld us (max %lld us), hold %lld us (max %lld us)",
+			__name.GetPointer(), statistics.GetAcquireCount(), statistics.GetContentionCount(), statistics.GetTotalWaitTime(),
+			statistics.GetMaxWaitTime(), statistics.GetTotalHoldTime(), statistics.GetMaxHoldTime());
+	}
+
+private:
+	__LockProfile(const __LockProfile& rhs);
+	__LockProfile& operator =(const __LockProfile& rhs);
+
+	// A 64-bit load is not atomic on a 32-bit target
+	static long long Load(const volatile long long& value)
+	{
+		return __sync_add_and_fetch(const_cast< volatile long long* >(&value), 0);
+	}
+
+	static void UpdateMax(volatile long long& maxValue, long long value)
+	{
+		long long current = Load(maxValue);
+		while (value > current)
+		{
+			long long previous = __sync_val_compare_and_swap(&maxValue, current, value);
+			if (previous == current)
+			{
+				break;
+			}
+			current = previous;
+		}
+	}
+
+	static const long long NANOSECONDS_PER_SECOND = 1000000000LL;
+	static const long long NANOSECONDS_PER_MICROSECOND = 1000LL;
+
+	Tizen::Base::String __name;
+	volatile long long __acquireCount;
+	volatile long long __contentionCount;
+	volatile long long __totalWaitTime;
+	volatile long long __maxWaitTime;
+	volatile long long __totalHoldTime;
+	volatile long long __maxHoldTime;
+
+}; // __LockProfile
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_LOCK_STATISTICS_H_
@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+* @file		FBaseRtReadLockGuard.h
+* @brief	This is the header file for the %ReadLockGuard class.
+*
+* This header file contains the declarations of the %ReadLockGuard class.
+*/
+
+#ifndef _FBASE_RT_READ_LOCK_GUARD_H_
+#define _FBASE_RT_READ_LOCK_GUARD_H_
+
+#include <FBaseRtReadWriteLock.h>
+#include <FBaseRtTypes.h>
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+/**
+* @class	ReadLockGuard
+* @brief	This class is the RAII style class for reading with %ReadWriteLock class.
+*
+* @since 2.1
+*
+* The %ReadLockGuard class acquires the specified ReadWriteLock for reading when it is constructed, and releases it when it goes out of scope.
+*
+* @see		ReadWriteLock
+*/
+class ReadLockGuard
+{
+public:
+	/**
+	* This constructor acquires the lock for reading in a blocking way.
+	*
+	* @since 2.1
+	*
+	* @param[in]	lock	The %ReadWriteLock instance to be manipulated
+	* @remarks		The specific error code can be accessed using the GetLastResult() method.
+	* @see			ReadWriteLock::AcquireRead() for detailed exceptions
+	*/
+	ReadLockGuard(ReadWriteLock& lock)
+		: __lock(lock)
+		, __locked(false)
+	{
+		SetLastResult(Lock());
+	}
+
+	/**
+	* This constructor acquires the lock for reading in a non-blocking way.
+	*
+	* @since 2.1
+	*
+	* @param[in]	lock	The %ReadWriteLock instance to be manipulated
+	* @remarks		The specific error code can be accessed using the GetLastResult() method.
+	* @see			ReadWriteLock::TryToAcquireRead() for detailed exceptions
+	*/
+	ReadLockGuard(ReadWriteLock& lock, TryTag)
+		: __lock(lock)
+		, __locked(false)
+	{
+		SetLastResult(TryToLock());
+	}
+
+	/**
+	* This destructor releases the lock if acquired when going out of a scope
+	*
+	* @since 2.1
+	*
+	* @remarks	The specific error code can be accessed using the GetLastResult() method.
+	* @see		ReadWriteLock::Release() for detailed exceptions
+	*/
+	~ReadLockGuard(void)
+	{
+		SetLastResult(Unlock());
+	}
+
+	/**
+	* Returns whether this instance owns the lock on the given lock at constructor.
+	*
+	* @since 2.1
+	*
+	* @return	true if the lock is owned, @n
+	*			false otherwise.
+	*/
+	bool IsLocked(void) const
+	{
+		return __locked;
+	}
+
+	/**
+	* Returns whether this instance owns the lock on the given lock at constructor. @n
+	* Have same effects to calling IsLocked().
+	*
+	* @since 2.1
+	*/
+	operator bool() const
+	{
+		return IsLocked();
+	}
+
+	/**
+	* Acquires the lock manually for reading on the given lock at constructor in a blocking way
+	*
+	* @since 2.1
+	*
+	* @return	An error code.
+	* @see		ReadWriteLock::AcquireRead() for detailed exceptions
+	*/
+	result Lock(void)
+	{
+		return SetLockedAndReturn(__lock.AcquireRead());
+	}
+
+	/**
+	* Acquires the lock manually for reading on the given lock at constructor in a non-blocking way
+	*
+	* @since 2.1
+	*
+	* @return	An error code.
+	* @see		ReadWriteLock::TryToAcquireRead() for detailed exceptions
+	*/
+	result TryToLock(void)
+	{
+		return SetLockedAndReturn(__lock.TryToAcquireRead());
+	}
+
+	/**
+	* Releases the lock manually
+	*
+	* @since 2.1
+	*
+	* @return	An error code.
+	* @see		ReadWriteLock::Release() for detailed exceptions
+	*/
+	result Unlock(void)
+	{
+		result r = E_SUCCESS;
+		if (__locked)
+		{
+			r = __lock.Release();
+			__locked = false;
+		}
+		return r;
+	}
+
+private:
+	/**
+	* The implementation of this copy constructor is intentionally blank and declared as private 
+	* to prohibit copying of objects.
+	*
+	* @since 2.1
+	*/
+	ReadLockGuard(const ReadLockGuard& rhs);
+
+	/**
+	* The implementation of this copy assignment operator is intentionally blank and declared as private
+	* to prohibit copying of objects.
+	*
+	* @since 2.1
+	*/
+	ReadLockGuard& operator =(const ReadLockGuard& rhs);
+
+	// helper function
+	result SetLockedAndReturn(result r)
+	{
+		__locked = (r == E_SUCCESS);
+		return r;
+	}
+
+private:
+	ReadWriteLock& __lock;
+	bool __locked;
+}; // ReadLockGuard
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_READ_LOCK_GUARD_H_
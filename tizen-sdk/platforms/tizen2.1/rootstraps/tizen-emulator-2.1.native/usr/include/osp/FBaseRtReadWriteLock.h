@@ -0,0 +1,393 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtReadWriteLock.h
+ * @brief		This is the header file for the %ReadWriteLock class.
+ *
+ * This header file contains the declarations of the %ReadWriteLock class.
+ */
+#ifndef _FBASE_RT_READ_WRITE_LOCK_H_
+#define _FBASE_RT_READ_WRITE_LOCK_H_
+
+#include <errno.h>
+#include <pthread.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseRtLockStatistics.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+/**
+ * @class	ReadWriteLock
+ * @brief	This class represents a lock that is shared by the readers and is exclusive to a writer.
+ *
+ * @since 2.1
+ *
+ * The %ReadWriteLock class represents a lock that any number of threads can hold for reading at the same time,
+ * while a thread that holds it for writing excludes all the others.
+ * It lets the readers of read-mostly data, such as a configuration or a cache map, run in parallel instead of being serialized by a Mutex. @n
+ * A waiting writer has priority over new readers, so that the writers are not starved by a stream of readers.
+ * The lock is not recursive, and a reader cannot upgrade to a writer. @n
+ * ReadLockGuard and WriteLockGuard release the lock when they go out of scope.
+ *
+ * The following example demonstrates how to use the %ReadWriteLock class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Runtime;
+ *
+ *	class ConfigCache
+ *	{
+ *	public:
+ *		result Construct(void)
+ *		{
+ *			return __lock.Create();
+ *		}
+ *
+ *		String GetValue(const String& key)
+ *		{
+ *			ReadLockGuard guard(__lock);
+ *			// Looks up the key ...
+ *			return String();
+ *		}
+ *
+ *		void SetValue(const String& key, const String& value)
+ *		{
+ *			WriteLockGuard guard(__lock);
+ *			// Updates the key ...
+ *		}
+ *
+ *	private:
+ *		ReadWriteLock __lock;
+ *	};
+ * @endcode
+ */
+class ReadWriteLock
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Create() method must be called explicitly to initialize this instance.
+	 */
+	ReadWriteLock(void)
+		: __isCreated(false)
+		, __isWriteLocked(false)
+		, __writeLockTime(0)
+		, __pProfile(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~ReadWriteLock(void)
+	{
+		if (__isCreated)
+		{
+			pthread_rwlock_destroy(&__lock);
+		}
+		delete __pProfile;
+	}
+
+	/**
+	 * Creates the lock.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	The lock has already been created.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Create(void)
+	{
+		TryReturn(!__isCreated, E_INVALID_OPERATION, "[%s] The lock has already been created.", GetErrorMessage(E_INVALID_OPERATION));
+
+		pthread_rwlockattr_t attribute;
+		pthread_rwlockattr_init(&attribute);
+		pthread_rwlockattr_setkind_np(&attribute, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+
+		int error = pthread_rwlock_init(&__lock, &attribute);
+		pthread_rwlockattr_destroy(&attribute);
+
+		TryReturn(error != ENOMEM, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		TryReturn(error == 0, E_SYSTEM, "[%s] Failed to create the lock(%d).", GetErrorMessage(E_SYSTEM), error);
+
+		__isCreated = true;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Acquires the lock for reading. @n
+	 * If a writer holds or waits for the lock, the current thread is blocked until the writer releases it.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The lock has not been created.
+	 * @exception	E_SYSTEM			A system error has occurred, or the calling thread already holds the lock for writing.
+	 */
+	result AcquireRead(void)
+	{
+		TryReturn(__isCreated, E_INVALID_STATE, "[%s] The lock has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		if (__pProfile == null)
+		{
+			return ConvertResult(pthread_rwlock_rdlock(&__lock));
+		}
+
+		long long startTime = __LockProfile::GetTime();
+		bool isContended = (pthread_rwlock_tryrdlock(&__lock) != 0);
+		if (isContended)
+		{
+			result r = ConvertResult(pthread_rwlock_rdlock(&__lock));
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+		__pProfile->RecordAcquire(__LockProfile::GetTime() - startTime, isContended);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Acquires the lock for reading if it is available at once.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The lock has not been created.
+	 * @exception	E_OBJECT_LOCKED		A writer holds or waits for the lock.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result TryToAcquireRead(void)
+	{
+		TryReturn(__isCreated, E_INVALID_STATE, "[%s] The lock has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		result r = ConvertResult(pthread_rwlock_tryrdlock(&__lock));
+		if (r == E_SUCCESS && __pProfile != null)
+		{
+			__pProfile->RecordAcquire(0, false);
+		}
+
+		return r;
+	}
+
+	/**
+	 * Acquires the lock for writing. @n
+	 * If another thread holds the lock, the current thread is blocked until all the holders release it.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The lock has not been created.
+	 * @exception	E_SYSTEM			A system error has occurred, or the calling thread already holds the lock.
+	 */
+	result AcquireWrite(void)
+	{
+		TryReturn(__isCreated, E_INVALID_STATE, "[%s] The lock has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		if (__pProfile == null)
+		{
+			result r = ConvertResult(pthread_rwlock_wrlock(&__lock));
+			__isWriteLocked = (r == E_SUCCESS);
+			return r;
+		}
+
+		long long startTime = __LockProfile::GetTime();
+		bool isContended = (pthread_rwlock_trywrlock(&__lock) != 0);
+		if (isContended)
+		{
+			result r = ConvertResult(pthread_rwlock_wrlock(&__lock));
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+		OnWriteLocked(startTime, isContended);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Acquires the lock for writing if it is available at once.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The lock has not been created.
+	 * @exception	E_OBJECT_LOCKED		Another thread holds the lock.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result TryToAcquireWrite(void)
+	{
+		TryReturn(__isCreated, E_INVALID_STATE, "[%s] The lock has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		result r = ConvertResult(pthread_rwlock_trywrlock(&__lock));
+		if (r == E_SUCCESS)
+		{
+			if (__pProfile != null)
+			{
+				OnWriteLocked(__LockProfile::GetTime(), false);
+			}
+			else
+			{
+				__isWriteLocked = true;
+			}
+		}
+
+		return r;
+	}
+
+	/**
+	 * Releases the lock held for reading or writing by the current thread.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The lock has not been created.
+	 * @exception	E_SYSTEM			A system error has occurred, or the current thread does not hold the lock.
+	 */
+	result Release(void)
+	{
+		TryReturn(__isCreated, E_INVALID_STATE, "[%s] The lock has not been created.", GetErrorMessage(E_INVALID_STATE));
+
+		// Only the writer can see __isWriteLocked set, because it excludes the readers
+		if (__isWriteLocked)
+		{
+			__isWriteLocked = false;
+			if (__pProfile != null)
+			{
+				__pProfile->RecordHold(__LockProfile::GetTime() - __writeLockTime);
+			}
+		}
+
+		return ConvertResult(pthread_rwlock_unlock(&__lock));
+	}
+
+	/**
+	 * Starts recording the contention statistics of this lock.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	name				The name of the lock in the log
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The lock has not been created.
+	 * @exception	E_INVALID_OPERATION	The profiling has already been enabled.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		This method must be called before the lock is shared by other threads. @n
+	 *				The profiling adds a clock read to each acquisition.
+	 */
+	result EnableProfiling(const Tizen::Base::String& name)
+	{
+		TryReturn(__isCreated, E_INVALID_STATE, "[%s] The lock has not been created.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__pProfile == null, E_INVALID_OPERATION, "[%s] The profiling has already been enabled.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__pProfile = new (std::nothrow) __LockProfile(name);
+		TryReturn(__pProfile != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the contention statistics of this lock.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	statistics			The statistics recorded since EnableProfiling() was called
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		The profiling has not been enabled.
+	 */
+	result GetStatistics(LockStatistics& statistics) const
+	{
+		TryReturn(__pProfile != null, E_INVALID_STATE, "[%s] The profiling has not been enabled.", GetErrorMessage(E_INVALID_STATE));
+
+		__pProfile->GetStatistics(statistics);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Writes the contention statistics of this lock to the log with AppLog().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		Nothing is written if the profiling has not been enabled.
+	 */
+	void LogStatistics(void) const
+	{
+		if (__pProfile != null)
+		{
+			__pProfile->Log();
+		}
+	}
+
+private:
+	ReadWriteLock(const ReadWriteLock& rhs);
+	ReadWriteLock& operator =(const ReadWriteLock& rhs);
+
+	void OnWriteLocked(long long startTime, bool isContended)
+	{
+		__writeLockTime = __LockProfile::GetTime();
+		__isWriteLocked = true;
+		__pProfile->RecordAcquire(__writeLockTime - startTime, isContended);
+	}
+
+	static result ConvertResult(int error)
+	{
+		switch (error)
+		{
+		case 0:
+			return E_SUCCESS;
+
+		case EBUSY:
+			return E_OBJECT_LOCKED;
+
+		default:
+			AppLogException("[%s] The lock operation failed(%d).", GetErrorMessage(E_SYSTEM), error);
+			return E_SYSTEM;
+		}
+	}
+
+	pthread_rwlock_t __lock;
+	bool __isCreated;
+	bool __isWriteLocked;
+	long long __writeLockTime;
+	__LockProfile* __pProfile;
+
+}; // ReadWriteLock
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_READ_WRITE_LOCK_H_
@@ -0,0 +1,954 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseRtThreadPool.h
+ * @brief		This is the header file for the %ThreadPool and %TaskFuture classes.
+ *
+ * This header file contains the declarations of the %ThreadPool and %TaskFuture classes.
+ */
+#ifndef _FBASE_RT_THREAD_POOL_H_
+#define _FBASE_RT_THREAD_POOL_H_
+
+#include <unistd.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtMonitor.h>
+#include <FBaseRtMutex.h>
+#include <FBaseRtMutexGuard.h>
+#include <FBaseRtThread.h>
+
+
+namespace Tizen { namespace Base { namespace Runtime
+{
+
+class ThreadPool;
+
+//
+// @class	__TaskFutureState
+// @brief	This class holds the completion state and the result of a task, which is shared by the pool and a %TaskFuture.
+// @since 2.1
+//
+class __TaskFutureState
+{
+public:
+	__TaskFutureState(void)
+		: __refCount(1)
+		, __isDone(false)
+		, __pResult(null)
+	{
+	}
+
+	result Construct(void)
+	{
+		return __monitor.Construct();
+	}
+
+	void AddRef(void)
+	{
+		__sync_add_and_fetch(&__refCount, 1);
+	}
+
+	// Deletes this instance and the result which has not been taken when the last reference is released
+	void Release(void)
+	{
+		if (__sync_sub_and_fetch(&__refCount, 1) == 0)
+		{
+			delete __pResult;
+			delete this;
+		}
+	}
+
+	void Complete(Object* pResult)
+	{
+		__monitor.Enter();
+		__pResult = pResult;
+		__isDone = true;
+		__monitor.NotifyAll();
+		__monitor.Exit();
+	}
+
+	void Wait(void)
+	{
+		__monitor.Enter();
+		while (!__isDone)
+		{
+			__monitor.Wait();
+		}
+		__monitor.Exit();
+	}
+
+	bool IsDone(void)
+	{
+		__monitor.Enter();
+		bool isDone = __isDone;
+		__monitor.Exit();
+
+		return isDone;
+	}
+
+	Object* DetachResult(void)
+	{
+		__monitor.Enter();
+		Object* pResult = __pResult;
+		__pResult = null;
+		__monitor.Exit();
+
+		return pResult;
+	}
+
+private:
+	__TaskFutureState(const __TaskFutureState& rhs);
+	__TaskFutureState& operator =(const __TaskFutureState& rhs);
+
+	~__TaskFutureState(void)
+	{
+	}
+
+	volatile int __refCount;
+	bool __isDone;
+	Object* __pResult;
+	Monitor __monitor;
+
+}; // __TaskFutureState
+
+/**
+ * @class	TaskFuture
+ * @brief	This class represents the completion of a task submitted to a %ThreadPool.
+ *
+ * @since 2.1
+ *
+ * The %TaskFuture class represents the completion of a task submitted to a ThreadPool.
+ * It is used to wait for the task and to take the object returned by IRunnable::Run(). @n
+ * An instance is created by ThreadPool::SubmitN() or ThreadPool::SubmitFunctorN(), and can be deleted at any time,
+ * even before the task completes.
+ *
+ * @see	ThreadPool
+ */
+class TaskFuture
+	: public Object
+{
+public:
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		If the result of the task has not been taken by GetResultN(), it is deleted when the task completes.
+	 */
+	virtual ~TaskFuture(void)
+	{
+		__pState->Release();
+	}
+
+	/**
+	 * Waits until the task completes.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		Waiting for a task of the same pool from inside a task can deadlock if all the workers wait.
+	 */
+	void Wait(void)
+	{
+		__pState->Wait();
+	}
+
+	/**
+	 * Checks whether the task has completed.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if the task has completed, @n
+	 *				else @c false
+	 */
+	bool IsDone(void) const
+	{
+		return __pState->IsDone();
+	}
+
+	/**
+	 * Waits until the task completes and takes the object returned by IRunnable::Run().
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The object returned by the task, @n
+	 *				else @c null if the task returned @c null or the result has already been taken
+	 * @remarks		The ownership of the object is transferred to the caller.
+	 */
+	Object* GetResultN(void)
+	{
+		__pState->Wait();
+		return __pState->DetachResult();
+	}
+
+private:
+	explicit TaskFuture(__TaskFutureState* pState)
+		: __pState(pState)
+	{
+	}
+
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	TaskFuture(const TaskFuture& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	TaskFuture& operator =(const TaskFuture& rhs);
+
+	__TaskFutureState* __pState;
+
+	friend class ThreadPool;
+
+}; // TaskFuture
+
+//
+// @struct	__ThreadPoolTask
+// @brief	This struct is a node of a task queued in a %ThreadPool.
+// @since 2.1
+//
+struct __ThreadPoolTask
+{
+	IRunnable* pRunnable;
+	bool ownsRunnable;
+	__TaskFutureState* pFuture;
+	__ThreadPoolTask* pNext;
+};
+
+//
+// @class	__FunctorTaskT
+// @brief	This class adapts a functor to IRunnable.
+// @since 2.1
+//
+template< class Functor >
+class __FunctorTaskT
+	: public IRunnable
+{
+public:
+	explicit __FunctorTaskT(const Functor& functor)
+		: __functor(functor)
+	{
+	}
+
+	virtual ~__FunctorTaskT(void)
+	{
+	}
+
+	virtual Object* Run(void)
+	{
+		__functor();
+		return null;
+	}
+
+private:
+	__FunctorTaskT(const __FunctorTaskT& rhs);
+	__FunctorTaskT& operator =(const __FunctorTaskT& rhs);
+
+	Functor __functor;
+
+}; // __FunctorTaskT
+
+//
+// @class	__WorkStealingDeque
+// @brief	This class is a bounded lock-free deque of tasks, which is owned by a worker and stolen from by the others.
+// @since 2.1
+//
+// This is the Chase-Lev deque with a fixed capacity. The owner pushes and pops at the bottom without a lock,
+// and the other workers steal from the top with a compare-and-swap. Push() fails when the deque is full,
+// in which case the pool falls back to its shared queue.
+// The indices are unsigned so that they wrap around safely, and are compared by their difference.
+//
+class __WorkStealingDeque
+{
+public:
+	__WorkStealingDeque(void)
+		: __top(0)
+		, __bottom(0)
+	{
+	}
+
+	// Called only by the owner
+	bool Push(__ThreadPoolTask* pTask)
+	{
+		unsigned int bottom = __bottom;
+		if (static_cast< int >(bottom - __top) >= CAPACITY)
+		{
+			return false;
+		}
+
+		__pTasks[bottom & MASK] = pTask;
+		__sync_synchronize();
+		__bottom = bottom + 1;
+
+		return true;
+	}
+
+	// Called only by the owner
+	__ThreadPoolTask* Pop(void)
+	{
+		unsigned int bottom = __bottom - 1;
+		__bottom = bottom;
+		__sync_synchronize();
+		unsigned int top = __top;
+
+		if (static_cast< int >(bottom - top) < 0)
+		{
+			__bottom = top;
+			return null;
+		}
+
+		__ThreadPoolTask* pTask = __pTasks[bottom & MASK];
+		if (bottom == top)
+		{
+			// The last task races with the thieves
+			if (!__sync_bool_compare_and_swap(&__top, top, top + 1))
+			{
+				pTask = null;
+			}
+			__bottom = top + 1;
+		}
+
+		return pTask;
+	}
+
+	// Called by the other workers
+	__ThreadPoolTask* Steal(void)
+	{
+		unsigned int top = __top;
+		__sync_synchronize();
+		unsigned int bottom = __bottom;
+
+		if (static_cast< int >(bottom - top) <= 0)
+		{
+			return null;
+		}
+
+		__ThreadPoolTask* pTask = __pTasks[top & MASK];
+		if (!__sync_bool_compare_and_swap(&__top, top, top + 1))
+		{
+			return null;
+		}
+
+		return pTask;
+	}
+
+private:
+	__WorkStealingDeque(const __WorkStealingDeque& rhs);
+	__WorkStealingDeque& operator =(const __WorkStealingDeque& rhs);
+
+	static const int CAPACITY = 1024;
+	static const unsigned int MASK = CAPACITY - 1;
+
+	volatile unsigned int __top;
+	volatile unsigned int __bottom;
+	__ThreadPoolTask* volatile __pTasks[CAPACITY];
+
+}; // __WorkStealingDeque
+
+//
+// @class	__ThreadPoolWorker
+// @brief	This class is a worker of a %ThreadPool, which owns a deque of tasks.
+// @since 2.1
+//
+class __ThreadPoolWorker
+	: public IRunnable
+{
+public:
+	__ThreadPoolWorker(void)
+		: pPool(null)
+		, index(0)
+	{
+	}
+
+	virtual ~__ThreadPoolWorker(void)
+	{
+	}
+
+	virtual Object* Run(void);
+
+	// Returns the worker that runs on the calling thread, or null
+	static __ThreadPoolWorker*& GetCurrent(void)
+	{
+		static __thread __ThreadPoolWorker* pCurrent = null;
+		return pCurrent;
+	}
+
+	ThreadPool* pPool;
+	int index;
+	__WorkStealingDeque deque;
+
+private:
+	__ThreadPoolWorker(const __ThreadPoolWorker& rhs);
+	__ThreadPoolWorker& operator =(const __ThreadPoolWorker& rhs);
+
+}; // __ThreadPoolWorker
+
+/**
+ * @class	ThreadPool
+ * @brief	This class runs tasks on a fixed set of worker threads that steal work from each other.
+ *
+ * @since 2.1
+ *
+ * The %ThreadPool class runs tasks on a fixed set of worker threads, so that a background job does not pay for creating a Thread.
+ * A task is an IRunnable instance or a functor. A task submitted from a worker is pushed to the lock-free deque of that worker,
+ * and an idle worker steals tasks from the others, so that nested tasks are spread over all the workers. @n
+ * The tasks run on worker threads, not on the main thread of a UiApp or ServiceApp.
+ * They must not access the UI controls, and must post their results back to the main thread, for example with Thread::SendUserEvent().
+ *
+ * The following example demonstrates how to use the %ThreadPool class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Runtime;
+ *
+ *	class DecodeTask
+ *		: public IRunnable
+ *	{
+ *	public:
+ *		virtual Object* Run(void)
+ *		{
+ *			// Decodes an image and returns it ...
+ *			return null;
+ *		}
+ *	};
+ *
+ *	void
+ *	MyClass::ThreadPoolSample(void)
+ *	{
+ *		ThreadPool pool;
+ *		DecodeTask task;
+ *
+ *		pool.Construct();
+ *
+ *		TaskFuture* pFuture = pool.SubmitN(task);
+ *		if (pFuture != null)
+ *		{
+ *			Object* pResult = pFuture->GetResultN();
+ *			// ...
+ *			delete pResult;
+ *			delete pFuture;
+ *		}
+ *	}
+ * @endcode
+ */
+class ThreadPool
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	ThreadPool(void)
+		: __pWorkers(null)
+		, __pThreads(null)
+		, __workerCount(0)
+		, __startedCount(0)
+		, __pQueueHead(null)
+		, __pQueueTail(null)
+		, __pendingCount(0)
+		, __idleCount(0)
+		, __isShuttingDown(false)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		The destructor waits until all the submitted tasks complete.
+	 */
+	virtual ~ThreadPool(void)
+	{
+		Shutdown();
+	}
+
+	/**
+	 * Initializes this instance of %ThreadPool with the specified number of workers.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	workerCount			The number of worker threads @n
+	 *									If it is @c 0, the number of online processors is used.
+	 * @param[in]	stackSize			The stack size of the worker threads
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c workerCount is negative or greater than @c 64.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(int workerCount = 0, long stackSize = Thread::DEFAULT_STACK_SIZE)
+	{
+		TryReturn(__pWorkers == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(workerCount >= 0 && workerCount <= MAX_WORKER_COUNT, E_INVALID_ARG,
+			"[%s] The workerCount(%d) MUST be between 0 and %d.", GetErrorMessage(E_INVALID_ARG), workerCount, MAX_WORKER_COUNT);
+
+		if (workerCount == 0)
+		{
+			long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+			workerCount = (processorCount > 0) ? static_cast< int >(processorCount) : 1;
+			workerCount = (workerCount < MAX_WORKER_COUNT) ? workerCount : MAX_WORKER_COUNT;
+		}
+
+		result r = __queueMutex.Create();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __idleMonitor.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pWorkers = new (std::nothrow) __ThreadPoolWorker[workerCount];
+		__pThreads = new (std::nothrow) Thread[workerCount];
+		TryCatch(__pWorkers != null && __pThreads != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		for (int i = 0; i < workerCount; i++)
+		{
+			__pWorkers[i].pPool = this;
+			__pWorkers[i].index = i;
+		}
+
+		// The workers see __workerCount only through the barrier of Thread::Start()
+		__workerCount = workerCount;
+
+		for (int i = 0; i < workerCount; i++)
+		{
+			r = __pThreads[i].Construct(__pWorkers[i], stackSize);
+			if (r == E_SUCCESS)
+			{
+				r = __pThreads[i].Start();
+			}
+
+			if (r != E_SUCCESS)
+			{
+				AppLogException("[%s] Failed to start the worker(%d).", GetErrorMessage(r), i);
+
+				__startedCount = i;
+				Shutdown();
+				return r;
+			}
+		}
+		__startedCount = workerCount;
+
+		return E_SUCCESS;
+
+CATCH:
+		delete[] __pWorkers;
+		__pWorkers = null;
+		delete[] __pThreads;
+		__pThreads = null;
+
+		return r;
+	}
+
+	/**
+	 * Submits the specified task.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	task				The task to run @n
+	 *									It must be valid until it completes.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or is shutting down.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The object returned by IRunnable::Run() is deleted by the pool.
+	 */
+	result Submit(IRunnable& task)
+	{
+		return Enqueue(&task, false, null);
+	}
+
+	/**
+	 * Submits the specified task and gets a future to wait for it.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A pointer to the TaskFuture instance, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	task				The task to run @n
+	 *									It must be valid until it completes.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or is shutting down.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	TaskFuture* SubmitN(IRunnable& task)
+	{
+		return EnqueueN(&task, false);
+	}
+
+	/**
+	 * Submits a copy of the specified functor as a task.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	functor				The functor to call with no argument @n
+	 *									Its return value is ignored.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or is shutting down.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	template< class Functor >
+	result SubmitFunctor(const Functor& functor)
+	{
+		__FunctorTaskT< Functor >* pTask = new (std::nothrow) __FunctorTaskT< Functor >(functor);
+		TryReturn(pTask != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return Enqueue(pTask, true, null);
+	}
+
+	/**
+	 * Submits a copy of the specified functor as a task and gets a future to wait for it.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A pointer to the TaskFuture instance, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	functor				The functor to call with no argument @n
+	 *									Its return value is ignored, and TaskFuture::GetResultN() returns @c null.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or is shutting down.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	template< class Functor >
+	TaskFuture* SubmitFunctorN(const Functor& functor)
+	{
+		__FunctorTaskT< Functor >* pTask = new (std::nothrow) __FunctorTaskT< Functor >(functor);
+		TryReturnResult(pTask != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		return EnqueueN(pTask, true);
+	}
+
+	/**
+	 * Gets the number of worker threads.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of worker threads
+	 */
+	int GetWorkerCount(void) const
+	{
+		return __workerCount;
+	}
+
+	/**
+	 * Waits until all the submitted tasks complete, and stops the worker threads.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After this method is called, only the running tasks can submit tasks. @n
+	 *				This method must not be called from a task of this pool.
+	 */
+	void Shutdown(void)
+	{
+		if (__pWorkers == null)
+		{
+			return;
+		}
+
+		{
+			// Enqueue() reads the flag under the queue mutex and WaitForTask() under the idle monitor, so it is written under both.
+			// A task submitted from another thread is either queued before this point and drained, or rejected.
+			MutexGuard lock(__queueMutex);
+
+			__idleMonitor.Enter();
+			__isShuttingDown = true;
+			__idleMonitor.NotifyAll();
+			__idleMonitor.Exit();
+		}
+
+		for (int i = 0; i < __startedCount; i++)
+		{
+			__pThreads[i].Join();
+		}
+
+		delete[] __pThreads;
+		__pThreads = null;
+		delete[] __pWorkers;
+		__pWorkers = null;
+		__workerCount = 0;
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ThreadPool(const ThreadPool& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ThreadPool& operator =(const ThreadPool& rhs);
+
+	TaskFuture* EnqueueN(IRunnable* pRunnable, bool ownsRunnable)
+	{
+		result r = E_SUCCESS;
+		TaskFuture* pFuture = null;
+		__TaskFutureState* pState = new (std::nothrow) __TaskFutureState();
+		TryCatch(pState != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pState->Construct();
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		pFuture = new (std::nothrow) TaskFuture(pState);
+		TryCatch(pFuture != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		// The pool holds a reference until the task completes
+		pState->AddRef();
+		r = Enqueue(pRunnable, ownsRunnable, pState);
+		if (r != E_SUCCESS)
+		{
+			delete pFuture;
+			pState->Release();
+			SetLastResult(r);
+			return null;
+		}
+
+		SetLastResult(E_SUCCESS);
+		return pFuture;
+
+CATCH:
+		if (pState != null)
+		{
+			pState->Release();
+		}
+
+		if (ownsRunnable)
+		{
+			delete pRunnable;
+		}
+
+		SetLastResult(r);
+		return null;
+	}
+
+	// Takes the ownership of pRunnable and a reference of pState even if it fails
+	result Enqueue(IRunnable* pRunnable, bool ownsRunnable, __TaskFutureState* pState)
+	{
+		result r = E_SUCCESS;
+		__ThreadPoolWorker* pWorker = __ThreadPoolWorker::GetCurrent();
+		bool isWorker = (pWorker != null && pWorker->pPool == this);
+
+		__ThreadPoolTask* pTask = new (std::nothrow) __ThreadPoolTask;
+		TryCatch(pTask != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		pTask->pRunnable = pRunnable;
+		pTask->ownsRunnable = ownsRunnable;
+		pTask->pFuture = pState;
+		pTask->pNext = null;
+
+		if (isWorker)
+		{
+			// Counted before the task becomes visible, so that no worker stops while it is queued
+			__sync_add_and_fetch(&__pendingCount, 1);
+
+			// The running tasks can still submit tasks during the shutdown
+			if (!pWorker->deque.Push(pTask))
+			{
+				MutexGuard lock(__queueMutex);
+				Append(pTask);
+			}
+		}
+		else
+		{
+			MutexGuard lock(__queueMutex);
+
+			TryCatch(!__isShuttingDown && __pWorkers != null, r = E_INVALID_STATE,
+				"[%s] This instance has not been constructed or is shutting down.", GetErrorMessage(E_INVALID_STATE));
+
+			__sync_add_and_fetch(&__pendingCount, 1);
+			Append(pTask);
+		}
+
+		// Pairs with the barrier in WaitForTask(), so that either this thread sees the idle worker or the worker sees the task
+		if (__idleCount > 0)
+		{
+			__idleMonitor.Enter();
+			__idleMonitor.Notify();
+			__idleMonitor.Exit();
+		}
+
+		return E_SUCCESS;
+
+CATCH:
+		delete pTask;
+
+		if (pState != null)
+		{
+			pState->Release();
+		}
+
+		if (ownsRunnable)
+		{
+			delete pRunnable;
+		}
+
+		return r;
+	}
+
+	// Appends the task to the shared queue. The mutex must be held.
+	void Append(__ThreadPoolTask* pTask)
+	{
+		if (__pQueueTail != null)
+		{
+			__pQueueTail->pNext = pTask;
+		}
+		else
+		{
+			__pQueueHead = pTask;
+		}
+		__pQueueTail = pTask;
+	}
+
+	__ThreadPoolTask* FindTask(__ThreadPoolWorker& worker)
+	{
+		__ThreadPoolTask* pTask = worker.deque.Pop();
+		if (pTask != null)
+		{
+			return pTask;
+		}
+
+		if (__pQueueHead != null)
+		{
+			MutexGuard lock(__queueMutex);
+
+			pTask = __pQueueHead;
+			if (pTask != null)
+			{
+				__pQueueHead = pTask->pNext;
+				if (__pQueueHead == null)
+				{
+					__pQueueTail = null;
+				}
+				return pTask;
+			}
+		}
+
+		for (int i = 1; i < __workerCount; i++)
+		{
+			pTask = __pWorkers[(worker.index + i) % __workerCount].deque.Steal();
+			if (pTask != null)
+			{
+				return pTask;
+			}
+		}
+
+		return null;
+	}
+
+	// Returns false if the worker must stop
+	bool WaitForTask(void)
+	{
+		__idleMonitor.Enter();
+
+		__sync_add_and_fetch(&__idleCount, 1);
+		if (__pendingCount == 0 && !__isShuttingDown)
+		{
+			__idleMonitor.Wait();
+		}
+		__sync_sub_and_fetch(&__idleCount, 1);
+
+		bool isStopping = (__isShuttingDown && __pendingCount == 0);
+
+		__idleMonitor.Exit();
+
+		return !isStopping;
+	}
+
+	static void Execute(__ThreadPoolTask* pTask)
+	{
+		Object* pResult = pTask->pRunnable->Run();
+
+		if (pTask->pFuture != null)
+		{
+			pTask->pFuture->Complete(pResult);
+			pTask->pFuture->Release();
+		}
+		else
+		{
+			delete pResult;
+		}
+
+		if (pTask->ownsRunnable)
+		{
+			delete pTask->pRunnable;
+		}
+
+		delete pTask;
+	}
+
+	void RunWorker(__ThreadPoolWorker& worker)
+	{
+		__ThreadPoolWorker::GetCurrent() = &worker;
+
+		do
+		{
+			__ThreadPoolTask* pTask = FindTask(worker);
+			while (pTask != null)
+			{
+				__sync_sub_and_fetch(&__pendingCount, 1);
+				Execute(pTask);
+
+				pTask = FindTask(worker);
+			}
+		}
+		while (WaitForTask());
+
+		__ThreadPoolWorker::GetCurrent() = null;
+	}
+
+	__ThreadPoolWorker* __pWorkers;
+	Thread* __pThreads;
+	int __workerCount;
+	int __startedCount;
+	Mutex __queueMutex;
+	__ThreadPoolTask* volatile __pQueueHead;
+	__ThreadPoolTask* __pQueueTail;
+	Monitor __idleMonitor;
+	volatile int __pendingCount;
+	volatile int __idleCount;
+	volatile bool __isShuttingDown;
+
+	static const int MAX_WORKER_COUNT = 64;
+
+	friend class __ThreadPoolWorker;
+
+}; // ThreadPool
+
+inline Object*
+__ThreadPoolWorker::Run(void)
+{
+	pPool->RunWorker(*this);
+	return null;
+}
+
+}}} // Tizen::Base::Runtime
+
+#endif // _FBASE_RT_THREAD_POOL_H_
@@ -43,6 +43,30 @@ enum TimerStatus
 	TIMER_STATUS_ACTIVATED_REPEATABLE,       // This enum value is for internal use only. Using this enum can cause behavioral, security-related, and consistency-related issues in the application.
 };
 
+/**
+ *	@enum	DispatchPriority
+ *	Defines the priorities of the concurrent dispatch queues.
+ *	@since 2.1
+ */
+enum DispatchPriority
+{
+	DISPATCH_PRIORITY_HIGH = 0,     /**< The queue for the tasks which run before the default and low priority tasks */
+	DISPATCH_PRIORITY_DEFAULT,      /**< The queue for the tasks of the default priority */
+	DISPATCH_PRIORITY_LOW           /**< The queue for the tasks which run after the high and default priority tasks */
+};
+
+/**
+ *	@enum	DispatchSourceType
+ *	Defines the types of the events that are delivered by a DispatchSource.
+ *	@since 2.1
+ */
+enum DispatchSourceType
+{
+	DISPATCH_SOURCE_TIMER = 0,      /**< The timer expires */
+	DISPATCH_SOURCE_READ,           /**< The file descriptor has data to read */
+	DISPATCH_SOURCE_WRITE           /**< The file descriptor has buffer space to write */
+};
+
 /**
 * @struct	TryTag
 * @brief	This struct is used only for supporting non-blocking acquisition of a resource
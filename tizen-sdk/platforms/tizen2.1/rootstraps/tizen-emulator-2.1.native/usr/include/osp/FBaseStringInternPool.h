@@ -0,0 +1,363 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseStringInternPool.h
+ * @brief		This is the header file for the %InternedString and %StringInternPool classes.
+ *
+ * This header file contains the declarations of the %InternedString and %StringInternPool classes.
+ */
+#ifndef _FBASE_STRING_INTERN_POOL_H_
+#define _FBASE_STRING_INTERN_POOL_H_
+
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseString.h>
+#include <FBaseColFlatHashMapT.h>
+#include <FBaseRtMutex.h>
+#include <FBaseRtMutexGuard.h>
+
+
+namespace Tizen { namespace Base
+{
+
+class StringInternPool;
+
+/**
+ * @class	InternedString
+ * @brief	This class is a handle to the canonical instance of a string in a %StringInternPool.
+ *
+ * @since	2.1
+ *
+ * The %InternedString class is a handle to the canonical instance of a string in a StringInternPool.
+ * Two handles from the same pool are equal if and only if they refer to the same canonical instance,
+ * so that the equality test is a pointer comparison instead of a character-by-character comparison. @n
+ * The handle is as small as a pointer and can be copied freely. A default-constructed handle refers to no string.
+ *
+ * @see		StringInternPool
+ */
+class InternedString
+{
+public:
+	/**
+	 * Initializes an instance of %InternedString that refers to no string.
+	 *
+	 * @since	2.1
+	 */
+	InternedString(void)
+		: __pString(null)
+	{
+	}
+
+	/**
+	 * Gets the canonical instance of the string.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the canonical instance, @n
+	 *				else @c null if this handle refers to no string
+	 * @remarks		The instance remains valid as long as the pool that created this handle.
+	 */
+	const String* GetString(void) const
+	{
+		return __pString;
+	}
+
+	/**
+	 * Gets the hash value of the string.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The hash value of the string, @n
+	 *				else @c 0 if this handle refers to no string
+	 * @remarks		The hash value is cached by the canonical instance, so that it is computed only once per pool entry.
+	 */
+	int GetHashCode(void) const
+	{
+		return (__pString != null) ? __pString->GetHashCode() : 0;
+	}
+
+	/**
+	 * Checks whether the two handles refer to the same canonical instance.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the two handles refer to the same canonical instance, @n
+	 *				else @c false
+	 * @param[in]	rhs		The handle to compare with
+	 * @remarks		The handles must be created by the same pool.
+	 */
+	bool operator ==(const InternedString& rhs) const
+	{
+		return __pString == rhs.__pString;
+	}
+
+	/**
+	 * Checks whether the two handles refer to different canonical instances.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the two handles refer to different canonical instances, @n
+	 *				else @c false
+	 * @param[in]	rhs		The handle to compare with
+	 */
+	bool operator !=(const InternedString& rhs) const
+	{
+		return __pString != rhs.__pString;
+	}
+
+private:
+	explicit InternedString(const String* pString)
+		: __pString(pString)
+	{
+	}
+
+	const String* __pString;
+
+	friend class StringInternPool;
+
+}; // InternedString
+
+/**
+ * @class	StringInternPool
+ * @brief	This class maps equal strings to a single canonical instance.
+ *
+ * @since	2.1
+ *
+ * The %StringInternPool class maps equal strings to a single canonical instance.
+ * All copies of an interned string share the character buffer of the canonical instance,
+ * and the returned InternedString handles are compared by pointer. @n
+ * This is useful for the strings that are short and repeated, such as the keys of a map or the texts of list items.
+ * The %String class itself cannot store short strings inline, because its layout is fixed by the platform binary.
+ *
+ * The pool is thread-safe. The canonical instances are never removed and are deleted when the pool is deleted.
+ *
+ * The following example demonstrates how to use the %StringInternPool class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *
+ *	using namespace Tizen::Base;
+ *
+ *	void
+ *	MyClass::StringInternPoolSample(void)
+ *	{
+ *		StringInternPool* pPool = StringInternPool::GetInstance();
+ *
+ *		InternedString key1 = pPool->Intern(L"Title");
+ *		InternedString key2 = pPool->Intern(String(L"Title"));
+ *
+ *		if (key1 == key2)	// A pointer comparison
+ *		{
+ *			AppLog("%ls", key1.GetString()->GetPointer());
+ *		}
+ *	}
+ * @endcode
+ */
+class StringInternPool
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	StringInternPool(void)
+		: __isConstructed(false)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		All the canonical instances are deleted, so that the handles created by this pool become invalid.
+	 */
+	virtual ~StringInternPool(void)
+	{
+		for (Collection::FlatHashMapT< String, String* >::ConstIterator iter = __table.begin(); iter != __table.end(); ++iter)
+		{
+			delete iter->GetValue();
+		}
+	}
+
+	/**
+	 * Initializes this instance of %StringInternPool.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(void)
+	{
+		TryReturn(!__isConstructed, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		result r = __table.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __mutex.Create();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__isConstructed = true;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the handle to the canonical instance of the specified string. @n
+	 * If the pool has no string equal to @c str, a copy of @c str becomes the canonical instance.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The handle to the canonical instance, @n
+	 *				else a handle that refers to no string if an exception occurs
+	 * @param[in]	str		The string to intern
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_INVALID_OPERATION	This instance has not been constructed.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	InternedString Intern(const String& str)
+	{
+		result r = E_SUCCESS;
+		String* pCanonical = null;
+
+		TryCatch(__isConstructed, r = E_INVALID_OPERATION, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		{
+			Runtime::MutexGuard lock(__mutex);
+
+			if (__table.GetValue(str, pCanonical) == E_SUCCESS)
+			{
+				SetLastResult(E_SUCCESS);
+				return InternedString(pCanonical);
+			}
+
+			pCanonical = new String(str);
+			TryCatch(pCanonical != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			// The key shares the character buffer with the canonical instance
+			r = __table.Add(*pCanonical, pCanonical);
+			TryCatch(r == E_SUCCESS, delete pCanonical, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		SetLastResult(E_SUCCESS);
+		return InternedString(pCanonical);
+
+CATCH:
+		SetLastResult(r);
+		return InternedString();
+	}
+
+	/**
+	 * Gets the handle to the canonical instance of the specified string, if it has already been interned.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The handle to the canonical instance, @n
+	 *				else a handle that refers to no string if @c str has not been interned
+	 * @param[in]	str		The string to find
+	 * @remarks		Unlike Intern(), this method never adds a string to the pool.
+	 */
+	InternedString Find(const String& str) const
+	{
+		String* pCanonical = null;
+
+		if (__isConstructed)
+		{
+			Runtime::MutexGuard lock(__mutex);
+			__table.GetValue(str, pCanonical);
+		}
+
+		return InternedString(pCanonical);
+	}
+
+	/**
+	 * Gets the number of canonical instances in the pool.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of canonical instances
+	 */
+	int GetCount(void) const
+	{
+		if (!__isConstructed)
+		{
+			return 0;
+		}
+
+		Runtime::MutexGuard lock(__mutex);
+		return __table.GetCount();
+	}
+
+	/**
+	 * Gets the process-wide instance of %StringInternPool.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the process-wide instance, @n
+	 *				else @c null if it failed to be constructed
+	 * @remarks		The instance is constructed on first use and is never deleted.
+	 */
+	static StringInternPool* GetInstance(void)
+	{
+		static StringInternPool* pInstance = CreateInstance();
+		return pInstance;
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	StringInternPool(const StringInternPool& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	StringInternPool& operator =(const StringInternPool& rhs);
+
+	static StringInternPool* CreateInstance(void)
+	{
+		StringInternPool* pPool = new StringInternPool();
+		TryReturn(pPool != null, null, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pPool->Construct();
+		if (IsFailed(r))
+		{
+			delete pPool;
+			return null;
+		}
+
+		return pPool;
+	}
+
+	Collection::FlatHashMapT< String, String* > __table;
+	mutable Runtime::Mutex __mutex;
+	bool __isConstructed;
+
+}; // StringInternPool
+
+}} // Tizen::Base
+
+#endif // _FBASE_STRING_INTERN_POOL_H_
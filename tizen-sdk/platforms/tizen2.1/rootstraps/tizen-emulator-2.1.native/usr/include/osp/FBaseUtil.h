@@ -33,6 +33,9 @@
 // StringUtil
 #include <FBaseUtilStringUtil.h>
 
+// WideStringUtil
+#include <FBaseUtilWideStringUtil.h>
+
 // Uri
 #include <FBaseUtilUri.h>
 
@@ -0,0 +1,335 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilDeflateStream.h
+ * @brief		This is the header file for the %DeflateStream class.
+ *
+ * This header file contains the declarations of the %DeflateStream class.
+ */
+#ifndef _FBASE_UTIL_DEFLATE_STREAM_H_
+#define _FBASE_UTIL_DEFLATE_STREAM_H_
+
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseUtilTypes.h>
+#include <FBaseUtilZStream.h>
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+/**
+ * @class	DeflateStream
+ * @brief	This class provides the incremental deflate functionality using zlib.
+ *
+ * @since 2.1
+ *
+ * The %DeflateStream class provides the incremental deflate functionality using zlib.
+ * Unlike Deflator::DeflateN(), it takes the input in chunks and writes the deflated data into the buffers owned by the caller,
+ * so that the memory usage is bounded by the size of the chunks rather than by the size of the whole data. @n
+ * Each method reads from the current position to the limit of the input buffer, writes from the current position to the limit of the output buffer,
+ * and advances the positions of both buffers by the number of bytes read and written.
+ * When a method returns @c E_OVERFLOW, the output buffer is full: the caller must drain it and call the method again.
+ *
+ * This header is not included from FBaseUtil.h, because it needs the zlib.h header, which the SDK does not provide.
+ * The application must include this header directly, and must be built with zlib.h and linked with zlib.
+ *
+ * The following example demonstrates how to use the %DeflateStream class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *	#include <FIo.h>
+ *	#include <FBaseUtilDeflateStream.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Utility;
+ *	using namespace Tizen::Io;
+ *
+ *	void
+ *	MyClass::DeflateStreamSample(File& src, File& dst)
+ *	{
+ *		DeflateStream stream;
+ *		ByteBuffer input;
+ *		ByteBuffer output;
+ *
+ *		stream.Construct(DEFAULT_COMPRESSION, COMPRESSION_FORMAT_GZIP);
+ *		input.Construct(64 * 1024);
+ *		output.Construct(64 * 1024);
+ *
+ *		while (src.Read(input) == E_SUCCESS)
+ *		{
+ *			input.Flip();
+ *			while (stream.Update(input, output) == E_OVERFLOW)
+ *			{
+ *				output.Flip();
+ *				dst.Write(output);
+ *				output.Clear();
+ *			}
+ *			input.Clear();
+ *		}
+ *
+ *		result r = E_OVERFLOW;
+ *		while (r == E_OVERFLOW)
+ *		{
+ *			r = stream.Finish(output);
+ *			output.Flip();
+ *			dst.Write(output);
+ *			output.Clear();
+ *		}
+ *	}
+ * @endcode
+ *
+ * @see	InflateStream
+ */
+class DeflateStream
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	DeflateStream(void)
+		: __isConstructed(false)
+		, __isFinished(false)
+		, __totalInputSize(0)
+		, __totalOutputSize(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~DeflateStream(void)
+	{
+		if (__isConstructed)
+		{
+			deflateEnd(&__stream);
+		}
+	}
+
+	/**
+	 * Initializes this instance of %DeflateStream with the specified compression level and format.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	level				Set to @c BEST_SPEED or @c BEST_COMPRESSION @n
+	 *									By default, it is set to @c DEFAULT_COMPRESSION.
+	 * @param[in]	format				The framing of the deflated data @n
+	 *									By default, it is set to @c COMPRESSION_FORMAT_ZLIB, which is the same as that of Deflator.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(CompressionLevel level = DEFAULT_COMPRESSION, CompressionFormat format = COMPRESSION_FORMAT_ZLIB)
+	{
+		TryReturn(!__isConstructed, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__stream.zalloc = Z_NULL;
+		__stream.zfree = Z_NULL;
+		__stream.opaque = Z_NULL;
+		__stream.next_in = Z_NULL;
+		__stream.avail_in = 0;
+
+		int zResult = deflateInit2(&__stream, __ZStream::GetLevel(level), Z_DEFLATED, __ZStream::GetWindowBits(format), MEMORY_LEVEL, Z_DEFAULT_STRATEGY);
+		result r = __ZStream::ConvertResult(zResult);
+		TryReturn(zResult == Z_OK, r, "[%s] Failed to initialize the deflate stream.", GetErrorMessage(r));
+
+		__isConstructed = true;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Deflates the remaining part of the input buffer into the output buffer.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in,out]	input			The buffer to deflate
+	 * @param[in,out]	output			The buffer to store the deflated data
+	 * @exception	E_SUCCESS			The method is successful and all the remaining bytes of @c input have been read.
+	 * @exception	E_OVERFLOW			The @c output is full before all the remaining bytes of @c input are read. @n
+	 *									Drain @c output and call this method again with the same @c input.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Finish() has already completed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		The deflated data may be kept in this instance until enough input is accumulated.
+	 *				Call Flush() or Finish() to write it.
+	 */
+	result Update(ByteBuffer& input, ByteBuffer& output)
+	{
+		int zResult = Z_OK;
+		result r = Process(&input, output, Z_NO_FLUSH, zResult);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return (input.GetRemaining() > 0) ? E_OVERFLOW : E_SUCCESS;
+	}
+
+	/**
+	 * Writes all the data deflated so far into the output buffer, aligned to a byte boundary.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in,out]	output			The buffer to store the deflated data
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OVERFLOW			The @c output is full before all the data is written. @n
+	 *									Drain @c output and call this method again.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Finish() has already completed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		The receiver can inflate all the data written so far, but flushing too often degrades the compression.
+	 */
+	result Flush(ByteBuffer& output)
+	{
+		int zResult = Z_OK;
+		result r = Process(null, output, Z_SYNC_FLUSH, zResult);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return (output.GetRemaining() == 0) ? E_OVERFLOW : E_SUCCESS;
+	}
+
+	/**
+	 * Writes the rest of the deflated data and the trailer of the format into the output buffer.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in,out]	output			The buffer to store the deflated data
+	 * @exception	E_SUCCESS			The method is successful and the deflated data is complete.
+	 * @exception	E_OVERFLOW			The @c output is full before all the data is written. @n
+	 *									Drain @c output and call this method again.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Finish() has already completed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		After this method completes, Reset() must be called to deflate new data.
+	 */
+	result Finish(ByteBuffer& output)
+	{
+		int zResult = Z_OK;
+		result r = Process(null, output, Z_FINISH, zResult);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (zResult != Z_STREAM_END)
+		{
+			return E_OVERFLOW;
+		}
+
+		__isFinished = true;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Discards the state of this instance to deflate new data with the same compression level and format.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		Unlike constructing a new instance, this method reuses the memory allocated by zlib.
+	 */
+	result Reset(void)
+	{
+		TryReturn(__isConstructed, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(deflateReset(&__stream) == Z_OK, E_SYSTEM, "[%s] Failed to reset the deflate stream.", GetErrorMessage(E_SYSTEM));
+
+		__isFinished = false;
+		__totalInputSize = 0;
+		__totalOutputSize = 0;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the number of bytes read from the input buffers since the construction or the last Reset().
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of bytes read
+	 */
+	long long GetTotalInputSize(void) const
+	{
+		return __totalInputSize;
+	}
+
+	/**
+	 * Gets the number of bytes written to the output buffers since the construction or the last Reset().
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of bytes written
+	 */
+	long long GetTotalOutputSize(void) const
+	{
+		return __totalOutputSize;
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	DeflateStream(const DeflateStream& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	DeflateStream& operator =(const DeflateStream& rhs);
+
+	result Process(ByteBuffer* pInput, ByteBuffer& output, int flush, int& zResult)
+	{
+		TryReturn(__isConstructed, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(!__isFinished, E_INVALID_STATE, "[%s] The deflated data is already complete.", GetErrorMessage(E_INVALID_STATE));
+
+		int readCount = 0;
+		int writtenCount = 0;
+
+		__ZStream::Bind(__stream, pInput, output);
+		zResult = deflate(&__stream, flush);
+		__ZStream::Unbind(__stream, pInput, output, readCount, writtenCount);
+
+		__totalInputSize += readCount;
+		__totalOutputSize += writtenCount;
+
+		result r = __ZStream::ConvertResult(zResult);
+		TryReturn(r == E_SUCCESS, r, "[%s] Failed to deflate.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	z_stream __stream;
+	bool __isConstructed;
+	bool __isFinished;
+	long long __totalInputSize;
+	long long __totalOutputSize;
+
+	static const int MEMORY_LEVEL = 8;
+
+}; // DeflateStream
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_DEFLATE_STREAM_H_
@@ -0,0 +1,291 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilInflateStream.h
+ * @brief		This is the header file for the %InflateStream class.
+ *
+ * This header file contains the declarations of the %InflateStream class.
+ */
+#ifndef _FBASE_UTIL_INFLATE_STREAM_H_
+#define _FBASE_UTIL_INFLATE_STREAM_H_
+
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseUtilTypes.h>
+#include <FBaseUtilZStream.h>
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+/**
+ * @class	InflateStream
+ * @brief	This class provides the incremental inflate functionality using zlib.
+ *
+ * @since 2.1
+ *
+ * The %InflateStream class provides the incremental inflate functionality using zlib.
+ * Unlike Inflator::InflateN(), it takes the deflated data in chunks and writes the inflated data into the buffers owned by the caller,
+ * so that the memory usage is bounded by the size of the chunks rather than by the size of the whole data. @n
+ * The buffers are used in the same way as DeflateStream does.
+ *
+ * This header is not included from FBaseUtil.h, because it needs the zlib.h header, which the SDK does not provide.
+ * The application must include this header directly, and must be built with zlib.h and linked with zlib.
+ *
+ * The following example demonstrates how to use the %InflateStream class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *	#include <FIo.h>
+ *	#include <FBaseUtilInflateStream.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Utility;
+ *	using namespace Tizen::Io;
+ *
+ *	void
+ *	MyClass::InflateStreamSample(File& src, File& dst)
+ *	{
+ *		InflateStream stream;
+ *		ByteBuffer input;
+ *		ByteBuffer output;
+ *
+ *		stream.Construct(COMPRESSION_FORMAT_GZIP);
+ *		input.Construct(64 * 1024);
+ *		output.Construct(64 * 1024);
+ *
+ *		while (!stream.IsFinished() && src.Read(input) == E_SUCCESS)
+ *		{
+ *			input.Flip();
+ *
+ *			result r = E_OVERFLOW;
+ *			while (r == E_OVERFLOW)
+ *			{
+ *				r = stream.Update(input, output);
+ *				output.Flip();
+ *				dst.Write(output);
+ *				output.Clear();
+ *			}
+ *
+ *			if (IsFailed(r))
+ *			{
+ *				// Error case handling...
+ *				break;
+ *			}
+ *
+ *			input.Clear();
+ *		}
+ *	}
+ * @endcode
+ *
+ * @see	DeflateStream
+ */
+class InflateStream
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	InflateStream(void)
+		: __isConstructed(false)
+		, __isFinished(false)
+		, __totalInputSize(0)
+		, __totalOutputSize(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~InflateStream(void)
+	{
+		if (__isConstructed)
+		{
+			inflateEnd(&__stream);
+		}
+	}
+
+	/**
+	 * Initializes this instance of %InflateStream with the specified format.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	format				The framing of the deflated data @n
+	 *									By default, it is set to @c COMPRESSION_FORMAT_ZLIB, which is the same as that of Inflator.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(CompressionFormat format = COMPRESSION_FORMAT_ZLIB)
+	{
+		TryReturn(!__isConstructed, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		__stream.zalloc = Z_NULL;
+		__stream.zfree = Z_NULL;
+		__stream.opaque = Z_NULL;
+		__stream.next_in = Z_NULL;
+		__stream.avail_in = 0;
+
+		int zResult = inflateInit2(&__stream, __ZStream::GetWindowBits(format));
+		result r = __ZStream::ConvertResult(zResult);
+		TryReturn(zResult == Z_OK, r, "[%s] Failed to initialize the inflate stream.", GetErrorMessage(r));
+
+		__isConstructed = true;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Inflates the remaining part of the input buffer into the output buffer.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in,out]	input			The buffer to inflate
+	 * @param[in,out]	output			The buffer to store the inflated data
+	 * @exception	E_SUCCESS			The method is successful. @n
+	 *									All the remaining bytes of @c input have been read, or the end of the deflated data has been reached.
+	 * @exception	E_OVERFLOW			The @c output is full and more inflated data may follow. @n
+	 *									Drain @c output and call this method again with the same @c input.
+	 * @exception	E_INVALID_FORMAT	The @c input is not valid deflated data of the specified format.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or the end of the deflated data has already been reached.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		When the end of the deflated data is reached, IsFinished() returns @c true
+	 *				and the position of @c input is left at the first byte after the deflated data.
+	 */
+	result Update(ByteBuffer& input, ByteBuffer& output)
+	{
+		TryReturn(__isConstructed, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(!__isFinished, E_INVALID_STATE, "[%s] The end of the deflated data has already been reached.", GetErrorMessage(E_INVALID_STATE));
+
+		int readCount = 0;
+		int writtenCount = 0;
+
+		__ZStream::Bind(__stream, &input, output);
+		int zResult = inflate(&__stream, Z_NO_FLUSH);
+		__ZStream::Unbind(__stream, &input, output, readCount, writtenCount);
+
+		__totalInputSize += readCount;
+		__totalOutputSize += writtenCount;
+
+		result r = __ZStream::ConvertResult(zResult);
+		TryReturn(r == E_SUCCESS, r, "[%s] Failed to inflate.", GetErrorMessage(r));
+
+		if (zResult == Z_STREAM_END)
+		{
+			__isFinished = true;
+			return E_SUCCESS;
+		}
+
+		// zlib may hold more inflated data whenever the output is full, even if the input is exhausted
+		return (output.GetRemaining() == 0) ? E_OVERFLOW : E_SUCCESS;
+	}
+
+	/**
+	 * Checks whether the end of the deflated data has been reached.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if the end of the deflated data has been reached, @n
+	 *				else @c false
+	 */
+	bool IsFinished(void) const
+	{
+		return __isFinished;
+	}
+
+	/**
+	 * Discards the state of this instance to inflate new data of the same format.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		Unlike constructing a new instance, this method reuses the memory allocated by zlib.
+	 */
+	result Reset(void)
+	{
+		TryReturn(__isConstructed, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(inflateReset(&__stream) == Z_OK, E_SYSTEM, "[%s] Failed to reset the inflate stream.", GetErrorMessage(E_SYSTEM));
+
+		__isFinished = false;
+		__totalInputSize = 0;
+		__totalOutputSize = 0;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the number of bytes read from the input buffers since the construction or the last Reset().
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of bytes read
+	 */
+	long long GetTotalInputSize(void) const
+	{
+		return __totalInputSize;
+	}
+
+	/**
+	 * Gets the number of bytes written to the output buffers since the construction or the last Reset().
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of bytes written
+	 */
+	long long GetTotalOutputSize(void) const
+	{
+		return __totalOutputSize;
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	InflateStream(const InflateStream& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	InflateStream& operator =(const InflateStream& rhs);
+
+	z_stream __stream;
+	bool __isConstructed;
+	bool __isFinished;
+	long long __totalInputSize;
+	long long __totalOutputSize;
+
+}; // InflateStream
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_INFLATE_STREAM_H_
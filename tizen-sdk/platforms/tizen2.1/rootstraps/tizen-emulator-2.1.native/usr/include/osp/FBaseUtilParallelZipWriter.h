@@ -0,0 +1,611 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilParallelZipWriter.h
+ * @brief		This is the header file for the %ParallelZipWriter class.
+ *
+ * This header file contains the declarations of the %ParallelZipWriter class.
+ */
+#ifndef _FBASE_UTIL_PARALLEL_ZIP_WRITER_H_
+#define _FBASE_UTIL_PARALLEL_ZIP_WRITER_H_
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <new>
+#include <zlib.h>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseString.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayListT.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtMutex.h>
+#include <FBaseRtMutexGuard.h>
+#include <FBaseRtThread.h>
+#include <FBaseUtilStringUtil.h>
+#include <FBaseUtilDeflateStream.h>
+#include <FBaseUtilZipFormat.h>
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+//
+// @struct	__ZipWriterEntry
+// @brief	This struct holds a file added to a %ParallelZipWriter and the fields of its headers.
+// @since 2.1
+//
+struct __ZipWriterEntry
+{
+	__ZipWriterEntry(void)
+		: level(DEFAULT_COMPRESSION)
+		, pName(null)
+		, nameLength(0)
+		, method(__ZipFormat::METHOD_STORED)
+		, dosDateTime(0)
+		, crc(0)
+		, compressedSize(0)
+		, uncompressedSize(0)
+		, localHeaderOffset(0)
+	{
+	}
+
+	~__ZipWriterEntry(void)
+	{
+		delete pName;
+	}
+
+	String filePath;
+	CompressionLevel level;
+	ByteBuffer* pName;
+	int nameLength;
+	unsigned int method;
+	unsigned int dosDateTime;
+	unsigned int crc;
+	unsigned int compressedSize;
+	unsigned int uncompressedSize;
+	unsigned int localHeaderOffset;
+};
+
+/**
+ * @class	ParallelZipWriter
+ * @brief	This class creates a zip archive by compressing several files concurrently.
+ *
+ * @since 2.1
+ *
+ * The %ParallelZipWriter class creates a zip archive by compressing several files concurrently.
+ * AddFile() only records the files. Close() compresses them on a set of worker threads, including the calling thread,
+ * appends each entry to the archive as soon as it is compressed, and then writes the central directory in the order the files were added. @n
+ * Each worker holds one file and its compressed data in memory at a time.
+ * An entry that does not become smaller by compression is stored without compression, so that ZipArchiveReader::MapEntry() can access it in place.
+ * Zip64 archives are not supported: the archive must be smaller than 4 GB and have less than 65535 entries.
+ *
+ * This header is not included from FBaseUtil.h, because it needs the zlib.h header, which the SDK does not provide.
+ * The application must include this header directly, and must be built with zlib.h and linked with zlib.
+ *
+ * The following example demonstrates how to use the %ParallelZipWriter class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *	#include <FBaseUtilParallelZipWriter.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Utility;
+ *
+ *	void
+ *	MyClass::ParallelZipWriterSample(void)
+ *	{
+ *		ParallelZipWriter writer;
+ *
+ *		writer.Construct(L"/opt/usr/media/Others/assets.zip");
+ *		writer.AddFile(L"/opt/usr/apps/com.example/data/a.xml", L"data/a.xml");
+ *		writer.AddFile(L"/opt/usr/apps/com.example/data/b.png", L"data/b.png", BEST_SPEED);
+ *
+ *		result r = writer.Close();
+ *		if (IsFailed(r))
+ *		{
+ *			// Error case handling...
+ *		}
+ *	}
+ * @endcode
+ *
+ * @see	ZipArchiveReader
+ */
+class ParallelZipWriter
+	: public Object
+	, private Runtime::IRunnable
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	ParallelZipWriter(void)
+		: __fd(-1)
+		, __threadCount(0)
+		, __nextEntryIndex(0)
+		, __offset(0)
+		, __lastResult(E_SUCCESS)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		If Close() has not been called, the archive is left incomplete.
+	 */
+	virtual ~ParallelZipWriter(void)
+	{
+		if (__fd >= 0)
+		{
+			close(__fd);
+		}
+
+		for (int i = 0; i < __entries.GetCount(); i++)
+		{
+			__ZipWriterEntry* pEntry = null;
+			__entries.GetAt(i, pEntry);
+			delete pEntry;
+		}
+	}
+
+	/**
+	 * Initializes this instance of %ParallelZipWriter with the specified archive path and number of threads.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filePath				The path of the archive to create @n
+	 *										If the file exists, it is overwritten.
+	 * @param[in]	threadCount				The number of threads to compress the files, including the thread that calls Close() @n
+	 *										If it is @c 0, the number of online processors is used.
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_OPERATION		This instance has already been constructed.
+	 * @exception	E_INVALID_ARG			The specified @c threadCount is negative.
+	 * @exception	E_ILLEGAL_ACCESS		The archive cannot be created.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @exception	E_SYSTEM				A system error has occurred.
+	 */
+	result Construct(const String& filePath, int threadCount = 0)
+	{
+		TryReturn(__fd < 0 && __threadCount == 0, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(threadCount >= 0, E_INVALID_ARG, "[%s] The threadCount(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), threadCount);
+
+		result r = __entries.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __mutex.Create();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (threadCount == 0)
+		{
+			long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+			threadCount = (processorCount > 0) ? static_cast< int >(processorCount) : 1;
+		}
+
+		ByteBuffer* pPath = StringUtil::StringToUtf8N(filePath);
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Failed to convert the path.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__fd = open(reinterpret_cast< const char* >(pPath->GetPointer()), O_WRONLY | O_CREAT | O_TRUNC, FILE_MODE);
+		delete pPath;
+		TryReturn(__fd >= 0, E_ILLEGAL_ACCESS, "[%s] Failed to create the archive.", GetErrorMessage(E_ILLEGAL_ACCESS));
+
+		__threadCount = (threadCount < MAX_THREAD_COUNT) ? threadCount : MAX_THREAD_COUNT;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Adds the specified file to the archive.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filePath			The path of the file to add
+	 * @param[in]	entryName			The name of the entry in the archive
+	 * @param[in]	level				Set to @c BEST_SPEED or @c BEST_COMPRESSION @n
+	 *									By default, it is set to @c DEFAULT_COMPRESSION.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Close() has already been called.
+	 * @exception	E_INVALID_ARG		The specified @c entryName is empty or too long.
+	 * @exception	E_MAX_EXCEEDED		The number of entries exceeds the limit of the zip format.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The file is read when Close() is called, and must not be modified before.
+	 */
+	result AddFile(const String& filePath, const String& entryName, CompressionLevel level = DEFAULT_COMPRESSION)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed or has already been closed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__entries.GetCount() < static_cast< int >(__ZipFormat::MAX_ENTRY_COUNT) - 1, E_MAX_EXCEEDED,
+			"[%s] The number of entries exceeds the limit.", GetErrorMessage(E_MAX_EXCEEDED));
+
+		result r = E_SUCCESS;
+		__ZipWriterEntry* pEntry = new (std::nothrow) __ZipWriterEntry();
+		TryReturn(pEntry != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		pEntry->filePath = filePath;
+		pEntry->level = level;
+		pEntry->pName = StringUtil::StringToUtf8N(entryName);
+		TryCatch(pEntry->pName != null, r = E_OUT_OF_MEMORY, "[%s] Failed to convert the entry name.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		// The limit of the buffer includes the null character
+		pEntry->nameLength = pEntry->pName->GetLimit() - 1;
+		TryCatch(pEntry->nameLength > 0 && pEntry->nameLength <= static_cast< int >(__ZipFormat::MAX_NAME_LENGTH), r = E_INVALID_ARG,
+			"[%s] The length of the entry name(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), pEntry->nameLength);
+
+		r = __entries.Add(pEntry);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+
+CATCH:
+		delete pEntry;
+		return r;
+	}
+
+	/**
+	 * Compresses the added files, writes them to the archive, and closes the archive.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed, or this method has already been called.
+	 * @exception	E_FILE_NOT_FOUND		An added file does not exist or cannot be read.
+	 * @exception	E_UNSUPPORTED_FORMAT	The archive requires the zip64 format.
+	 * @exception	E_STORAGE_FULL			The storage is full.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @exception	E_SYSTEM				A system error has occurred.
+	 * @remarks		This method blocks until all the files are written. @n
+	 *				If it fails, the remaining files are skipped and the archive is left incomplete.
+	 */
+	result Close(void)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed or has already been closed.", GetErrorMessage(E_INVALID_STATE));
+
+		int threadCount = (__threadCount < __entries.GetCount()) ? __threadCount : __entries.GetCount();
+		Runtime::Thread* pThreads = null;
+		int startedCount = 0;
+
+		// The calling thread is one of the workers
+		if (threadCount > 1)
+		{
+			pThreads = new (std::nothrow) Runtime::Thread[threadCount - 1];
+		}
+
+		if (pThreads != null)
+		{
+			for (; startedCount < threadCount - 1; startedCount++)
+			{
+				if (pThreads[startedCount].Construct(*this) != E_SUCCESS || pThreads[startedCount].Start() != E_SUCCESS)
+				{
+					break;
+				}
+			}
+		}
+
+		Run();
+
+		for (int i = 0; i < startedCount; i++)
+		{
+			pThreads[i].Join();
+		}
+		delete[] pThreads;
+
+		result r = __lastResult;
+		if (r == E_SUCCESS)
+		{
+			r = WriteCentralDirectory();
+		}
+
+		if (close(__fd) != 0 && r == E_SUCCESS)
+		{
+			r = E_SYSTEM;
+		}
+		__fd = -1;
+
+		TryReturn(r == E_SUCCESS, r, "[%s] Failed to create the archive.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ParallelZipWriter(const ParallelZipWriter& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ParallelZipWriter& operator =(const ParallelZipWriter& rhs);
+
+	// The body of the workers, which take the next file until all the files are written or an error occurs
+	virtual Object* Run(void)
+	{
+		while (true)
+		{
+			__ZipWriterEntry* pEntry = null;
+
+			{
+				Runtime::MutexGuard lock(__mutex);
+
+				if (__lastResult != E_SUCCESS || __nextEntryIndex >= __entries.GetCount())
+				{
+					break;
+				}
+
+				__entries.GetAt(__nextEntryIndex++, pEntry);
+			}
+
+			ByteBuffer input;
+			ByteBuffer output;
+			const ByteBuffer* pData = null;
+
+			result r = CompressEntry(*pEntry, input, output, pData);
+			if (r == E_SUCCESS)
+			{
+				Runtime::MutexGuard lock(__mutex);
+				r = WriteEntry(*pEntry, pData);
+			}
+
+			if (r != E_SUCCESS)
+			{
+				Runtime::MutexGuard lock(__mutex);
+
+				if (__lastResult == E_SUCCESS)
+				{
+					__lastResult = r;
+				}
+			}
+		}
+
+		return null;
+	}
+
+	result CompressEntry(__ZipWriterEntry& entry, ByteBuffer& input, ByteBuffer& output, const ByteBuffer*& pData) const
+	{
+		result r = ReadFile(entry, input);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		entry.method = __ZipFormat::METHOD_STORED;
+		entry.uncompressedSize = input.GetLimit();
+		entry.compressedSize = entry.uncompressedSize;
+		entry.crc = crc32(crc32(0L, Z_NULL, 0), input.GetPointer(), entry.uncompressedSize);
+		pData = &input;
+
+		if (entry.uncompressedSize == 0)
+		{
+			return E_SUCCESS;
+		}
+
+		// The output is as large as the input, so that an entry which does not shrink overflows and is stored
+		r = output.Construct(entry.uncompressedSize);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		DeflateStream deflater;
+		r = deflater.Construct(entry.level, COMPRESSION_FORMAT_RAW);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = deflater.Update(input, output);
+		if (r == E_SUCCESS)
+		{
+			r = deflater.Finish(output);
+		}
+
+		if (r == E_OVERFLOW || output.GetPosition() >= static_cast< int >(entry.uncompressedSize))
+		{
+			input.SetPosition(0);
+			return E_SUCCESS;
+		}
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		output.Flip();
+		entry.method = __ZipFormat::METHOD_DEFLATED;
+		entry.compressedSize = output.GetLimit();
+		pData = &output;
+
+		return E_SUCCESS;
+	}
+
+	static result ReadFile(__ZipWriterEntry& entry, ByteBuffer& buffer)
+	{
+		ByteBuffer* pPath = StringUtil::StringToUtf8N(entry.filePath);
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Failed to convert the path.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		int fd = open(reinterpret_cast< const char* >(pPath->GetPointer()), O_RDONLY);
+		delete pPath;
+		TryReturn(fd >= 0, E_FILE_NOT_FOUND, "[%s] Failed to open the file.", GetErrorMessage(E_FILE_NOT_FOUND));
+
+		result r = E_SUCCESS;
+		struct stat status;
+		int size = 0;
+
+		TryCatch(fstat(fd, &status) == 0, r = E_SYSTEM, "[%s] Failed to get the status of the file.", GetErrorMessage(E_SYSTEM));
+		TryCatch(status.st_size <= MAX_ENTRY_SIZE, r = E_UNSUPPORTED_FORMAT, "[%s] The file is too large.", GetErrorMessage(E_UNSUPPORTED_FORMAT));
+
+		size = static_cast< int >(status.st_size);
+		entry.dosDateTime = __ZipFormat::ToDosDateTime(status.st_mtime);
+
+		r = buffer.Construct(size);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		while (buffer.HasRemaining())
+		{
+			ssize_t count = read(fd, buffer.GetPointer() + buffer.GetPosition(), buffer.GetRemaining());
+			if (count < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			TryCatch(count > 0, r = E_FILE_NOT_FOUND, "[%s] Failed to read the file.", GetErrorMessage(E_FILE_NOT_FOUND));
+
+			buffer.SetPosition(buffer.GetPosition() + count);
+		}
+
+		buffer.Flip();
+
+		close(fd);
+		return E_SUCCESS;
+
+CATCH:
+		close(fd);
+		return r;
+	}
+
+	// Appends the local header and the data of the entry. The mutex must be held.
+	result WriteEntry(__ZipWriterEntry& entry, const ByteBuffer* pData)
+	{
+		long long recordSize = __ZipFormat::LOCAL_HEADER_SIZE + entry.nameLength + entry.compressedSize;
+		TryReturn(__offset + recordSize <= MAX_ARCHIVE_OFFSET, E_UNSUPPORTED_FORMAT,
+			"[%s] The archive requires the zip64 format.", GetErrorMessage(E_UNSUPPORTED_FORMAT));
+
+		byte header[__ZipFormat::LOCAL_HEADER_SIZE];
+		byte* p = header;
+		p = __ZipFormat::WriteUInt32(p, __ZipFormat::LOCAL_HEADER_SIGNATURE);
+		p = __ZipFormat::WriteUInt16(p, __ZipFormat::VERSION_NEEDED);
+		p = __ZipFormat::WriteUInt16(p, __ZipFormat::FLAG_UTF8);
+		p = __ZipFormat::WriteUInt16(p, entry.method);
+		p = __ZipFormat::WriteUInt32(p, entry.dosDateTime);
+		p = __ZipFormat::WriteUInt32(p, entry.crc);
+		p = __ZipFormat::WriteUInt32(p, entry.compressedSize);
+		p = __ZipFormat::WriteUInt32(p, entry.uncompressedSize);
+		p = __ZipFormat::WriteUInt16(p, entry.nameLength);
+		__ZipFormat::WriteUInt16(p, 0);
+
+		result r = Write(header, __ZipFormat::LOCAL_HEADER_SIZE);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = Write(entry.pName->GetPointer(), entry.nameLength);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (entry.compressedSize > 0)
+		{
+			r = Write(pData->GetPointer(), entry.compressedSize);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		entry.localHeaderOffset = static_cast< unsigned int >(__offset);
+		__offset += recordSize;
+
+		return E_SUCCESS;
+	}
+
+	result WriteCentralDirectory(void)
+	{
+		int entryCount = __entries.GetCount();
+		long long directorySize = 0;
+
+		for (int i = 0; i < entryCount; i++)
+		{
+			__ZipWriterEntry* pEntry = null;
+			__entries.GetAt(i, pEntry);
+			directorySize += __ZipFormat::CENTRAL_HEADER_SIZE + pEntry->nameLength;
+		}
+
+		TryReturn(__offset + directorySize + __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIZE <= MAX_ARCHIVE_OFFSET, E_UNSUPPORTED_FORMAT,
+			"[%s] The archive requires the zip64 format.", GetErrorMessage(E_UNSUPPORTED_FORMAT));
+
+		// The directory is built in memory and written at once
+		int bufferSize = static_cast< int >(directorySize) + __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIZE;
+		byte* pBuffer = new (std::nothrow) byte[bufferSize];
+		TryReturn(pBuffer != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		byte* p = pBuffer;
+		for (int i = 0; i < entryCount; i++)
+		{
+			__ZipWriterEntry* pEntry = null;
+			__entries.GetAt(i, pEntry);
+
+			p = __ZipFormat::WriteUInt32(p, __ZipFormat::CENTRAL_HEADER_SIGNATURE);
+			p = __ZipFormat::WriteUInt16(p, __ZipFormat::VERSION_MADE_BY_UNIX);
+			p = __ZipFormat::WriteUInt16(p, __ZipFormat::VERSION_NEEDED);
+			p = __ZipFormat::WriteUInt16(p, __ZipFormat::FLAG_UTF8);
+			p = __ZipFormat::WriteUInt16(p, pEntry->method);
+			p = __ZipFormat::WriteUInt32(p, pEntry->dosDateTime);
+			p = __ZipFormat::WriteUInt32(p, pEntry->crc);
+			p = __ZipFormat::WriteUInt32(p, pEntry->compressedSize);
+			p = __ZipFormat::WriteUInt32(p, pEntry->uncompressedSize);
+			p = __ZipFormat::WriteUInt16(p, pEntry->nameLength);
+			p = __ZipFormat::WriteUInt16(p, 0);	// The extra field length
+			p = __ZipFormat::WriteUInt16(p, 0);	// The comment length
+			p = __ZipFormat::WriteUInt16(p, 0);	// The disk number
+			p = __ZipFormat::WriteUInt16(p, 0);	// The internal attributes
+			p = __ZipFormat::WriteUInt32(p, __ZipFormat::EXTERNAL_ATTRIBUTES_FILE);
+			p = __ZipFormat::WriteUInt32(p, pEntry->localHeaderOffset);
+			memcpy(p, pEntry->pName->GetPointer(), pEntry->nameLength);
+			p += pEntry->nameLength;
+		}
+
+		p = __ZipFormat::WriteUInt32(p, __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIGNATURE);
+		p = __ZipFormat::WriteUInt16(p, 0);	// The disk number
+		p = __ZipFormat::WriteUInt16(p, 0);	// The disk number of the central directory
+		p = __ZipFormat::WriteUInt16(p, entryCount);
+		p = __ZipFormat::WriteUInt16(p, entryCount);
+		p = __ZipFormat::WriteUInt32(p, static_cast< unsigned int >(directorySize));
+		p = __ZipFormat::WriteUInt32(p, static_cast< unsigned int >(__offset));
+		__ZipFormat::WriteUInt16(p, 0);	// The comment length
+
+		result r = Write(pBuffer, bufferSize);
+		delete[] pBuffer;
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	result Write(const byte* pData, int length)
+	{
+		while (length > 0)
+		{
+			ssize_t count = write(__fd, pData, length);
+			if (count < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			TryReturn(count > 0, (errno == ENOSPC) ? E_STORAGE_FULL : E_SYSTEM, "[%s] Failed to write the archive.", GetErrorMessage(E_SYSTEM));
+
+			pData += count;
+			length -= count;
+		}
+
+		return E_SUCCESS;
+	}
+
+	int __fd;
+	int __threadCount;
+	Collection::ArrayListT< __ZipWriterEntry* > __entries;
+	int __nextEntryIndex;
+	long long __offset;
+	result __lastResult;
+	Runtime::Mutex __mutex;
+
+	static const int MAX_THREAD_COUNT = 8;
+	static const int FILE_MODE = 0644;
+	static const long long MAX_ENTRY_SIZE = 0x7FFFFFFFLL;
+	static const long long MAX_ARCHIVE_OFFSET = 0xFFFFFFFFLL;
+
+}; // ParallelZipWriter
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_PARALLEL_ZIP_WRITER_H_
@@ -42,6 +42,18 @@ enum CompressionLevel
 	DEFAULT_COMPRESSION             /**< For average speed and average compression */
 };
 
+/**
+ *	@enum	CompressionFormat
+ *	Defines the framing of the compressed data.
+ *	@since 2.1
+ */
+enum CompressionFormat
+{
+	COMPRESSION_FORMAT_ZLIB = 0,    /**< The zlib framing (RFC 1950), which is used by Deflator and Inflator */
+	COMPRESSION_FORMAT_GZIP,        /**< The gzip framing (RFC 1952) */
+	COMPRESSION_FORMAT_RAW          /**< The raw deflate data (RFC 1951) without a header and a checksum */
+};
+
 
 /**
  *	@enum LinkType
@@ -0,0 +1,610 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilWideStringUtil.h
+ * @brief		This is the header file for the %WideStringUtil class.
+ *
+ * This header file contains the declarations of the %WideStringUtil class.
+ */
+#ifndef _FBASE_UTIL_WIDE_STRING_UTIL_H_
+#define _FBASE_UTIL_WIDE_STRING_UTIL_H_
+
+#include <new>
+#include <FBaseResult.h>
+#include <FBaseCharacter.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define _FBASE_UTIL_WIDE_STRING_SSE2_
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define _FBASE_UTIL_WIDE_STRING_NEON_
+#endif
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+//
+// @class	__WideCharBlock
+// @brief	This class wraps four 32-bit wide characters in a vector register.
+// @since 2.1
+//
+// The block is implemented with SSE2 or NEON, depending on the target of the compilation.
+// If neither is available, WIDE_CHAR_BLOCK_SUPPORTED is false and the kernels use scalar code only.
+//
+#if defined(_FBASE_UTIL_WIDE_STRING_SSE2_)
+
+struct __WideCharBlock
+{
+	static const bool SUPPORTED = true;
+	static const int LENGTH = 4;
+
+	static __m128i Load(const wchar_t* p)
+	{
+		return _mm_loadu_si128(reinterpret_cast< const __m128i* >(p));
+	}
+
+	static void Store(wchar_t* p, __m128i block)
+	{
+		_mm_storeu_si128(reinterpret_cast< __m128i* >(p), block);
+	}
+
+	static __m128i Splat(wchar_t ch)
+	{
+		return _mm_set1_epi32(static_cast< int >(ch));
+	}
+
+	// Returns a 4-bit mask whose bit i is set if the lane i of the two blocks are equal
+	static int EqualMask(__m128i block0, __m128i block1)
+	{
+		return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block0, block1)));
+	}
+
+	static int EqualMask(__m128i block0, __m128i block1, __m128i block2, __m128i block3)
+	{
+		return _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(_mm_cmpeq_epi32(block0, block1), _mm_cmpeq_epi32(block2, block3))));
+	}
+
+	static bool IsAscii(__m128i block)
+	{
+		__m128i high = _mm_and_si128(block, _mm_set1_epi32(~0x7F));
+		return _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFF;
+	}
+
+	// Converts L'A' to L'Z' to lowercase. The block must contain ASCII characters only.
+	static __m128i ToLowerAscii(__m128i block)
+	{
+		__m128i isUpper = _mm_and_si128(_mm_cmpgt_epi32(block, _mm_set1_epi32(L'A' - 1)), _mm_cmplt_epi32(block, _mm_set1_epi32(L'Z' + 1)));
+		return _mm_add_epi32(block, _mm_and_si128(isUpper, _mm_set1_epi32(L'a' - L'A')));
+	}
+
+	typedef __m128i Type;
+
+}; // __WideCharBlock
+
+#elif defined(_FBASE_UTIL_WIDE_STRING_NEON_)
+
+struct __WideCharBlock
+{
+	static const bool SUPPORTED = true;
+	static const int LENGTH = 4;
+
+	static uint32x4_t Load(const wchar_t* p)
+	{
+		return vld1q_u32(reinterpret_cast< const uint32_t* >(p));
+	}
+
+	static void Store(wchar_t* p, uint32x4_t block)
+	{
+		vst1q_u32(reinterpret_cast< uint32_t* >(p), block);
+	}
+
+	static uint32x4_t Splat(wchar_t ch)
+	{
+		return vdupq_n_u32(static_cast< uint32_t >(ch));
+	}
+
+	static int EqualMask(uint32x4_t block0, uint32x4_t block1)
+	{
+		return ToMask(vceqq_u32(block0, block1));
+	}
+
+	static int EqualMask(uint32x4_t block0, uint32x4_t block1, uint32x4_t block2, uint32x4_t block3)
+	{
+		return ToMask(vandq_u32(vceqq_u32(block0, block1), vceqq_u32(block2, block3)));
+	}
+
+	static bool IsAscii(uint32x4_t block)
+	{
+		uint32x4_t high = vandq_u32(block, vdupq_n_u32(~0x7Fu));
+		uint32x2_t folded = vorr_u32(vget_low_u32(high), vget_high_u32(high));
+		folded = vpmax_u32(folded, folded);
+		return vget_lane_u32(folded, 0) == 0;
+	}
+
+	static uint32x4_t ToLowerAscii(uint32x4_t block)
+	{
+		uint32x4_t isUpper = vandq_u32(vcgeq_u32(block, vdupq_n_u32(L'A')), vcleq_u32(block, vdupq_n_u32(L'Z')));
+		return vaddq_u32(block, vandq_u32(isUpper, vdupq_n_u32(L'a' - L'A')));
+	}
+
+	// Packs the all-ones or all-zeros lanes into a 4-bit mask (ARMv7 has no movemask)
+	static int ToMask(uint32x4_t lanes)
+	{
+		static const uint32_t LANE_BITS[4] = { 1, 2, 4, 8 };
+		uint32x4_t bits = vandq_u32(lanes, vld1q_u32(LANE_BITS));
+		uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+		sum = vpadd_u32(sum, sum);
+		return static_cast< int >(vget_lane_u32(sum, 0));
+	}
+
+	typedef uint32x4_t Type;
+
+}; // __WideCharBlock
+
+#else
+
+struct __WideCharBlock
+{
+	static const bool SUPPORTED = false;
+	static const int LENGTH = 1;
+
+}; // __WideCharBlock
+
+#endif
+
+//
+// @class	__WideStringKernel
+// @brief	This class implements the search, comparison and case conversion of wide character arrays.
+// @since 2.1
+//
+// Each kernel processes __WideCharBlock::LENGTH characters at a time and handles the tail with scalar code.
+// Non-ASCII characters are always case-converted by Character::ToLowerCase(), so that the results are the same as the scalar path.
+//
+class __WideStringKernel
+{
+public:
+	// Returns the index of the first ch in p[0, length), or -1
+	static int FindChar(const wchar_t* p, int length, wchar_t ch)
+	{
+		int i = 0;
+
+#if defined(_FBASE_UTIL_WIDE_STRING_SSE2_) || defined(_FBASE_UTIL_WIDE_STRING_NEON_)
+		const __WideCharBlock::Type pattern = __WideCharBlock::Splat(ch);
+		for (; i + __WideCharBlock::LENGTH <= length; i += __WideCharBlock::LENGTH)
+		{
+			int mask = __WideCharBlock::EqualMask(__WideCharBlock::Load(p + i), pattern);
+			if (mask != 0)
+			{
+				return i + __builtin_ctz(mask);
+			}
+		}
+#endif
+
+		for (; i < length; i++)
+		{
+			if (p[i] == ch)
+			{
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	// Returns the index of the first character that differs between p0[0, length) and p1[0, length), or length
+	static int Mismatch(const wchar_t* p0, const wchar_t* p1, int length)
+	{
+		int i = 0;
+
+#if defined(_FBASE_UTIL_WIDE_STRING_SSE2_) || defined(_FBASE_UTIL_WIDE_STRING_NEON_)
+		for (; i + __WideCharBlock::LENGTH <= length; i += __WideCharBlock::LENGTH)
+		{
+			int mask = __WideCharBlock::EqualMask(__WideCharBlock::Load(p0 + i), __WideCharBlock::Load(p1 + i));
+			if (mask != ALL_LANES)
+			{
+				return i + __builtin_ctz(~mask);
+			}
+		}
+#endif
+
+		for (; i < length; i++)
+		{
+			if (p0[i] != p1[i])
+			{
+				return i;
+			}
+		}
+
+		return length;
+	}
+
+	// Returns the index of the first occurrence of sub[0, subLength) in p[0, length), or -1
+	static int FindString(const wchar_t* p, int length, const wchar_t* sub, int subLength)
+	{
+		if (subLength == 0)
+		{
+			return 0;
+		}
+
+		if (subLength == 1)
+		{
+			return FindChar(p, length, sub[0]);
+		}
+
+		int last = length - subLength;
+		int i = 0;
+
+#if defined(_FBASE_UTIL_WIDE_STRING_SSE2_) || defined(_FBASE_UTIL_WIDE_STRING_NEON_)
+		// Filters the candidates by the first and the last characters of sub, then verifies them
+		const __WideCharBlock::Type first = __WideCharBlock::Splat(sub[0]);
+		const __WideCharBlock::Type lastChar = __WideCharBlock::Splat(sub[subLength - 1]);
+		for (; i + __WideCharBlock::LENGTH - 1 <= last; i += __WideCharBlock::LENGTH)
+		{
+			int mask = __WideCharBlock::EqualMask(__WideCharBlock::Load(p + i), first,
+				__WideCharBlock::Load(p + i + subLength - 1), lastChar);
+			while (mask != 0)
+			{
+				int candidate = i + __builtin_ctz(mask);
+				if (Mismatch(p + candidate + 1, sub + 1, subLength - 2) == subLength - 2)
+				{
+					return candidate;
+				}
+				mask &= mask - 1;
+			}
+		}
+#endif
+
+		for (; i <= last; i++)
+		{
+			if (p[i] == sub[0] && p[i + subLength - 1] == sub[subLength - 1]
+				&& Mismatch(p + i + 1, sub + 1, subLength - 2) == subLength - 2)
+			{
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	// Checks whether p0[0, length) and p1[0, length) are equal, ignoring case
+	static bool EqualsIgnoreCase(const wchar_t* p0, const wchar_t* p1, int length)
+	{
+		int i = 0;
+
+#if defined(_FBASE_UTIL_WIDE_STRING_SSE2_) || defined(_FBASE_UTIL_WIDE_STRING_NEON_)
+		for (; i + __WideCharBlock::LENGTH <= length; i += __WideCharBlock::LENGTH)
+		{
+			__WideCharBlock::Type block0 = __WideCharBlock::Load(p0 + i);
+			__WideCharBlock::Type block1 = __WideCharBlock::Load(p1 + i);
+
+			if (__WideCharBlock::EqualMask(block0, block1) == ALL_LANES)
+			{
+				continue;
+			}
+
+			if (__WideCharBlock::IsAscii(block0) && __WideCharBlock::IsAscii(block1))
+			{
+				if (__WideCharBlock::EqualMask(__WideCharBlock::ToLowerAscii(block0), __WideCharBlock::ToLowerAscii(block1)) != ALL_LANES)
+				{
+					return false;
+				}
+			}
+			else if (!EqualsIgnoreCaseScalar(p0 + i, p1 + i, __WideCharBlock::LENGTH))
+			{
+				return false;
+			}
+		}
+#endif
+
+		return EqualsIgnoreCaseScalar(p0 + i, p1 + i, length - i);
+	}
+
+	// Converts pSrc[0, length) to lowercase into pDst[0, length)
+	static void ToLowerCase(const wchar_t* pSrc, wchar_t* pDst, int length)
+	{
+		int i = 0;
+
+#if defined(_FBASE_UTIL_WIDE_STRING_SSE2_) || defined(_FBASE_UTIL_WIDE_STRING_NEON_)
+		for (; i + __WideCharBlock::LENGTH <= length; i += __WideCharBlock::LENGTH)
+		{
+			__WideCharBlock::Type block = __WideCharBlock::Load(pSrc + i);
+			if (__WideCharBlock::IsAscii(block))
+			{
+				__WideCharBlock::Store(pDst + i, __WideCharBlock::ToLowerAscii(block));
+			}
+			else
+			{
+				for (int j = i; j < i + __WideCharBlock::LENGTH; j++)
+				{
+					pDst[j] = Character::ToLowerCase(pSrc[j]);
+				}
+			}
+		}
+#endif
+
+		for (; i < length; i++)
+		{
+			pDst[i] = Character::ToLowerCase(pSrc[i]);
+		}
+	}
+
+private:
+	static bool EqualsIgnoreCaseScalar(const wchar_t* p0, const wchar_t* p1, int length)
+	{
+		for (int i = 0; i < length; i++)
+		{
+			if (p0[i] != p1[i] && Character::ToLowerCase(p0[i]) != Character::ToLowerCase(p1[i]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static const int ALL_LANES = (1 << __WideCharBlock::LENGTH) - 1;
+
+}; // __WideStringKernel
+
+/**
+ * @class	WideStringUtil
+ * @brief	This class provides the vectorized search, comparison and case conversion methods for String.
+ *
+ * @since 2.1
+ *
+ * The %WideStringUtil class provides the search, comparison and case conversion methods for String,
+ * which process several wide characters at a time with SSE2 on x86 targets and NEON on ARM targets.
+ * When neither instruction set is enabled at compile time, the scalar code is used. @n
+ * The results are the same as those of the corresponding methods of %String.
+ *
+ * The following example demonstrates how to use the %WideStringUtil class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Utility;
+ *
+ *	void
+ *	MyClass::WideStringUtilSample(const String& line)
+ *	{
+ *		int index = 0;
+ *
+ *		if (WideStringUtil::IndexOf(line, L"ERROR", 0, index) == E_SUCCESS)
+ *		{
+ *			// ...
+ *		}
+ *	}
+ * @endcode
+ */
+class WideStringUtil
+{
+public:
+	/**
+	 * Searches for a character in the specified string, as String::IndexOf() does.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	str				The string to search
+	 * @param[in]	ch				The Unicode character to locate
+	 * @param[in]	startIndex		The starting position of the search
+	 * @param[out]	indexOf			The index of the character
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND	The specified character is not found.
+	 * @exception	E_OUT_OF_RANGE	The specified @c startIndex is either greater than or equal to the length of @c str or less than @c 0.
+	 */
+	static result IndexOf(const String& str, wchar_t ch, int startIndex, int& indexOf)
+	{
+		int length = str.GetLength();
+		TryReturn(startIndex >= 0 && startIndex < length, E_OUT_OF_RANGE,
+			"[%s] The startIndex(%d) MUST be greater than or equal to 0 and less than the length of the string(%d).",
+			GetErrorMessage(E_OUT_OF_RANGE), startIndex, length);
+
+		int index = __WideStringKernel::FindChar(str.GetPointer() + startIndex, length - startIndex, ch);
+		if (index < 0)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		indexOf = startIndex + index;
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Searches for a substring in the specified string, as String::IndexOf() does.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	str				The string to search
+	 * @param[in]	subStr			The substring to locate
+	 * @param[in]	startIndex		The starting position of the search
+	 * @param[out]	indexOf			The index of the substring
+	 * @exception	E_SUCCESS		The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND	The specified substring is not found.
+	 * @exception	E_OUT_OF_RANGE	The specified @c startIndex is either greater than or equal to the length of @c str or less than @c 0.
+	 */
+	static result IndexOf(const String& str, const String& subStr, int startIndex, int& indexOf)
+	{
+		int length = str.GetLength();
+		TryReturn(startIndex >= 0 && startIndex < length, E_OUT_OF_RANGE,
+			"[%s] The startIndex(%d) MUST be greater than or equal to 0 and less than the length of the string(%d).",
+			GetErrorMessage(E_OUT_OF_RANGE), startIndex, length);
+
+		int index = __WideStringKernel::FindString(str.GetPointer() + startIndex, length - startIndex, subStr.GetPointer(), subStr.GetLength());
+		if (index < 0)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		indexOf = startIndex + index;
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Checks whether the specified string contains the specified substring, as String::Contains() does.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if @c str contains @c subStr, @n
+	 *				else @c false
+	 * @param[in]	str			The string to search
+	 * @param[in]	subStr		The substring to locate
+	 */
+	static bool Contains(const String& str, const String& subStr)
+	{
+		return __WideStringKernel::FindString(str.GetPointer(), str.GetLength(), subStr.GetPointer(), subStr.GetLength()) >= 0;
+	}
+
+	/**
+	 * Compares the two strings ordinally, as String::CompareTo() does.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A 32-bit @c signed integer value
+	 *@code
+	 *				<  0  if @c str0 is less than @c str1
+	 *				== 0  if @c str0 is equal to @c str1
+	 *				>  0  if @c str0 is greater than @c str1
+	 *@endcode
+	 * @param[in]	str0		The first string to compare
+	 * @param[in]	str1		The second string to compare
+	 */
+	static int Compare(const String& str0, const String& str1)
+	{
+		int length0 = str0.GetLength();
+		int length1 = str1.GetLength();
+		int length = (length0 < length1) ? length0 : length1;
+
+		const wchar_t* p0 = str0.GetPointer();
+		const wchar_t* p1 = str1.GetPointer();
+
+		int index = __WideStringKernel::Mismatch(p0, p1, length);
+		if (index < length)
+		{
+			return (p0[index] < p1[index]) ? -1 : 1;
+		}
+
+		return length0 - length1;
+	}
+
+	/**
+	 * Checks whether the two strings are equal, as String::Equals(const String&, bool) does.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if the strings are equal, @n
+	 *				else @c false
+	 * @param[in]	str0			The first string to compare
+	 * @param[in]	str1			The second string to compare
+	 * @param[in]	caseSensitive	Set to @c true to perform a case sensitive comparison, @n
+	 *								else @c false
+	 * @remarks		The case insensitive comparison folds the ASCII characters in blocks
+	 *				and falls back to Character::ToLowerCase() for the blocks with other characters.
+	 */
+	static bool Equals(const String& str0, const String& str1, bool caseSensitive)
+	{
+		int length = str0.GetLength();
+		if (length != str1.GetLength())
+		{
+			return false;
+		}
+
+		if (caseSensitive)
+		{
+			return __WideStringKernel::Mismatch(str0.GetPointer(), str1.GetPointer(), length) == length;
+		}
+
+		return __WideStringKernel::EqualsIgnoreCase(str0.GetPointer(), str1.GetPointer(), length);
+	}
+
+	/**
+	 * Gets the lowercase form of the specified string, as String::ToLowerCase(String&) does.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	str					The string to convert
+	 * @param[out]	out					The lowercase form of @c str
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The Unicode characters other than the English alphabets are also supported.
+	 */
+	static result ToLowerCase(const String& str, String& out)
+	{
+		int length = str.GetLength();
+		wchar_t localBuffer[LOCAL_BUFFER_LENGTH];
+		wchar_t* pBuffer = localBuffer;
+
+		if (length >= LOCAL_BUFFER_LENGTH)
+		{
+			pBuffer = new (std::nothrow) wchar_t[length + 1];
+			TryReturn(pBuffer != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+
+		__WideStringKernel::ToLowerCase(str.GetPointer(), pBuffer, length);
+		pBuffer[length] = L'\0';
+
+		out = pBuffer;
+
+		if (pBuffer != localBuffer)
+		{
+			delete[] pBuffer;
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the lowercase form of the specified wide character array.
+	 *
+	 * @since 2.1
+	 *
+	 * @param[in]	pSrc		The characters to convert
+	 * @param[out]	pDst		The buffer to store the lowercase characters @n
+	 *							It may be the same as @c pSrc.
+	 * @param[in]	length		The number of characters to convert
+	 * @remarks		Unlike ToLowerCase(const String&, String&), this method does not allocate memory.
+	 */
+	static void ToLowerCase(const wchar_t* pSrc, wchar_t* pDst, int length)
+	{
+		__WideStringKernel::ToLowerCase(pSrc, pDst, length);
+	}
+
+private:
+	//
+	// This default constructor is intentionally declared as private because this class is not constructible.
+	//
+	WideStringUtil(void);
+
+	//
+	// This destructor is intentionally declared as private because this class is not constructible.
+	//
+	virtual ~WideStringUtil(void);
+
+	static const int LOCAL_BUFFER_LENGTH = 256;
+
+}; // WideStringUtil
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_WIDE_STRING_UTIL_H_
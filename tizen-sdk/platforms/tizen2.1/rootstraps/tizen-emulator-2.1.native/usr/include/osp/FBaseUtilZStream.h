@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilZStream.h
+ * @brief		This is the header file for the %__ZStream class.
+ *
+ * This header file contains the declarations of the %__ZStream class,
+ * which is used by the DeflateStream and InflateStream classes.
+ */
+#ifndef _FBASE_UTIL_ZSTREAM_H_
+#define _FBASE_UTIL_ZSTREAM_H_
+
+#include <zlib.h>
+#include <FBaseResult.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseUtilTypes.h>
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+//
+// @class	__ZStream
+// @brief	This class binds the byte buffers to a zlib stream and converts the zlib constants.
+// @since 2.1
+//
+// Bind() points the stream at the remaining part of each buffer,
+// and Unbind() advances the positions of the buffers by the number of bytes that zlib has read and written.
+//
+class __ZStream
+{
+public:
+	static void Bind(z_stream& stream, ByteBuffer* pInput, ByteBuffer& output)
+	{
+		if (pInput != null && pInput->GetRemaining() > 0)
+		{
+			stream.next_in = pInput->GetPointer() + pInput->GetPosition();
+			stream.avail_in = pInput->GetRemaining();
+		}
+		else
+		{
+			stream.next_in = Z_NULL;
+			stream.avail_in = 0;
+		}
+
+		if (output.GetRemaining() > 0)
+		{
+			stream.next_out = output.GetPointer() + output.GetPosition();
+			stream.avail_out = output.GetRemaining();
+		}
+		else
+		{
+			// zlib rejects a null output pointer even if no space is available
+			static Bytef emptyOutput[1];
+			stream.next_out = emptyOutput;
+			stream.avail_out = 0;
+		}
+	}
+
+	// Returns the number of bytes read and written through the arguments
+	static void Unbind(z_stream& stream, ByteBuffer* pInput, ByteBuffer& output, int& readCount, int& writtenCount)
+	{
+		readCount = 0;
+		if (pInput != null)
+		{
+			readCount = pInput->GetRemaining() - static_cast< int >(stream.avail_in);
+			pInput->SetPosition(pInput->GetPosition() + readCount);
+		}
+
+		writtenCount = output.GetRemaining() - static_cast< int >(stream.avail_out);
+		output.SetPosition(output.GetPosition() + writtenCount);
+
+		stream.next_in = Z_NULL;
+		stream.avail_in = 0;
+		stream.next_out = Z_NULL;
+		stream.avail_out = 0;
+	}
+
+	static int GetWindowBits(CompressionFormat format)
+	{
+		switch (format)
+		{
+		case COMPRESSION_FORMAT_GZIP:
+			return MAX_WBITS + GZIP_WINDOW_BITS_OFFSET;
+
+		case COMPRESSION_FORMAT_RAW:
+			return -MAX_WBITS;
+
+		default:
+			return MAX_WBITS;
+		}
+	}
+
+	static int GetLevel(CompressionLevel level)
+	{
+		switch (level)
+		{
+		case BEST_SPEED:
+			return Z_BEST_SPEED;
+
+		case BEST_COMPRESSION:
+			return Z_BEST_COMPRESSION;
+
+		default:
+			return Z_DEFAULT_COMPRESSION;
+		}
+	}
+
+	static result ConvertResult(int zResult)
+	{
+		switch (zResult)
+		{
+		case Z_OK:
+			// fall through
+		case Z_STREAM_END:
+			// fall through
+		case Z_BUF_ERROR:
+			return E_SUCCESS;
+
+		case Z_MEM_ERROR:
+			return E_OUT_OF_MEMORY;
+
+		case Z_DATA_ERROR:
+			// fall through
+		case Z_NEED_DICT:
+			return E_INVALID_FORMAT;
+
+		default:
+			return E_SYSTEM;
+		}
+	}
+
+private:
+	static const int GZIP_WINDOW_BITS_OFFSET = 16;
+
+}; // __ZStream
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_ZSTREAM_H_
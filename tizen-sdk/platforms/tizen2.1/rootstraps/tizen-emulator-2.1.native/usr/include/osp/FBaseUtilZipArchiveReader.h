@@ -0,0 +1,670 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilZipArchiveReader.h
+ * @brief		This is the header file for the %ZipArchiveReader and %ZipEntryReader classes.
+ *
+ * This header file contains the declarations of the %ZipArchiveReader and %ZipEntryReader classes.
+ */
+#ifndef _FBASE_UTIL_ZIP_ARCHIVE_READER_H_
+#define _FBASE_UTIL_ZIP_ARCHIVE_READER_H_
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string.h>
+#include <new>
+#include <zlib.h>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseString.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseColFlatHashMapT.h>
+#include <FBaseUtilStringUtil.h>
+#include <FBaseUtilInflateStream.h>
+#include <FBaseUtilZipFormat.h>
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+class ZipArchiveReader;
+
+//
+// @struct	__ZipArchiveEntry
+// @brief	This struct holds the fields of a central directory file header.
+// @since 2.1
+//
+struct __ZipArchiveEntry
+{
+	String name;
+	unsigned int flags;
+	unsigned int method;
+	unsigned int crc;
+	unsigned int compressedSize;
+	unsigned int uncompressedSize;
+	unsigned int localHeaderOffset;
+};
+
+/**
+ * @class	ZipEntryReader
+ * @brief	This class reads the uncompressed data of a single entry of a %ZipArchiveReader.
+ *
+ * @since 2.1
+ *
+ * The %ZipEntryReader class reads the uncompressed data of a single entry of a ZipArchiveReader.
+ * The compressed data is inflated directly from the memory-mapped archive into the buffer of the caller,
+ * so that no file is extracted to the file system. @n
+ * An instance is created by ZipArchiveReader::OpenEntryN() and must be deleted before the %ZipArchiveReader instance.
+ *
+ * @see	ZipArchiveReader
+ */
+class ZipEntryReader
+	: public Object
+{
+public:
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 */
+	virtual ~ZipEntryReader(void)
+	{
+	}
+
+	/**
+	 * Reads the uncompressed data of the entry into the specified buffer.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in,out]	buffer			The buffer to store the data @n
+	 *									The data is written from the current position to the limit of @c buffer,
+	 *									and the position is advanced by the number of bytes written.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_END_OF_FILE		All the data of the entry has already been read.
+	 * @exception	E_INVALID_DATA		The entry is corrupted, or its checksum does not match.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		The checksum of the entry is verified when the last byte is read.
+	 */
+	result Read(ByteBuffer& buffer)
+	{
+		TryReturn(!__isFinished, E_END_OF_FILE, "[%s] All the data of the entry has already been read.", GetErrorMessage(E_END_OF_FILE));
+
+		int position = buffer.GetPosition();
+		result r = E_SUCCESS;
+
+		if (__method == __ZipFormat::METHOD_STORED)
+		{
+			int count = __input.GetRemaining() < buffer.GetRemaining() ? __input.GetRemaining() : buffer.GetRemaining();
+			memcpy(buffer.GetPointer() + position, __input.GetPointer() + __input.GetPosition(), count);
+			__input.SetPosition(__input.GetPosition() + count);
+			buffer.SetPosition(position + count);
+
+			__isFinished = (__input.GetRemaining() == 0);
+		}
+		else
+		{
+			r = __inflater.Update(__input, buffer);
+			TryReturn(r == E_SUCCESS || r == E_OVERFLOW, (r == E_INVALID_FORMAT) ? E_INVALID_DATA : r,
+				"[%s] Failed to inflate the entry.", GetErrorMessage(r));
+
+			__isFinished = __inflater.IsFinished();
+			TryReturn(__isFinished || r == E_OVERFLOW, E_INVALID_DATA, "[%s] The entry is truncated.", GetErrorMessage(E_INVALID_DATA));
+		}
+
+		int count = buffer.GetPosition() - position;
+		__crc = crc32(__crc, buffer.GetPointer() + position, count);
+		__readSize += count;
+
+		if (__isFinished)
+		{
+			TryReturn(__readSize == __uncompressedSize && __crc == __expectedCrc, E_INVALID_DATA,
+				"[%s] The checksum of the entry does not match.", GetErrorMessage(E_INVALID_DATA));
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the uncompressed size of the entry.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The uncompressed size of the entry
+	 */
+	int GetSize(void) const
+	{
+		return __uncompressedSize;
+	}
+
+private:
+	ZipEntryReader(void)
+		: __method(__ZipFormat::METHOD_STORED)
+		, __expectedCrc(0)
+		, __uncompressedSize(0)
+		, __crc(0)
+		, __readSize(0)
+		, __isFinished(false)
+	{
+	}
+
+	result Construct(const byte* pData, const __ZipArchiveEntry& entry)
+	{
+		__method = entry.method;
+		__expectedCrc = entry.crc;
+		__uncompressedSize = entry.uncompressedSize;
+		__crc = crc32(0L, Z_NULL, 0);
+
+		// The input shares the memory-mapped data
+		result r = __input.Construct(pData, 0, entry.compressedSize, entry.compressedSize);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (__method == __ZipFormat::METHOD_DEFLATED)
+		{
+			r = __inflater.Construct(COMPRESSION_FORMAT_RAW);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		__isFinished = (entry.compressedSize == 0 && __method == __ZipFormat::METHOD_STORED);
+
+		return E_SUCCESS;
+	}
+
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ZipEntryReader(const ZipEntryReader& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ZipEntryReader& operator =(const ZipEntryReader& rhs);
+
+	ByteBuffer __input;
+	InflateStream __inflater;
+	unsigned int __method;
+	unsigned long __expectedCrc;
+	int __uncompressedSize;
+	unsigned long __crc;
+	int __readSize;
+	bool __isFinished;
+
+	friend class ZipArchiveReader;
+
+}; // ZipEntryReader
+
+/**
+ * @class	ZipArchiveReader
+ * @brief	This class provides random access to the entries of a zip archive without extracting them.
+ *
+ * @since 2.1
+ *
+ * The %ZipArchiveReader class provides random access to the entries of a zip archive without extracting them.
+ * The archive is memory-mapped and only its central directory is parsed on construction,
+ * so that opening an archive with thousands of entries touches none of the entry data. @n
+ * An entry can be read as a stream with OpenEntryN(), or accessed in place with MapEntry() if it is stored without compression. @n
+ * After the construction, all the methods are thread-safe, and several entries can be read concurrently.
+ * Zip64 archives and encrypted entries are not supported.
+ *
+ * This header is not included from FBaseUtil.h, because it needs the zlib.h header, which the SDK does not provide.
+ * The application must include this header directly, and must be built with zlib.h and linked with zlib.
+ *
+ * The following example demonstrates how to use the %ZipArchiveReader class.
+ *
+ * @code
+ *	#include <FBase.h>
+ *	#include <FBaseUtilZipArchiveReader.h>
+ *
+ *	using namespace Tizen::Base;
+ *	using namespace Tizen::Base::Utility;
+ *
+ *	void
+ *	MyClass::ZipArchiveReaderSample(const ZipArchiveReader& archive)
+ *	{
+ *		int index = 0;
+ *		archive.FindEntry(L"res/strings.xml", index);
+ *
+ *		ZipEntryReader* pEntry = archive.OpenEntryN(index);
+ *		if (pEntry != null)
+ *		{
+ *			ByteBuffer buffer;
+ *			buffer.Construct(pEntry->GetSize());
+ *
+ *			while (pEntry->Read(buffer) == E_SUCCESS)
+ *			{
+ *			}
+ *
+ *			delete pEntry;
+ *		}
+ *	}
+ * @endcode
+ *
+ * @see	ParallelZipWriter
+ */
+class ZipArchiveReader
+	: public Object
+{
+public:
+	/**
+	 * This is the default constructor for this class.
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		After creating an instance of this class, the Construct() method must be called explicitly to initialize this instance.
+	 */
+	ZipArchiveReader(void)
+		: __pMapping(null)
+		, __mappingSize(0)
+		, __pEntries(null)
+		, __entryCount(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since 2.1
+	 *
+	 * @remarks		The pointers returned by MapEntry() become invalid.
+	 */
+	virtual ~ZipArchiveReader(void)
+	{
+		delete[] __pEntries;
+
+		if (__pMapping != null)
+		{
+			munmap(__pMapping, __mappingSize);
+		}
+	}
+
+	/**
+	 * Initializes this instance of %ZipArchiveReader with the specified archive.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filePath				The path of the archive
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_OPERATION		This instance has already been constructed.
+	 * @exception	E_FILE_NOT_FOUND		The archive does not exist or cannot be opened.
+	 * @exception	E_INVALID_FORMAT		The archive is not a valid zip archive.
+	 * @exception	E_UNSUPPORTED_FORMAT	The archive is a zip64 archive.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @exception	E_SYSTEM				A system error has occurred.
+	 */
+	result Construct(const String& filePath)
+	{
+		TryReturn(__pMapping == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		result r = MapFile(filePath);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = ReadCentralDirectory();
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+
+CATCH:
+		delete[] __pEntries;
+		__pEntries = null;
+		__entryCount = 0;
+		munmap(__pMapping, __mappingSize);
+		__pMapping = null;
+		__mappingSize = 0;
+
+		return r;
+	}
+
+	/**
+	 * Gets the number of entries in the archive.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The number of entries
+	 */
+	int GetEntryCount(void) const
+	{
+		return __entryCount;
+	}
+
+	/**
+	 * Gets the name of the entry at the specified index.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	index				The index of the entry
+	 * @param[out]	name				The name of the entry
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is outside the bounds of the entries.
+	 */
+	result GetEntryName(int index, String& name) const
+	{
+		TryReturn(index >= 0 && index < __entryCount, E_OUT_OF_RANGE,
+			"[%s] The index(%d) MUST be greater than or equal to 0 and less than the number of entries(%d).", GetErrorMessage(E_OUT_OF_RANGE), index, __entryCount);
+
+		name = __pEntries[index].name;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Finds the entry with the specified name.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	name				The name of the entry
+	 * @param[out]	index				The index of the entry
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The archive has no entry with the specified @c name.
+	 * @remarks		The lookup takes a constant time on average. If several entries have the same name, the first one is found.
+	 */
+	result FindEntry(const String& name, int& index) const
+	{
+		if (__entryCount == 0)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		return __nameIndex.GetValue(name, index);
+	}
+
+	/**
+	 * Gets the uncompressed size of the entry at the specified index.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		The uncompressed size of the entry, @n
+	 *				else @c -1 if an exception occurs
+	 * @param[in]	index				The index of the entry
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is outside the bounds of the entries.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method.
+	 */
+	int GetEntrySize(int index) const
+	{
+		TryReturnResult(index >= 0 && index < __entryCount, -1, E_OUT_OF_RANGE,
+			"[%s] The index(%d) MUST be greater than or equal to 0 and less than the number of entries(%d).", GetErrorMessage(E_OUT_OF_RANGE), index, __entryCount);
+
+		SetLastResult(E_SUCCESS);
+		return __pEntries[index].uncompressedSize;
+	}
+
+	/**
+	 * Checks whether the entry at the specified index is stored without compression.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		@c true if the entry is stored without compression, @n
+	 *				else @c false
+	 * @param[in]	index				The index of the entry
+	 * @remarks		If this method returns @c true, the entry can be accessed in place with MapEntry().
+	 */
+	bool IsEntryStored(int index) const
+	{
+		return index >= 0 && index < __entryCount && __pEntries[index].method == __ZipFormat::METHOD_STORED;
+	}
+
+	/**
+	 * Opens the entry at the specified index as a stream.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		A pointer to the ZipEntryReader instance, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	index					The index of the entry
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_OUT_OF_RANGE			The specified @c index is outside the bounds of the entries.
+	 * @exception	E_INVALID_FORMAT		The local header of the entry is invalid.
+	 * @exception	E_UNSUPPORTED_FORMAT	The entry is encrypted or compressed with a method other than deflate.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method. @n
+	 *				The returned instance must be deleted before this instance.
+	 */
+	ZipEntryReader* OpenEntryN(int index) const
+	{
+		const byte* pData = null;
+		ZipEntryReader* pReader = null;
+
+		result r = GetEntryData(index, pData);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		pReader = new (std::nothrow) ZipEntryReader();
+		TryCatch(pReader != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pReader->Construct(pData, __pEntries[index]);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		SetLastResult(E_SUCCESS);
+		return pReader;
+
+CATCH:
+		delete pReader;
+		SetLastResult(r);
+		return null;
+	}
+
+	/**
+	 * Gets the memory-mapped data of the entry at the specified index, which is stored without compression.
+	 *
+	 * @since 2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	index					The index of the entry
+	 * @param[out]	pData					The pointer to the data of the entry
+	 * @param[out]	length					The length of the data
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_OUT_OF_RANGE			The specified @c index is outside the bounds of the entries.
+	 * @exception	E_INVALID_OPERATION		The entry is compressed.
+	 * @exception	E_INVALID_FORMAT		The local header of the entry is invalid.
+	 * @exception	E_UNSUPPORTED_FORMAT	The entry is encrypted.
+	 * @remarks		No data is copied, and the pages are read from the archive on first access. @n
+	 *				The pointer is valid as long as this instance. The checksum of the entry is not verified.
+	 */
+	result MapEntry(int index, const byte*& pData, int& length) const
+	{
+		TryReturn(index < 0 || index >= __entryCount || __pEntries[index].method == __ZipFormat::METHOD_STORED, E_INVALID_OPERATION,
+			"[%s] The entry is compressed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		const byte* pEntryData = null;
+		result r = GetEntryData(index, pEntryData);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		pData = pEntryData;
+		length = __pEntries[index].compressedSize;
+
+		return E_SUCCESS;
+	}
+
+private:
+	//
+	// The implementation of this copy constructor is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ZipArchiveReader(const ZipArchiveReader& rhs);
+
+	//
+	// The implementation of this copy assignment operator is intentionally blank and declared as private to prohibit copying of objects.
+	//
+	ZipArchiveReader& operator =(const ZipArchiveReader& rhs);
+
+	result MapFile(const String& filePath)
+	{
+		ByteBuffer* pPath = StringUtil::StringToUtf8N(filePath);
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Failed to convert the path.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		int fd = open(reinterpret_cast< const char* >(pPath->GetPointer()), O_RDONLY);
+		delete pPath;
+		TryReturn(fd >= 0, E_FILE_NOT_FOUND, "[%s] Failed to open the archive.", GetErrorMessage(E_FILE_NOT_FOUND));
+
+		struct stat status;
+		if (fstat(fd, &status) != 0 || status.st_size < __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIZE || status.st_size > MAX_ARCHIVE_SIZE)
+		{
+			close(fd);
+			AppLogException("[%s] The size of the archive is invalid.", GetErrorMessage(E_INVALID_FORMAT));
+			return E_INVALID_FORMAT;
+		}
+
+		void* pMapping = mmap(null, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		TryReturn(pMapping != MAP_FAILED, E_SYSTEM, "[%s] Failed to map the archive.", GetErrorMessage(E_SYSTEM));
+
+		__pMapping = static_cast< byte* >(pMapping);
+		__mappingSize = status.st_size;
+
+		return E_SUCCESS;
+	}
+
+	result ReadCentralDirectory(void)
+	{
+		const byte* pEnd = FindEndOfCentralDirectory();
+		TryReturn(pEnd != null, E_INVALID_FORMAT, "[%s] The end of central directory record is not found.", GetErrorMessage(E_INVALID_FORMAT));
+
+		unsigned int entryCount = __ZipFormat::ReadUInt16(pEnd + __ZipFormat::END_ENTRY_COUNT);
+		unsigned int directorySize = __ZipFormat::ReadUInt32(pEnd + __ZipFormat::END_DIRECTORY_SIZE);
+		unsigned int directoryOffset = __ZipFormat::ReadUInt32(pEnd + __ZipFormat::END_DIRECTORY_OFFSET);
+
+		TryReturn(entryCount != __ZipFormat::MAX_ENTRY_COUNT && directoryOffset != 0xFFFFFFFF, E_UNSUPPORTED_FORMAT,
+			"[%s] Zip64 archives are not supported.", GetErrorMessage(E_UNSUPPORTED_FORMAT));
+		TryReturn(directoryOffset <= static_cast< unsigned int >(pEnd - __pMapping) && directorySize <= static_cast< unsigned int >(pEnd - __pMapping) - directoryOffset,
+			E_INVALID_FORMAT, "[%s] The central directory is out of the archive.", GetErrorMessage(E_INVALID_FORMAT));
+
+		// Sized so that the index is not resized with the default load factor
+		result r = __nameIndex.Construct(entryCount + entryCount / 3 + 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pEntries = new (std::nothrow) __ZipArchiveEntry[entryCount > 0 ? entryCount : 1];
+		TryReturn(__pEntries != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		const byte* p = __pMapping + directoryOffset;
+		const byte* pDirectoryEnd = p + directorySize;
+		char localName[LOCAL_NAME_BUFFER_LENGTH];
+
+		for (unsigned int i = 0; i < entryCount; i++)
+		{
+			TryReturn(pDirectoryEnd - p >= __ZipFormat::CENTRAL_HEADER_SIZE && __ZipFormat::ReadUInt32(p) == __ZipFormat::CENTRAL_HEADER_SIGNATURE,
+				E_INVALID_FORMAT, "[%s] The central directory file header(%d) is invalid.", GetErrorMessage(E_INVALID_FORMAT), i);
+
+			int nameLength = __ZipFormat::ReadUInt16(p + __ZipFormat::CENTRAL_NAME_LENGTH);
+			int recordSize = __ZipFormat::CENTRAL_HEADER_SIZE + nameLength + __ZipFormat::ReadUInt16(p + __ZipFormat::CENTRAL_EXTRA_LENGTH)
+				+ __ZipFormat::ReadUInt16(p + __ZipFormat::CENTRAL_COMMENT_LENGTH);
+			TryReturn(pDirectoryEnd - p >= recordSize, E_INVALID_FORMAT,
+				"[%s] The central directory file header(%d) is truncated.", GetErrorMessage(E_INVALID_FORMAT), i);
+
+			__ZipArchiveEntry& entry = __pEntries[i];
+			entry.flags = __ZipFormat::ReadUInt16(p + __ZipFormat::CENTRAL_FLAGS);
+			entry.method = __ZipFormat::ReadUInt16(p + __ZipFormat::CENTRAL_METHOD);
+			entry.crc = __ZipFormat::ReadUInt32(p + __ZipFormat::CENTRAL_CRC);
+			entry.compressedSize = __ZipFormat::ReadUInt32(p + __ZipFormat::CENTRAL_COMPRESSED_SIZE);
+			entry.uncompressedSize = __ZipFormat::ReadUInt32(p + __ZipFormat::CENTRAL_UNCOMPRESSED_SIZE);
+			entry.localHeaderOffset = __ZipFormat::ReadUInt32(p + __ZipFormat::CENTRAL_LOCAL_HEADER_OFFSET);
+
+			// The names are null-terminated for the conversion, on the stack unless they are long
+			char* pName = (nameLength < LOCAL_NAME_BUFFER_LENGTH) ? localName : new (std::nothrow) char[nameLength + 1];
+			TryReturn(pName != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			memcpy(pName, p + __ZipFormat::CENTRAL_HEADER_SIZE, nameLength);
+			pName[nameLength] = '\0';
+			r = StringUtil::Utf8ToString(pName, entry.name);
+
+			if (pName != localName)
+			{
+				delete[] pName;
+			}
+			TryReturn(r == E_SUCCESS, E_INVALID_FORMAT, "[%s] The name of the entry(%d) is invalid.", GetErrorMessage(E_INVALID_FORMAT), i);
+
+			int index = 0;
+			if (__nameIndex.GetValue(entry.name, index) != E_SUCCESS)
+			{
+				r = __nameIndex.Add(entry.name, i);
+				TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+			}
+
+			__entryCount++;
+			p += recordSize;
+		}
+
+		return E_SUCCESS;
+	}
+
+	const byte* FindEndOfCentralDirectory(void) const
+	{
+		const byte* pFirst = __pMapping;
+		if (__mappingSize > __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIZE + __ZipFormat::MAX_COMMENT_LENGTH)
+		{
+			pFirst = __pMapping + __mappingSize - __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIZE - __ZipFormat::MAX_COMMENT_LENGTH;
+		}
+
+		// The record is at the end of the archive, followed by a comment of up to 64 KB
+		for (const byte* p = __pMapping + __mappingSize - __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIZE; p >= pFirst; p--)
+		{
+			if (__ZipFormat::ReadUInt32(p) == __ZipFormat::END_OF_CENTRAL_DIRECTORY_SIGNATURE)
+			{
+				return p;
+			}
+		}
+
+		return null;
+	}
+
+	// The local header is parsed only when the entry is accessed, so that the construction touches the central directory only
+	result GetEntryData(int index, const byte*& pData) const
+	{
+		TryReturn(index >= 0 && index < __entryCount, E_OUT_OF_RANGE,
+			"[%s] The index(%d) MUST be greater than or equal to 0 and less than the number of entries(%d).", GetErrorMessage(E_OUT_OF_RANGE), index, __entryCount);
+
+		const __ZipArchiveEntry& entry = __pEntries[index];
+		TryReturn((entry.flags & __ZipFormat::FLAG_ENCRYPTED) == 0
+			&& (entry.method == __ZipFormat::METHOD_STORED || entry.method == __ZipFormat::METHOD_DEFLATED),
+			E_UNSUPPORTED_FORMAT, "[%s] The entry(%d) is encrypted or its compression method(%u) is not supported.", GetErrorMessage(E_UNSUPPORTED_FORMAT), index, entry.method);
+
+		unsigned int size = static_cast< unsigned int >(__mappingSize);
+		TryReturn(entry.localHeaderOffset <= size - __ZipFormat::LOCAL_HEADER_SIZE
+			&& __ZipFormat::ReadUInt32(__pMapping + entry.localHeaderOffset) == __ZipFormat::LOCAL_HEADER_SIGNATURE,
+			E_INVALID_FORMAT, "[%s] The local header of the entry(%d) is invalid.", GetErrorMessage(E_INVALID_FORMAT), index);
+
+		const byte* pHeader = __pMapping + entry.localHeaderOffset;
+		unsigned int dataOffset = entry.localHeaderOffset + __ZipFormat::LOCAL_HEADER_SIZE
+			+ __ZipFormat::ReadUInt16(pHeader + __ZipFormat::LOCAL_NAME_LENGTH) + __ZipFormat::ReadUInt16(pHeader + __ZipFormat::LOCAL_EXTRA_LENGTH);
+		TryReturn(dataOffset <= size && entry.compressedSize <= size - dataOffset && entry.uncompressedSize <= MAX_ENTRY_SIZE
+			&& (entry.method != __ZipFormat::METHOD_STORED || entry.compressedSize == entry.uncompressedSize),
+			E_INVALID_FORMAT, "[%s] The data of the entry(%d) is out of the archive.", GetErrorMessage(E_INVALID_FORMAT), index);
+
+		pData = __pMapping + dataOffset;
+
+		return E_SUCCESS;
+	}
+
+	byte* __pMapping;
+	long long __mappingSize;
+	__ZipArchiveEntry* __pEntries;
+	int __entryCount;
+	Collection::FlatHashMapT< String, int > __nameIndex;
+
+	static const long long MAX_ARCHIVE_SIZE = 0x7FFFFFFFLL;
+	static const unsigned int MAX_ENTRY_SIZE = 0x7FFFFFFF;
+	static const int LOCAL_NAME_BUFFER_LENGTH = 256;
+
+}; // ZipArchiveReader
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_ZIP_ARCHIVE_READER_H_
@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file		FBaseUtilZipFormat.h
+ * @brief		This is the header file for the %__ZipFormat class.
+ *
+ * This header file contains the declarations of the %__ZipFormat class,
+ * which is used by the ZipArchiveReader and ParallelZipWriter classes.
+ */
+#ifndef _FBASE_UTIL_ZIP_FORMAT_H_
+#define _FBASE_UTIL_ZIP_FORMAT_H_
+
+#include <time.h>
+#include <FBaseTypes.h>
+
+
+namespace Tizen { namespace Base { namespace Utility
+{
+
+//
+// @class	__ZipFormat
+// @brief	This class defines the record layouts of the zip file format and reads and writes their little-endian fields.
+// @since 2.1
+//
+// Only the fields used by ZipArchiveReader and ParallelZipWriter are defined. Zip64 records are not supported.
+//
+class __ZipFormat
+{
+public:
+	static unsigned int ReadUInt16(const byte* p)
+	{
+		return p[0] | (p[1] << 8);
+	}
+
+	static unsigned int ReadUInt32(const byte* p)
+	{
+		return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast< unsigned int >(p[3]) << 24);
+	}
+
+	static byte* WriteUInt16(byte* p, unsigned int value)
+	{
+		p[0] = static_cast< byte >(value);
+		p[1] = static_cast< byte >(value >> 8);
+		return p + 2;
+	}
+
+	static byte* WriteUInt32(byte* p, unsigned int value)
+	{
+		p[0] = static_cast< byte >(value);
+		p[1] = static_cast< byte >(value >> 8);
+		p[2] = static_cast< byte >(value >> 16);
+		p[3] = static_cast< byte >(value >> 24);
+		return p + 4;
+	}
+
+	// Converts the time to the MS-DOS date in the upper 16 bits and the MS-DOS time in the lower 16 bits
+	static unsigned int ToDosDateTime(time_t time)
+	{
+		struct tm local;
+		if (localtime_r(&time, &local) == null || local.tm_year < DOS_EPOCH_YEAR - TM_EPOCH_YEAR)
+		{
+			return DOS_MIN_DATE_TIME;
+		}
+
+		unsigned int date = ((local.tm_year + TM_EPOCH_YEAR - DOS_EPOCH_YEAR) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday;
+		unsigned int dosTime = (local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec >> 1);
+
+		return (date << 16) | dosTime;
+	}
+
+	static const unsigned int LOCAL_HEADER_SIGNATURE = 0x04034B50;
+	static const unsigned int CENTRAL_HEADER_SIGNATURE = 0x02014B50;
+	static const unsigned int END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054B50;
+
+	static const int LOCAL_HEADER_SIZE = 30;
+	static const int CENTRAL_HEADER_SIZE = 46;
+	static const int END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+	static const int MAX_COMMENT_LENGTH = 0xFFFF;
+
+	// The field offsets of the local file header
+	static const int LOCAL_NAME_LENGTH = 26;
+	static const int LOCAL_EXTRA_LENGTH = 28;
+
+	// The field offsets of the central directory file header
+	static const int CENTRAL_FLAGS = 8;
+	static const int CENTRAL_METHOD = 10;
+	static const int CENTRAL_CRC = 16;
+	static const int CENTRAL_COMPRESSED_SIZE = 20;
+	static const int CENTRAL_UNCOMPRESSED_SIZE = 24;
+	static const int CENTRAL_NAME_LENGTH = 28;
+	static const int CENTRAL_EXTRA_LENGTH = 30;
+	static const int CENTRAL_COMMENT_LENGTH = 32;
+	static const int CENTRAL_LOCAL_HEADER_OFFSET = 42;
+
+	// The field offsets of the end of central directory record
+	static const int END_ENTRY_COUNT = 10;
+	static const int END_DIRECTORY_SIZE = 12;
+	static const int END_DIRECTORY_OFFSET = 16;
+
+	static const unsigned int METHOD_STORED = 0;
+	static const unsigned int METHOD_DEFLATED = 8;
+
+	static const unsigned int FLAG_ENCRYPTED = 0x0001;
+	static const unsigned int FLAG_UTF8 = 0x0800;
+
+	static const unsigned int VERSION_NEEDED = 20;
+	static const unsigned int VERSION_MADE_BY_UNIX = (3 << 8) | 20;
+	static const unsigned int EXTERNAL_ATTRIBUTES_FILE = 0100644u << 16;
+
+	static const unsigned int MAX_ENTRY_COUNT = 0xFFFF;
+	static const unsigned int MAX_NAME_LENGTH = 0xFFFF;
+
+private:
+	static const int DOS_EPOCH_YEAR = 1980;
+	static const int TM_EPOCH_YEAR = 1900;
+	static const unsigned int DOS_MIN_DATE_TIME = (1 << 5 | 1) << 16;
+
+}; // __ZipFormat
+
+}}} // Tizen::Base::Utility
+
+#endif // _FBASE_UTIL_ZIP_FORMAT_H_
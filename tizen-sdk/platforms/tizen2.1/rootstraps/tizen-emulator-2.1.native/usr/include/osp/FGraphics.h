@@ -50,9 +50,12 @@
 
 #include "FGrpCanvasCommon.h"
 #include "FGrpCanvas.h"
+#include "FGrpSoftwareCanvas.h"
 
 #include "FGrpFontCommon.h"
 #include "FGrpFont.h"
+#include "FGrpGlyphAtlas.h"
+#include "FGrpTextRunCache.h"
 
 #include "FGrpTextElement.h"
 #include "FGrpEnrichedText.h"
@@ -0,0 +1,1193 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FGrpGlyphAtlas.h
+ * @brief	This is the header file for the %GlyphAtlas class.
+ *
+ * This header file contains the declarations of the %GlyphAtlas class and the %GlyphInfo struct.
+ */
+
+#ifndef _FGRP_GLYPH_ATLAS_H_
+#define _FGRP_GLYPH_ATLAS_H_
+
+#include <string.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseString.h>
+#include <FBaseRtMutex.h>
+#include <FBaseRtMutexGuard.h>
+#include <FGrpPoint.h>
+#include <FGrpRectangle.h>
+#include <FGrpDimension.h>
+#include <FGrpColor.h>
+#include <FGrpBufferInfo.h>
+#include <FGrpFont.h>
+#include <FGrpCanvas.h>
+#include <FGrpSoftwareCanvas.h>
+
+namespace Tizen { namespace Graphics
+{
+
+/**
+ * @struct	GlyphInfo
+ * @brief	This struct locates a glyph which is cached by %GlyphAtlas.
+ *
+ * The %GlyphInfo struct contains the area of a page of the atlas which holds the coverage mask of a glyph,
+ * and the position of the mask relative to the pen. The mask can be drawn with SoftwareCanvas::DrawAlphaMask().
+ *
+ * @since 2.1
+ */
+struct GlyphInfo
+{
+	const unsigned char* pPage; /**< The first row of the page which holds the glyph @n
+			*	It is @c null if the glyph has no visible pixels, such as a space.
+			*/
+	int pitch; /**< The number of bytes between the rows of the page */
+	int x; /**< The x position of the glyph in the page */
+	int y; /**< The y position of the glyph in the page */
+	int width; /**< The width of the glyph */
+	int height; /**< The height of the glyph */
+	int offsetX; /**< The horizontal distance from the pen position to the left of the glyph */
+	int offsetY; /**< The vertical distance from the top of the line to the top of the glyph */
+	int advance; /**< The horizontal distance from the pen position to the next pen position */
+};
+
+//
+// @struct	__GlyphAtlasFace
+// @brief	This struct is a face, size, and style of a font, which all the equal Font instances share.
+// @since 2.1
+//
+struct __GlyphAtlasFace
+{
+	Tizen::Base::String faceName;
+	float size;
+	int style;
+	int charSpace;
+	int lineHeight;
+	int pinCount;
+
+	// The page to which the new glyphs are added, or -1
+	int currentPage;
+
+}; // __GlyphAtlasFace
+
+//
+// @struct	__GlyphAtlasPage
+// @brief	This struct is a square 8-bit page, which is filled with the glyphs of one face row by row.
+// @since 2.1
+//
+struct __GlyphAtlasPage
+{
+	unsigned char* pPixels;
+	int size;
+	int face;
+	int cursorX;
+	int cursorY;
+	int rowHeight;
+	long long lastUse;
+
+}; // __GlyphAtlasPage
+
+//
+// @struct	__GlyphAtlasEntry
+// @brief	This struct is a cached glyph.
+// @since 2.1
+//
+struct __GlyphAtlasEntry
+{
+	// The face in the upper 32 bits, and the character in the lower 32 bits
+	long long key;
+
+	// The page, or -1 if the glyph has no visible pixels
+	int page;
+	int x;
+	int y;
+	int width;
+	int height;
+	int offsetX;
+	int offsetY;
+	int advance;
+
+}; // __GlyphAtlasEntry
+
+/**
+ * @class	GlyphAtlas
+ * @brief	This class caches the rasterized glyphs of fonts in shared pages, within a memory limit.
+ *
+ * @since	2.1
+ *
+ * The %GlyphAtlas class rasterizes each glyph once per face, size, and style, and keeps its coverage mask in an 8-bit page,
+ * so that drawing the same text again only copies the masks. The Font instances of the same face, size, and style share the glyphs,
+ * and the glyphs of a face are packed into the same pages, so that SoftwareCanvas draws them in one batch. @n
+ * When a new page would exceed the memory limit, the least recently used page is evicted, unless its font has been pinned
+ * with PinFont(). The pages which have been used by the same call are never evicted by it. @n
+ * A SoftwareCanvas in the deferred mode reads the pages when it is flushed, so that HoldPages() keeps the memory of the evicted pages
+ * until the canvas has been flushed.
+ *
+ * The process-wide atlas is returned by GetInstance(), and all the methods are thread-safe. The hit rate and the memory size
+ * show whether the limit fits the working set of the application.
+ *
+ * The following example demonstrates how to use the %GlyphAtlas class.
+ *
+ * @code
+ *	result
+ *	MyLabel::DrawDigits(SoftwareCanvas& canvas, const Font& font, const Point& point)
+ *	{
+ *		static const wchar_t digits[] = L"0123456789";
+ *		GlyphInfo glyphs[10];
+ *
+ *		GlyphAtlas* pAtlas = GlyphAtlas::GetInstance();
+ *		TryReturn(pAtlas != null, E_OUT_OF_MEMORY, "[%s] Propagating.", GetErrorMessage(E_OUT_OF_MEMORY));
+ *
+ *		result r = pAtlas->HoldPages(canvas);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		r = pAtlas->GetGlyphs(font, digits, 10, glyphs);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		int x = point.x;
+ *		for (int i = 0; i < 10; i++)
+ *		{
+ *			if (glyphs[i].pPage != null)
+ *			{
+ *				canvas.DrawAlphaMask(Point(x + glyphs[i].offsetX, point.y + glyphs[i].offsetY), glyphs[i].pPage, glyphs[i].pitch,
+ *					Rectangle(glyphs[i].x, glyphs[i].y, glyphs[i].width, glyphs[i].height));
+ *			}
+ *			x += glyphs[i].advance;
+ *		}
+ *
+ *		return E_SUCCESS;
+ *	}
+ * @endcode
+ */
+class GlyphAtlas
+	: public Tizen::Base::Object
+	, public __ISoftwareCanvasFlushListener
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	GlyphAtlas(void)
+		: __maxMemorySize(0)
+		, __memorySize(0)
+		, __ppFaces(null)
+		, __faceCount(0)
+		, __faceCapacity(0)
+		, __pPages(null)
+		, __pageCount(0)
+		, __pageCapacity(0)
+		, __pEntries(null)
+		, __entryCount(0)
+		, __entryCapacity(0)
+		, __pSlots(null)
+		, __slotCapacity(0)
+		, __pCanvas(null)
+		, __canvasWidth(0)
+		, __canvasHeight(0)
+		, __holdCount(0)
+		, __ppRetiredPages(null)
+		, __retiredPageCount(0)
+		, __retiredPageCapacity(0)
+		, __clock(0)
+		, __hitCount(0)
+		, __missCount(0)
+		, __evictionCount(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * All the pages are freed.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		The canvases which hold the pages must have been flushed or destroyed.
+	 */
+	virtual ~GlyphAtlas(void)
+	{
+		FreeRetiredPages();
+
+		for (int i = 0; i < __faceCount; i++)
+		{
+			delete __ppFaces[i];
+		}
+		for (int i = 0; i < __pageCount; i++)
+		{
+			delete[] __pPages[i].pPixels;
+		}
+
+		delete[] __ppFaces;
+		delete[] __pPages;
+		delete[] __pEntries;
+		delete[] __pSlots;
+		delete[] __ppRetiredPages;
+		delete __pCanvas;
+	}
+
+	/**
+	 * Initializes this instance of %GlyphAtlas with the specified memory limit.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	maxMemorySize		The maximum number of bytes of the pages
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c maxMemorySize is less than the size of a page, which is 64 KB.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(long long maxMemorySize = DEFAULT_MAX_MEMORY_SIZE)
+	{
+		TryReturn(__maxMemorySize == 0, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(maxMemorySize >= DEFAULT_PAGE_SIZE * DEFAULT_PAGE_SIZE, E_OUT_OF_RANGE,
+			"[%s] The maxMemorySize(%lld) MUST be at least the size of a page.", GetErrorMessage(E_OUT_OF_RANGE), maxMemorySize);
+
+		result r = __mutex.Create();
+		TryReturn(r == E_SUCCESS, E_SYSTEM, "[%s] Failed to create the mutex.", GetErrorMessage(E_SYSTEM));
+
+		__maxMemorySize = maxMemorySize;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the atlas which is shared by the whole process.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the shared atlas, @n
+	 *				else @c null if it cannot be created
+	 * @remarks		The shared atlas is created at the first call, with the default memory limit of 4 MB.
+	 */
+	static GlyphAtlas* GetInstance(void)
+	{
+		static GlyphAtlas* pInstance = CreateInstanceN();
+
+		return pInstance;
+	}
+
+	/**
+	 * Gets the identifier which all the Font instances of the same face, size, and style share in this atlas.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	font				The font
+	 * @param[out]	fontId				The identifier of the font, which is valid for the lifetime of this atlas
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The identifier can be a part of the key of a cache of measured text, such as TextRunCache.
+	 */
+	result GetFontId(const Font& font, int& fontId)
+	{
+		TryReturn(__maxMemorySize > 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__GlyphAtlasFace face;
+		LoadFace(font, face);
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		result r = FindFace(face, true, fontId);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the glyphs of the specified characters, which are rasterized with the specified font if they are not cached.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	font				The font of the characters
+	 * @param[in]	pCharacters			The characters
+	 * @param[in]	count				The number of the characters
+	 * @param[out]	pGlyphs				The array of at least @c count elements, which receives the glyphs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		A specified pointer is @c null, or the specified @c count is negative.
+	 * @exception	E_OVERFLOW			A new page exceeds the memory limit, and every page is pinned or used by this call.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The glyph cannot be rasterized.
+	 * @remarks		The pages of the glyphs stay valid until they are evicted by a later call, which can be made by another thread.
+	 *				Pin the font with PinFont() while the glyphs are used by another thread. @n
+	 *				If the glyphs are drawn on a SoftwareCanvas in the deferred mode, call HoldPages() before this method.
+	 */
+	result GetGlyphs(const Font& font, const wchar_t* pCharacters, int count, GlyphInfo* pGlyphs)
+	{
+		TryReturn(__maxMemorySize > 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(pCharacters != null && pGlyphs != null && count >= 0, E_INVALID_ARG,
+			"[%s] The pCharacters or pGlyphs is null, or the count(%d) is negative.", GetErrorMessage(E_INVALID_ARG), count);
+
+		__GlyphAtlasFace face;
+		LoadFace(font, face);
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		int faceIndex = -1;
+		result r = FindFace(face, true, faceIndex);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__clock++;
+		for (int i = 0; i < count; i++)
+		{
+			r = GetGlyph(font, faceIndex, pCharacters[i], pGlyphs[i]);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the glyph of the specified character, which is rasterized with the specified font if it is not cached.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	font				The font of the character
+	 * @param[in]	character			The character
+	 * @param[out]	glyph				The glyph
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OVERFLOW			A new page exceeds the memory limit, and every page is pinned.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The glyph cannot be rasterized.
+	 * @remarks		GetGlyphs() is faster for several characters, because it locks the atlas once.
+	 */
+	result GetGlyph(const Font& font, wchar_t character, GlyphInfo& glyph)
+	{
+		return GetGlyphs(font, &character, 1, &glyph);
+	}
+
+	/**
+	 * Keeps the memory of the pages from being freed until the specified canvas is flushed, which reads them in the deferred mode.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	canvas				The canvas on which the glyphs are drawn
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The pages can still be evicted, and the glyphs of an evicted page are rasterized again when they are requested.
+	 *				The memory of the evicted pages is freed when all the canvases which hold the pages have been flushed or destroyed,
+	 *				so that it is not counted by GetMemorySize() and can exceed the limit until then. @n
+	 *				Calling this method again before the canvas is flushed has no effect. This instance must outlive the canvas.
+	 */
+	result HoldPages(SoftwareCanvas& canvas)
+	{
+		TryReturn(__maxMemorySize > 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		if (canvas.HasFlushListener(*this))
+		{
+			return E_SUCCESS;
+		}
+
+		result r = canvas.AddFlushListener(*this);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__holdCount++;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Keeps the glyphs of the specified font from being evicted, until UnpinFont() is called as many times.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	font				The font
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The pin applies to all the Font instances of the same face, size, and style.
+	 */
+	result PinFont(const Font& font)
+	{
+		TryReturn(__maxMemorySize > 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__GlyphAtlasFace face;
+		LoadFace(font, face);
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		int faceIndex = -1;
+		result r = FindFace(face, true, faceIndex);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__ppFaces[faceIndex]->pinCount++;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Releases a pin of the specified font.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	font				The font
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OBJ_NOT_FOUND		The font has not been pinned.
+	 */
+	result UnpinFont(const Font& font)
+	{
+		TryReturn(__maxMemorySize > 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__GlyphAtlasFace face;
+		LoadFace(font, face);
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		int faceIndex = -1;
+		FindFace(face, false, faceIndex);
+		TryReturn(faceIndex >= 0 && __ppFaces[faceIndex]->pinCount > 0, E_OBJ_NOT_FOUND, "[%s] The font has not been pinned.", GetErrorMessage(E_OBJ_NOT_FOUND));
+
+		__ppFaces[faceIndex]->pinCount--;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Sets the maximum number of bytes of the pages, and evicts the pages which exceed it.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	maxMemorySize		The maximum number of bytes of the pages
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c maxMemorySize is less than the size of a page, which is 64 KB.
+	 * @remarks		The pinned pages are kept, even if they exceed the limit.
+	 */
+	result SetMaxMemorySize(long long maxMemorySize)
+	{
+		TryReturn(__maxMemorySize > 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(maxMemorySize >= DEFAULT_PAGE_SIZE * DEFAULT_PAGE_SIZE, E_OUT_OF_RANGE,
+			"[%s] The maxMemorySize(%lld) MUST be at least the size of a page.", GetErrorMessage(E_OUT_OF_RANGE), maxMemorySize);
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		__maxMemorySize = maxMemorySize;
+		__clock++;
+		while (__memorySize > __maxMemorySize && EvictPage())
+		{
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the maximum number of bytes of the pages.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The maximum number of bytes of the pages
+	 */
+	long long GetMaxMemorySize(void) const
+	{
+		return __maxMemorySize;
+	}
+
+	/**
+	 * Evicts all the pages of the fonts which are not pinned, such as when the memory of the device is low.
+	 *
+	 * @since	2.1
+	 */
+	void RemoveAll(void)
+	{
+		if (__maxMemorySize == 0)
+		{
+			return;
+		}
+
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		__clock++;
+		while (EvictPage())
+		{
+		}
+	}
+
+	/**
+	 * Gets the number of bytes of the pages.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of bytes of the pages
+	 */
+	long long GetMemorySize(void) const
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		return __memorySize;
+	}
+
+	/**
+	 * Gets the number of the cached glyphs.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the cached glyphs
+	 */
+	int GetGlyphCount(void) const
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		return __entryCount;
+	}
+
+	/**
+	 * Gets the number of the glyphs which have been found in the atlas, since the creation or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the hits
+	 */
+	long long GetHitCount(void) const
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		return __hitCount;
+	}
+
+	/**
+	 * Gets the number of the glyphs which have been rasterized, since the creation or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the misses
+	 */
+	long long GetMissCount(void) const
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		return __missCount;
+	}
+
+	/**
+	 * Gets the ratio of the hits to all the requested glyphs, since the creation or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The hit rate, from @c 0.0f to @c 1.0f, @n
+	 *				else @c 0.0f if no glyph has been requested
+	 */
+	float GetHitRate(void) const
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		long long total = __hitCount + __missCount;
+		return (total > 0) ? static_cast< float >(static_cast< double >(__hitCount) / total) : 0.0f;
+	}
+
+	/**
+	 * Gets the number of the pages which have been evicted, since the creation or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the evicted pages
+	 */
+	long long GetEvictionCount(void) const
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		return __evictionCount;
+	}
+
+	/**
+	 * Resets the numbers of the hits, the misses, and the evictions.
+	 *
+	 * @since	2.1
+	 */
+	void ResetStatistics(void)
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		__hitCount = 0;
+		__missCount = 0;
+		__evictionCount = 0;
+	}
+
+private:
+	GlyphAtlas(const GlyphAtlas& rhs);
+	GlyphAtlas& operator =(const GlyphAtlas& rhs);
+
+	static GlyphAtlas* CreateInstanceN(void)
+	{
+		GlyphAtlas* pAtlas = new (std::nothrow) GlyphAtlas();
+		TryReturn(pAtlas != null, null, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pAtlas->Construct();
+		if (r != E_SUCCESS)
+		{
+			delete pAtlas;
+			pAtlas = null;
+		}
+
+		return pAtlas;
+	}
+
+	static void LoadFace(const Font& font, __GlyphAtlasFace& face)
+	{
+		face.faceName = font.GetFaceName();
+		face.size = font.GetSizeF();
+		face.style = (font.IsBold() ? FONT_STYLE_BOLD : 0) | (font.IsItalic() ? FONT_STYLE_ITALIC : 0);
+		face.charSpace = font.GetCharSpace();
+		face.lineHeight = font.GetMaxHeight();
+		face.pinCount = 0;
+		face.currentPage = -1;
+	}
+
+	// Finds the face which is equal to the specified one, and adds it if isAdded is true
+	result FindFace(const __GlyphAtlasFace& face, bool isAdded, int& faceIndex)
+	{
+		for (int i = 0; i < __faceCount; i++)
+		{
+			const __GlyphAtlasFace& other = *__ppFaces[i];
+			if (other.size == face.size && other.style == face.style && other.charSpace == face.charSpace && other.faceName == face.faceName)
+			{
+				faceIndex = i;
+				return E_SUCCESS;
+			}
+		}
+
+		faceIndex = -1;
+		if (!isAdded)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		result r = Grow(__ppFaces, __faceCount, __faceCapacity, __faceCount + 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__GlyphAtlasFace* pFace = new (std::nothrow) __GlyphAtlasFace(face);
+		TryReturn(pFace != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		faceIndex = __faceCount;
+		__ppFaces[__faceCount++] = pFace;
+
+		return E_SUCCESS;
+	}
+
+	result GetGlyph(const Font& font, int faceIndex, wchar_t character, GlyphInfo& glyph)
+	{
+		long long key = (static_cast< long long >(faceIndex) << 32) | static_cast< unsigned int >(character);
+
+		int index = FindEntry(key);
+		if (index >= 0)
+		{
+			__hitCount++;
+		}
+		else
+		{
+			__missCount++;
+
+			result r = AddEntry(font, faceIndex, key, character, index);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		const __GlyphAtlasEntry& entry = __pEntries[index];
+		if (entry.page >= 0)
+		{
+			__GlyphAtlasPage& page = __pPages[entry.page];
+			page.lastUse = __clock;
+			glyph.pPage = page.pPixels;
+			glyph.pitch = page.size;
+		}
+		else
+		{
+			glyph.pPage = null;
+			glyph.pitch = 0;
+		}
+		glyph.x = entry.x;
+		glyph.y = entry.y;
+		glyph.width = entry.width;
+		glyph.height = entry.height;
+		glyph.offsetX = entry.offsetX;
+		glyph.offsetY = entry.offsetY;
+		glyph.advance = entry.advance;
+
+		return E_SUCCESS;
+	}
+
+	static unsigned int GetSlot(long long key, int slotCapacity)
+	{
+		unsigned long long hash = static_cast< unsigned long long >(key) * 0x9E3779B97F4A7C15ULL;
+		return static_cast< unsigned int >(hash >> 32) & (slotCapacity - 1);
+	}
+
+	int FindEntry(long long key) const
+	{
+		if (__slotCapacity == 0)
+		{
+			return -1;
+		}
+
+		for (unsigned int slot = GetSlot(key, __slotCapacity); __pSlots[slot] >= 0; slot = (slot + 1) & (__slotCapacity - 1))
+		{
+			if (__pEntries[__pSlots[slot]].key == key)
+			{
+				return __pSlots[slot];
+			}
+		}
+
+		return -1;
+	}
+
+	// Rebuilds the slots of the entries, with at least twice as many slots as the specified number of entries
+	result RebuildSlots(int minEntryCount)
+	{
+		int slotCapacity = (__slotCapacity > 0) ? __slotCapacity : DEFAULT_CAPACITY;
+		while (slotCapacity < minEntryCount * 2)
+		{
+			slotCapacity *= 2;
+		}
+
+		if (slotCapacity != __slotCapacity)
+		{
+			int* pSlots = new (std::nothrow) int[slotCapacity];
+			TryReturn(pSlots != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			delete[] __pSlots;
+			__pSlots = pSlots;
+			__slotCapacity = slotCapacity;
+		}
+
+		memset(__pSlots, 0xFF, sizeof(int) * __slotCapacity);
+		for (int i = 0; i < __entryCount; i++)
+		{
+			InsertSlot(i);
+		}
+
+		return E_SUCCESS;
+	}
+
+	void InsertSlot(int index)
+	{
+		unsigned int slot = GetSlot(__pEntries[index].key, __slotCapacity);
+		while (__pSlots[slot] >= 0)
+		{
+			slot = (slot + 1) & (__slotCapacity - 1);
+		}
+		__pSlots[slot] = index;
+	}
+
+	// Rasterizes the glyph, and adds it to the current page of the face
+	result AddEntry(const Font& font, int faceIndex, long long key, wchar_t character, int& index)
+	{
+		result r = Grow(__pEntries, __entryCount, __entryCapacity, __entryCount + 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (__slotCapacity < (__entryCount + 1) * 2)
+		{
+			r = RebuildSlots(__entryCount + 1);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		__GlyphAtlasEntry entry;
+		memset(&entry, 0, sizeof(entry));
+		entry.key = key;
+		entry.page = -1;
+
+		r = RasterizeGlyph(font, faceIndex, character, entry);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// The page allocation can evict entries, so that the entry is appended after it
+		index = __entryCount;
+		__pEntries[__entryCount++] = entry;
+		InsertSlot(index);
+
+		return E_SUCCESS;
+	}
+
+	// Draws the glyph in white on black, and copies the bounding box of its coverage to a page
+	result RasterizeGlyph(const Font& font, int faceIndex, wchar_t character, __GlyphAtlasEntry& entry)
+	{
+		const __GlyphAtlasFace& face = *__ppFaces[faceIndex];
+		Tizen::Base::String text(character);
+
+		Dimension extent;
+		result r = font.GetTextExtent(text, 1, extent);
+		TryReturn(r == E_SUCCESS, E_SYSTEM, "[%s] Failed to measure the character(0x%x).", GetErrorMessage(E_SYSTEM), character);
+
+		entry.advance = extent.width;
+		if (extent.width <= 0 || face.lineHeight <= 0)
+		{
+			return E_SUCCESS;
+		}
+
+		// The margin keeps the overhang of italic glyphs and negative bearings inside the canvas
+		int margin = face.lineHeight / 2 + 1;
+		int cellWidth = extent.width + margin * 2;
+		int cellHeight = face.lineHeight;
+
+		BufferInfo bufferInfo;
+		r = PrepareCanvas(cellWidth, cellHeight);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pCanvas->SetBackgroundColor(Color(0xFF000000));
+		__pCanvas->SetForegroundColor(Color(0xFFFFFFFF));
+		__pCanvas->Clear();
+		__pCanvas->SetFont(font);
+		r = __pCanvas->DrawText(Point(margin, 0), text);
+		TryReturn(r == E_SUCCESS, E_SYSTEM, "[%s] Failed to draw the character(0x%x).", GetErrorMessage(E_SYSTEM), character);
+
+		r = __pCanvas->Lock(bufferInfo);
+		TryReturn(r == E_SUCCESS, E_SYSTEM, "[%s] Failed to lock the canvas.", GetErrorMessage(E_SYSTEM));
+
+		{
+			int left = cellWidth;
+			int top = cellHeight;
+			int right = 0;
+			int bottom = 0;
+			for (int y = 0; y < cellHeight; y++)
+			{
+				const unsigned int* pRow = GetCanvasRow(bufferInfo, y);
+				for (int x = 0; x < cellWidth; x++)
+				{
+					if ((pRow[x] & 0x0000FF00) != 0)
+					{
+						left = (x < left) ? x : left;
+						right = (x + 1 > right) ? x + 1 : right;
+						top = (y < top) ? y : top;
+						bottom = y + 1;
+					}
+				}
+			}
+
+			if (left < right)
+			{
+				int width = right - left;
+				int height = bottom - top;
+				r = AllocateArea(faceIndex, width, height, entry.page, entry.x, entry.y);
+				TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+				const __GlyphAtlasPage& page = __pPages[entry.page];
+				for (int y = 0; y < height; y++)
+				{
+					const unsigned int* pSource = GetCanvasRow(bufferInfo, top + y) + left;
+					unsigned char* pDestination = page.pPixels + static_cast< long >(entry.y + y) * page.size + entry.x;
+					for (int x = 0; x < width; x++)
+					{
+						pDestination[x] = static_cast< unsigned char >((pSource[x] >> 8) & 0xFF);
+					}
+				}
+
+				entry.width = width;
+				entry.height = height;
+				entry.offsetX = left - margin;
+				entry.offsetY = top;
+			}
+		}
+
+	CATCH:
+		__pCanvas->Unlock();
+		return r;
+	}
+
+	static const unsigned int* GetCanvasRow(const BufferInfo& bufferInfo, int y)
+	{
+		return reinterpret_cast< const unsigned int* >(static_cast< const unsigned char* >(bufferInfo.pPixels) + static_cast< long >(y) * bufferInfo.pitch);
+	}
+
+	// Keeps a scratch canvas which is at least as large as the cell of a glyph
+	result PrepareCanvas(int width, int height)
+	{
+		if (__pCanvas != null && __canvasWidth >= width && __canvasHeight >= height)
+		{
+			return E_SUCCESS;
+		}
+
+		width = (width > __canvasWidth) ? width : __canvasWidth;
+		height = (height > __canvasHeight) ? height : __canvasHeight;
+
+		delete __pCanvas;
+		__canvasWidth = 0;
+		__canvasHeight = 0;
+
+		__pCanvas = new (std::nothrow) Canvas();
+		TryReturn(__pCanvas != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = __pCanvas->Construct(Rectangle(0, 0, width, height));
+		if (r != E_SUCCESS)
+		{
+			delete __pCanvas;
+			__pCanvas = null;
+		}
+		TryReturn(r == E_SUCCESS, E_SYSTEM, "[%s] Failed to create the canvas(%d, %d).", GetErrorMessage(E_SYSTEM), width, height);
+
+		__canvasWidth = width;
+		__canvasHeight = height;
+
+		return E_SUCCESS;
+	}
+
+	// Places the area in the current row of the current page of the face, in the next row, or in a new page
+	result AllocateArea(int faceIndex, int width, int height, int& pageIndex, int& x, int& y)
+	{
+		__GlyphAtlasFace& face = *__ppFaces[faceIndex];
+
+		if (face.currentPage >= 0 && Place(__pPages[face.currentPage], width, height, x, y))
+		{
+			pageIndex = face.currentPage;
+			return E_SUCCESS;
+		}
+
+		int size = DEFAULT_PAGE_SIZE;
+		while (size < width || size < height)
+		{
+			size *= 2;
+		}
+
+		long long pageSize = static_cast< long long >(size) * size;
+		while (__memorySize + pageSize > __maxMemorySize)
+		{
+			TryReturn(EvictPage(), E_OVERFLOW, "[%s] The memory limit(%lld) is exceeded, and all the pages are in use.",
+				GetErrorMessage(E_OVERFLOW), __maxMemorySize);
+		}
+
+		pageIndex = -1;
+		for (int i = 0; i < __pageCount && pageIndex < 0; i++)
+		{
+			pageIndex = (__pPages[i].pPixels == null) ? i : -1;
+		}
+		if (pageIndex < 0)
+		{
+			result r = Grow(__pPages, __pageCount, __pageCapacity, __pageCount + 1);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+			pageIndex = __pageCount++;
+			memset(&__pPages[pageIndex], 0, sizeof(__GlyphAtlasPage));
+			__pPages[pageIndex].face = -1;
+		}
+
+		__GlyphAtlasPage& page = __pPages[pageIndex];
+		page.pPixels = new (std::nothrow) unsigned char[pageSize];
+		TryReturn(page.pPixels != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		page.size = size;
+		page.face = faceIndex;
+		page.cursorX = 0;
+		page.cursorY = 0;
+		page.rowHeight = 0;
+		page.lastUse = __clock;
+		__memorySize += pageSize;
+		face.currentPage = pageIndex;
+
+		Place(page, width, height, x, y);
+
+		return E_SUCCESS;
+	}
+
+	static bool Place(__GlyphAtlasPage& page, int width, int height, int& x, int& y)
+	{
+		int cursorX = page.cursorX;
+		int cursorY = page.cursorY;
+		int rowHeight = page.rowHeight;
+		if (cursorX + width > page.size)
+		{
+			cursorX = 0;
+			cursorY += rowHeight;
+			rowHeight = 0;
+		}
+
+		if (cursorY + height > page.size)
+		{
+			return false;
+		}
+
+		x = cursorX;
+		y = cursorY;
+		page.cursorX = cursorX + width;
+		page.cursorY = cursorY;
+		page.rowHeight = (height > rowHeight) ? height : rowHeight;
+
+		return true;
+	}
+
+	// Called by a canvas which has been held by HoldPages()
+	virtual void OnSoftwareCanvasFlushed(void)
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+
+		__holdCount--;
+		if (__holdCount == 0)
+		{
+			FreeRetiredPages();
+		}
+	}
+
+	void FreeRetiredPages(void)
+	{
+		for (int i = 0; i < __retiredPageCount; i++)
+		{
+			delete[] __ppRetiredPages[i];
+		}
+		__retiredPageCount = 0;
+	}
+
+	// Evicts the least recently used page which is neither pinned nor used by the current call, and removes its entries
+	bool EvictPage(void)
+	{
+		int victim = -1;
+		for (int i = 0; i < __pageCount; i++)
+		{
+			const __GlyphAtlasPage& page = __pPages[i];
+			if (page.pPixels == null || page.lastUse == __clock || __ppFaces[page.face]->pinCount > 0)
+			{
+				continue;
+			}
+
+			if (victim < 0 || page.lastUse < __pPages[victim].lastUse)
+			{
+				victim = i;
+			}
+		}
+
+		if (victim < 0)
+		{
+			return false;
+		}
+
+		// A held canvas can still read the page, so that its memory is kept until the canvas is flushed
+		if (__holdCount > 0 && Grow(__ppRetiredPages, __retiredPageCount, __retiredPageCapacity, __retiredPageCount + 1) != E_SUCCESS)
+		{
+			return false;
+		}
+
+		__GlyphAtlasPage& page = __pPages[victim];
+		__GlyphAtlasFace& face = *__ppFaces[page.face];
+		if (face.currentPage == victim)
+		{
+			face.currentPage = -1;
+		}
+
+		if (__holdCount > 0)
+		{
+			__ppRetiredPages[__retiredPageCount++] = page.pPixels;
+		}
+		else
+		{
+			delete[] page.pPixels;
+		}
+		page.pPixels = null;
+		page.face = -1;
+		__memorySize -= static_cast< long long >(page.size) * page.size;
+		__evictionCount++;
+
+		int count = 0;
+		for (int i = 0; i < __entryCount; i++)
+		{
+			if (__pEntries[i].page != victim)
+			{
+				__pEntries[count++] = __pEntries[i];
+			}
+		}
+		__entryCount = count;
+
+		// The slots are only compacted, so that the rebuild does not allocate
+		RebuildSlots(0);
+
+		return true;
+	}
+
+	template< class Type >
+	static result Grow(Type*& pArray, int count, int& capacity, int minCapacity)
+	{
+		if (minCapacity <= capacity)
+		{
+			return E_SUCCESS;
+		}
+
+		int newCapacity = (capacity > 0) ? capacity : DEFAULT_CAPACITY;
+		while (newCapacity < minCapacity)
+		{
+			newCapacity *= 2;
+		}
+
+		Type* pNewArray = new (std::nothrow) Type[newCapacity];
+		TryReturn(pNewArray != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		if (count > 0)
+		{
+			memcpy(pNewArray, pArray, sizeof(Type) * count);
+		}
+		delete[] pArray;
+
+		pArray = pNewArray;
+		capacity = newCapacity;
+
+		return E_SUCCESS;
+	}
+
+	static const int DEFAULT_CAPACITY = 16;
+	static const int DEFAULT_PAGE_SIZE = 256;
+	static const long long DEFAULT_MAX_MEMORY_SIZE = 4LL * 1024 * 1024;
+
+	long long __maxMemorySize;
+	long long __memorySize;
+	mutable Tizen::Base::Runtime::Mutex __mutex;
+
+	__GlyphAtlasFace** __ppFaces;
+	int __faceCount;
+	int __faceCapacity;
+
+	__GlyphAtlasPage* __pPages;
+	int __pageCount;
+	int __pageCapacity;
+
+	// The entries, and the open addressing slots which index them by key, or -1
+	__GlyphAtlasEntry* __pEntries;
+	int __entryCount;
+	int __entryCapacity;
+	int* __pSlots;
+	int __slotCapacity;
+
+	// The scratch canvas on which the glyphs are rasterized
+	Canvas* __pCanvas;
+	int __canvasWidth;
+	int __canvasHeight;
+
+	// The number of the canvases which hold the pages, and the memory of the pages which have been evicted since they are held
+	int __holdCount;
+	unsigned char** __ppRetiredPages;
+	int __retiredPageCount;
+	int __retiredPageCapacity;
+
+	// The number of the calls, which orders the uses of the pages
+	long long __clock;
+	long long __hitCount;
+	long long __missCount;
+	long long __evictionCount;
+
+}; // GlyphAtlas
+
+}} // Tizen::Graphics
+
+#endif // _FGRP_GLYPH_ATLAS_H_
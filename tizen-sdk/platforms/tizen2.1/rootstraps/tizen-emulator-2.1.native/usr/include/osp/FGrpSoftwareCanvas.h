@@ -0,0 +1,2535 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FGrpSoftwareCanvas.h
+ * @brief	This is the header file for the %SoftwareCanvas class.
+ *
+ * This header file contains the declarations of the %SoftwareCanvas class.
+ */
+
+#ifndef _FGRP_SOFTWARE_CANVAS_H_
+#define _FGRP_SOFTWARE_CANVAS_H_
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseColIList.h>
+#include <FBaseColIListT.h>
+#include <FGrpPoint.h>
+#include <FGrpFloatPoint.h>
+#include <FGrpRectangle.h>
+#include <FGrpColor.h>
+#include <FGrpPixelFormat.h>
+#include <FGrpBufferInfo.h>
+#include <FGrpCanvasCommon.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define _FGRP_SOFTWARE_CANVAS_AVX2_
+#define _FGRP_SOFTWARE_CANVAS_SSE2_
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define _FGRP_SOFTWARE_CANVAS_SSE2_
+#endif
+
+
+namespace Tizen { namespace Graphics
+{
+
+class GlyphAtlas;
+
+//
+// @class	__ISoftwareCanvasFlushListener
+// @brief	This interface is notified when the recorded operations of a %SoftwareCanvas have been drawn or discarded.
+// @since 2.1
+//
+// The memory which the operations refer to, such as the pages of GlyphAtlas, can be released from then on.
+//
+class __ISoftwareCanvasFlushListener
+{
+public:
+	virtual ~__ISoftwareCanvasFlushListener(void) {}
+
+	virtual void OnSoftwareCanvasFlushed(void) = 0;
+
+}; // __ISoftwareCanvasFlushListener
+
+//
+// @struct	__SoftwareCanvasSpan
+// @brief	This struct contains the kernels which write a horizontal run of ARGB8888 pixels.
+// @since 2.1
+//
+// The kernels use AVX2 or SSE2, depending on the target of the compilation, and scalar code for the remaining pixels.
+// The scalar and the vector code compute the same values.
+//
+struct __SoftwareCanvasSpan
+{
+	// Fills the span with the pixel
+	static void Fill(unsigned int* pDestination, int count, unsigned int pixel)
+	{
+		int i = 0;
+
+#if defined(_FGRP_SOFTWARE_CANVAS_AVX2_)
+		__m256i pixel8 = _mm256_set1_epi32(static_cast< int >(pixel));
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_si256(reinterpret_cast< __m256i* >(pDestination + i), pixel8);
+		}
+#endif
+#if defined(_FGRP_SOFTWARE_CANVAS_SSE2_)
+		__m128i pixel4 = _mm_set1_epi32(static_cast< int >(pixel));
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_si128(reinterpret_cast< __m128i* >(pDestination + i), pixel4);
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			pDestination[i] = pixel;
+		}
+	}
+
+	// Interpolates all the channels of the span towards the pixel, by weight / 255
+	static void Lerp(unsigned int* pDestination, int count, unsigned int pixel, unsigned int weight)
+	{
+		int i = 0;
+
+#if defined(_FGRP_SOFTWARE_CANVAS_AVX2_)
+		{
+			__m256i zero = _mm256_setzero_si256();
+			__m256i pixelTerm = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast< int >(pixel)), zero),
+				_mm256_set1_epi16(static_cast< short >(weight))), _mm256_set1_epi16(128));
+			__m256i inverse = _mm256_set1_epi16(static_cast< short >(255 - weight));
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256i destination = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(pDestination + i));
+				__m256i low = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(destination, zero), inverse), pixelTerm);
+				__m256i high = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(destination, zero), inverse), pixelTerm);
+				low = _mm256_srli_epi16(_mm256_add_epi16(low, _mm256_srli_epi16(low, 8)), 8);
+				high = _mm256_srli_epi16(_mm256_add_epi16(high, _mm256_srli_epi16(high, 8)), 8);
+				_mm256_storeu_si256(reinterpret_cast< __m256i* >(pDestination + i), _mm256_packus_epi16(low, high));
+			}
+		}
+#endif
+#if defined(_FGRP_SOFTWARE_CANVAS_SSE2_)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i pixelTerm = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(static_cast< int >(pixel)), zero),
+				_mm_set1_epi16(static_cast< short >(weight))), _mm_set1_epi16(128));
+			__m128i inverse = _mm_set1_epi16(static_cast< short >(255 - weight));
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i destination = _mm_loadu_si128(reinterpret_cast< const __m128i* >(pDestination + i));
+				__m128i low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(destination, zero), inverse), pixelTerm);
+				__m128i high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(destination, zero), inverse), pixelTerm);
+				low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+				high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(pDestination + i), _mm_packus_epi16(low, high));
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			pDestination[i] = Lerp(pixel, pDestination[i], weight);
+		}
+	}
+
+	// Draws the pixels of the source, whose alpha is not premultiplied, over the span
+	static void BlendOver(unsigned int* pDestination, const unsigned int* pSource, int count)
+	{
+		int i = 0;
+
+#if defined(_FGRP_SOFTWARE_CANVAS_SSE2_)
+		// The opaque and the transparent blocks, which are the most of a typical image, are not blended
+		__m128i alphaMask = _mm_set1_epi32(static_cast< int >(0xFF000000));
+		__m128i zero = _mm_setzero_si128();
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i source = _mm_loadu_si128(reinterpret_cast< const __m128i* >(pSource + i));
+			__m128i alpha = _mm_and_si128(source, alphaMask);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xFFFF)
+			{
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(pDestination + i), source);
+			}
+			else if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) != 0xFFFF)
+			{
+				for (int j = i; j < i + 4; j++)
+				{
+					pDestination[j] = BlendOver(pSource[j], pDestination[j]);
+				}
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			pDestination[i] = BlendOver(pSource[i], pDestination[i]);
+		}
+	}
+
+	static unsigned int BlendOver(unsigned int source, unsigned int destination)
+	{
+		unsigned int alpha = source >> 24;
+		if (alpha == 0xFF)
+		{
+			return source;
+		}
+		if (alpha == 0)
+		{
+			return destination;
+		}
+		return Lerp(source | 0xFF000000, destination, alpha);
+	}
+
+	// Interpolates all the channels from the destination towards the source, by weight / 255, with rounding
+	static unsigned int Lerp(unsigned int source, unsigned int destination, unsigned int weight)
+	{
+		unsigned int inverse = 255 - weight;
+		unsigned int redBlue = (source & 0x00FF00FF) * weight + (destination & 0x00FF00FF) * inverse + 0x00800080;
+		unsigned int alphaGreen = ((source >> 8) & 0x00FF00FF) * weight + ((destination >> 8) & 0x00FF00FF) * inverse + 0x00800080;
+
+		redBlue = ((redBlue + ((redBlue >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+		alphaGreen = (alphaGreen + ((alphaGreen >> 8) & 0x00FF00FF)) & 0xFF00FF00;
+
+		return redBlue | alphaGreen;
+	}
+
+	// Interpolates all the channels from the first pixel towards the second one, by weight / 256
+	static unsigned int Interpolate(unsigned int pixel0, unsigned int pixel1, unsigned int weight)
+	{
+		unsigned int inverse = 256 - weight;
+		unsigned int redBlue = (((pixel0 & 0x00FF00FF) * inverse + (pixel1 & 0x00FF00FF) * weight) >> 8) & 0x00FF00FF;
+		unsigned int alphaGreen = (((pixel0 >> 8) & 0x00FF00FF) * inverse + ((pixel1 >> 8) & 0x00FF00FF) * weight) & 0xFF00FF00;
+
+		return redBlue | alphaGreen;
+	}
+
+	static unsigned int Divide255(unsigned int value)
+	{
+		value += 0x80;
+		return (value + (value >> 8)) >> 8;
+	}
+
+}; // __SoftwareCanvasSpan
+
+//
+// @struct	__SoftwareCanvasCommand
+// @brief	This struct is a drawing operation recorded by %SoftwareCanvas.
+// @since 2.1
+//
+struct __SoftwareCanvasCommand
+{
+	int type;
+	bool isCopy;
+	bool isAntiAliased;
+	unsigned int color;
+
+	// The affected pixels, which are clipped to the surface and to the clip bounds
+	int left;
+	int top;
+	int right;
+	int bottom;
+
+	// The points of a polygon or a polyline in the point storage of the canvas
+	int pointOffset;
+	int pointCount;
+
+	// The style of a polyline
+	float lineWidth;
+	int lineCapStyle;
+	int lineJoinStyle;
+	bool isClosed;
+
+	// The source of a bitmap or a mask, and the rectangle to which it is scaled
+	const unsigned char* pSource;
+	int sourcePitch;
+	int sourceX;
+	int sourceY;
+	int sourceWidth;
+	int sourceHeight;
+	int destinationX;
+	int destinationY;
+	int destinationWidth;
+	int destinationHeight;
+
+	// The next command of the same batch, or -1
+	int next;
+
+}; // __SoftwareCanvasCommand
+
+//
+// @struct	__SoftwareCanvasBatch
+// @brief	This struct is a run of commands of the same state, which are executed together.
+// @since 2.1
+//
+struct __SoftwareCanvasBatch
+{
+	int first;
+	int last;
+	int left;
+	int top;
+	int right;
+	int bottom;
+
+}; // __SoftwareCanvasBatch
+
+//
+// @struct	__SoftwareCanvasEdge
+// @brief	This struct is an edge of a polygon, whose end points are ordered from top to bottom.
+// @since 2.1
+//
+struct __SoftwareCanvasEdge
+{
+	float x0;
+	float y0;
+	float x1;
+	float y1;
+	float dxdy;
+
+	// 1.0f if the edge goes down, and -1.0f if it goes up
+	float direction;
+
+	static bool CompareTop(const __SoftwareCanvasEdge& edge1, const __SoftwareCanvasEdge& edge2)
+	{
+		return edge1.y0 < edge2.y0;
+	}
+
+}; // __SoftwareCanvasEdge
+
+//
+// @struct	__SoftwareCanvasColumn
+// @brief	This struct is the horizontal sampling of a column of a scaled bitmap.
+// @since 2.1
+//
+struct __SoftwareCanvasColumn
+{
+	int x0;
+	int x1;
+	unsigned int weight;
+
+}; // __SoftwareCanvasColumn
+
+/**
+ * @class	SoftwareCanvas
+ * @brief	This class draws on a memory surface with a software rasterizer, and can defer the drawing to a batch.
+ *
+ * @since	2.1
+ *
+ * The %SoftwareCanvas class draws rectangles, polygons, polylines, bitmaps, and alpha masks on a ::PIXEL_FORMAT_ARGB8888 surface which is described by a BufferInfo,
+ * such as a locked Bitmap or Canvas, or a buffer allocated by the application. It does not depend on a display,
+ * so that it can also run on a build host. @n
+ * The spans are filled and blended with SSE2 or AVX2 when the target supports them. The polygons are rasterized with exact area coverage,
+ * and the bitmaps are scaled with bilinear filtering. @n
+ * A wide polyline is converted to the outlines of its segments, joins, and caps, which are rasterized together in one pass,
+ * so that the overlapping parts are not blended twice. The points can be passed as an array or an IListT of FloatPoint,
+ * as well as an IList of Point or FloatPoint instances.
+ *
+ * If the deferred mode is enabled, the drawing methods only record the operations, which are drawn by Flush(). The flush then:
+ * - skips the operations which are entirely covered by a later opaque rectangle, such as the background of a redrawn item.
+ * - groups the operations of the same color or source bitmap, when no operation in between overlaps them, so that the order of the result is kept.
+ *
+ * The canvas accumulates the rectangles which have been drawn on, which are merged when they are close,
+ * so that only those areas are shown or copied to the display.
+ *
+ * The colors of the surface and of the source bitmaps are not premultiplied by alpha. The text is not shaped by this class,
+ * but the glyphs of a GlyphAtlas can be drawn as alpha masks, as TextRunCache does.
+ *
+ * The following example demonstrates how to use the %SoftwareCanvas class.
+ *
+ * @code
+ *	result
+ *	MyListItem::Draw(Canvas& canvas)
+ *	{
+ *		BufferInfo surfaceInfo;
+ *		result r = canvas.Lock(surfaceInfo);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		SoftwareCanvas softwareCanvas;
+ *		r = softwareCanvas.Construct(surfaceInfo);
+ *		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		softwareCanvas.SetDeferredModeEnabled(true);
+ *		softwareCanvas.FillRectangle(Color(0xFF202020), Rectangle(0, 0, 480, 96));
+ *		softwareCanvas.DrawBitmap(Rectangle(8, 8, 80, 80), __iconInfo);
+ *		softwareCanvas.FillPolygon(Color::GetColor(COLOR_ID_WHITE), __arrowPoints);
+ *
+ *		r = softwareCanvas.Flush();
+ *
+ *	CATCH:
+ *		canvas.Unlock();
+ *		return r;
+ *	}
+ * @endcode
+ */
+class SoftwareCanvas
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	SoftwareCanvas(void)
+		: __pSurface(null)
+		, __surfacePitch(0)
+		, __surfaceWidth(0)
+		, __surfaceHeight(0)
+		, __clipLeft(0)
+		, __clipTop(0)
+		, __clipRight(0)
+		, __clipBottom(0)
+		, __foregroundColor(0xFF000000)
+		, __backgroundColor(0x00000000)
+		, __lineWidth(1.0f)
+		, __lineCapStyle(LINE_CAP_STYLE_ROUND)
+		, __lineJoinStyle(LINE_JOIN_STYLE_ROUND)
+		, __isCopy(false)
+		, __isAntiAliased(true)
+		, __isDeferred(false)
+		, __pCommands(null)
+		, __commandCount(0)
+		, __commandCapacity(0)
+		, __pPoints(null)
+		, __pointCount(0)
+		, __pointCapacity(0)
+		, __pBatches(null)
+		, __batchCount(0)
+		, __batchCapacity(0)
+		, __dirtyRectangleCount(0)
+		, __pEdges(null)
+		, __edgeCapacity(0)
+		, __pActiveEdges(null)
+		, __activeEdgeCapacity(0)
+		, __pCells(null)
+		, __cellCapacity(0)
+		, __pCoverage(null)
+		, __coverageCapacity(0)
+		, __pColumns(null)
+		, __columnCapacity(0)
+		, __pRow(null)
+		, __rowCapacity(0)
+		, __ppFlushListeners(null)
+		, __flushListenerCount(0)
+		, __flushListenerCapacity(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The operations which have not been flushed are discarded.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~SoftwareCanvas(void)
+	{
+		NotifyFlushListeners();
+
+		delete[] __pCommands;
+		delete[] __pPoints;
+		delete[] __pBatches;
+		delete[] __pEdges;
+		delete[] __pActiveEdges;
+		delete[] __pCells;
+		delete[] __pCoverage;
+		delete[] __pColumns;
+		delete[] __pRow;
+		delete[] __ppFlushListeners;
+	}
+
+	/**
+	 * Initializes this instance of %SoftwareCanvas with the specified surface.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	bufferInfo				The information of the surface to draw on @n
+	 *										The pixels are not copied, and must be valid while this instance draws on them.
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_OPERATION		This instance has already been constructed.
+	 * @exception	E_INVALID_ARG			The buffer information is invalid.
+	 * @exception	E_UNSUPPORTED_FORMAT	The pixel format of the buffer is not ::PIXEL_FORMAT_ARGB8888.
+	 * @remarks		The clip bounds are set to the whole surface.
+	 */
+	result Construct(const BufferInfo& bufferInfo)
+	{
+		TryReturn(__pSurface == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		result r = CheckBufferInfo(bufferInfo);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pSurface = static_cast< unsigned char* >(bufferInfo.pPixels);
+		__surfacePitch = bufferInfo.pitch;
+		__surfaceWidth = bufferInfo.width;
+		__surfaceHeight = bufferInfo.height;
+		__clipRight = __surfaceWidth;
+		__clipBottom = __surfaceHeight;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the bounds of the surface.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The bounds of the surface
+	 */
+	Rectangle GetBounds(void) const
+	{
+		return Rectangle(0, 0, __surfaceWidth, __surfaceHeight);
+	}
+
+	/**
+	 * Sets the clip bounds, outside of which the drawing methods do not change the pixels.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	rect				The clip bounds, which are intersected with the bounds of the surface
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c rect does not intersect with the surface.
+	 * @remarks		The recorded operations keep the clip bounds at the time they are recorded.
+	 */
+	result SetClipBounds(const Rectangle& rect)
+	{
+		int left = (rect.x > 0) ? rect.x : 0;
+		int top = (rect.y > 0) ? rect.y : 0;
+		int right = (rect.x + rect.width < __surfaceWidth) ? rect.x + rect.width : __surfaceWidth;
+		int bottom = (rect.y + rect.height < __surfaceHeight) ? rect.y + rect.height : __surfaceHeight;
+		TryReturn(left < right && top < bottom, E_OUT_OF_RANGE, "[%s] The rect(%d, %d, %d, %d) does not intersect with the surface.",
+			GetErrorMessage(E_OUT_OF_RANGE), rect.x, rect.y, rect.width, rect.height);
+
+		__clipLeft = left;
+		__clipTop = top;
+		__clipRight = right;
+		__clipBottom = bottom;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the clip bounds.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The clip bounds
+	 */
+	Rectangle GetClipBounds(void) const
+	{
+		return Rectangle(__clipLeft, __clipTop, __clipRight - __clipLeft, __clipBottom - __clipTop);
+	}
+
+	/**
+	 * Sets the color with which Clear() fills the surface.
+	 *
+	 * @since	2.1
+	 *
+	 * @param[in]	color		The background color @n
+	 *							The default value is the transparent black.
+	 */
+	void SetBackgroundColor(const Color& color)
+	{
+		__backgroundColor = color.GetRGB32();
+	}
+
+	/**
+	 * Gets the background color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The background color
+	 */
+	Color GetBackgroundColor(void) const
+	{
+		return Color(__backgroundColor, true);
+	}
+
+	/**
+	 * Sets the color with which the lines are drawn.
+	 *
+	 * @since	2.1
+	 *
+	 * @param[in]	color		The foreground color @n
+	 *							The default value is the opaque black.
+	 */
+	void SetForegroundColor(const Color& color)
+	{
+		__foregroundColor = color.GetRGB32();
+	}
+
+	/**
+	 * Gets the foreground color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The foreground color
+	 */
+	Color GetForegroundColor(void) const
+	{
+		return Color(__foregroundColor, true);
+	}
+
+	/**
+	 * Sets the width of the lines.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	width				The width of the lines, which must be greater than @c 0 @n
+	 *									The default value is @c 1.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c width is less than or equal to @c 0.
+	 */
+	result SetLineWidth(int width)
+	{
+		return SetLineWidth(static_cast< float >(width));
+	}
+
+	/**
+	 * Sets the width of the lines.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	width				The width of the lines, which must be greater than @c 0.0f @n
+	 *									The default value is @c 1.0f.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c width is less than or equal to @c 0.0f, or too large.
+	 */
+	result SetLineWidth(float width)
+	{
+		TryReturn(width > 0.0f && width <= MAX_LINE_WIDTH, E_OUT_OF_RANGE, "[%s] The width(%f) MUST be greater than 0.0f.",
+			GetErrorMessage(E_OUT_OF_RANGE), width);
+
+		__lineWidth = width;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the width of the lines, rounded to an integer.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The width of the lines
+	 */
+	int GetLineWidth(void) const
+	{
+		return static_cast< int >(__lineWidth + 0.5f);
+	}
+
+	/**
+	 * Gets the width of the lines.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The width of the lines
+	 */
+	float GetLineWidthF(void) const
+	{
+		return __lineWidth;
+	}
+
+	/**
+	 * Sets the style of the ends of the polylines.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	lineCapStyle		The line cap style @n
+	 *									The default value is ::LINE_CAP_STYLE_ROUND.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_ARG		The specified @c lineCapStyle is invalid.
+	 */
+	result SetLineCapStyle(LineCapStyle lineCapStyle)
+	{
+		TryReturn(lineCapStyle == LINE_CAP_STYLE_ROUND || lineCapStyle == LINE_CAP_STYLE_BUTT || lineCapStyle == LINE_CAP_STYLE_SQUARE, E_INVALID_ARG,
+			"[%s] The lineCapStyle(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), lineCapStyle);
+
+		__lineCapStyle = lineCapStyle;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the line cap style.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The line cap style
+	 */
+	LineCapStyle GetLineCapStyle(void) const
+	{
+		return __lineCapStyle;
+	}
+
+	/**
+	 * Sets the style of the corners of the polylines and the polygons.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	lineJoinStyle		The line join style @n
+	 *									The default value is ::LINE_JOIN_STYLE_ROUND.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_ARG		The specified @c lineJoinStyle is invalid.
+	 * @remarks		A miter which is longer than 4 times the width of the line is drawn as a bevel.
+	 */
+	result SetLineJoinStyle(LineJoinStyle lineJoinStyle)
+	{
+		TryReturn(lineJoinStyle == LINE_JOIN_STYLE_ROUND || lineJoinStyle == LINE_JOIN_STYLE_MITER || lineJoinStyle == LINE_JOIN_STYLE_BEVEL, E_INVALID_ARG,
+			"[%s] The lineJoinStyle(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), lineJoinStyle);
+
+		__lineJoinStyle = lineJoinStyle;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the line join style.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The line join style
+	 */
+	LineJoinStyle GetLineJoinStyle(void) const
+	{
+		return __lineJoinStyle;
+	}
+
+	/**
+	 * Sets the composite mode of the drawing methods.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	compositeMode				The composite mode @n
+	 *											The default value is ::COMPOSITE_MODE_SRC_OVER.
+	 * @exception	E_SUCCESS					The method is successful.
+	 * @exception	E_UNSUPPORTED_OPERATION		The specified @c compositeMode is neither ::COMPOSITE_MODE_SRC_OVER nor ::COMPOSITE_MODE_SRC.
+	 */
+	result SetCompositeMode(CompositeMode compositeMode)
+	{
+		TryReturn(compositeMode == COMPOSITE_MODE_SRC_OVER || compositeMode == COMPOSITE_MODE_SRC, E_UNSUPPORTED_OPERATION,
+			"[%s] The compositeMode(%d) is not supported.", GetErrorMessage(E_UNSUPPORTED_OPERATION), compositeMode);
+
+		__isCopy = (compositeMode == COMPOSITE_MODE_SRC);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the composite mode.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The composite mode
+	 */
+	CompositeMode GetCompositeMode(void) const
+	{
+		return __isCopy ? COMPOSITE_MODE_SRC : COMPOSITE_MODE_SRC_OVER;
+	}
+
+	/**
+	 * Enables or disables the anti-aliasing of the polygons and the lines.
+	 *
+	 * @since	2.1
+	 *
+	 * @param[in]	enable		Set to @c true to enable the anti-aliasing, which is the default, @n
+	 *							else @c false
+	 */
+	void SetAntiAliasingEnabled(bool enable)
+	{
+		__isAntiAliased = enable;
+	}
+
+	/**
+	 * Checks whether the anti-aliasing is enabled.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the anti-aliasing is enabled, @n
+	 *				else @c false
+	 */
+	bool IsAntiAliasingEnabled(void) const
+	{
+		return __isAntiAliased;
+	}
+
+	/**
+	 * Enables or disables the deferred mode, in which the drawing methods record the operations until Flush() is called.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	enable				Set to @c true to enable the deferred mode, @n
+	 *									else @c false to draw the operations immediately, which is the default
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient to draw the recorded operations.
+	 * @remarks		When the deferred mode is disabled, the recorded operations are flushed.
+	 */
+	result SetDeferredModeEnabled(bool enable)
+	{
+		__isDeferred = enable;
+
+		return enable ? E_SUCCESS : Flush();
+	}
+
+	/**
+	 * Checks whether the deferred mode is enabled.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the deferred mode is enabled, @n
+	 *				else @c false
+	 */
+	bool IsDeferredModeEnabled(void) const
+	{
+		return __isDeferred;
+	}
+
+	/**
+	 * Fills the clip bounds with the background color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The pixels are replaced, regardless of the composite mode.
+	 */
+	result Clear(void)
+	{
+		return Clear(GetClipBounds());
+	}
+
+	/**
+	 * Fills the specified area with the background color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	rect				The area to clear
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The width or the height of the specified @c rect is negative, or it is outside the surface.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The pixels are replaced, regardless of the composite mode.
+	 */
+	result Clear(const Rectangle& rect)
+	{
+		return RecordFill(__backgroundColor, true, rect);
+	}
+
+	/**
+	 * Fills the specified rectangle with the specified color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	color				The fill color
+	 * @param[in]	rect				The rectangle to fill
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The width or the height of the specified @c rect is negative, or it is outside the surface.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result FillRectangle(const Color& color, const Rectangle& rect)
+	{
+		return RecordFill(color.GetRGB32(), __isCopy, rect);
+	}
+
+	/**
+	 * Fills the specified polygon with the specified color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	color				The fill color
+	 * @param[in]	points				A list of the vertices of the polygon, which are Point or FloatPoint instances @n
+	 *									The vertices are on the corners of the pixels, and the last vertex is connected to the first.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c points contains an object which is neither a Point nor a FloatPoint.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The polygon is filled by the non-zero winding rule. @n
+	 *				A polygon of less than 3 vertices is not drawn.
+	 */
+	result FillPolygon(const Color& color, const Tizen::Base::Collection::IList& points)
+	{
+		result r = StorePoints(points);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordPolygon(color.GetRGB32(), points.GetCount());
+	}
+
+	/**
+	 * Fills the specified polygon with the specified color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	color				The fill color
+	 * @param[in]	pPoints				An array of the vertices of the polygon @n
+	 *									The vertices are on the corners of the pixels, and the last vertex is connected to the first.
+	 * @param[in]	count				The number of vertices
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pPoints is @c null, or the specified @c count is negative.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The polygon is filled by the non-zero winding rule. @n
+	 *				A polygon of less than 3 vertices is not drawn.
+	 */
+	result FillPolygon(const Color& color, const FloatPoint* pPoints, int count)
+	{
+		result r = StorePoints(pPoints, count);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordPolygon(color.GetRGB32(), count);
+	}
+
+	/**
+	 * Fills the specified polygon with the specified color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	color				The fill color
+	 * @param[in]	points				A list of the vertices of the polygon @n
+	 *									The vertices are on the corners of the pixels, and the last vertex is connected to the first.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The polygon is filled by the non-zero winding rule. @n
+	 *				A polygon of less than 3 vertices is not drawn.
+	 */
+	result FillPolygon(const Color& color, const Tizen::Base::Collection::IListT< FloatPoint >& points)
+	{
+		result r = StorePoints(points);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordPolygon(color.GetRGB32(), points.GetCount());
+	}
+
+	/**
+	 * Draws a line between the specified points with the foreground color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	point1				The start of the line
+	 * @param[in]	point2				The end of the line
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The points are on the corners of the pixels, so that a horizontal line of the width @c 1 between integer points covers the halves of two rows.
+	 */
+	result DrawLine(const Point& point1, const Point& point2)
+	{
+		return DrawLine(FloatPoint(static_cast< float >(point1.x), static_cast< float >(point1.y)),
+			FloatPoint(static_cast< float >(point2.x), static_cast< float >(point2.y)));
+	}
+
+	/**
+	 * Draws a line between the specified points with the foreground color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	point1				The start of the line
+	 * @param[in]	point2				The end of the line
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The points are on the corners of the pixels, so that a horizontal line of the width @c 1 between integer points covers the halves of two rows.
+	 */
+	result DrawLine(const FloatPoint& point1, const FloatPoint& point2)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		result r = Grow(__pPoints, __pointCount * 2, __pointCapacity, (__pointCount + 2) * 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		float* pPoints = __pPoints + __pointCount * 2;
+		pPoints[0] = point1.x;
+		pPoints[1] = point1.y;
+		pPoints[2] = point2.x;
+		pPoints[3] = point2.y;
+
+		return RecordStroke(2, false);
+	}
+
+	/**
+	 * Draws a polyline through the specified points with the foreground color, the line width, and the line styles.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	points				A list of the points, which are Point or FloatPoint instances
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c points contains an object which is neither a Point nor a FloatPoint.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The points are on the corners of the pixels. @n
+	 *				The segments, the joins, and the caps are rasterized together, so that a translucent polyline is blended once on each pixel.
+	 */
+	result DrawPolyline(const Tizen::Base::Collection::IList& points)
+	{
+		result r = StorePoints(points);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordStroke(points.GetCount(), false);
+	}
+
+	/**
+	 * Draws a polyline through the specified points with the foreground color, the line width, and the line styles.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pPoints				An array of the points
+	 * @param[in]	count				The number of points
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pPoints is @c null, or the specified @c count is negative.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The points are on the corners of the pixels. @n
+	 *				The segments, the joins, and the caps are rasterized together, so that a translucent polyline is blended once on each pixel.
+	 */
+	result DrawPolyline(const FloatPoint* pPoints, int count)
+	{
+		result r = StorePoints(pPoints, count);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordStroke(count, false);
+	}
+
+	/**
+	 * Draws a polyline through the specified points with the foreground color, the line width, and the line styles.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	points				A list of the points
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The points are on the corners of the pixels. @n
+	 *				The segments, the joins, and the caps are rasterized together, so that a translucent polyline is blended once on each pixel.
+	 */
+	result DrawPolyline(const Tizen::Base::Collection::IListT< FloatPoint >& points)
+	{
+		result r = StorePoints(points);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordStroke(points.GetCount(), false);
+	}
+
+	/**
+	 * Draws the outline of the specified polygon with the foreground color, the line width, and the line join style.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	points				A list of the vertices, which are Point or FloatPoint instances
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c points contains an object which is neither a Point nor a FloatPoint.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The last vertex is connected to the first, and all the vertices are joined.
+	 */
+	result DrawPolygon(const Tizen::Base::Collection::IList& points)
+	{
+		result r = StorePoints(points);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordStroke(points.GetCount(), true);
+	}
+
+	/**
+	 * Draws the outline of the specified polygon with the foreground color, the line width, and the line join style.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pPoints				An array of the vertices
+	 * @param[in]	count				The number of vertices
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pPoints is @c null, or the specified @c count is negative.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The last vertex is connected to the first, and all the vertices are joined.
+	 */
+	result DrawPolygon(const FloatPoint* pPoints, int count)
+	{
+		result r = StorePoints(pPoints, count);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordStroke(count, true);
+	}
+
+	/**
+	 * Draws the outline of the specified polygon with the foreground color, the line width, and the line join style.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	points				A list of the vertices
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The last vertex is connected to the first, and all the vertices are joined.
+	 */
+	result DrawPolygon(const Tizen::Base::Collection::IListT< FloatPoint >& points)
+	{
+		result r = StorePoints(points);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return RecordStroke(points.GetCount(), true);
+	}
+
+	/**
+	 * Draws the specified bitmap at the specified point without scaling.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	point				The location of the top-left corner of the bitmap
+	 * @param[in]	bufferInfo			The pixels of the bitmap, such as a locked Bitmap @n
+	 *									In the deferred mode, the pixels must be valid until Flush() is called.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The buffer information is invalid.
+	 * @exception	E_UNSUPPORTED_FORMAT	The pixel format of the bitmap is not ::PIXEL_FORMAT_ARGB8888.
+	 * @exception	E_OUT_OF_RANGE		The bitmap is outside the surface.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result DrawBitmap(const Point& point, const BufferInfo& bufferInfo)
+	{
+		return RecordBitmap(Rectangle(point.x, point.y, bufferInfo.width, bufferInfo.height), bufferInfo, Rectangle(0, 0, bufferInfo.width, bufferInfo.height));
+	}
+
+	/**
+	 * Draws the specified bitmap scaled to the specified rectangle.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	rect				The rectangle to which the bitmap is scaled
+	 * @param[in]	bufferInfo			The pixels of the bitmap, such as a locked Bitmap @n
+	 *									In the deferred mode, the pixels must be valid until Flush() is called.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The buffer information is invalid.
+	 * @exception	E_UNSUPPORTED_FORMAT	The pixel format of the bitmap is not ::PIXEL_FORMAT_ARGB8888.
+	 * @exception	E_OUT_OF_RANGE		The width or the height of the specified @c rect is negative, or it is outside the surface.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The bitmap is scaled with bilinear filtering.
+	 */
+	result DrawBitmap(const Rectangle& rect, const BufferInfo& bufferInfo)
+	{
+		return RecordBitmap(rect, bufferInfo, Rectangle(0, 0, bufferInfo.width, bufferInfo.height));
+	}
+
+	/**
+	 * Draws the specified area of the specified bitmap scaled to the specified rectangle.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	destRect			The rectangle to which the area is scaled
+	 * @param[in]	srcBufferInfo		The pixels of the bitmap, such as a locked Bitmap @n
+	 *									In the deferred mode, the pixels must be valid until Flush() is called.
+	 * @param[in]	srcRect				The area of the bitmap to draw
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The buffer information is invalid.
+	 * @exception	E_UNSUPPORTED_FORMAT	The pixel format of the bitmap is not ::PIXEL_FORMAT_ARGB8888.
+	 * @exception	E_OUT_OF_RANGE		The specified @c srcRect is not inside the bitmap, or the specified @c destRect is outside the surface.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The area is scaled with bilinear filtering, and the samples are taken only inside the area.
+	 */
+	result DrawBitmap(const Rectangle& destRect, const BufferInfo& srcBufferInfo, const Rectangle& srcRect)
+	{
+		return RecordBitmap(destRect, srcBufferInfo, srcRect);
+	}
+
+	/**
+	 * Draws the specified area of an 8-bit coverage mask, such as a glyph of GlyphAtlas, with the foreground color.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	point				The position of the top-left corner of the area
+	 * @param[in]	pMask				The first row of the mask, with one coverage value per pixel @n
+	 *									In the deferred mode, the mask must be valid until Flush() is called.
+	 * @param[in]	pitch				The number of bytes between the rows of the mask
+	 * @param[in]	maskRect			The area of the mask to draw
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pMask is @c null, or the specified @c pitch is less than the right edge of the area.
+	 * @exception	E_OUT_OF_RANGE		The specified @c maskRect has a negative position or size.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		In the deferred mode, the areas of the same mask which are drawn with the same color are batched together,
+	 *				so that the glyphs of an atlas page are drawn in one pass.
+	 */
+	result DrawAlphaMask(const Point& point, const unsigned char* pMask, int pitch, const Rectangle& maskRect)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(pMask != null, E_INVALID_ARG, "[%s] The pMask is null.", GetErrorMessage(E_INVALID_ARG));
+		TryReturn(maskRect.x >= 0 && maskRect.y >= 0 && maskRect.width >= 0 && maskRect.height >= 0, E_OUT_OF_RANGE,
+			"[%s] The maskRect(%d, %d, %d, %d) is invalid.", GetErrorMessage(E_OUT_OF_RANGE), maskRect.x, maskRect.y, maskRect.width, maskRect.height);
+		TryReturn(pitch >= maskRect.x + maskRect.width, E_INVALID_ARG, "[%s] The pitch(%d) is less than the right edge of the maskRect(%d).",
+			GetErrorMessage(E_INVALID_ARG), pitch, maskRect.x + maskRect.width);
+
+		__SoftwareCanvasCommand* pCommand = null;
+		result r = AddCommand(COMMAND_MASK, __isCopy, __foregroundColor, point.x, point.y, point.x + maskRect.width, point.y + maskRect.height, pCommand);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (pCommand == null)
+		{
+			return E_SUCCESS;
+		}
+
+		pCommand->pSource = pMask;
+		pCommand->sourcePitch = pitch;
+		pCommand->sourceX = maskRect.x;
+		pCommand->sourceY = maskRect.y;
+		pCommand->sourceWidth = maskRect.width;
+		pCommand->sourceHeight = maskRect.height;
+		pCommand->destinationX = point.x;
+		pCommand->destinationY = point.y;
+		pCommand->destinationWidth = maskRect.width;
+		pCommand->destinationHeight = maskRect.height;
+
+		return Commit();
+	}
+
+	/**
+	 * Draws the operations which have been recorded in the deferred mode.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient to draw a polygon or a scaled bitmap, which is skipped.
+	 * @remarks		The recorded operations are discarded, even if an exception has occurred.
+	 */
+	result Flush(void)
+	{
+		if (__commandCount == 0)
+		{
+			NotifyFlushListeners();
+			return E_SUCCESS;
+		}
+
+		CullOccludedCommands();
+
+		result r = E_SUCCESS;
+		if (BuildBatches() == E_SUCCESS)
+		{
+			for (int i = 0; i < __batchCount; i++)
+			{
+				for (int j = __pBatches[i].first; j >= 0; j = __pCommands[j].next)
+				{
+					result drawResult = Rasterize(__pCommands[j]);
+					r = (r == E_SUCCESS) ? drawResult : r;
+				}
+			}
+		}
+		else
+		{
+			// The commands are drawn in the recorded order if the batches cannot be built
+			for (int i = 0; i < __commandCount; i++)
+			{
+				if (__pCommands[i].type != COMMAND_NONE)
+				{
+					result drawResult = Rasterize(__pCommands[i]);
+					r = (r == E_SUCCESS) ? drawResult : r;
+				}
+			}
+		}
+
+		__commandCount = 0;
+		__pointCount = 0;
+		__batchCount = 0;
+
+		NotifyFlushListeners();
+
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the number of the operations which have been recorded and not yet flushed.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of operations
+	 */
+	int GetPendingCommandCount(void) const
+	{
+		return __commandCount;
+	}
+
+	/**
+	 * Gets the number of the rectangles which have been drawn on since ResetDirtyRectangles() has been called.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of rectangles, which is at most @c 8
+	 * @remarks		The areas of the drawing operations are merged into a few rectangles when they are close to each other,
+	 *				so that the rectangles can contain pixels which have not been changed.
+	 */
+	int GetDirtyRectangleCount(void) const
+	{
+		return __dirtyRectangleCount;
+	}
+
+	/**
+	 * Gets the rectangle at the specified index, which has been drawn on since ResetDirtyRectangles() has been called.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	index				The index of the rectangle
+	 * @param[out]	rect				The rectangle
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is less than @c 0, or not less than the value of GetDirtyRectangleCount().
+	 */
+	result GetDirtyRectangleAt(int index, Rectangle& rect) const
+	{
+		TryReturn(index >= 0 && index < __dirtyRectangleCount, E_OUT_OF_RANGE,
+			"[%s] The index(%d) MUST be less than the count(%d).", GetErrorMessage(E_OUT_OF_RANGE), index, __dirtyRectangleCount);
+
+		const int* pRect = __dirtyRectangles[index];
+		rect.SetBounds(pRect[0], pRect[1], pRect[2] - pRect[0], pRect[3] - pRect[1]);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Forgets the rectangles which have been drawn on, typically after they have been shown.
+	 *
+	 * @since	2.1
+	 */
+	void ResetDirtyRectangles(void)
+	{
+		__dirtyRectangleCount = 0;
+	}
+
+private:
+	SoftwareCanvas(const SoftwareCanvas& rhs);
+	SoftwareCanvas& operator =(const SoftwareCanvas& rhs);
+
+	// Notifies the listener once, when the operations which are recorded until then are drawn or discarded
+	result AddFlushListener(__ISoftwareCanvasFlushListener& listener)
+	{
+		result r = Grow(__ppFlushListeners, __flushListenerCount, __flushListenerCapacity, __flushListenerCount + 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__ppFlushListeners[__flushListenerCount++] = &listener;
+
+		return E_SUCCESS;
+	}
+
+	bool HasFlushListener(const __ISoftwareCanvasFlushListener& listener) const
+	{
+		for (int i = 0; i < __flushListenerCount; i++)
+		{
+			if (__ppFlushListeners[i] == &listener)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void NotifyFlushListeners(void)
+	{
+		int count = __flushListenerCount;
+		__flushListenerCount = 0;
+
+		for (int i = 0; i < count; i++)
+		{
+			__ppFlushListeners[i]->OnSoftwareCanvasFlushed();
+		}
+	}
+
+	static result CheckBufferInfo(const BufferInfo& bufferInfo)
+	{
+		TryReturn(bufferInfo.pixelFormat == PIXEL_FORMAT_ARGB8888 && bufferInfo.bitsPerPixel == 32, E_UNSUPPORTED_FORMAT,
+			"[%s] The pixel format(%d) is not supported.", GetErrorMessage(E_UNSUPPORTED_FORMAT), bufferInfo.pixelFormat);
+		TryReturn(bufferInfo.pPixels != null && bufferInfo.width > 0 && bufferInfo.height > 0 && bufferInfo.pitch >= bufferInfo.width * 4,
+			E_INVALID_ARG, "[%s] The buffer information(%d x %d, pitch %d) is invalid.", GetErrorMessage(E_INVALID_ARG),
+			bufferInfo.width, bufferInfo.height, bufferInfo.pitch);
+
+		return E_SUCCESS;
+	}
+
+	result RecordFill(unsigned int color, bool isCopy, const Rectangle& rect)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(rect.width >= 0 && rect.height >= 0 && rect.x < __surfaceWidth && rect.y < __surfaceHeight
+			&& rect.x + rect.width > 0 && rect.y + rect.height > 0, E_OUT_OF_RANGE, "[%s] The rect(%d, %d, %d, %d) is outside the surface.",
+			GetErrorMessage(E_OUT_OF_RANGE), rect.x, rect.y, rect.width, rect.height);
+
+		// A transparent color does not change the pixels
+		if (!isCopy && (color >> 24) == 0)
+		{
+			return E_SUCCESS;
+		}
+
+		__SoftwareCanvasCommand* pCommand = null;
+		result r = AddCommand(COMMAND_FILL, isCopy, color, rect.x, rect.y, rect.x + rect.width, rect.y + rect.height, pCommand);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return (pCommand != null) ? Commit() : E_SUCCESS;
+	}
+
+	// Stores the points after the points of the other commands, without counting them
+	result StorePoints(const Tizen::Base::Collection::IList& points)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		int count = points.GetCount();
+		result r = Grow(__pPoints, __pointCount * 2, __pointCapacity, (__pointCount + count) * 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		float* pPoints = __pPoints + __pointCount * 2;
+		for (int i = 0; i < count; i++)
+		{
+			const Tizen::Base::Object* pObject = points.GetAt(i);
+			const Point* pPoint = dynamic_cast< const Point* >(pObject);
+			const FloatPoint* pFloatPoint = (pPoint == null) ? dynamic_cast< const FloatPoint* >(pObject) : null;
+			TryReturn(pPoint != null || pFloatPoint != null, E_INVALID_ARG, "[%s] The object at %d is not a point.", GetErrorMessage(E_INVALID_ARG), i);
+
+			pPoints[i * 2] = (pPoint != null) ? static_cast< float >(pPoint->x) : pFloatPoint->x;
+			pPoints[i * 2 + 1] = (pPoint != null) ? static_cast< float >(pPoint->y) : pFloatPoint->y;
+		}
+
+		return E_SUCCESS;
+	}
+
+	result StorePoints(const FloatPoint* pPoints, int count)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(count >= 0 && (pPoints != null || count == 0), E_INVALID_ARG, "[%s] The pPoints is null, or the count(%d) is negative.",
+			GetErrorMessage(E_INVALID_ARG), count);
+
+		result r = Grow(__pPoints, __pointCount * 2, __pointCapacity, (__pointCount + count) * 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		float* pStored = __pPoints + __pointCount * 2;
+		for (int i = 0; i < count; i++)
+		{
+			pStored[i * 2] = pPoints[i].x;
+			pStored[i * 2 + 1] = pPoints[i].y;
+		}
+
+		return E_SUCCESS;
+	}
+
+	result StorePoints(const Tizen::Base::Collection::IListT< FloatPoint >& points)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		int count = points.GetCount();
+		result r = Grow(__pPoints, __pointCount * 2, __pointCapacity, (__pointCount + count) * 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		float* pStored = __pPoints + __pointCount * 2;
+		FloatPoint point;
+		for (int i = 0; i < count; i++)
+		{
+			points.GetAt(i, point);
+			pStored[i * 2] = point.x;
+			pStored[i * 2 + 1] = point.y;
+		}
+
+		return E_SUCCESS;
+	}
+
+	// Records the polygon whose points have been stored
+	result RecordPolygon(unsigned int color, int count)
+	{
+		if (count < 3 || (!__isCopy && (color >> 24) == 0))
+		{
+			return E_SUCCESS;
+		}
+
+		__SoftwareCanvasCommand* pCommand = null;
+		result r = RecordPath(COMMAND_POLYGON, color, count, 0.0f, pCommand);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return (pCommand != null) ? Commit() : E_SUCCESS;
+	}
+
+	// Records the polyline whose points have been stored
+	result RecordStroke(int count, bool isClosed)
+	{
+		if (count < 1 || (!__isCopy && (__foregroundColor >> 24) == 0))
+		{
+			return E_SUCCESS;
+		}
+
+		// The outline reaches half of the width from the points, and the square caps and the miters reach further
+		float halfWidth = __lineWidth * 0.5f;
+		float reach = (__lineJoinStyle == LINE_JOIN_STYLE_MITER) ? MITER_LIMIT : ((__lineCapStyle == LINE_CAP_STYLE_SQUARE) ? 1.5f : 1.0f);
+
+		__SoftwareCanvasCommand* pCommand = null;
+		result r = RecordPath(COMMAND_STROKE, __foregroundColor, count, halfWidth * reach + 1.0f, pCommand);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (pCommand == null)
+		{
+			return E_SUCCESS;
+		}
+
+		pCommand->lineWidth = __lineWidth;
+		pCommand->lineCapStyle = __lineCapStyle;
+		pCommand->lineJoinStyle = __lineJoinStyle;
+		pCommand->isClosed = isClosed;
+
+		return Commit();
+	}
+
+	// Adds a command with the stored points, whose bounds are expanded by the specified distance
+	result RecordPath(int type, unsigned int color, int count, float expansion, __SoftwareCanvasCommand*& pCommand)
+	{
+		const float* pPoints = __pPoints + __pointCount * 2;
+		float minX = pPoints[0];
+		float maxX = pPoints[0];
+		float minY = pPoints[1];
+		float maxY = pPoints[1];
+		for (int i = 1; i < count; i++)
+		{
+			minX = (pPoints[i * 2] < minX) ? pPoints[i * 2] : minX;
+			maxX = (pPoints[i * 2] > maxX) ? pPoints[i * 2] : maxX;
+			minY = (pPoints[i * 2 + 1] < minY) ? pPoints[i * 2 + 1] : minY;
+			maxY = (pPoints[i * 2 + 1] > maxY) ? pPoints[i * 2 + 1] : maxY;
+		}
+
+		// The bounds are limited before the conversion, so that huge coordinates do not overflow
+		const float limit = 1 << 24;
+		minX = (minX - expansion > -limit) ? minX - expansion : -limit;
+		minY = (minY - expansion > -limit) ? minY - expansion : -limit;
+		maxX = (maxX + expansion < limit) ? maxX + expansion : limit;
+		maxY = (maxY + expansion < limit) ? maxY + expansion : limit;
+
+		result r = AddCommand(type, __isCopy, color, static_cast< int >(floorf(minX)), static_cast< int >(floorf(minY)),
+			static_cast< int >(ceilf(maxX)), static_cast< int >(ceilf(maxY)), pCommand);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (pCommand != null)
+		{
+			pCommand->isAntiAliased = __isAntiAliased;
+			pCommand->pointOffset = __pointCount;
+			pCommand->pointCount = count;
+			__pointCount += count;
+		}
+
+		return E_SUCCESS;
+	}
+
+	result RecordBitmap(const Rectangle& destRect, const BufferInfo& srcBufferInfo, const Rectangle& srcRect)
+	{
+		TryReturn(__pSurface != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		result r = CheckBufferInfo(srcBufferInfo);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		TryReturn(srcRect.x >= 0 && srcRect.y >= 0 && srcRect.width > 0 && srcRect.height > 0
+			&& srcRect.x + srcRect.width <= srcBufferInfo.width && srcRect.y + srcRect.height <= srcBufferInfo.height, E_OUT_OF_RANGE,
+			"[%s] The srcRect(%d, %d, %d, %d) is not inside the bitmap.", GetErrorMessage(E_OUT_OF_RANGE), srcRect.x, srcRect.y, srcRect.width, srcRect.height);
+		TryReturn(destRect.width >= 0 && destRect.height >= 0 && destRect.x < __surfaceWidth && destRect.y < __surfaceHeight
+			&& destRect.x + destRect.width > 0 && destRect.y + destRect.height > 0, E_OUT_OF_RANGE,
+			"[%s] The destRect(%d, %d, %d, %d) is outside the surface.", GetErrorMessage(E_OUT_OF_RANGE), destRect.x, destRect.y, destRect.width, destRect.height);
+
+		__SoftwareCanvasCommand* pCommand = null;
+		r = AddCommand(COMMAND_BITMAP, __isCopy, 0, destRect.x, destRect.y, destRect.x + destRect.width, destRect.y + destRect.height, pCommand);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (pCommand == null)
+		{
+			return E_SUCCESS;
+		}
+
+		pCommand->pSource = static_cast< const unsigned char* >(srcBufferInfo.pPixels);
+		pCommand->sourcePitch = srcBufferInfo.pitch;
+		pCommand->sourceX = srcRect.x;
+		pCommand->sourceY = srcRect.y;
+		pCommand->sourceWidth = srcRect.width;
+		pCommand->sourceHeight = srcRect.height;
+		pCommand->destinationX = destRect.x;
+		pCommand->destinationY = destRect.y;
+		pCommand->destinationWidth = destRect.width;
+		pCommand->destinationHeight = destRect.height;
+
+		return Commit();
+	}
+
+	// Appends a command with the bounds clipped, or sets pCommand to null if nothing is visible
+	result AddCommand(int type, bool isCopy, unsigned int color, int left, int top, int right, int bottom, __SoftwareCanvasCommand*& pCommand)
+	{
+		pCommand = null;
+
+		left = (left > __clipLeft) ? left : __clipLeft;
+		top = (top > __clipTop) ? top : __clipTop;
+		right = (right < __clipRight) ? right : __clipRight;
+		bottom = (bottom < __clipBottom) ? bottom : __clipBottom;
+		if (left >= right || top >= bottom)
+		{
+			return E_SUCCESS;
+		}
+
+		result r = Grow(__pCommands, __commandCount, __commandCapacity, __commandCount + 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		pCommand = &__pCommands[__commandCount++];
+		memset(pCommand, 0, sizeof(__SoftwareCanvasCommand));
+		pCommand->type = type;
+		pCommand->isCopy = isCopy;
+		pCommand->color = color;
+		pCommand->left = left;
+		pCommand->top = top;
+		pCommand->right = right;
+		pCommand->bottom = bottom;
+		pCommand->next = -1;
+
+		AddDirtyRectangle(left, top, right, bottom);
+
+		return E_SUCCESS;
+	}
+
+	result Commit(void)
+	{
+		return __isDeferred ? E_SUCCESS : Flush();
+	}
+
+	// Merges the rectangle into the dirty rectangle which grows the least, unless a new one can be added and every merge grows the area
+	void AddDirtyRectangle(int left, int top, int right, int bottom)
+	{
+		long long area = static_cast< long long >(right - left) * (bottom - top);
+		int bestIndex = -1;
+		long long bestWaste = 0;
+
+		for (int i = 0; i < __dirtyRectangleCount; i++)
+		{
+			const int* pRect = __dirtyRectangles[i];
+			int unionLeft = (left < pRect[0]) ? left : pRect[0];
+			int unionTop = (top < pRect[1]) ? top : pRect[1];
+			int unionRight = (right > pRect[2]) ? right : pRect[2];
+			int unionBottom = (bottom > pRect[3]) ? bottom : pRect[3];
+
+			long long waste = static_cast< long long >(unionRight - unionLeft) * (unionBottom - unionTop)
+				- static_cast< long long >(pRect[2] - pRect[0]) * (pRect[3] - pRect[1]) - area;
+			if (bestIndex < 0 || waste < bestWaste)
+			{
+				bestIndex = i;
+				bestWaste = waste;
+			}
+		}
+
+		if (bestIndex < 0 || (bestWaste > 0 && __dirtyRectangleCount < MAX_DIRTY_RECTANGLE_COUNT))
+		{
+			int* pRect = __dirtyRectangles[__dirtyRectangleCount++];
+			pRect[0] = left;
+			pRect[1] = top;
+			pRect[2] = right;
+			pRect[3] = bottom;
+			return;
+		}
+
+		int* pRect = __dirtyRectangles[bestIndex];
+		pRect[0] = (left < pRect[0]) ? left : pRect[0];
+		pRect[1] = (top < pRect[1]) ? top : pRect[1];
+		pRect[2] = (right > pRect[2]) ? right : pRect[2];
+		pRect[3] = (bottom > pRect[3]) ? bottom : pRect[3];
+	}
+
+	static bool IsOpaqueFill(const __SoftwareCanvasCommand& command)
+	{
+		return command.type == COMMAND_FILL && (command.isCopy || (command.color >> 24) == 0xFF);
+	}
+
+	static bool Contains(const int* pRect, const __SoftwareCanvasCommand& command)
+	{
+		return pRect[0] <= command.left && pRect[1] <= command.top && pRect[2] >= command.right && pRect[3] >= command.bottom;
+	}
+
+	// Removes the commands which are covered by an opaque fill recorded after them
+	void CullOccludedCommands(void)
+	{
+		int occluders[MAX_OCCLUDER_COUNT][4];
+		int occluderCount = 0;
+
+		for (int i = __commandCount - 1; i >= 0; i--)
+		{
+			__SoftwareCanvasCommand& command = __pCommands[i];
+
+			bool isOccluded = false;
+			for (int j = 0; j < occluderCount && !isOccluded; j++)
+			{
+				isOccluded = Contains(occluders[j], command);
+			}
+
+			if (isOccluded)
+			{
+				command.type = COMMAND_NONE;
+				continue;
+			}
+
+			if (!IsOpaqueFill(command))
+			{
+				continue;
+			}
+
+			// The largest fills are kept, because they cover the most
+			int index = occluderCount;
+			if (occluderCount == MAX_OCCLUDER_COUNT)
+			{
+				index = 0;
+				for (int j = 1; j < occluderCount; j++)
+				{
+					if (GetArea(occluders[j]) < GetArea(occluders[index]))
+					{
+						index = j;
+					}
+				}
+
+				if (GetArea(occluders[index]) >= static_cast< long long >(command.right - command.left) * (command.bottom - command.top))
+				{
+					continue;
+				}
+			}
+			else
+			{
+				occluderCount++;
+			}
+
+			occluders[index][0] = command.left;
+			occluders[index][1] = command.top;
+			occluders[index][2] = command.right;
+			occluders[index][3] = command.bottom;
+		}
+	}
+
+	static long long GetArea(const int* pRect)
+	{
+		return static_cast< long long >(pRect[2] - pRect[0]) * (pRect[3] - pRect[1]);
+	}
+
+	static bool IsSameState(const __SoftwareCanvasCommand& command1, const __SoftwareCanvasCommand& command2)
+	{
+		if (command1.type != command2.type || command1.isCopy != command2.isCopy)
+		{
+			return false;
+		}
+
+		switch (command1.type)
+		{
+		case COMMAND_FILL:
+			return command1.color == command2.color;
+
+		case COMMAND_POLYGON:
+			// Falls through
+		case COMMAND_STROKE:
+			return command1.color == command2.color && command1.isAntiAliased == command2.isAntiAliased;
+
+		case COMMAND_BITMAP:
+			return command1.pSource == command2.pSource;
+
+		case COMMAND_MASK:
+			return command1.pSource == command2.pSource && command1.color == command2.color;
+
+		default:
+			return false;
+		}
+	}
+
+	// Moves each command into an earlier batch of the same state, if no batch after that one overlaps the command
+	result BuildBatches(void)
+	{
+		__batchCount = 0;
+
+		for (int i = 0; i < __commandCount; i++)
+		{
+			__SoftwareCanvasCommand& command = __pCommands[i];
+			if (command.type == COMMAND_NONE)
+			{
+				continue;
+			}
+
+			int target = -1;
+			int lowest = (__batchCount > MAX_BATCH_LOOKBEHIND) ? __batchCount - MAX_BATCH_LOOKBEHIND : 0;
+			for (int j = __batchCount - 1; j >= lowest; j--)
+			{
+				const __SoftwareCanvasBatch& batch = __pBatches[j];
+				if (IsSameState(__pCommands[batch.first], command))
+				{
+					target = j;
+					break;
+				}
+
+				if (batch.left < command.right && command.left < batch.right && batch.top < command.bottom && command.top < batch.bottom)
+				{
+					break;
+				}
+			}
+
+			if (target >= 0)
+			{
+				__SoftwareCanvasBatch& batch = __pBatches[target];
+				__pCommands[batch.last].next = i;
+				batch.last = i;
+				batch.left = (command.left < batch.left) ? command.left : batch.left;
+				batch.top = (command.top < batch.top) ? command.top : batch.top;
+				batch.right = (command.right > batch.right) ? command.right : batch.right;
+				batch.bottom = (command.bottom > batch.bottom) ? command.bottom : batch.bottom;
+				continue;
+			}
+
+			result r = Grow(__pBatches, __batchCount, __batchCapacity, __batchCount + 1);
+			if (r != E_SUCCESS)
+			{
+				for (int j = 0; j < __commandCount; j++)
+				{
+					__pCommands[j].next = -1;
+				}
+				__batchCount = 0;
+				return r;
+			}
+
+			__SoftwareCanvasBatch& batch = __pBatches[__batchCount++];
+			batch.first = i;
+			batch.last = i;
+			batch.left = command.left;
+			batch.top = command.top;
+			batch.right = command.right;
+			batch.bottom = command.bottom;
+		}
+
+		return E_SUCCESS;
+	}
+
+	unsigned int* GetRow(int y) const
+	{
+		return reinterpret_cast< unsigned int* >(__pSurface + static_cast< long >(y) * __surfacePitch);
+	}
+
+	result Rasterize(const __SoftwareCanvasCommand& command)
+	{
+		switch (command.type)
+		{
+		case COMMAND_FILL:
+			for (int y = command.top; y < command.bottom; y++)
+			{
+				FillSpan(GetRow(y) + command.left, command.right - command.left, command.color, command.isCopy);
+			}
+			return E_SUCCESS;
+
+		case COMMAND_POLYGON:
+			// Falls through
+		case COMMAND_STROKE:
+			return RasterizePath(command);
+
+		case COMMAND_BITMAP:
+			return RasterizeBitmap(command);
+
+		case COMMAND_MASK:
+			for (int y = command.top; y < command.bottom; y++)
+			{
+				const unsigned char* pMask = command.pSource + static_cast< long >(command.sourceY + y - command.destinationY) * command.sourcePitch
+					+ command.sourceX + command.left - command.destinationX;
+				FillCoverageSpan(GetRow(y) + command.left, pMask, command.right - command.left, command.color, command.isCopy);
+			}
+			return E_SUCCESS;
+
+		default:
+			return E_SUCCESS;
+		}
+	}
+
+	static void FillSpan(unsigned int* pDestination, int count, unsigned int color, bool isCopy)
+	{
+		unsigned int alpha = color >> 24;
+		if (isCopy || alpha == 0xFF)
+		{
+			__SoftwareCanvasSpan::Fill(pDestination, count, color);
+		}
+		else if (alpha != 0)
+		{
+			__SoftwareCanvasSpan::Lerp(pDestination, count, color | 0xFF000000, alpha);
+		}
+	}
+
+	// Fills the span with the color, which is weighted by the coverage of each pixel
+	static void FillCoverageSpan(unsigned int* pDestination, const unsigned char* pCoverage, int count, unsigned int color, bool isCopy)
+	{
+		unsigned int alpha = color >> 24;
+		unsigned int pixel = isCopy ? color : (color | 0xFF000000);
+
+		for (int i = 0; i < count; )
+		{
+			unsigned int coverage = pCoverage[i];
+			int end = i + 1;
+			while (end < count && pCoverage[end] == coverage)
+			{
+				end++;
+			}
+
+			if (coverage == 0xFF)
+			{
+				FillSpan(pDestination + i, end - i, color, isCopy);
+			}
+			else if (coverage != 0)
+			{
+				unsigned int weight = isCopy ? coverage : __SoftwareCanvasSpan::Divide255(alpha * coverage);
+				for (int j = i; j < end; j++)
+				{
+					pDestination[j] = __SoftwareCanvasSpan::Lerp(pixel, pDestination[j], weight);
+				}
+			}
+
+			i = end;
+		}
+	}
+
+	// Rasterizes the path row by row, accumulating the signed area which each edge covers in each cell
+	result RasterizePath(const __SoftwareCanvasCommand& command)
+	{
+		int width = command.right - command.left;
+
+		result r = Grow(__pCells, 0, __cellCapacity, width + 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		r = Grow(__pCoverage, 0, __coverageCapacity, width);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int edgeCount = 0;
+		r = (command.type == COMMAND_STROKE) ? BuildStrokeEdges(command, edgeCount) : BuildFillEdges(command, edgeCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		r = Grow(__pActiveEdges, 0, __activeEdgeCapacity, edgeCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		std::sort(__pEdges, __pEdges + edgeCount, __SoftwareCanvasEdge::CompareTop);
+		memset(__pCells, 0, sizeof(float) * (width + 2));
+
+		int nextEdge = 0;
+		int activeCount = 0;
+		for (int y = command.top; y < command.bottom; y++)
+		{
+			float rowTop = static_cast< float >(y);
+
+			while (nextEdge < edgeCount && __pEdges[nextEdge].y0 < rowTop + 1.0f)
+			{
+				__pActiveEdges[activeCount++] = nextEdge++;
+			}
+
+			int keptCount = 0;
+			for (int i = 0; i < activeCount; i++)
+			{
+				const __SoftwareCanvasEdge& edge = __pEdges[__pActiveEdges[i]];
+				if (edge.y1 > rowTop)
+				{
+					AccumulateEdge(edge, rowTop, static_cast< float >(width));
+					__pActiveEdges[keptCount++] = __pActiveEdges[i];
+				}
+			}
+			activeCount = keptCount;
+
+			float area = 0.0f;
+			for (int x = 0; x < width; x++)
+			{
+				area += __pCells[x];
+				__pCells[x] = 0.0f;
+
+				float coverage = fabsf(area);
+				if (command.isAntiAliased)
+				{
+					__pCoverage[x] = (coverage >= 1.0f) ? 0xFF : static_cast< unsigned char >(coverage * 255.0f + 0.5f);
+				}
+				else
+				{
+					__pCoverage[x] = (coverage >= 0.5f) ? 0xFF : 0;
+				}
+			}
+			__pCells[width] = 0.0f;
+			__pCells[width + 1] = 0.0f;
+
+			FillCoverageSpan(GetRow(y) + command.left, __pCoverage, width, command.color, command.isCopy);
+		}
+
+		return E_SUCCESS;
+	}
+
+	result BuildFillEdges(const __SoftwareCanvasCommand& command, int& edgeCount)
+	{
+		result r = Grow(__pEdges, 0, __edgeCapacity, command.pointCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		const float* pPoints = __pPoints + command.pointOffset * 2;
+		edgeCount = 0;
+		for (int i = 0; i < command.pointCount; i++)
+		{
+			int next = (i + 1 < command.pointCount) ? i + 1 : 0;
+			AddEdge(command, pPoints[i * 2], pPoints[i * 2 + 1], pPoints[next * 2], pPoints[next * 2 + 1], 1.0f, edgeCount);
+		}
+
+		return E_SUCCESS;
+	}
+
+	// Adds the outlines of the segments, and of the joins and the caps outside them, which are all oriented the same way.
+	// The joins and the caps share their edges with the segments instead of overlapping them, so that the coverage of the edges
+	// of the line is added once, except on the few pixels around an inner corner, where two segments overlap.
+	result BuildStrokeEdges(const __SoftwareCanvasCommand& command, int& edgeCount)
+	{
+		// The repeated points are removed in place, because the points are rasterized only once
+		float* pPoints = __pPoints + command.pointOffset * 2;
+		int count = 1;
+		for (int i = 1; i < command.pointCount; i++)
+		{
+			if (pPoints[i * 2] != pPoints[count * 2 - 2] || pPoints[i * 2 + 1] != pPoints[count * 2 - 1])
+			{
+				pPoints[count * 2] = pPoints[i * 2];
+				pPoints[count * 2 + 1] = pPoints[i * 2 + 1];
+				count++;
+			}
+		}
+
+		bool isClosed = command.isClosed;
+		if (isClosed && count > 1 && pPoints[0] == pPoints[count * 2 - 2] && pPoints[1] == pPoints[count * 2 - 1])
+		{
+			count--;
+		}
+		isClosed = isClosed && count >= 3;
+
+		float halfWidth = command.lineWidth * 0.5f;
+		int roundCount = GetRoundSegmentCount(halfWidth);
+		int segmentCount = isClosed ? count : count - 1;
+
+		result r = Grow(__pEdges, 0, __edgeCapacity, segmentCount * 4 + (count + 2) * (roundCount + 4));
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		edgeCount = 0;
+		if (count == 1)
+		{
+			float x = pPoints[0];
+			float y = pPoints[1];
+			if (command.lineCapStyle == LINE_CAP_STYLE_ROUND)
+			{
+				AddArc(command, x, y, halfWidth, 0.0f, 6.28318531f, false, roundCount, edgeCount);
+			}
+			else if (command.lineCapStyle == LINE_CAP_STYLE_SQUARE)
+			{
+				float ring[8] = { x - halfWidth, y - halfWidth, x + halfWidth, y - halfWidth, x + halfWidth, y + halfWidth, x - halfWidth, y + halfWidth };
+				AddRing(command, ring, 4, edgeCount);
+			}
+			return E_SUCCESS;
+		}
+
+		for (int i = 0; i < segmentCount; i++)
+		{
+			int next = (i + 1 < count) ? i + 1 : 0;
+			float x0 = pPoints[i * 2];
+			float y0 = pPoints[i * 2 + 1];
+			float x1 = pPoints[next * 2];
+			float y1 = pPoints[next * 2 + 1];
+
+			float dx = x1 - x0;
+			float dy = y1 - y0;
+			float length = sqrtf(dx * dx + dy * dy);
+			dx /= length;
+			dy /= length;
+			float nx = -dy * halfWidth;
+			float ny = dx * halfWidth;
+
+			if (!isClosed && (i == 0 || i == segmentCount - 1))
+			{
+				if (command.lineCapStyle == LINE_CAP_STYLE_SQUARE)
+				{
+					x0 -= (i == 0) ? dx * halfWidth : 0.0f;
+					y0 -= (i == 0) ? dy * halfWidth : 0.0f;
+					x1 += (i == segmentCount - 1) ? dx * halfWidth : 0.0f;
+					y1 += (i == segmentCount - 1) ? dy * halfWidth : 0.0f;
+				}
+				else if (command.lineCapStyle == LINE_CAP_STYLE_ROUND)
+				{
+					// The caps are the halves of the circles behind the ends
+					if (i == 0)
+					{
+						AddArc(command, x0, y0, halfWidth, atan2f(ny, nx), 3.14159265f, false, roundCount, edgeCount);
+					}
+					if (i == segmentCount - 1)
+					{
+						AddArc(command, x1, y1, halfWidth, atan2f(-ny, -nx), 3.14159265f, false, roundCount, edgeCount);
+					}
+				}
+			}
+
+			float ring[8] = { x0 + nx, y0 + ny, x1 + nx, y1 + ny, x1 - nx, y1 - ny, x0 - nx, y0 - ny };
+			AddRing(command, ring, 4, edgeCount);
+		}
+
+		int firstJoin = isClosed ? 0 : 1;
+		int lastJoin = isClosed ? count : count - 1;
+		for (int i = firstJoin; i < lastJoin; i++)
+		{
+			int previous = (i > 0) ? i - 1 : count - 1;
+			int next = (i + 1 < count) ? i + 1 : 0;
+			AddJoin(command, pPoints + previous * 2, pPoints + i * 2, pPoints + next * 2, halfWidth, roundCount, edgeCount);
+		}
+
+		return E_SUCCESS;
+	}
+
+	// Adds the wedge outside the corner between the segments, whose sides are the ends of the segments
+	void AddJoin(const __SoftwareCanvasCommand& command, const float* pPrevious, const float* pPoint, const float* pNext, float halfWidth,
+		int roundCount, int& edgeCount)
+	{
+		float dx1 = pPoint[0] - pPrevious[0];
+		float dy1 = pPoint[1] - pPrevious[1];
+		float dx2 = pNext[0] - pPoint[0];
+		float dy2 = pNext[1] - pPoint[1];
+		float length1 = sqrtf(dx1 * dx1 + dy1 * dy1);
+		float length2 = sqrtf(dx2 * dx2 + dy2 * dy2);
+		dx1 /= length1;
+		dy1 /= length1;
+		dx2 /= length2;
+		dy2 /= length2;
+
+		float cross = dx1 * dy2 - dy1 * dx2;
+		float dot = dx1 * dx2 + dy1 * dy2;
+		if (cross == 0.0f && dot > 0.0f)
+		{
+			return;
+		}
+
+		// The outside of the corner is on the other side of the turn
+		float side = (cross > 0.0f) ? -1.0f : 1.0f;
+		float x = pPoint[0];
+		float y = pPoint[1];
+		float nx1 = -dy1 * halfWidth * side;
+		float ny1 = dx1 * halfWidth * side;
+		float nx2 = -dy2 * halfWidth * side;
+		float ny2 = dx2 * halfWidth * side;
+
+		if (command.lineJoinStyle == LINE_JOIN_STYLE_ROUND)
+		{
+			AddArc(command, x, y, halfWidth, atan2f(ny1, nx1), atan2f(cross, dot), true, roundCount, edgeCount);
+			return;
+		}
+
+		// The miter is limited by the ratio of its length to the width of the line, which is 1 / cos(turn / 2)
+		float mx = nx1 + nx2;
+		float my = ny1 + ny2;
+		float squaredLength = mx * mx + my * my;
+		if (command.lineJoinStyle == LINE_JOIN_STYLE_MITER && squaredLength * MITER_LIMIT * MITER_LIMIT >= 4.0f * halfWidth * halfWidth)
+		{
+			float scale = 2.0f * halfWidth * halfWidth / squaredLength;
+			float ring[8] = { x, y, x + nx1, y + ny1, x + mx * scale, y + my * scale, x + nx2, y + ny2 };
+			AddRing(command, ring, 4, edgeCount);
+			return;
+		}
+
+		float ring[6] = { x, y, x + nx1, y + ny1, x + nx2, y + ny2 };
+		AddRing(command, ring, 3, edgeCount);
+	}
+
+	// Adds the arc of the circle, which is closed by its chord or through its center
+	void AddArc(const __SoftwareCanvasCommand& command, float x, float y, float radius, float startAngle, float sweepAngle, bool hasCenter,
+		int roundCount, int& edgeCount)
+	{
+		float ring[(MAX_ROUND_SEGMENT_COUNT + 2) * 2];
+		int segmentCount = static_cast< int >(ceilf(fabsf(sweepAngle) * roundCount / 6.28318531f));
+		segmentCount = (segmentCount > 1) ? ((segmentCount < MAX_ROUND_SEGMENT_COUNT) ? segmentCount : MAX_ROUND_SEGMENT_COUNT) : 1;
+
+		int count = 0;
+		if (hasCenter)
+		{
+			ring[count * 2] = x;
+			ring[count * 2 + 1] = y;
+			count++;
+		}
+
+		// The full circle does not repeat its first point
+		int lastIndex = (fabsf(sweepAngle) >= 6.28318531f) ? segmentCount - 1 : segmentCount;
+		for (int i = 0; i <= lastIndex; i++)
+		{
+			float angle = startAngle + sweepAngle * i / segmentCount;
+			ring[count * 2] = x + radius * cosf(angle);
+			ring[count * 2 + 1] = y + radius * sinf(angle);
+			count++;
+		}
+
+		AddRing(command, ring, count, edgeCount);
+	}
+
+	// Adds the closed ring in the positive orientation, so that the overlapping rings do not cancel each other
+	void AddRing(const __SoftwareCanvasCommand& command, const float* pRing, int count, int& edgeCount)
+	{
+		float area = 0.0f;
+		for (int i = 0; i < count; i++)
+		{
+			int next = (i + 1 < count) ? i + 1 : 0;
+			area += pRing[i * 2] * pRing[next * 2 + 1] - pRing[next * 2] * pRing[i * 2 + 1];
+		}
+
+		if (area == 0.0f)
+		{
+			return;
+		}
+
+		float direction = (area > 0.0f) ? 1.0f : -1.0f;
+		for (int i = 0; i < count; i++)
+		{
+			int next = (i + 1 < count) ? i + 1 : 0;
+			AddEdge(command, pRing[i * 2], pRing[i * 2 + 1], pRing[next * 2], pRing[next * 2 + 1], direction, edgeCount);
+		}
+	}
+
+	void AddEdge(const __SoftwareCanvasCommand& command, float x0, float y0, float x1, float y1, float direction, int& edgeCount)
+	{
+		if (y0 == y1)
+		{
+			return;
+		}
+
+		__SoftwareCanvasEdge& edge = __pEdges[edgeCount];
+		edge.direction = (y0 < y1) ? direction : -direction;
+		edge.x0 = ((y0 < y1) ? x0 : x1) - command.left;
+		edge.y0 = (y0 < y1) ? y0 : y1;
+		edge.x1 = ((y0 < y1) ? x1 : x0) - command.left;
+		edge.y1 = (y0 < y1) ? y1 : y0;
+		edge.dxdy = (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+
+		if (edge.y1 > command.top && edge.y0 < command.bottom)
+		{
+			edgeCount++;
+		}
+	}
+
+	// Gets the number of segments of a circle whose chords are at most 1/32 of a pixel inside it
+	static int GetRoundSegmentCount(float radius)
+	{
+		if (radius <= 0.0625f)
+		{
+			return MIN_ROUND_SEGMENT_COUNT;
+		}
+
+		int count = static_cast< int >(ceilf(6.28318531f / (2.0f * acosf(1.0f - 0.03125f / radius))));
+
+		return (count < MIN_ROUND_SEGMENT_COUNT) ? MIN_ROUND_SEGMENT_COUNT : ((count > MAX_ROUND_SEGMENT_COUNT) ? MAX_ROUND_SEGMENT_COUNT : count);
+	}
+
+	// Accumulates the part of the edge inside the row, which is split where it leaves the bounds horizontally
+	void AccumulateEdge(const __SoftwareCanvasEdge& edge, float rowTop, float width)
+	{
+		float top = (edge.y0 > rowTop) ? edge.y0 : rowTop;
+		float bottom = (edge.y1 < rowTop + 1.0f) ? edge.y1 : rowTop + 1.0f;
+		if (bottom <= top)
+		{
+			return;
+		}
+
+		float xTop = edge.x0 + (top - edge.y0) * edge.dxdy;
+		float xBottom = edge.x0 + (bottom - edge.y0) * edge.dxdy;
+
+		// Outside the bounds, the edge is clamped to a vertical line, which keeps the coverage inside
+		float splits[4] = { 0.0f, 1.0f, 1.0f, 1.0f };
+		int splitCount = 1;
+		const float limits[2] = { 0.0f, width };
+		for (int i = 0; i < 2; i++)
+		{
+			if ((xTop - limits[i]) * (xBottom - limits[i]) < 0.0f)
+			{
+				splits[splitCount++] = (limits[i] - xTop) / (xBottom - xTop);
+			}
+		}
+		if (splitCount == 3 && splits[1] > splits[2])
+		{
+			std::swap(splits[1], splits[2]);
+		}
+		splits[splitCount] = 1.0f;
+
+		for (int i = 0; i < splitCount; i++)
+		{
+			float x0 = xTop + (xBottom - xTop) * splits[i];
+			float x1 = xTop + (xBottom - xTop) * splits[i + 1];
+			float y0 = top + (bottom - top) * splits[i];
+			float y1 = top + (bottom - top) * splits[i + 1];
+
+			x0 = (x0 < 0.0f) ? 0.0f : ((x0 > width) ? width : x0);
+			x1 = (x1 < 0.0f) ? 0.0f : ((x1 > width) ? width : x1);
+			AccumulateLine(x0, x1, (y1 - y0) * edge.direction);
+		}
+	}
+
+	// Accumulates a line inside a row, whose ends are inside the cells, and whose signed height is dy
+	void AccumulateLine(float x0, float x1, float dy)
+	{
+		float left = (x0 < x1) ? x0 : x1;
+		float right = (x0 < x1) ? x1 : x0;
+		float leftFloor = floorf(left);
+		float rightCeil = ceilf(right);
+		int leftIndex = static_cast< int >(leftFloor);
+		int rightIndex = static_cast< int >(rightCeil);
+
+		if (rightIndex <= leftIndex + 1)
+		{
+			float middle = 0.5f * (x0 + x1) - leftFloor;
+			__pCells[leftIndex] += dy - dy * middle;
+			__pCells[leftIndex + 1] += dy * middle;
+			return;
+		}
+
+		float slope = 1.0f / (right - left);
+		float leftFraction = left - leftFloor;
+		float leftArea = 0.5f * slope * (1.0f - leftFraction) * (1.0f - leftFraction);
+		float rightFraction = right - rightCeil + 1.0f;
+		float rightArea = 0.5f * slope * rightFraction * rightFraction;
+
+		__pCells[leftIndex] += dy * leftArea;
+		if (rightIndex == leftIndex + 2)
+		{
+			__pCells[leftIndex + 1] += dy * (1.0f - leftArea - rightArea);
+		}
+		else
+		{
+			float area = slope * (1.5f - leftFraction);
+			__pCells[leftIndex + 1] += dy * (area - leftArea);
+			for (int i = leftIndex + 2; i < rightIndex - 1; i++)
+			{
+				__pCells[i] += dy * slope;
+			}
+			area += (rightIndex - leftIndex - 3) * slope;
+			__pCells[rightIndex - 1] += dy * (1.0f - area - rightArea);
+		}
+		__pCells[rightIndex] += dy * rightArea;
+	}
+
+	result RasterizeBitmap(const __SoftwareCanvasCommand& command)
+	{
+		int width = command.right - command.left;
+
+		if (command.destinationWidth == command.sourceWidth && command.destinationHeight == command.sourceHeight)
+		{
+			int offsetX = command.sourceX + command.left - command.destinationX;
+			for (int y = command.top; y < command.bottom; y++)
+			{
+				const unsigned int* pSource = GetSourceRow(command, command.sourceY + y - command.destinationY) + offsetX;
+				DrawRow(GetRow(y) + command.left, pSource, width, command.isCopy);
+			}
+			return E_SUCCESS;
+		}
+
+		result r = Grow(__pColumns, 0, __columnCapacity, width);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		r = Grow(__pRow, 0, __rowCapacity, width);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int x = command.left; x < command.right; x++)
+		{
+			__SoftwareCanvasColumn& column = __pColumns[x - command.left];
+			GetSample(x - command.destinationX, command.destinationWidth, command.sourceWidth, column.x0, column.x1, column.weight);
+			column.x0 += command.sourceX;
+			column.x1 += command.sourceX;
+		}
+
+		for (int y = command.top; y < command.bottom; y++)
+		{
+			int y0 = 0;
+			int y1 = 0;
+			unsigned int weight = 0;
+			GetSample(y - command.destinationY, command.destinationHeight, command.sourceHeight, y0, y1, weight);
+
+			const unsigned int* pSource0 = GetSourceRow(command, command.sourceY + y0);
+			const unsigned int* pSource1 = GetSourceRow(command, command.sourceY + y1);
+			for (int x = 0; x < width; x++)
+			{
+				const __SoftwareCanvasColumn& column = __pColumns[x];
+				unsigned int top = __SoftwareCanvasSpan::Interpolate(pSource0[column.x0], pSource0[column.x1], column.weight);
+				unsigned int bottom = __SoftwareCanvasSpan::Interpolate(pSource1[column.x0], pSource1[column.x1], column.weight);
+				__pRow[x] = __SoftwareCanvasSpan::Interpolate(top, bottom, weight);
+			}
+
+			DrawRow(GetRow(y) + command.left, __pRow, width, command.isCopy);
+		}
+
+		return E_SUCCESS;
+	}
+
+	static const unsigned int* GetSourceRow(const __SoftwareCanvasCommand& command, int y)
+	{
+		return reinterpret_cast< const unsigned int* >(command.pSource + static_cast< long >(y) * command.sourcePitch);
+	}
+
+	static void DrawRow(unsigned int* pDestination, const unsigned int* pSource, int count, bool isCopy)
+	{
+		if (isCopy)
+		{
+			memcpy(pDestination, pSource, count * sizeof(unsigned int));
+		}
+		else
+		{
+			__SoftwareCanvasSpan::BlendOver(pDestination, pSource, count);
+		}
+	}
+
+	// Maps the center of the destination pixel to the two source pixels around it, in 16.16 fixed point
+	static void GetSample(int destination, int destinationLength, int sourceLength, int& source0, int& source1, unsigned int& weight)
+	{
+		long long step = (static_cast< long long >(sourceLength) << 16) / destinationLength;
+		long long position = ((destination * 2LL + 1) * step) / 2 - 0x8000;
+
+		if (position <= 0)
+		{
+			source0 = 0;
+			source1 = 0;
+			weight = 0;
+			return;
+		}
+
+		source0 = static_cast< int >(position >> 16);
+		if (source0 >= sourceLength - 1)
+		{
+			source0 = sourceLength - 1;
+			source1 = sourceLength - 1;
+			weight = 0;
+			return;
+		}
+
+		source1 = source0 + 1;
+		weight = static_cast< unsigned int >((position >> 8) & 0xFF);
+	}
+
+	template< class Type >
+	static result Grow(Type*& pArray, int count, int& capacity, int minCapacity)
+	{
+		if (minCapacity <= capacity)
+		{
+			return E_SUCCESS;
+		}
+
+		int newCapacity = (capacity > 0) ? capacity : DEFAULT_CAPACITY;
+		while (newCapacity < minCapacity)
+		{
+			newCapacity *= 2;
+		}
+
+		Type* pNewArray = new (std::nothrow) Type[newCapacity];
+		TryReturn(pNewArray != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		if (count > 0)
+		{
+			memcpy(pNewArray, pArray, sizeof(Type) * count);
+		}
+		delete[] pArray;
+
+		pArray = pNewArray;
+		capacity = newCapacity;
+
+		return E_SUCCESS;
+	}
+
+	static const int COMMAND_NONE = 0;
+	static const int COMMAND_FILL = 1;
+	static const int COMMAND_POLYGON = 2;
+	static const int COMMAND_BITMAP = 3;
+	static const int COMMAND_STROKE = 4;
+	static const int COMMAND_MASK = 5;
+	static const int DEFAULT_CAPACITY = 64;
+	static const int MAX_DIRTY_RECTANGLE_COUNT = 8;
+	static const int MAX_OCCLUDER_COUNT = 4;
+	static const int MAX_BATCH_LOOKBEHIND = 32;
+	static const int MIN_ROUND_SEGMENT_COUNT = 8;
+	static const int MAX_ROUND_SEGMENT_COUNT = 64;
+	static const int MAX_LINE_WIDTH = 4096;
+	static const int MITER_LIMIT = 4;
+
+	unsigned char* __pSurface;
+	int __surfacePitch;
+	int __surfaceWidth;
+	int __surfaceHeight;
+	int __clipLeft;
+	int __clipTop;
+	int __clipRight;
+	int __clipBottom;
+	unsigned int __foregroundColor;
+	unsigned int __backgroundColor;
+	float __lineWidth;
+	LineCapStyle __lineCapStyle;
+	LineJoinStyle __lineJoinStyle;
+	bool __isCopy;
+	bool __isAntiAliased;
+	bool __isDeferred;
+
+	__SoftwareCanvasCommand* __pCommands;
+	int __commandCount;
+	int __commandCapacity;
+
+	// The x and y coordinates of the points of the recorded polygons and polylines
+	float* __pPoints;
+	int __pointCount;
+	int __pointCapacity;
+
+	__SoftwareCanvasBatch* __pBatches;
+	int __batchCount;
+	int __batchCapacity;
+
+	// The left, top, right, and bottom of each dirty rectangle
+	int __dirtyRectangles[MAX_DIRTY_RECTANGLE_COUNT][4];
+	int __dirtyRectangleCount;
+
+	// The buffers of the rasterization, which are reused
+	__SoftwareCanvasEdge* __pEdges;
+	int __edgeCapacity;
+	int* __pActiveEdges;
+	int __activeEdgeCapacity;
+	float* __pCells;
+	int __cellCapacity;
+	unsigned char* __pCoverage;
+	int __coverageCapacity;
+	__SoftwareCanvasColumn* __pColumns;
+	int __columnCapacity;
+	unsigned int* __pRow;
+	int __rowCapacity;
+
+	// The listeners which are notified by the next flush
+	__ISoftwareCanvasFlushListener** __ppFlushListeners;
+	int __flushListenerCount;
+	int __flushListenerCapacity;
+
+	friend class GlyphAtlas;
+
+}; // SoftwareCanvas
+
+}} // Tizen::Graphics
+
+#endif // _FGRP_SOFTWARE_CANVAS_H_
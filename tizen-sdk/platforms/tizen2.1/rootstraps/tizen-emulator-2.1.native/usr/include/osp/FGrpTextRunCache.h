@@ -0,0 +1,701 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FGrpTextRunCache.h
+ * @brief	This is the header file for the %TextRunCache class.
+ *
+ * This header file contains the declarations of the %TextRunCache class.
+ */
+
+#ifndef _FGRP_TEXT_RUN_CACHE_H_
+#define _FGRP_TEXT_RUN_CACHE_H_
+
+#include <string.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseString.h>
+#include <FGrpPoint.h>
+#include <FGrpRectangle.h>
+#include <FGrpDimension.h>
+#include <FGrpFont.h>
+#include <FGrpGlyphAtlas.h>
+#include <FGrpSoftwareCanvas.h>
+
+namespace Tizen { namespace Graphics
+{
+
+//
+// @struct	__TextRunCacheEntry
+// @brief	This struct is a text which has been laid out with a font in a width.
+// @since 2.1
+//
+struct __TextRunCacheEntry
+{
+	Tizen::Base::String text;
+	int fontId;
+	int width;
+	int hash;
+
+	// The characters other than the line breaks, and the x and y position of the pen for each of them
+	wchar_t* pCharacters;
+	int* pPositions;
+	int glyphCount;
+	int glyphCapacity;
+
+	int extentWidth;
+	int extentHeight;
+
+	// The neighbors in the order of use, from the most recent, and the next entry of the same bucket or of the free list
+	int previous;
+	int next;
+	int nextInBucket;
+
+}; // __TextRunCacheEntry
+
+/**
+ * @class	TextRunCache
+ * @brief	This class keeps the layouts of the recently drawn texts, and draws them with the glyphs of GlyphAtlas.
+ *
+ * @since	2.1
+ *
+ * The %TextRunCache class lays out a text with the advances of its characters, wraps it at the spaces to fit a width,
+ * and keeps the positions of the glyphs, so that the same text, font, and width is not laid out again.
+ * The least recently used layout is replaced when the cache is full. The glyphs are taken from the process-wide GlyphAtlas,
+ * and drawn as alpha masks on a SoftwareCanvas, which batches the glyphs of the same atlas page. @n
+ * The layouts are keyed by the hash of the text, the font identifier of GlyphAtlas::GetFontId(), and the width,
+ * so that the Font instances of the same face, size, and style share them. The hit rate and the memory size show whether
+ * the capacity fits the number of items which are visible together.
+ *
+ * The characters are placed by their advances, without kerning or complex shaping. The texts which need them,
+ * such as Arabic or Indic scripts, should be drawn with Canvas::DrawText() or EnrichedText. @n
+ * An instance is used by one thread, such as the main thread of the list which owns it.
+ *
+ * The following example demonstrates how to use the %TextRunCache class.
+ *
+ * @code
+ *	result
+ *	MyListView::DrawItem(SoftwareCanvas& canvas, int index, const Rectangle& bounds)
+ *	{
+ *		canvas.SetForegroundColor(Color::GetColor(COLOR_ID_WHITE));
+ *
+ *		// __textRunCache.Construct() is called when the list is created
+ *		result r = __textRunCache.DrawText(canvas, Point(bounds.x + 8, bounds.y + 8), *__pTitles[index], __titleFont, bounds.width - 16);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		return E_SUCCESS;
+ *	}
+ * @endcode
+ */
+class TextRunCache
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	TextRunCache(void)
+		: __pAtlas(null)
+		, __pEntries(null)
+		, __maxRunCount(0)
+		, __runCount(0)
+		, __first(-1)
+		, __last(-1)
+		, __free(-1)
+		, __pBuckets(null)
+		, __bucketCount(0)
+		, __pCharacters(null)
+		, __pPositions(null)
+		, __pGlyphs(null)
+		, __scratchCapacity(0)
+		, __glyphMemorySize(0)
+		, __hitCount(0)
+		, __missCount(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since	2.1
+	 */
+	virtual ~TextRunCache(void)
+	{
+		for (int i = 0; i < __maxRunCount; i++)
+		{
+			delete[] __pEntries[i].pCharacters;
+			delete[] __pEntries[i].pPositions;
+		}
+
+		delete[] __pEntries;
+		delete[] __pBuckets;
+		delete[] __pCharacters;
+		delete[] __pPositions;
+		delete[] __pGlyphs;
+	}
+
+	/**
+	 * Initializes this instance of %TextRunCache with the specified capacity.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	maxRunCount			The maximum number of the layouts which are kept
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c maxRunCount is less than or equal to @c 0.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The process-wide GlyphAtlas cannot be created.
+	 */
+	result Construct(int maxRunCount = DEFAULT_MAX_RUN_COUNT)
+	{
+		TryReturn(__pEntries == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(maxRunCount > 0, E_OUT_OF_RANGE, "[%s] The maxRunCount(%d) MUST be greater than 0.", GetErrorMessage(E_OUT_OF_RANGE), maxRunCount);
+
+		GlyphAtlas* pAtlas = GlyphAtlas::GetInstance();
+		TryReturn(pAtlas != null, E_SYSTEM, "[%s] The glyph atlas is not available.", GetErrorMessage(E_SYSTEM));
+
+		int bucketCount = DEFAULT_BUCKET_COUNT;
+		while (bucketCount < maxRunCount)
+		{
+			bucketCount *= 2;
+		}
+
+		__TextRunCacheEntry* pEntries = new (std::nothrow) __TextRunCacheEntry[maxRunCount];
+		TryReturn(pEntries != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__pBuckets = new (std::nothrow) int[bucketCount];
+		if (__pBuckets == null)
+		{
+			delete[] pEntries;
+		}
+		TryReturn(__pBuckets != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__pAtlas = pAtlas;
+		__pEntries = pEntries;
+		__maxRunCount = maxRunCount;
+		__bucketCount = bucketCount;
+
+		for (int i = 0; i < maxRunCount; i++)
+		{
+			__TextRunCacheEntry& entry = __pEntries[i];
+			entry.pCharacters = null;
+			entry.pPositions = null;
+			entry.glyphCapacity = 0;
+		}
+		Reset();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Draws the specified text with the specified font and the foreground color of the canvas, wrapping it to fit the specified width.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	canvas				The canvas
+	 * @param[in]	point				The position of the top-left corner of the text
+	 * @param[in]	text				The text @n
+	 *									The line break character starts a new line.
+	 * @param[in]	font				The font
+	 * @param[in]	width				The width at which the lines are wrapped, @n
+	 *									or @c 0 if the lines are not wrapped
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OVERFLOW			The glyphs exceed the memory limit of GlyphAtlas, and every page is in use.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A glyph cannot be rasterized.
+	 * @remarks		If the canvas is in the deferred mode, the pages of the glyphs are held with GlyphAtlas::HoldPages(),
+	 *				so that they stay valid until the canvas is flushed, even if they are evicted by later calls.
+	 */
+	result DrawText(SoftwareCanvas& canvas, const Point& point, const Tizen::Base::String& text, const Font& font, int width = 0)
+	{
+		TryReturn(__pEntries != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		int index = -1;
+		result r = FindRun(text, font, width, index);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		const __TextRunCacheEntry& entry = __pEntries[index];
+		r = GrowScratch(entry.glyphCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (canvas.IsDeferredModeEnabled())
+		{
+			r = __pAtlas->HoldPages(canvas);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		r = __pAtlas->GetGlyphs(font, entry.pCharacters, entry.glyphCount, __pGlyphs);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int i = 0; i < entry.glyphCount; i++)
+		{
+			const GlyphInfo& glyph = __pGlyphs[i];
+			if (glyph.pPage == null)
+			{
+				continue;
+			}
+
+			r = canvas.DrawAlphaMask(Point(point.x + entry.pPositions[i * 2] + glyph.offsetX, point.y + entry.pPositions[i * 2 + 1] + glyph.offsetY),
+				glyph.pPage, glyph.pitch, Rectangle(glyph.x, glyph.y, glyph.width, glyph.height));
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the extent of the specified text, which is wrapped to fit the specified width.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	text				The text
+	 * @param[in]	font				The font
+	 * @param[in]	width				The width at which the lines are wrapped, @n
+	 *									or @c 0 if the lines are not wrapped
+	 * @param[out]	extent				The width of the longest line, and the height of all the lines
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OVERFLOW			The glyphs exceed the memory limit of GlyphAtlas, and every page is in use.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A glyph cannot be rasterized.
+	 * @remarks		The layout is kept, so that drawing the same text afterwards does not lay it out again.
+	 */
+	result GetTextExtent(const Tizen::Base::String& text, const Font& font, int width, Dimension& extent)
+	{
+		TryReturn(__pEntries != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		int index = -1;
+		result r = FindRun(text, font, width, index);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		extent.SetSize(__pEntries[index].extentWidth, __pEntries[index].extentHeight);
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Removes all the layouts.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		The buffers of the layouts are kept for reuse.
+	 */
+	void RemoveAll(void)
+	{
+		if (__pEntries != null)
+		{
+			Reset();
+		}
+	}
+
+	/**
+	 * Gets the number of the kept layouts.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the kept layouts
+	 */
+	int GetRunCount(void) const
+	{
+		return __runCount;
+	}
+
+	/**
+	 * Gets the number of bytes which this instance uses.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of bytes of the entries, the buckets, and the layouts
+	 * @remarks		The texts are shared with the String instances of the application, so that they are not counted.
+	 */
+	long long GetMemorySize(void) const
+	{
+		return static_cast< long long >(__maxRunCount) * sizeof(__TextRunCacheEntry) + static_cast< long long >(__bucketCount) * sizeof(int)
+			+ __glyphMemorySize;
+	}
+
+	/**
+	 * Gets the number of the layouts which have been found in the cache, since the construction or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the hits
+	 */
+	long long GetHitCount(void) const
+	{
+		return __hitCount;
+	}
+
+	/**
+	 * Gets the number of the texts which have been laid out, since the construction or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the misses
+	 */
+	long long GetMissCount(void) const
+	{
+		return __missCount;
+	}
+
+	/**
+	 * Gets the ratio of the hits to all the requested layouts, since the construction or the last call to ResetStatistics().
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The hit rate, from @c 0.0f to @c 1.0f, @n
+	 *				else @c 0.0f if no layout has been requested
+	 */
+	float GetHitRate(void) const
+	{
+		long long total = __hitCount + __missCount;
+		return (total > 0) ? static_cast< float >(static_cast< double >(__hitCount) / total) : 0.0f;
+	}
+
+	/**
+	 * Resets the numbers of the hits and the misses.
+	 *
+	 * @since	2.1
+	 */
+	void ResetStatistics(void)
+	{
+		__hitCount = 0;
+		__missCount = 0;
+	}
+
+private:
+	TextRunCache(const TextRunCache& rhs);
+	TextRunCache& operator =(const TextRunCache& rhs);
+
+	// Empties the buckets and the order of use, and chains all the entries into the free list
+	void Reset(void)
+	{
+		memset(__pBuckets, 0xFF, sizeof(int) * __bucketCount);
+		for (int i = 0; i < __maxRunCount; i++)
+		{
+			__pEntries[i].text = Tizen::Base::String();
+			__pEntries[i].nextInBucket = (i + 1 < __maxRunCount) ? i + 1 : -1;
+		}
+
+		__runCount = 0;
+		__first = -1;
+		__last = -1;
+		__free = 0;
+	}
+
+	static int GetHash(const Tizen::Base::String& text, int fontId, int width)
+	{
+		unsigned int hash = static_cast< unsigned int >(text.GetHashCode());
+		hash = hash * 31 + static_cast< unsigned int >(fontId);
+		hash = hash * 31 + static_cast< unsigned int >(width);
+
+		return static_cast< int >(hash ^ (hash >> 16));
+	}
+
+	// Finds the layout of the text, or lays it out and replaces the least recently used one
+	result FindRun(const Tizen::Base::String& text, const Font& font, int width, int& index)
+	{
+		int fontId = -1;
+		result r = __pAtlas->GetFontId(font, fontId);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		width = (width > 0) ? width : 0;
+		int hash = GetHash(text, fontId, width);
+		int bucket = hash & (__bucketCount - 1);
+
+		for (index = __pBuckets[bucket]; index >= 0; index = __pEntries[index].nextInBucket)
+		{
+			const __TextRunCacheEntry& entry = __pEntries[index];
+			if (entry.hash == hash && entry.fontId == fontId && entry.width == width && entry.text == text)
+			{
+				__hitCount++;
+				Unlink(index);
+				LinkFirst(index);
+				return E_SUCCESS;
+			}
+		}
+
+		__missCount++;
+
+		int glyphCount = 0;
+		int extentWidth = 0;
+		int extentHeight = 0;
+		r = Layout(text, font, width, glyphCount, extentWidth, extentHeight);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (__free >= 0)
+		{
+			index = __free;
+			__free = __pEntries[index].nextInBucket;
+			__runCount++;
+		}
+		else
+		{
+			index = __last;
+			Unlink(index);
+			RemoveFromBucket(index);
+		}
+
+		__TextRunCacheEntry& entry = __pEntries[index];
+		if (entry.glyphCapacity < glyphCount)
+		{
+			wchar_t* pCharacters = new (std::nothrow) wchar_t[glyphCount];
+			int* pPositions = new (std::nothrow) int[glyphCount * 2];
+			if (pCharacters == null || pPositions == null)
+			{
+				delete[] pCharacters;
+				delete[] pPositions;
+
+				entry.text = Tizen::Base::String();
+				entry.nextInBucket = __free;
+				__free = index;
+				__runCount--;
+			}
+			TryReturn(pCharacters != null && pPositions != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			delete[] entry.pCharacters;
+			delete[] entry.pPositions;
+			__glyphMemorySize += static_cast< long long >(glyphCount - entry.glyphCapacity) * (sizeof(wchar_t) + sizeof(int) * 2);
+
+			entry.pCharacters = pCharacters;
+			entry.pPositions = pPositions;
+			entry.glyphCapacity = glyphCount;
+		}
+
+		if (glyphCount > 0)
+		{
+			memcpy(entry.pCharacters, __pCharacters, sizeof(wchar_t) * glyphCount);
+			memcpy(entry.pPositions, __pPositions, sizeof(int) * glyphCount * 2);
+		}
+		entry.text = text;
+		entry.fontId = fontId;
+		entry.width = width;
+		entry.hash = hash;
+		entry.glyphCount = glyphCount;
+		entry.extentWidth = extentWidth;
+		entry.extentHeight = extentHeight;
+
+		entry.nextInBucket = __pBuckets[bucket];
+		__pBuckets[bucket] = index;
+		LinkFirst(index);
+
+		return E_SUCCESS;
+	}
+
+	// Places the characters into the scratch buffers, moving the words which exceed the width to the next line
+	result Layout(const Tizen::Base::String& text, const Font& font, int width, int& glyphCount, int& extentWidth, int& extentHeight)
+	{
+		int length = text.GetLength();
+		result r = GrowScratch(length);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		const wchar_t* pText = text.GetPointer();
+		r = __pAtlas->GetGlyphs(font, pText, length, __pGlyphs);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int lineHeight = font.GetMaxHeight();
+		int x = 0;
+		int y = 0;
+		int lineStart = 0;
+
+		// The first glyph after the last space of the line, which starts the next line if the line is wrapped
+		int wordStart = -1;
+
+		glyphCount = 0;
+		extentWidth = 0;
+		for (int i = 0; i < length; i++)
+		{
+			if (pText[i] == L'\n')
+			{
+				extentWidth = (x > extentWidth) ? x : extentWidth;
+				x = 0;
+				y += lineHeight;
+				lineStart = glyphCount;
+				wordStart = -1;
+				continue;
+			}
+
+			int advance = __pGlyphs[i].advance;
+			if (width > 0 && x + advance > width && glyphCount > lineStart && pText[i] != L' ')
+			{
+				int breakX = x;
+				if (wordStart > lineStart)
+				{
+					breakX = (wordStart < glyphCount) ? __pPositions[wordStart * 2] : x;
+					for (int j = wordStart; j < glyphCount; j++)
+					{
+						__pPositions[j * 2] -= breakX;
+						__pPositions[j * 2 + 1] += lineHeight;
+					}
+					lineStart = wordStart;
+				}
+				else
+				{
+					lineStart = glyphCount;
+				}
+
+				extentWidth = (breakX > extentWidth) ? breakX : extentWidth;
+				x -= breakX;
+				y += lineHeight;
+				wordStart = -1;
+			}
+
+			__pCharacters[glyphCount] = pText[i];
+			__pPositions[glyphCount * 2] = x;
+			__pPositions[glyphCount * 2 + 1] = y;
+			glyphCount++;
+			x += advance;
+
+			if (pText[i] == L' ')
+			{
+				wordStart = glyphCount;
+			}
+		}
+
+		extentWidth = (x > extentWidth) ? x : extentWidth;
+		extentHeight = (length > 0) ? y + lineHeight : 0;
+
+		return E_SUCCESS;
+	}
+
+	result GrowScratch(int count)
+	{
+		if (count <= __scratchCapacity)
+		{
+			return E_SUCCESS;
+		}
+
+		int capacity = (__scratchCapacity > 0) ? __scratchCapacity : DEFAULT_SCRATCH_CAPACITY;
+		while (capacity < count)
+		{
+			capacity *= 2;
+		}
+
+		wchar_t* pCharacters = new (std::nothrow) wchar_t[capacity];
+		int* pPositions = new (std::nothrow) int[capacity * 2];
+		GlyphInfo* pGlyphs = new (std::nothrow) GlyphInfo[capacity];
+		if (pCharacters == null || pPositions == null || pGlyphs == null)
+		{
+			delete[] pCharacters;
+			delete[] pPositions;
+			delete[] pGlyphs;
+		}
+		TryReturn(pCharacters != null && pPositions != null && pGlyphs != null, E_OUT_OF_MEMORY,
+			"[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		delete[] __pCharacters;
+		delete[] __pPositions;
+		delete[] __pGlyphs;
+
+		__pCharacters = pCharacters;
+		__pPositions = pPositions;
+		__pGlyphs = pGlyphs;
+		__scratchCapacity = capacity;
+
+		return E_SUCCESS;
+	}
+
+	void LinkFirst(int index)
+	{
+		__TextRunCacheEntry& entry = __pEntries[index];
+		entry.previous = -1;
+		entry.next = __first;
+		if (__first >= 0)
+		{
+			__pEntries[__first].previous = index;
+		}
+		else
+		{
+			__last = index;
+		}
+		__first = index;
+	}
+
+	void Unlink(int index)
+	{
+		__TextRunCacheEntry& entry = __pEntries[index];
+		if (entry.previous >= 0)
+		{
+			__pEntries[entry.previous].next = entry.next;
+		}
+		else
+		{
+			__first = entry.next;
+		}
+
+		if (entry.next >= 0)
+		{
+			__pEntries[entry.next].previous = entry.previous;
+		}
+		else
+		{
+			__last = entry.previous;
+		}
+	}
+
+	void RemoveFromBucket(int index)
+	{
+		int* pLink = &__pBuckets[__pEntries[index].hash & (__bucketCount - 1)];
+		while (*pLink != index)
+		{
+			pLink = &__pEntries[*pLink].nextInBucket;
+		}
+		*pLink = __pEntries[index].nextInBucket;
+	}
+
+	static const int DEFAULT_MAX_RUN_COUNT = 512;
+	static const int DEFAULT_BUCKET_COUNT = 16;
+	static const int DEFAULT_SCRATCH_CAPACITY = 64;
+
+	GlyphAtlas* __pAtlas;
+
+	__TextRunCacheEntry* __pEntries;
+	int __maxRunCount;
+	int __runCount;
+
+	// The most and the least recently used entries, and the first unused entry, or -1
+	int __first;
+	int __last;
+	int __free;
+
+	// The first entry of each bucket, or -1
+	int* __pBuckets;
+	int __bucketCount;
+
+	// The buffers of the layout and of the drawing, which are reused
+	wchar_t* __pCharacters;
+	int* __pPositions;
+	GlyphInfo* __pGlyphs;
+	int __scratchCapacity;
+
+	long long __glyphMemorySize;
+	long long __hitCount;
+	long long __missCount;
+
+}; // TextRunCache
+
+}} // Tizen::Graphics
+
+#endif // _FGRP_TEXT_RUN_CACHE_H_
@@ -25,20 +25,28 @@
 #define _FIO_H_
 
 #include <FIoFile.h>
+#include <FIoAsyncFile.h>
 #include <FIoDirectory.h>
 #include <FIoDirEntry.h>
 #include <FIoDirEnumerator.h>
+#include <FIoDirEntryBlock.h>
 #include <FIoRegistry.h>
+#include <FIoBinaryRegistry.h>
 #include <FIoDbTypes.h>
 #include <FIoDatabase.h>
 #include <FIoDbStatement.h>
 #include <FIoDbEnumerator.h>
+#include <FIoDbStatementCache.h>
+#include <FIoDbBatch.h>
+#include <FIoDbColumnBlock.h>
+#include <FIoDbBlockReader.h>
 #include <FIoSqlStatementBuilder.h>
 #include <FIoFileEventManager.h>
 #include <FIoChannel.h>
 #include <FIoMessagePortManager.h>
 #include <FIoSerialPort.h>
 #include <FIoMmcStorageManager.h>
+#include <FIoIAsyncFileListener.h>
 #include <FIoIDbEnumerator.h>
 #include <FIoIFileEventListener.h>
 #include <FIoIMessagePortListener.h>
@@ -46,6 +54,7 @@
 #include <FIoIMmcStorageMountListener.h>
 #include <FIoIMmcStorageFormatListener.h>
 #include <FIoMemoryMappedFile.h>
+#include <FIoMappedByteBuffer.h>
 #include <FIoFileLock.h>
 #include <FIoDataRow.h>
 #include <FIoDataSetEnumerator.h>
@@ -0,0 +1,855 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoAsyncFile.h
+ * @brief	This is the header file for the %AsyncFile class.
+ *
+ * This header file contains the declarations of the %AsyncFile class.
+ */
+
+#ifndef _FIO_ASYNC_FILE_H_
+#define _FIO_ASYNC_FILE_H_
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseString.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayListT.h>
+#include <FBaseRtEvent.h>
+#include <FBaseRtIEventArg.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtMonitor.h>
+#include <FBaseRtThreadPool.h>
+#include <FBaseUtilStringUtil.h>
+#include <FIoIAsyncFileListener.h>
+
+namespace Tizen { namespace Io
+{
+
+/**
+ * @enum	FileAccessAdvice
+ *
+ * Defines the expected access pattern of a file, which the system uses for its readahead and caching.
+ *
+ * @since	2.1
+ */
+enum FileAccessAdvice
+{
+	FILE_ACCESS_ADVICE_NORMAL = 0,		/**< No advice is given */
+	FILE_ACCESS_ADVICE_SEQUENTIAL,		/**< The data is read sequentially, so that a larger readahead is used */
+	FILE_ACCESS_ADVICE_RANDOM,			/**< The data is read randomly, so that the readahead is disabled */
+	FILE_ACCESS_ADVICE_WILL_NEED,		/**< The data is read soon, so that it is read into the cache in the background */
+	FILE_ACCESS_ADVICE_DONT_NEED		/**< The data is not read again soon, so that its cache can be dropped */
+};
+
+class AsyncFile;
+
+//
+// @class	__AsyncFileRequest
+// @brief	This class is a read or write request of %AsyncFile, which runs on a worker thread of the pool.
+// @since 2.1
+//
+class __AsyncFileRequest
+	: public Tizen::Base::Runtime::IRunnable
+{
+public:
+	enum State
+	{
+		STATE_PENDING,
+		STATE_RUNNING,
+		STATE_CANCELED
+	};
+
+	__AsyncFileRequest(AsyncFile& file, RequestId requestId, bool isWrite, long long offset)
+		: pFile(&file)
+		, id(requestId)
+		, isWrite(isWrite)
+		, offset(offset)
+		, state(STATE_PENDING)
+		, pVectors(null)
+		, ppBuffers(null)
+		, vectorCount(0)
+		, transferred(0)
+		, r(E_SUCCESS)
+	{
+	}
+
+	virtual ~__AsyncFileRequest(void)
+	{
+		delete[] pVectors;
+		delete[] ppBuffers;
+	}
+
+	result Construct(int count)
+	{
+		pVectors = new (std::nothrow) struct iovec[count];
+		TryReturn(pVectors != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		vectorCount = count;
+
+		return E_SUCCESS;
+	}
+
+	virtual Tizen::Base::Object* Run(void);
+
+	AsyncFile* pFile;
+	RequestId id;
+	bool isWrite;
+	long long offset;
+	volatile int state;
+
+	struct iovec* pVectors;
+
+	// The buffers whose positions are advanced on completion, or null for a raw buffer
+	Tizen::Base::ByteBuffer** ppBuffers;
+	int vectorCount;
+
+	int transferred;
+	result r;
+
+private:
+	__AsyncFileRequest(const __AsyncFileRequest& rhs);
+	__AsyncFileRequest& operator =(const __AsyncFileRequest& rhs);
+
+}; // __AsyncFileRequest
+
+//
+// @class	__AsyncFileCompletionArg
+// @brief	This class carries a completed %__AsyncFileRequest to the thread which has constructed the %AsyncFile.
+// @since 2.1
+//
+class __AsyncFileCompletionArg
+	: public Tizen::Base::Runtime::IEventArg
+{
+public:
+	explicit __AsyncFileCompletionArg(__AsyncFileRequest* pRequest)
+		: pRequest(pRequest)
+	{
+	}
+
+	virtual ~__AsyncFileCompletionArg(void)
+	{
+		delete pRequest;
+	}
+
+	__AsyncFileRequest* pRequest;
+
+private:
+	__AsyncFileCompletionArg(const __AsyncFileCompletionArg& rhs);
+	__AsyncFileCompletionArg& operator =(const __AsyncFileCompletionArg& rhs);
+
+}; // __AsyncFileCompletionArg
+
+//
+// @class	__AsyncFileCompletionEvent
+// @brief	This class delivers the completions of %AsyncFile to its listener on the thread which constructs it.
+// @since 2.1
+//
+class __AsyncFileCompletionEvent
+	: public Tizen::Base::Runtime::Event
+{
+public:
+	__AsyncFileCompletionEvent(void)
+	{
+	}
+
+	virtual ~__AsyncFileCompletionEvent(void)
+	{
+	}
+
+protected:
+	virtual void FireImpl(Tizen::Base::Runtime::IEventListener& listener, const Tizen::Base::Runtime::IEventArg& arg);
+
+private:
+	__AsyncFileCompletionEvent(const __AsyncFileCompletionEvent& rhs);
+	__AsyncFileCompletionEvent& operator =(const __AsyncFileCompletionEvent& rhs);
+
+}; // __AsyncFileCompletionEvent
+
+/**
+ * @class	AsyncFile
+ * @brief	This class reads and writes a file on worker threads, and notifies the completions to a listener.
+ *
+ * @since	2.1
+ *
+ * The %AsyncFile class submits read and write requests to a pool of worker threads, so that the thread that makes them is not blocked by the storage.
+ * The completion of each request is delivered to IAsyncFileListener on the thread that has constructed the instance,
+ * which must be an event-driven thread such as the main thread of a UI application. @n
+ * A request reads or writes at an explicit offset, so that requests do not share a file position and can run in parallel.
+ * A request can scatter the data into, or gather it from, several buffers with a single system call. @n
+ * A request that has not started yet can be canceled, and Advise() tells the system the access pattern so that it can read ahead.
+ *
+ * The following example demonstrates how to use the %AsyncFile class.
+ *
+ * @code
+ *	result
+ *	MyGallery::Construct(const String& thumbnailPackPath)
+ *	{
+ *		result r = __thumbnails.Construct(thumbnailPackPath, L"r", *this);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		return __thumbnails.Advise(0, 0, FILE_ACCESS_ADVICE_RANDOM);
+ *	}
+ *
+ *	void
+ *	MyGallery::OnItemVisible(int index)
+ *	{
+ *		RequestId requestId = 0;
+ *		__thumbnails.ReadAsync(GetThumbnailOffset(index), GetThumbnailBuffer(index), GetThumbnailSize(index), requestId);
+ *	}
+ *
+ *	void
+ *	MyGallery::OnAsyncFileReadCompleted(AsyncFile& file, RequestId requestId, int length, result r)
+ *	{
+ *		// Decodes and shows the thumbnail ...
+ *	}
+ * @endcode
+ */
+class AsyncFile
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	AsyncFile(void)
+		: __fd(-1)
+		, __pListener(null)
+		, __pPool(null)
+		, __ownsPool(false)
+		, __nextRequestId(0)
+		, __outstandingCount(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The requests that have not started are canceled, the running requests are waited for, and the file is closed.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		No completion is delivered after the instance is deleted.
+	 */
+	virtual ~AsyncFile(void)
+	{
+		if (__pPool != null)
+		{
+			CancelAll();
+
+			__monitor.Enter();
+			while (__outstandingCount > 0)
+			{
+				__monitor.Wait();
+			}
+			__monitor.Exit();
+
+			if (__ownsPool)
+			{
+				delete __pPool;
+			}
+		}
+
+		if (__fd >= 0)
+		{
+			close(__fd);
+		}
+	}
+
+	/**
+	 * Opens the specified file for the asynchronous requests.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filePath			The path of the file
+	 * @param[in]	openMode			The mode to open the file, which is one of "r", "r+", "w", "w+", "a", and "a+" as in File::Construct()
+	 * @param[in]	listener			The listener of the completions
+	 * @param[in]	pPool				The pool to run the requests on, which must outlive this instance, @n
+	 *									else @c null to create a pool of two workers for this instance
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c openMode is invalid.
+	 * @exception	E_FILE_NOT_FOUND	The file does not exist.
+	 * @exception	E_ILLEGAL_ACCESS	The access to the file is denied.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				The file cannot be opened.
+	 * @exception	E_SYSTEM			The worker threads cannot be started.
+	 * @remarks		This method must be called on an event-driven thread, which the completions are delivered to.
+	 */
+	result Construct(const Tizen::Base::String& filePath, const Tizen::Base::String& openMode, IAsyncFileListener& listener,
+		Tizen::Base::Runtime::ThreadPool* pPool = null)
+	{
+		TryReturn(__fd < 0, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		int flags = GetOpenFlags(openMode);
+		TryReturn(flags >= 0, E_INVALID_ARG, "[%s] The openMode(%ls) is invalid.", GetErrorMessage(E_INVALID_ARG), openMode.GetPointer());
+
+		result r = __monitor.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __requests.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __completionEvent.AddListener(listener, true);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		Tizen::Base::ByteBuffer* pPath = Tizen::Base::Utility::StringUtil::StringToUtf8N(filePath);
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Failed to convert the path.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		int fd = open64(reinterpret_cast< const char* >(pPath->GetPointer()), flags | O_CLOEXEC, FILE_MODE);
+		int error = errno;
+		delete pPath;
+
+		if (fd < 0)
+		{
+			r = ConvertError(error);
+			AppLogException("[%s] Failed to open the file(%ls).", GetErrorMessage(r), filePath.GetPointer());
+			return r;
+		}
+
+		if (pPool == null)
+		{
+			pPool = new (std::nothrow) Tizen::Base::Runtime::ThreadPool();
+			TryCatch(pPool != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			r = pPool->Construct(DEFAULT_WORKER_COUNT);
+			if (r != E_SUCCESS)
+			{
+				delete pPool;
+				AppLogException("[%s] Propagating.", GetErrorMessage(r));
+				goto CATCH;
+			}
+			__ownsPool = true;
+		}
+
+		__fd = fd;
+		__pListener = &listener;
+		__pPool = pPool;
+
+		return E_SUCCESS;
+
+CATCH:
+		close(fd);
+		return r;
+	}
+
+	/**
+	 * Requests to read the data at the specified offset into the specified buffer.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	offset				The offset in the file to read from
+	 * @param[out]	pBuffer				The buffer to read into, which must be valid until the request completes
+	 * @param[in]	length				The number of bytes to read
+	 * @param[out]	requestId			The ID of the request
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c offset or @c length is negative, or the specified @c pBuffer is @c null.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		IAsyncFileListener::OnAsyncFileReadCompleted() is called when the request completes.
+	 */
+	result ReadAsync(long long offset, void* pBuffer, int length, RequestId& requestId)
+	{
+		return SubmitRaw(false, offset, pBuffer, length, requestId);
+	}
+
+	/**
+	 * Requests to read the data at the specified offset into the remaining space of the specified buffers in order.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	offset				The offset in the file to read from
+	 * @param[in]	pBuffers			The array of the buffers to read into, which must be valid until the request completes @n
+	 *									The data is read from the position to the limit of each buffer.
+	 * @param[in]	bufferCount			The number of the buffers
+	 * @param[out]	requestId			The ID of the request
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c offset is negative, @c pBuffers or one of the buffers is @c null,
+	 *									or the specified @c bufferCount is not between @c 1 and @c 1024.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The position of each buffer is advanced by the number of bytes read into it before the listener is called.
+	 */
+	result ReadAsync(long long offset, Tizen::Base::ByteBuffer* pBuffers[], int bufferCount, RequestId& requestId)
+	{
+		return SubmitBuffers(false, offset, pBuffers, bufferCount, requestId);
+	}
+
+	/**
+	 * Requests to write the data in the specified buffer at the specified offset.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	offset				The offset in the file to write to
+	 * @param[in]	pBuffer				The data to write, which must be valid until the request completes
+	 * @param[in]	length				The number of bytes to write
+	 * @param[out]	requestId			The ID of the request
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c offset or @c length is negative, or the specified @c pBuffer is @c null.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		IAsyncFileListener::OnAsyncFileWriteCompleted() is called when the request completes. @n
+	 *				If the file is opened in the append mode, the data is written at the end of the file regardless of @c offset. @n
+	 *				The order of the writes to overlapping regions is not defined unless a write is requested after the previous one completes.
+	 */
+	result WriteAsync(long long offset, const void* pBuffer, int length, RequestId& requestId)
+	{
+		return SubmitRaw(true, offset, const_cast< void* >(pBuffer), length, requestId);
+	}
+
+	/**
+	 * Requests to write the remaining data of the specified buffers in order at the specified offset.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	offset				The offset in the file to write to
+	 * @param[in]	pBuffers			The array of the buffers to write, which must be valid until the request completes @n
+	 *									The data is written from the position to the limit of each buffer.
+	 * @param[in]	bufferCount			The number of the buffers
+	 * @param[out]	requestId			The ID of the request
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c offset is negative, @c pBuffers or one of the buffers is @c null,
+	 *									or the specified @c bufferCount is not between @c 1 and @c 1024.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The position of each buffer is advanced by the number of bytes written from it before the listener is called.
+	 */
+	result WriteAsync(long long offset, Tizen::Base::ByteBuffer* pBuffers[], int bufferCount, RequestId& requestId)
+	{
+		return SubmitBuffers(true, offset, pBuffers, bufferCount, requestId);
+	}
+
+	/**
+	 * Cancels the specified request if it has not started yet.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	requestId			The ID of the request
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The request has already started, has completed, or does not exist.
+	 * @remarks		The listener is not called for a canceled request, and its buffers can be reused at once.
+	 */
+	result Cancel(RequestId requestId)
+	{
+		result r = E_OBJ_NOT_FOUND;
+
+		__monitor.Enter();
+
+		int count = __requests.GetCount();
+		for (int i = 0; i < count; i++)
+		{
+			__AsyncFileRequest* pRequest = null;
+			__requests.GetAt(i, pRequest);
+
+			if (pRequest->id == requestId)
+			{
+				if (__sync_bool_compare_and_swap(&pRequest->state, __AsyncFileRequest::STATE_PENDING, __AsyncFileRequest::STATE_CANCELED))
+				{
+					r = E_SUCCESS;
+				}
+				break;
+			}
+		}
+
+		__monitor.Exit();
+
+		return r;
+	}
+
+	/**
+	 * Cancels all the requests that have not started yet.
+	 *
+	 * @since	2.1
+	 */
+	void CancelAll(void)
+	{
+		__monitor.Enter();
+
+		int count = __requests.GetCount();
+		for (int i = 0; i < count; i++)
+		{
+			__AsyncFileRequest* pRequest = null;
+			__requests.GetAt(i, pRequest);
+
+			__sync_bool_compare_and_swap(&pRequest->state, __AsyncFileRequest::STATE_PENDING, __AsyncFileRequest::STATE_CANCELED);
+		}
+
+		__monitor.Exit();
+	}
+
+	/**
+	 * Tells the system how the specified region of the file is accessed.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	offset				The offset of the region
+	 * @param[in]	length				The length of the region, or @c 0 for the region to the end of the file
+	 * @param[in]	advice				The expected access pattern
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c offset or @c length is negative, or the specified @c advice is invalid.
+	 * @remarks		FILE_ACCESS_ADVICE_WILL_NEED starts reading the region into the cache without blocking, so that the following reads of the region do not wait for the storage.
+	 */
+	result Advise(long long offset, long long length, FileAccessAdvice advice)
+	{
+		static const int ADVICES[] =
+		{
+			POSIX_FADV_NORMAL, POSIX_FADV_SEQUENTIAL, POSIX_FADV_RANDOM, POSIX_FADV_WILLNEED, POSIX_FADV_DONTNEED
+		};
+
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(offset >= 0 && length >= 0, E_INVALID_ARG,
+			"[%s] The offset(%lld) and the length(%lld) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), offset, length);
+		TryReturn(advice >= FILE_ACCESS_ADVICE_NORMAL && advice <= FILE_ACCESS_ADVICE_DONT_NEED, E_INVALID_ARG,
+			"[%s] The advice(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), advice);
+
+		int error = posix_fadvise64(__fd, offset, length, ADVICES[advice]);
+		TryReturn(error == 0, ConvertError(error), "[%s] Failed to give the advice.", GetErrorMessage(ConvertError(error)));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the number of the requests that have not completed.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the pending and running requests
+	 */
+	int GetPendingRequestCount(void) const
+	{
+		return __outstandingCount;
+	}
+
+private:
+	AsyncFile(const AsyncFile& rhs);
+	AsyncFile& operator =(const AsyncFile& rhs);
+
+	result SubmitRaw(bool isWrite, long long offset, void* pBuffer, int length, RequestId& requestId)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(offset >= 0 && length >= 0 && pBuffer != null, E_INVALID_ARG,
+			"[%s] The offset(%lld) and the length(%d) MUST be greater than or equal to 0, and the buffer MUST not be null.",
+			GetErrorMessage(E_INVALID_ARG), offset, length);
+
+		__AsyncFileRequest* pRequest = new (std::nothrow) __AsyncFileRequest(*this, __sync_add_and_fetch(&__nextRequestId, 1), isWrite, offset);
+		TryReturn(pRequest != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pRequest->Construct(1);
+		if (r != E_SUCCESS)
+		{
+			delete pRequest;
+			return r;
+		}
+
+		pRequest->pVectors[0].iov_base = pBuffer;
+		pRequest->pVectors[0].iov_len = length;
+
+		return Submit(pRequest, requestId);
+	}
+
+	result SubmitBuffers(bool isWrite, long long offset, Tizen::Base::ByteBuffer* pBuffers[], int bufferCount, RequestId& requestId)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(offset >= 0 && pBuffers != null && bufferCount > 0 && bufferCount <= MAX_BUFFER_COUNT, E_INVALID_ARG,
+			"[%s] The offset(%lld) MUST be greater than or equal to 0, and the bufferCount(%d) MUST be between 1 and %d.",
+			GetErrorMessage(E_INVALID_ARG), offset, bufferCount, MAX_BUFFER_COUNT);
+
+		for (int i = 0; i < bufferCount; i++)
+		{
+			TryReturn(pBuffers[i] != null, E_INVALID_ARG, "[%s] The buffer(%d) is null.", GetErrorMessage(E_INVALID_ARG), i);
+		}
+
+		result r = E_SUCCESS;
+		__AsyncFileRequest* pRequest = new (std::nothrow) __AsyncFileRequest(*this, __sync_add_and_fetch(&__nextRequestId, 1), isWrite, offset);
+		TryReturn(pRequest != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pRequest->Construct(bufferCount);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		pRequest->ppBuffers = new (std::nothrow) Tizen::Base::ByteBuffer*[bufferCount];
+		TryCatch(pRequest->ppBuffers != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		for (int i = 0; i < bufferCount; i++)
+		{
+			pRequest->ppBuffers[i] = pBuffers[i];
+			pRequest->pVectors[i].iov_base = const_cast< byte* >(pBuffers[i]->GetPointer()) + pBuffers[i]->GetPosition();
+			pRequest->pVectors[i].iov_len = pBuffers[i]->GetRemaining();
+		}
+
+		return Submit(pRequest, requestId);
+
+CATCH:
+		delete pRequest;
+		return r;
+	}
+
+	result Submit(__AsyncFileRequest* pRequest, RequestId& requestId)
+	{
+		// A worker may complete and delete the request before ThreadPool::Submit() returns.
+		const RequestId id = pRequest->id;
+
+		__monitor.Enter();
+
+		result r = __requests.Add(pRequest);
+		if (r == E_SUCCESS)
+		{
+			__outstandingCount++;
+		}
+
+		__monitor.Exit();
+
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __pPool->Submit(*pRequest);
+		if (r != E_SUCCESS)
+		{
+			AppLogException("[%s] Failed to submit the request.", GetErrorMessage(r));
+
+			__monitor.Enter();
+			__requests.Remove(pRequest);
+			__outstandingCount--;
+			__monitor.Exit();
+
+			goto CATCH;
+		}
+
+		requestId = id;
+
+		return E_SUCCESS;
+
+CATCH:
+		delete pRequest;
+		return r;
+	}
+
+	// Called on a worker thread
+	void Process(__AsyncFileRequest* pRequest)
+	{
+		if (__sync_bool_compare_and_swap(&pRequest->state, __AsyncFileRequest::STATE_PENDING, __AsyncFileRequest::STATE_RUNNING))
+		{
+			Transfer(*pRequest);
+		}
+
+		__monitor.Enter();
+
+		__requests.Remove(pRequest);
+
+		// The completion of a request canceled before it started is not delivered
+		if (pRequest->state == __AsyncFileRequest::STATE_CANCELED)
+		{
+			delete pRequest;
+		}
+		else
+		{
+			__AsyncFileCompletionArg* pArg = new (std::nothrow) __AsyncFileCompletionArg(pRequest);
+			if (pArg == null)
+			{
+				AppLogException("[%s] Failed to deliver the completion of the request(%ld).", GetErrorMessage(E_OUT_OF_MEMORY), pRequest->id);
+				delete pRequest;
+			}
+			else if (__completionEvent.Fire(*pArg) != E_SUCCESS)
+			{
+				AppLogException("[%s] Failed to deliver the completion of the request(%ld).", GetErrorMessage(E_SYSTEM), pRequest->id);
+
+				// The undelivered argument deletes the request
+				delete pArg;
+			}
+		}
+
+		// The destructor may return as soon as the count becomes 0
+		__outstandingCount--;
+		__monitor.NotifyAll();
+		__monitor.Exit();
+	}
+
+	void Transfer(__AsyncFileRequest& request)
+	{
+		struct iovec* pVectors = request.pVectors;
+		int vectorCount = request.vectorCount;
+		long long offset = request.offset;
+
+		// The 64-bit variants take a 64-bit offset on a 32-bit target as well
+		while (vectorCount > 0)
+		{
+			ssize_t length = request.isWrite ? pwritev64(__fd, pVectors, vectorCount, offset) : preadv64(__fd, pVectors, vectorCount, offset);
+			if (length < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				request.r = ConvertError(errno);
+				break;
+			}
+
+			// The end of the file
+			if (length == 0)
+			{
+				break;
+			}
+
+			request.transferred += length;
+			offset += length;
+
+			// Skips the vectors that have been transferred, and continues a short transfer from the rest
+			while (vectorCount > 0 && static_cast< size_t >(length) >= pVectors->iov_len)
+			{
+				length -= pVectors->iov_len;
+				pVectors++;
+				vectorCount--;
+			}
+			if (vectorCount > 0)
+			{
+				pVectors->iov_base = static_cast< byte* >(pVectors->iov_base) + length;
+				pVectors->iov_len -= length;
+			}
+		}
+	}
+
+	// Called on the thread which has constructed this instance
+	void Complete(__AsyncFileRequest& request)
+	{
+		if (request.ppBuffers != null)
+		{
+			int remaining = request.transferred;
+			for (int i = 0; i < request.vectorCount && remaining > 0; i++)
+			{
+				Tizen::Base::ByteBuffer* pBuffer = request.ppBuffers[i];
+				int length = (remaining < pBuffer->GetRemaining()) ? remaining : pBuffer->GetRemaining();
+
+				pBuffer->SetPosition(pBuffer->GetPosition() + length);
+				remaining -= length;
+			}
+		}
+
+		if (request.isWrite)
+		{
+			__pListener->OnAsyncFileWriteCompleted(*this, request.id, request.transferred, request.r);
+		}
+		else
+		{
+			__pListener->OnAsyncFileReadCompleted(*this, request.id, request.transferred, request.r);
+		}
+	}
+
+	static int GetOpenFlags(const Tizen::Base::String& openMode)
+	{
+		static const wchar_t* const MODES[] = { L"r", L"r+", L"w", L"w+", L"a", L"a+" };
+		static const int FLAGS[] =
+		{
+			O_RDONLY, O_RDWR, O_WRONLY | O_CREAT | O_TRUNC, O_RDWR | O_CREAT | O_TRUNC, O_WRONLY | O_CREAT | O_APPEND, O_RDWR | O_CREAT | O_APPEND
+		};
+
+		for (unsigned int i = 0; i < sizeof(FLAGS) / sizeof(FLAGS[0]); i++)
+		{
+			if (openMode == MODES[i])
+			{
+				return FLAGS[i];
+			}
+		}
+
+		return -1;
+	}
+
+	static result ConvertError(int error)
+	{
+		switch (error)
+		{
+		case ENOENT:
+			return E_FILE_NOT_FOUND;
+
+		case EACCES:
+			// Falls through
+		case EPERM:
+			// Falls through
+		case EROFS:
+			// Falls through
+		case EBADF:
+			return E_ILLEGAL_ACCESS;
+
+		case ENOSPC:
+			return E_STORAGE_FULL;
+
+		case EINVAL:
+			return E_INVALID_ARG;
+
+		case ENOMEM:
+			return E_OUT_OF_MEMORY;
+
+		default:
+			return E_IO;
+		}
+	}
+
+	static const int DEFAULT_WORKER_COUNT = 2;
+	static const int MAX_BUFFER_COUNT = 1024;
+	static const int FILE_MODE = 0666;
+
+	int __fd;
+	IAsyncFileListener* __pListener;
+	Tizen::Base::Runtime::ThreadPool* __pPool;
+	bool __ownsPool;
+	volatile RequestId __nextRequestId;
+
+	// Guards __requests and __outstandingCount
+	Tizen::Base::Runtime::Monitor __monitor;
+	Tizen::Base::Collection::ArrayListT< __AsyncFileRequest* > __requests;
+	volatile int __outstandingCount;
+
+	__AsyncFileCompletionEvent __completionEvent;
+
+	friend class __AsyncFileRequest;
+	friend class __AsyncFileCompletionEvent;
+
+}; // AsyncFile
+
+inline Tizen::Base::Object*
+__AsyncFileRequest::Run(void)
+{
+	pFile->Process(this);
+
+	return null;
+}
+
+inline void
+__AsyncFileCompletionEvent::FireImpl(Tizen::Base::Runtime::IEventListener&, const Tizen::Base::Runtime::IEventArg& arg)
+{
+	const __AsyncFileCompletionArg* pArg = dynamic_cast< const __AsyncFileCompletionArg* >(&arg);
+	if (pArg != null)
+	{
+		pArg->pRequest->pFile->Complete(*pArg->pRequest);
+	}
+}
+
+}} // Tizen::Io
+
+#endif // _FIO_ASYNC_FILE_H_
@@ -0,0 +1,2040 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoBinaryRegistry.h
+ * @brief	This is the header file for the %BinaryRegistry class.
+ *
+ * This header file contains the declarations of the %BinaryRegistry class.
+ */
+
+#ifndef _FIO_BINARY_REGISTRY_H_
+#define _FIO_BINARY_REGISTRY_H_
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseString.h>
+#include <FBaseUuId.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayList.h>
+#include <FBaseColArrayListT.h>
+#include <FBaseUtilStringUtil.h>
+
+namespace Tizen { namespace Io
+{
+
+//
+// @struct	__BinaryRegistryFileHeader
+// @brief	This is the header at the start of a binary registry file.
+//
+// The header is followed by the snapshot of the live records written by the last compaction, the hashed index of the snapshot,
+// and the log of the records appended by the flushes since the last compaction.
+//
+struct __BinaryRegistryFileHeader
+{
+	unsigned int magic;
+	unsigned short version;
+	unsigned short reserved;
+	unsigned int indexOffset;
+	unsigned int indexSlotCount;
+	unsigned int logOffset;
+	unsigned int snapshotRecordCount;
+	unsigned int reserved2[2];
+};
+
+//
+// @struct	__BinaryRegistryRecordHeader
+// @brief	This is the header of a record, which is followed by the section name, the entry name, and the value.
+//
+// The names are UTF-8 and null-terminated, the value is followed by a null byte, and the record is padded to 4 bytes.
+// A section record has an empty entry name. The checksum covers the record from the operation to the null byte after the value.
+//
+struct __BinaryRegistryRecordHeader
+{
+	unsigned int size;
+	unsigned int checksum;
+	byte operation;
+	byte type;
+	unsigned short sectionLength;
+	unsigned short entryLength;
+	unsigned short reserved;
+	unsigned int valueLength;
+};
+
+//
+// @struct	__BinaryRegistrySlot
+// @brief	This is a slot of a hashed index, which locates the latest record of a key by the hash of the key.
+//
+// The offset of an empty slot is 0, as no record starts at the file header.
+//
+struct __BinaryRegistrySlot
+{
+	unsigned int hash;
+	unsigned int offset;
+};
+
+//
+// @class	__BinaryRegistryKey
+// @brief	This class holds the UTF-8 section name and entry name of a key, and the hash of the key.
+//
+class __BinaryRegistryKey
+{
+public:
+	__BinaryRegistryKey(void)
+		: __pBuffer(__inlineBuffer)
+		, __sectionLength(0)
+		, __entryLength(0)
+		, __hash(0)
+	{
+	}
+
+	~__BinaryRegistryKey(void)
+	{
+		if (__pBuffer != __inlineBuffer)
+		{
+			delete[] __pBuffer;
+		}
+	}
+
+	// The key of a section if pEntryName is null, or the key of an entry
+	result Construct(const Tizen::Base::String& sectionName, const Tizen::Base::String* pEntryName)
+	{
+		int sectionChars = sectionName.GetLength();
+		int entryChars = (pEntryName != null) ? pEntryName->GetLength() : 0;
+		TryReturn(sectionChars > 0 && sectionChars <= MAX_NAME_LENGTH && (pEntryName == null || (entryChars > 0 && entryChars <= MAX_NAME_LENGTH)),
+			E_INVALID_ARG, "[%s] The length of the section name(%d) and the entry name(%d) MUST be between 1 and %d.",
+			GetErrorMessage(E_INVALID_ARG), sectionChars, entryChars, MAX_NAME_LENGTH);
+
+		// A UTF-32 character is at most 4 bytes in UTF-8
+		result r = Reserve((sectionChars + entryChars) * 4 + 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__sectionLength = EncodeUtf8(sectionName.GetPointer(), sectionChars, __pBuffer);
+		__pBuffer[__sectionLength] = 0;
+		__entryLength = (pEntryName != null) ? EncodeUtf8(pEntryName->GetPointer(), entryChars, __pBuffer + __sectionLength + 1) : 0;
+		__pBuffer[__sectionLength + 1 + __entryLength] = 0;
+
+		TryReturn(__sectionLength <= MAX_NAME_LENGTH && __entryLength <= MAX_NAME_LENGTH, E_INVALID_ARG,
+			"[%s] The section name or the entry name is longer than %d bytes in UTF-8.", GetErrorMessage(E_INVALID_ARG), MAX_NAME_LENGTH);
+
+		__hash = Hash(__pBuffer, __sectionLength, GetEntry(), __entryLength);
+		return E_SUCCESS;
+	}
+
+	// The key of the specified UTF-8 names, which are not null-terminated
+	result Construct(const byte* pSection, int sectionLength, const byte* pEntry, int entryLength)
+	{
+		result r = Reserve(sectionLength + entryLength + 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		memcpy(__pBuffer, pSection, sectionLength);
+		__pBuffer[sectionLength] = 0;
+		if (entryLength > 0)
+		{
+			memcpy(__pBuffer + sectionLength + 1, pEntry, entryLength);
+		}
+		__pBuffer[sectionLength + 1 + entryLength] = 0;
+
+		__sectionLength = sectionLength;
+		__entryLength = entryLength;
+		__hash = Hash(__pBuffer, __sectionLength, GetEntry(), __entryLength);
+		return E_SUCCESS;
+	}
+
+	const byte* GetSection(void) const
+	{
+		return __pBuffer;
+	}
+
+	int GetSectionLength(void) const
+	{
+		return __sectionLength;
+	}
+
+	const byte* GetEntry(void) const
+	{
+		return __pBuffer + __sectionLength + 1;
+	}
+
+	int GetEntryLength(void) const
+	{
+		return __entryLength;
+	}
+
+	unsigned int GetHash(void) const
+	{
+		return __hash;
+	}
+
+	// FNV-1a of the section name and the entry name, separated by a byte which does not occur in UTF-8
+	static unsigned int Hash(const byte* pSection, int sectionLength, const byte* pEntry, int entryLength)
+	{
+		unsigned int hash = Checksum(pSection, sectionLength, FNV_OFFSET_BASIS);
+		hash = (hash ^ 0xFF) * FNV_PRIME;
+		return Checksum(pEntry, entryLength, hash);
+	}
+
+	static unsigned int Checksum(const byte* pData, int length, unsigned int hash = FNV_OFFSET_BASIS)
+	{
+		for (int i = 0; i < length; i++)
+		{
+			hash = (hash ^ pData[i]) * FNV_PRIME;
+		}
+		return hash;
+	}
+
+	// Returns the number of bytes written, which is at most 4 times length
+	static int EncodeUtf8(const wchar_t* pText, int length, byte* pOut)
+	{
+		byte* pStart = pOut;
+		for (int i = 0; i < length; i++)
+		{
+			unsigned int ch = static_cast< unsigned int >(pText[i]);
+
+			if (ch < 0x80)
+			{
+				*pOut++ = static_cast< byte >(ch);
+			}
+			else if (ch < 0x800)
+			{
+				*pOut++ = static_cast< byte >(0xC0 | (ch >> 6));
+				*pOut++ = static_cast< byte >(0x80 | (ch & 0x3F));
+			}
+			else if (ch < 0x10000)
+			{
+				*pOut++ = static_cast< byte >(0xE0 | (ch >> 12));
+				*pOut++ = static_cast< byte >(0x80 | ((ch >> 6) & 0x3F));
+				*pOut++ = static_cast< byte >(0x80 | (ch & 0x3F));
+			}
+			else
+			{
+				*pOut++ = static_cast< byte >(0xF0 | ((ch >> 18) & 0x07));
+				*pOut++ = static_cast< byte >(0x80 | ((ch >> 12) & 0x3F));
+				*pOut++ = static_cast< byte >(0x80 | ((ch >> 6) & 0x3F));
+				*pOut++ = static_cast< byte >(0x80 | (ch & 0x3F));
+			}
+		}
+		return static_cast< int >(pOut - pStart);
+	}
+
+	static const int MAX_NAME_LENGTH = 0xFFFF;
+
+private:
+	__BinaryRegistryKey(const __BinaryRegistryKey& rhs);
+	__BinaryRegistryKey& operator =(const __BinaryRegistryKey& rhs);
+
+	result Reserve(int capacity)
+	{
+		if (capacity > INLINE_CAPACITY && __pBuffer == __inlineBuffer)
+		{
+			__pBuffer = new (std::nothrow) byte[capacity];
+			if (__pBuffer == null)
+			{
+				__pBuffer = __inlineBuffer;
+				AppLogException("[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+				return E_OUT_OF_MEMORY;
+			}
+		}
+		return E_SUCCESS;
+	}
+
+	static const int INLINE_CAPACITY = 256;
+	static const unsigned int FNV_OFFSET_BASIS = 2166136261U;
+	static const unsigned int FNV_PRIME = 16777619U;
+
+	byte __inlineBuffer[INLINE_CAPACITY];
+	byte* __pBuffer;
+	int __sectionLength;
+	int __entryLength;
+	unsigned int __hash;
+
+}; // __BinaryRegistryKey
+
+/**
+ * @class	BinaryRegistry
+ * @brief	This class provides a registry whose file is in a binary format that is mapped into memory and read lazily.
+ *
+ * @since	2.1
+ *
+ * The %BinaryRegistry class provides the same sections, entries, and value types as Registry, but stores them in a binary file
+ * instead of a text file. @n
+ * Construct() maps the file read-only and reads only the header of it, instead of parsing all the entries.
+ * A value is located by a hashed index of the file and decoded only when it is retrieved. @n
+ * The changes are kept in memory, and Flush() appends only the changed values and the removals to the end of the file, instead of rewriting it.
+ * When the appended records have grown larger than the rest of the file, Flush() compacts the file by writing the live values
+ * and a new index to a temporary file, which replaces the file. @n
+ * A record that has been partially written when the application was terminated during a flush is detected by its checksum and discarded
+ * when the file is opened again.
+ *
+ * This class is not thread-safe. The file is not locked, and it must not be opened by more than one instance at the same time.
+ *
+ * The following example demonstrates how to use the %BinaryRegistry class.
+ *
+ * @code
+ *	result
+ *	MyApp::SaveVolume(int volume)
+ *	{
+ *		BinaryRegistry reg;
+ *
+ *		result r = reg.Construct(App::GetInstance()->GetAppDataPath() + L"settings.reg", "a+");
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		r = reg.SetValue(L"sound", L"volume", volume);
+ *		if (r == E_SECTION_NOT_FOUND || r == E_KEY_NOT_FOUND)
+ *		{
+ *			reg.AddSection(L"sound");
+ *			r = reg.AddValue(L"sound", L"volume", volume);
+ *		}
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		// Appends only the changed value to the file
+ *		return reg.Flush();
+ *	}
+ * @endcode
+ */
+class BinaryRegistry
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	BinaryRegistry(void)
+		: __fd(-1)
+		, __writable(false)
+		, __pMap(null)
+		, __fileSize(0)
+		, __validEnd(0)
+		, __indexOffset(0)
+		, __indexSlotCount(0)
+		, __logOffset(0)
+		, __pOverlay(null)
+		, __overlaySlotCount(0)
+		, __overlayCount(0)
+		, __pPending(null)
+		, __pendingLength(0)
+		, __pendingCapacity(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The changes that have not been flushed are discarded.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~BinaryRegistry(void)
+	{
+		Close();
+		delete[] __pPending;
+	}
+
+	/**
+	 * Initializes this instance of %BinaryRegistry with the specified file and open mode.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	regPath				The path of the registry file
+	 * @param[in]	pOpenMode			The open mode @n
+	 *									"r" opens the file to read only, "r+" opens it to read and flush, @n
+	 *									"w" and "w+" create the file, or truncate it if it exists, @n
+	 *									and "a" and "a+" open the file to read and flush, or create it if it does not exist.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pOpenMode is invalid.
+	 * @exception	E_FILE_NOT_FOUND	The file does not exist.
+	 * @exception	E_ILLEGAL_ACCESS	The access to the file is denied.
+	 * @exception	E_INVALID_FORMAT	The file is not a binary registry file, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				An I/O error has occurred.
+	 * @remarks		A text registry file of Registry cannot be opened by this class.
+	 */
+	result Construct(const Tizen::Base::String& regPath, const char* pOpenMode)
+	{
+		TryReturn(__fd < 0, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		int flags = GetOpenFlags(pOpenMode);
+		TryReturn(flags >= 0, E_INVALID_ARG, "[%s] The open mode is invalid.", GetErrorMessage(E_INVALID_ARG));
+
+		int fd = -1;
+		result r = Open(regPath, flags, fd);
+		TryReturn(r == E_SUCCESS, r, "[%s] Failed to open the file(%ls).", GetErrorMessage(r), regPath.GetPointer());
+
+		__fd = fd;
+		__writable = ((flags & O_ACCMODE) == O_RDWR);
+
+		r = Load();
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		__path = regPath;
+		return E_SUCCESS;
+
+CATCH:
+		Close();
+		return r;
+	}
+
+	/**
+	 * Appends the changes to the file, and compacts the file if the appended records have grown larger than the rest of it.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_ILLEGAL_ACCESS	The file has been opened to read only.
+	 * @exception	E_STORAGE_FULL		The disk space is full.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				An I/O error has occurred.
+	 * @remarks		The changes are written to the storage device before this method returns.
+	 */
+	result Flush(void)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__writable, E_ILLEGAL_ACCESS, "[%s] The file has been opened to read only.", GetErrorMessage(E_ILLEGAL_ACCESS));
+
+		if (__pendingLength == 0)
+		{
+			return E_SUCCESS;
+		}
+
+		// A torn record left by a flush that was interrupted is overwritten
+		if (__fileSize > __validEnd && ftruncate64(__fd, __validEnd) != 0)
+		{
+			result r = ConvertError(errno);
+			AppLogException("[%s] Failed to truncate the file.", GetErrorMessage(r));
+			return r;
+		}
+
+		result r = WriteFully(__fd, __pPending, __pendingLength, __validEnd);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (fdatasync(__fd) != 0)
+		{
+			r = ConvertError(errno);
+			AppLogException("[%s] Failed to synchronize the file.", GetErrorMessage(r));
+			return r;
+		}
+
+		// The pending records are kept if the remapping fails, and the offsets of them remain valid
+		r = Remap(__validEnd + __pendingLength);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__validEnd = __fileSize;
+		__pendingLength = 0;
+
+		// Each compaction rewrites the live records, so it is amortized over as many bytes appended
+		unsigned int logSize = __validEnd - __logOffset;
+		unsigned int snapshotSize = __indexOffset - sizeof(__BinaryRegistryFileHeader);
+		if (logSize > MIN_COMPACTION_LOG_SIZE && logSize > snapshotSize)
+		{
+			r = Compact();
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Rewrites the file with only the live values and a new index, including the changes that have not been flushed.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_ILLEGAL_ACCESS	The file has been opened to read only, or the directory of the file cannot be written.
+	 * @exception	E_MAX_EXCEEDED		The size of the file has exceeded the maximum limit.
+	 * @exception	E_STORAGE_FULL		The disk space is full.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				An I/O error has occurred.
+	 * @remarks		Flush() calls this method when it is needed, so that an application need not call it. @n
+	 *				The file is replaced atomically by renaming a temporary file in the same directory.
+	 */
+	result Compact(void)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__writable, E_ILLEGAL_ACCESS, "[%s] The file has been opened to read only.", GetErrorMessage(E_ILLEGAL_ACCESS));
+
+		Tizen::Base::Collection::ArrayListT< unsigned int > offsets;
+		result r = CollectLiveRecords(offsets);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int count = offsets.GetCount();
+		unsigned int slotCount = MIN_INDEX_SLOT_COUNT;
+		while (slotCount < static_cast< unsigned int >(count) * 2)
+		{
+			slotCount *= 2;
+		}
+
+		unsigned long long imageSize = sizeof(__BinaryRegistryFileHeader);
+		for (int i = 0; i < count; i++)
+		{
+			unsigned int offset = 0;
+			offsets.GetAt(i, offset);
+			imageSize += GetRecord(offset)->size;
+		}
+		unsigned int indexOffset = static_cast< unsigned int >(imageSize);
+		imageSize += static_cast< unsigned long long >(slotCount) * sizeof(__BinaryRegistrySlot);
+		TryReturn(imageSize <= MAX_FILE_SIZE, E_MAX_EXCEEDED, "[%s] The size of the file(%llu) exceeds the maximum limit.", GetErrorMessage(E_MAX_EXCEEDED), imageSize);
+
+		byte* pImage = new (std::nothrow) byte[static_cast< unsigned int >(imageSize)];
+		TryReturn(pImage != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__BinaryRegistrySlot* pSlots = reinterpret_cast< __BinaryRegistrySlot* >(pImage + indexOffset);
+		memset(pSlots, 0, slotCount * sizeof(__BinaryRegistrySlot));
+
+		// The records are copied as they are, as the checksum does not cover the offset
+		unsigned int position = sizeof(__BinaryRegistryFileHeader);
+		for (int i = 0; i < count; i++)
+		{
+			unsigned int offset = 0;
+			offsets.GetAt(i, offset);
+
+			const __BinaryRegistryRecordHeader* pRecord = GetRecord(offset);
+			memcpy(pImage + position, pRecord, pRecord->size);
+			InsertSlot(pSlots, slotCount, HashRecord(pRecord), position);
+			position += pRecord->size;
+		}
+
+		__BinaryRegistryFileHeader* pHeader = reinterpret_cast< __BinaryRegistryFileHeader* >(pImage);
+		memset(pHeader, 0, sizeof(__BinaryRegistryFileHeader));
+		pHeader->magic = MAGIC;
+		pHeader->version = VERSION;
+		pHeader->indexOffset = indexOffset;
+		pHeader->indexSlotCount = slotCount;
+		pHeader->logOffset = static_cast< unsigned int >(imageSize);
+		pHeader->snapshotRecordCount = count;
+
+		Tizen::Base::String tempPath(__path);
+		tempPath.Append(L".tmp");
+
+		int fd = -1;
+		r = Open(tempPath, O_RDWR | O_CREAT | O_TRUNC, fd);
+		if (r != E_SUCCESS)
+		{
+			delete[] pImage;
+			AppLogException("[%s] Failed to create the temporary file(%ls).", GetErrorMessage(r), tempPath.GetPointer());
+			return r;
+		}
+
+		r = WriteFully(fd, pImage, static_cast< unsigned int >(imageSize), 0);
+		delete[] pImage;
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		if (fdatasync(fd) != 0)
+		{
+			r = ConvertError(errno);
+			AppLogException("[%s] Failed to synchronize the temporary file.", GetErrorMessage(r));
+			goto CATCH;
+		}
+
+		r = Rename(tempPath, __path);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		// The temporary file has become the file, so that its descriptor replaces the one of the old file
+		Close();
+		__fd = fd;
+		__pendingLength = 0;
+
+		r = Load();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+
+CATCH:
+		close(fd);
+		Remove(tempPath);
+		return r;
+	}
+
+	/**
+	 * Adds a section with the specified name.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			The specified @c sectionName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_ALREADY_EXIST	A section with the specified name already exists.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result AddSection(const Tizen::Base::String& sectionName)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__BinaryRegistryKey key;
+		result r = key.Construct(sectionName, null);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		TryReturn(FindLive(key) == 0, E_SECTION_ALREADY_EXIST, "[%s] The section(%ls) already exists.", GetErrorMessage(E_SECTION_ALREADY_EXIST), sectionName.GetPointer());
+
+		byte* pValue = null;
+		r = BeginRecord(OPERATION_SECTION, 0, key, 0, pValue);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		EndRecord(key, 0);
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Removes the specified section and all the entries of it.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			The specified @c sectionName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		A removal is appended for each entry of the section, so that finding an entry does not need to check the section.
+	 */
+	result RemoveSection(const Tizen::Base::String& sectionName)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__BinaryRegistryKey key;
+		result r = key.Construct(sectionName, null);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		TryReturn(FindLive(key) != 0, E_SECTION_NOT_FOUND, "[%s] The section(%ls) is not found.", GetErrorMessage(E_SECTION_NOT_FOUND), sectionName.GetPointer());
+
+		Tizen::Base::Collection::ArrayListT< unsigned int > offsets;
+		r = CollectLiveRecords(offsets);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int i = 0; i < offsets.GetCount(); i++)
+		{
+			unsigned int offset = 0;
+			offsets.GetAt(i, offset);
+
+			// Appending a record may move the pending records, so that the record is looked up again by the offset
+			const __BinaryRegistryRecordHeader* pRecord = GetRecord(offset);
+			if (pRecord->operation != OPERATION_VALUE || !IsInSection(pRecord, key))
+			{
+				continue;
+			}
+
+			__BinaryRegistryKey entryKey;
+			r = entryKey.Construct(GetSectionName(pRecord), pRecord->sectionLength, GetEntryName(pRecord), pRecord->entryLength);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+			r = AppendRemoval(entryKey);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		r = AppendRemoval(key);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the names of all the sections.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to an IList containing the names of the sections as Tizen::Base::String instances, @n
+	 *				else @c null if an exception occurs
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method. @n
+	 *				Do not forget to delete not only the returned IList instance, but also its contents by invoking IList::RemoveAll(true). @n
+	 *				The names are not in any particular order.
+	 */
+	Tizen::Base::Collection::IList* GetAllSectionNamesN(void) const
+	{
+		return GetNamesN(null);
+	}
+
+	/**
+	 * Gets the names of all the entries of the specified section.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to an IList containing the names of the entries as Tizen::Base::String instances, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	sectionName				The section name
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			The specified @c sectionName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method. @n
+	 *				Do not forget to delete not only the returned IList instance, but also its contents by invoking IList::RemoveAll(true). @n
+	 *				The names are not in any particular order.
+	 */
+	Tizen::Base::Collection::IList* GetAllEntryNamesN(const Tizen::Base::String& sectionName) const
+	{
+		return GetNamesN(&sectionName);
+	}
+
+	/**
+	 * Adds an entry with the specified @c int value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	value					The @c int value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_ALREADY_EXIST		The specified @c entryName already exists in this section.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result AddValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, int value)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_INT, &value, sizeof(value), false);
+	}
+
+	/**
+	 * Adds an entry with the specified @c double value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	value					The @c double value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_ALREADY_EXIST		The specified @c entryName already exists in this section.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		The value is stored in binary, so that it is retrieved without loss of precision.
+	 */
+	result AddValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, double value)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_DOUBLE, &value, sizeof(value), false);
+	}
+
+	/**
+	 * Adds an entry with the specified @c float value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	value					The @c float value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_ALREADY_EXIST		The specified @c entryName already exists in this section.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		The value is stored in binary, so that it is retrieved without loss of precision.
+	 */
+	result AddValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, float value)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_FLOAT, &value, sizeof(value), false);
+	}
+
+	/**
+	 * Adds an entry with the specified String value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	value					The String value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_ALREADY_EXIST		The specified @c entryName already exists in this section.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result AddValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::String& value)
+	{
+		return PutText(sectionName, entryName, value, false);
+	}
+
+	/**
+	 * Adds an entry with the specified UuId value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	value					The UuId value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_ALREADY_EXIST		The specified @c entryName already exists in this section.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result AddValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::UuId& value)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_UUID, value.uuid, sizeof(value.uuid), false);
+	}
+
+	/**
+	 * Adds an entry with the specified ByteBuffer value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	value					The ByteBuffer value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_ALREADY_EXIST		The specified @c entryName already exists in this section.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		The bytes from @c 0 up to the limit of the buffer are saved.
+	 */
+	result AddValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::ByteBuffer& value)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_BYTES, value.GetPointer(), value.GetLimit(), false);
+	}
+
+	/**
+	 * Gets the @c int value of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[out]	retVal					The value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_PARSING_FAILED		The value has been stored with another type, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result GetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, int& retVal) const
+	{
+		return GetFixedValue(sectionName, entryName, VALUE_TYPE_INT, &retVal, sizeof(retVal));
+	}
+
+	/**
+	 * Gets the @c double value of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[out]	retVal					The value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_PARSING_FAILED		The value has been stored with another type, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result GetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, double& retVal) const
+	{
+		return GetFixedValue(sectionName, entryName, VALUE_TYPE_DOUBLE, &retVal, sizeof(retVal));
+	}
+
+	/**
+	 * Gets the @c float value of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[out]	retVal					The value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_PARSING_FAILED		The value has been stored with another type, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result GetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, float& retVal) const
+	{
+		return GetFixedValue(sectionName, entryName, VALUE_TYPE_FLOAT, &retVal, sizeof(retVal));
+	}
+
+	/**
+	 * Gets the String value of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[out]	retVal					The value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_PARSING_FAILED		The value has been stored with another type, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result GetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, Tizen::Base::String& retVal) const
+	{
+		const __BinaryRegistryRecordHeader* pRecord = null;
+		result r = FindValue(sectionName, entryName, VALUE_TYPE_STRING, pRecord);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (pRecord->valueLength == 0)
+		{
+			retVal.Clear();
+			return E_SUCCESS;
+		}
+
+		// The value is null-terminated in the record
+		r = Tizen::Base::Utility::StringUtil::Utf8ToString(reinterpret_cast< const char* >(GetValueBytes(pRecord)), retVal);
+		TryReturn(r == E_SUCCESS, E_PARSING_FAILED, "[%s] The value is not valid UTF-8.", GetErrorMessage(E_PARSING_FAILED));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the UuId value of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[out]	retVal					The value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_PARSING_FAILED		The value has been stored with another type, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result GetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, Tizen::Base::UuId& retVal) const
+	{
+		return GetFixedValue(sectionName, entryName, VALUE_TYPE_UUID, retVal.uuid, sizeof(retVal.uuid));
+	}
+
+	/**
+	 * Gets the ByteBuffer value of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[out]	retVal					The buffer to which the value is copied
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_PARSING_FAILED		The value has been stored with another type, or it is corrupted.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		As Registry::GetValue(), the value is copied from the index @c 0 of the buffer up to its capacity. @n
+	 *				The position of the buffer is not changed. If the capacity is greater than the value, the limit is set to the length of the value.
+	 */
+	result GetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, Tizen::Base::ByteBuffer& retVal) const
+	{
+		const __BinaryRegistryRecordHeader* pRecord = null;
+		result r = FindValue(sectionName, entryName, VALUE_TYPE_BYTES, pRecord);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int capacity = retVal.GetCapacity();
+		int length = (static_cast< int >(pRecord->valueLength) < capacity) ? static_cast< int >(pRecord->valueLength) : capacity;
+
+		if (length > 0)
+		{
+			memcpy(retVal.GetPointer(), GetValueBytes(pRecord), length);
+		}
+
+		if (length < capacity)
+		{
+			if (retVal.GetPosition() > length)
+			{
+				retVal.SetPosition(length);
+			}
+			retVal.SetLimit(length);
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Changes the value of the specified entry to the specified @c int value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	newValue				The new @c int value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		Nothing is appended to the file if the entry already has the same type and value.
+	 */
+	result SetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, int newValue)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_INT, &newValue, sizeof(newValue), true);
+	}
+
+	/**
+	 * Changes the value of the specified entry to the specified @c double value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	newValue				The new @c double value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		Nothing is appended to the file if the entry already has the same type and value.
+	 */
+	result SetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, double newValue)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_DOUBLE, &newValue, sizeof(newValue), true);
+	}
+
+	/**
+	 * Changes the value of the specified entry to the specified @c float value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	newValue				The new @c float value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		Nothing is appended to the file if the entry already has the same type and value.
+	 */
+	result SetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, float newValue)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_FLOAT, &newValue, sizeof(newValue), true);
+	}
+
+	/**
+	 * Changes the value of the specified entry to the specified String value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	newValue				The new String value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		Nothing is appended to the file if the entry already has the same type and value.
+	 */
+	result SetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::String& newValue)
+	{
+		return PutText(sectionName, entryName, newValue, true);
+	}
+
+	/**
+	 * Changes the value of the specified entry to the specified UuId value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	newValue				The new UuId value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		Nothing is appended to the file if the entry already has the same type and value.
+	 */
+	result SetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::UuId& newValue)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_UUID, newValue.uuid, sizeof(newValue.uuid), true);
+	}
+
+	/**
+	 * Changes the value of the specified entry to the specified ByteBuffer value.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @param[in]	newValue				The new ByteBuffer value
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 * @remarks		The bytes from @c 0 up to the limit of the buffer are saved. @n
+	 *				Nothing is appended to the file if the entry already has the same type and value.
+	 */
+	result SetValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::ByteBuffer& newValue)
+	{
+		return PutValue(sectionName, entryName, VALUE_TYPE_BYTES, newValue.GetPointer(), newValue.GetLimit(), true);
+	}
+
+	/**
+	 * Removes the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sectionName				The section name
+	 * @param[in]	entryName				The entry name
+	 * @exception	E_SUCCESS				The method is successful.
+	 * @exception	E_INVALID_STATE			This instance has not been constructed.
+	 * @exception	E_INVALID_ARG			Either the specified @c sectionName or @c entryName is empty or longer than @c 65535 bytes in UTF-8.
+	 * @exception	E_SECTION_NOT_FOUND		The specified @c sectionName is not found within the registry.
+	 * @exception	E_KEY_NOT_FOUND			The specified @c entryName is not found within the registry.
+	 * @exception	E_MAX_EXCEEDED			The size of the file has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY			The memory is insufficient.
+	 */
+	result RemoveValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName)
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__BinaryRegistryKey key;
+		result r = key.Construct(sectionName, &entryName);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (FindLive(key) == 0)
+		{
+			r = GetNotFoundResult(key);
+			AppLogException("[%s] The entry(%ls) is not found.", GetErrorMessage(r), entryName.GetPointer());
+			return r;
+		}
+
+		r = AppendRemoval(key);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Deletes the specified registry file.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	regPath				The path of the registry file
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_FILE_NOT_FOUND	The file does not exist.
+	 * @exception	E_ILLEGAL_ACCESS	The access to the file is denied.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				An I/O error has occurred.
+	 * @remarks		The file must not be opened by an instance of %BinaryRegistry.
+	 */
+	static result Remove(const Tizen::Base::String& regPath)
+	{
+		Tizen::Base::ByteBuffer* pPath = Tizen::Base::Utility::StringUtil::StringToUtf8N(regPath);
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Failed to convert the path.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		int ret = unlink(reinterpret_cast< const char* >(pPath->GetPointer()));
+		int error = errno;
+		delete pPath;
+
+		if (ret != 0)
+		{
+			result r = ConvertError(error);
+			AppLogException("[%s] Failed to remove the file(%ls).", GetErrorMessage(r), regPath.GetPointer());
+			return r;
+		}
+
+		return E_SUCCESS;
+	}
+
+private:
+	BinaryRegistry(const BinaryRegistry& rhs);
+	BinaryRegistry& operator =(const BinaryRegistry& rhs);
+
+	// Maps the file, and indexes the records appended after the snapshot
+	result Load(void)
+	{
+		struct stat64 status;
+		if (fstat64(__fd, &status) != 0)
+		{
+			result r = ConvertError(errno);
+			AppLogException("[%s] Failed to get the status of the file.", GetErrorMessage(r));
+			return r;
+		}
+
+		TryReturn(status.st_size <= static_cast< long long >(MAX_FILE_SIZE), E_INVALID_FORMAT,
+			"[%s] The file is too large to be a registry file.", GetErrorMessage(E_INVALID_FORMAT));
+
+		unsigned int fileSize = static_cast< unsigned int >(status.st_size);
+		if (fileSize == 0 && __writable)
+		{
+			__BinaryRegistryFileHeader header;
+			memset(&header, 0, sizeof(header));
+			header.magic = MAGIC;
+			header.version = VERSION;
+			header.indexOffset = sizeof(header);
+			header.logOffset = sizeof(header);
+
+			result r = WriteFully(__fd, reinterpret_cast< const byte* >(&header), sizeof(header), 0);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+			fileSize = sizeof(header);
+		}
+
+		TryReturn(fileSize >= sizeof(__BinaryRegistryFileHeader), E_INVALID_FORMAT,
+			"[%s] The file is too short to be a registry file.", GetErrorMessage(E_INVALID_FORMAT));
+
+		result r = Remap(fileSize);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		const __BinaryRegistryFileHeader* pHeader = reinterpret_cast< const __BinaryRegistryFileHeader* >(__pMap);
+		unsigned long long indexEnd = pHeader->indexOffset + static_cast< unsigned long long >(pHeader->indexSlotCount) * sizeof(__BinaryRegistrySlot);
+		TryReturn(pHeader->magic == MAGIC && pHeader->version == VERSION, E_INVALID_FORMAT,
+			"[%s] The file is not a binary registry file.", GetErrorMessage(E_INVALID_FORMAT));
+		TryReturn(pHeader->indexOffset >= sizeof(__BinaryRegistryFileHeader) && pHeader->indexOffset % 4 == 0
+			&& (pHeader->indexSlotCount & (pHeader->indexSlotCount - 1)) == 0 && indexEnd == pHeader->logOffset && indexEnd <= fileSize,
+			E_INVALID_FORMAT, "[%s] The header of the file is corrupted.", GetErrorMessage(E_INVALID_FORMAT));
+
+		__indexOffset = pHeader->indexOffset;
+		__indexSlotCount = pHeader->indexSlotCount;
+		__logOffset = pHeader->logOffset;
+
+		delete[] __pOverlay;
+		__pOverlay = null;
+		__overlaySlotCount = 0;
+		__overlayCount = 0;
+
+		r = ReserveOverlay(MIN_OVERLAY_SLOT_COUNT / 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// The log ends at the first record that is not complete or valid
+		__validEnd = fileSize;
+		unsigned int offset = __logOffset;
+		while (offset < fileSize)
+		{
+			const __BinaryRegistryRecordHeader* pRecord = reinterpret_cast< const __BinaryRegistryRecordHeader* >(__pMap + offset);
+			if (!IsValidRecord(pRecord, fileSize - offset, true))
+			{
+				AppLog("The registry file is truncated to %u bytes from %u bytes.", offset, fileSize);
+				break;
+			}
+
+			r = ReserveOverlay(__overlayCount + 1);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+			if (InsertSlot(__pOverlay, __overlaySlotCount, HashRecord(pRecord), offset))
+			{
+				__overlayCount++;
+			}
+			offset += pRecord->size;
+		}
+		__validEnd = offset;
+
+		return E_SUCCESS;
+	}
+
+	result Remap(unsigned int fileSize)
+	{
+		void* pMap = mmap(null, fileSize, PROT_READ, MAP_SHARED, __fd, 0);
+		if (pMap == MAP_FAILED)
+		{
+			result r = ConvertError(errno);
+			AppLogException("[%s] Failed to map the file.", GetErrorMessage(r));
+			return r;
+		}
+
+		if (__pMap != null)
+		{
+			munmap(const_cast< byte* >(__pMap), __fileSize);
+		}
+
+		__pMap = static_cast< const byte* >(pMap);
+		__fileSize = fileSize;
+		return E_SUCCESS;
+	}
+
+	void Close(void)
+	{
+		if (__pMap != null)
+		{
+			munmap(const_cast< byte* >(__pMap), __fileSize);
+			__pMap = null;
+		}
+
+		if (__fd >= 0)
+		{
+			close(__fd);
+			__fd = -1;
+		}
+
+		delete[] __pOverlay;
+		__pOverlay = null;
+		__overlaySlotCount = 0;
+		__overlayCount = 0;
+	}
+
+	// The records at or after the valid end of the file are the pending ones, which have not been flushed
+	const __BinaryRegistryRecordHeader* GetRecord(unsigned int offset) const
+	{
+		const byte* pRecord = (offset < __validEnd) ? __pMap + offset : __pPending + (offset - __validEnd);
+		return reinterpret_cast< const __BinaryRegistryRecordHeader* >(pRecord);
+	}
+
+	static const byte* GetSectionName(const __BinaryRegistryRecordHeader* pRecord)
+	{
+		return reinterpret_cast< const byte* >(pRecord + 1);
+	}
+
+	static const byte* GetEntryName(const __BinaryRegistryRecordHeader* pRecord)
+	{
+		return GetSectionName(pRecord) + pRecord->sectionLength + 1;
+	}
+
+	static const byte* GetValueBytes(const __BinaryRegistryRecordHeader* pRecord)
+	{
+		return GetEntryName(pRecord) + pRecord->entryLength + 1;
+	}
+
+	static unsigned int GetContentLength(const __BinaryRegistryRecordHeader* pRecord)
+	{
+		return sizeof(__BinaryRegistryRecordHeader) + pRecord->sectionLength + 1 + pRecord->entryLength + 1 + pRecord->valueLength + 1;
+	}
+
+	static unsigned int HashRecord(const __BinaryRegistryRecordHeader* pRecord)
+	{
+		return __BinaryRegistryKey::Hash(GetSectionName(pRecord), pRecord->sectionLength, GetEntryName(pRecord), pRecord->entryLength);
+	}
+
+	// The records of the snapshot are checked only for the bounds, as the snapshot has been written as a whole
+	static bool IsValidRecord(const __BinaryRegistryRecordHeader* pRecord, unsigned int available, bool verifyChecksum)
+	{
+		if (available < sizeof(__BinaryRegistryRecordHeader) || pRecord->size < sizeof(__BinaryRegistryRecordHeader)
+			|| pRecord->size > available || pRecord->size % 4 != 0 || pRecord->valueLength > MAX_VALUE_LENGTH)
+		{
+			return false;
+		}
+
+		if (pRecord->operation < OPERATION_SECTION || pRecord->operation > OPERATION_REMOVAL || GetContentLength(pRecord) > pRecord->size)
+		{
+			return false;
+		}
+
+		if (verifyChecksum)
+		{
+			const byte* pContent = reinterpret_cast< const byte* >(pRecord) + CHECKSUM_START;
+			return pRecord->checksum == __BinaryRegistryKey::Checksum(pContent, GetContentLength(pRecord) - CHECKSUM_START);
+		}
+
+		return true;
+	}
+
+	bool KeyEquals(const __BinaryRegistryRecordHeader* pRecord, const __BinaryRegistryKey& key) const
+	{
+		return pRecord->sectionLength == key.GetSectionLength() && pRecord->entryLength == key.GetEntryLength()
+			&& memcmp(GetSectionName(pRecord), key.GetSection(), key.GetSectionLength()) == 0
+			&& memcmp(GetEntryName(pRecord), key.GetEntry(), key.GetEntryLength()) == 0;
+	}
+
+	static bool IsInSection(const __BinaryRegistryRecordHeader* pRecord, const __BinaryRegistryKey& sectionKey)
+	{
+		return pRecord->sectionLength == sectionKey.GetSectionLength()
+			&& memcmp(GetSectionName(pRecord), sectionKey.GetSection(), sectionKey.GetSectionLength()) == 0;
+	}
+
+	// Returns the offset of the latest record of the key in the overlay, or 0
+	unsigned int ProbeOverlay(const __BinaryRegistryKey& key) const
+	{
+		unsigned int mask = __overlaySlotCount - 1;
+		for (unsigned int i = key.GetHash() & mask; __pOverlay[i].offset != 0; i = (i + 1) & mask)
+		{
+			if (__pOverlay[i].hash == key.GetHash() && KeyEquals(GetRecord(__pOverlay[i].offset), key))
+			{
+				return __pOverlay[i].offset;
+			}
+		}
+		return 0;
+	}
+
+	// Returns the offset of the record of the key in the snapshot, or 0
+	unsigned int ProbeIndex(const __BinaryRegistryKey& key) const
+	{
+		if (__indexSlotCount == 0)
+		{
+			return 0;
+		}
+
+		const __BinaryRegistrySlot* pSlots = reinterpret_cast< const __BinaryRegistrySlot* >(__pMap + __indexOffset);
+		unsigned int mask = __indexSlotCount - 1;
+		unsigned int i = key.GetHash() & mask;
+
+		for (unsigned int probes = 0; probes < __indexSlotCount && pSlots[i].offset != 0; probes++, i = (i + 1) & mask)
+		{
+			if (pSlots[i].hash != key.GetHash())
+			{
+				continue;
+			}
+
+			unsigned int offset = pSlots[i].offset;
+			if (offset < sizeof(__BinaryRegistryFileHeader) || offset >= __indexOffset
+				|| !IsValidRecord(GetRecord(offset), __indexOffset - offset, false))
+			{
+				AppLog("The index of the registry file has an invalid offset(%u).", offset);
+				return 0;
+			}
+
+			if (KeyEquals(GetRecord(offset), key))
+			{
+				return offset;
+			}
+		}
+		return 0;
+	}
+
+	// Returns the offset of the latest record of the key if it is not a removal, or 0
+	unsigned int FindLive(const __BinaryRegistryKey& key) const
+	{
+		unsigned int offset = ProbeOverlay(key);
+		if (offset == 0)
+		{
+			offset = ProbeIndex(key);
+		}
+
+		if (offset != 0 && GetRecord(offset)->operation == OPERATION_REMOVAL)
+		{
+			return 0;
+		}
+		return offset;
+	}
+
+	// The result for a key of an entry that is not found, which depends on whether the section is found
+	result GetNotFoundResult(const __BinaryRegistryKey& key) const
+	{
+		__BinaryRegistryKey sectionKey;
+		result r = sectionKey.Construct(key.GetSection(), key.GetSectionLength(), null, 0);
+		if (r != E_SUCCESS)
+		{
+			return r;
+		}
+
+		return (FindLive(sectionKey) == 0) ? E_SECTION_NOT_FOUND : E_KEY_NOT_FOUND;
+	}
+
+	result FindValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, byte type,
+		const __BinaryRegistryRecordHeader*& pRecord) const
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__BinaryRegistryKey key;
+		result r = key.Construct(sectionName, &entryName);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		unsigned int offset = FindLive(key);
+		if (offset == 0)
+		{
+			r = GetNotFoundResult(key);
+			AppLogException("[%s] The entry(%ls) is not found.", GetErrorMessage(r), entryName.GetPointer());
+			return r;
+		}
+
+		pRecord = GetRecord(offset);
+		TryReturn(pRecord->type == type, E_PARSING_FAILED, "[%s] The entry(%ls) has been stored with another type(%d).",
+			GetErrorMessage(E_PARSING_FAILED), entryName.GetPointer(), pRecord->type);
+
+		return E_SUCCESS;
+	}
+
+	result GetFixedValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, byte type, void* pValue, unsigned int length) const
+	{
+		const __BinaryRegistryRecordHeader* pRecord = null;
+		result r = FindValue(sectionName, entryName, type, pRecord);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		TryReturn(pRecord->valueLength == length, E_PARSING_FAILED, "[%s] The value of the entry(%ls) is corrupted.",
+			GetErrorMessage(E_PARSING_FAILED), entryName.GetPointer());
+
+		// The value in the record is not aligned to its type
+		memcpy(pValue, GetValueBytes(pRecord), length);
+		return E_SUCCESS;
+	}
+
+	result CheckPut(const __BinaryRegistryKey& key, bool replace, unsigned int& offset) const
+	{
+		TryReturn(__fd >= 0, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		offset = FindLive(key);
+		if (offset == 0)
+		{
+			result r = GetNotFoundResult(key);
+			if (r != E_KEY_NOT_FOUND || replace)
+			{
+				AppLogException("[%s] The entry is not found.", GetErrorMessage(r));
+				return r;
+			}
+		}
+		else
+		{
+			TryReturn(replace, E_KEY_ALREADY_EXIST, "[%s] The entry already exists.", GetErrorMessage(E_KEY_ALREADY_EXIST));
+		}
+
+		return E_SUCCESS;
+	}
+
+	result PutValue(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, byte type, const void* pData, int length, bool replace)
+	{
+		__BinaryRegistryKey key;
+		result r = key.Construct(sectionName, &entryName);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		unsigned int offset = 0;
+		r = CheckPut(key, replace, offset);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (offset != 0 && HasValue(GetRecord(offset), type, pData, length))
+		{
+			return E_SUCCESS;
+		}
+
+		byte* pValue = null;
+		r = BeginRecord(OPERATION_VALUE, type, key, length, pValue);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (length > 0)
+		{
+			memcpy(pValue, pData, length);
+		}
+
+		EndRecord(key, length);
+		return E_SUCCESS;
+	}
+
+	result PutText(const Tizen::Base::String& sectionName, const Tizen::Base::String& entryName, const Tizen::Base::String& value, bool replace)
+	{
+		__BinaryRegistryKey key;
+		result r = key.Construct(sectionName, &entryName);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		unsigned int offset = 0;
+		r = CheckPut(key, replace, offset);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// The text is encoded in the space reserved for the worst case, and the record is dropped if the value has not changed
+		int chars = value.GetLength();
+		TryReturn(chars <= static_cast< int >(MAX_VALUE_LENGTH / 4), E_INVALID_ARG, "[%s] The value is too long.", GetErrorMessage(E_INVALID_ARG));
+
+		byte* pValue = null;
+		r = BeginRecord(OPERATION_VALUE, VALUE_TYPE_STRING, key, chars * 4, pValue);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int length = __BinaryRegistryKey::EncodeUtf8(value.GetPointer(), chars, pValue);
+		if (offset != 0 && HasValue(GetRecord(offset), VALUE_TYPE_STRING, pValue, length))
+		{
+			return E_SUCCESS;
+		}
+
+		EndRecord(key, length);
+		return E_SUCCESS;
+	}
+
+	static bool HasValue(const __BinaryRegistryRecordHeader* pRecord, byte type, const void* pData, int length)
+	{
+		return pRecord->type == type && pRecord->valueLength == static_cast< unsigned int >(length)
+			&& (length == 0 || memcmp(GetValueBytes(pRecord), pData, length) == 0);
+	}
+
+	result AppendRemoval(const __BinaryRegistryKey& key)
+	{
+		byte* pValue = null;
+		result r = BeginRecord(OPERATION_REMOVAL, 0, key, 0, pValue);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		EndRecord(key, 0);
+		return E_SUCCESS;
+	}
+
+	// Reserves a record of the key after the pending records, and returns where the value is written
+	result BeginRecord(byte operation, byte type, const __BinaryRegistryKey& key, unsigned int maxValueLength, byte*& pValue)
+	{
+		TryReturn(maxValueLength <= MAX_VALUE_LENGTH, E_INVALID_ARG, "[%s] The value is too long.", GetErrorMessage(E_INVALID_ARG));
+
+		unsigned long long maxSize = sizeof(__BinaryRegistryRecordHeader) + key.GetSectionLength() + 1 + key.GetEntryLength() + 1 + maxValueLength + 1 + 3;
+		TryReturn(__validEnd + __pendingLength + maxSize <= MAX_FILE_SIZE, E_MAX_EXCEEDED,
+			"[%s] The size of the file exceeds the maximum limit.", GetErrorMessage(E_MAX_EXCEEDED));
+
+		// The overlay is grown here, so that EndRecord() does not fail
+		result r = ReserveOverlay(__overlayCount + 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		if (__pendingLength + maxSize > __pendingCapacity)
+		{
+			unsigned int newCapacity = (__pendingCapacity > 0) ? __pendingCapacity : DEFAULT_PENDING_CAPACITY;
+			while (newCapacity < __pendingLength + maxSize)
+			{
+				newCapacity *= 2;
+			}
+
+			byte* pPending = new (std::nothrow) byte[newCapacity];
+			TryReturn(pPending != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			if (__pendingLength > 0)
+			{
+				memcpy(pPending, __pPending, __pendingLength);
+			}
+			delete[] __pPending;
+			__pPending = pPending;
+			__pendingCapacity = newCapacity;
+		}
+
+		__BinaryRegistryRecordHeader* pRecord = reinterpret_cast< __BinaryRegistryRecordHeader* >(__pPending + __pendingLength);
+		pRecord->size = 0;
+		pRecord->checksum = 0;
+		pRecord->operation = operation;
+		pRecord->type = type;
+		pRecord->sectionLength = static_cast< unsigned short >(key.GetSectionLength());
+		pRecord->entryLength = static_cast< unsigned short >(key.GetEntryLength());
+		pRecord->reserved = 0;
+		pRecord->valueLength = 0;
+
+		// The names are copied with their null bytes
+		byte* pNames = reinterpret_cast< byte* >(pRecord + 1);
+		memcpy(pNames, key.GetSection(), key.GetSectionLength() + 1 + key.GetEntryLength() + 1);
+
+		pValue = pNames + key.GetSectionLength() + 1 + key.GetEntryLength() + 1;
+		return E_SUCCESS;
+	}
+
+	// Completes the record reserved by BeginRecord(), and makes it the latest record of the key
+	void EndRecord(const __BinaryRegistryKey& key, unsigned int valueLength)
+	{
+		__BinaryRegistryRecordHeader* pRecord = reinterpret_cast< __BinaryRegistryRecordHeader* >(__pPending + __pendingLength);
+		pRecord->valueLength = valueLength;
+
+		unsigned int contentLength = GetContentLength(pRecord);
+		unsigned int size = (contentLength + 3) & ~3U;
+
+		byte* pBytes = reinterpret_cast< byte* >(pRecord);
+		memset(pBytes + contentLength - 1, 0, size - contentLength + 1);
+
+		pRecord->size = size;
+		pRecord->checksum = __BinaryRegistryKey::Checksum(pBytes + CHECKSUM_START, contentLength - CHECKSUM_START);
+
+		if (InsertSlot(__pOverlay, __overlaySlotCount, key.GetHash(), __validEnd + __pendingLength))
+		{
+			__overlayCount++;
+		}
+		__pendingLength += size;
+	}
+
+	// Returns true if a slot is taken, or false if the slot of the same key is updated
+	bool InsertSlot(__BinaryRegistrySlot* pSlots, unsigned int slotCount, unsigned int hash, unsigned int offset) const
+	{
+		const __BinaryRegistryRecordHeader* pRecord = (pSlots == __pOverlay) ? GetRecord(offset) : null;
+		unsigned int mask = slotCount - 1;
+		unsigned int i = hash & mask;
+
+		for (; pSlots[i].offset != 0; i = (i + 1) & mask)
+		{
+			// The keys in a snapshot being written are unique
+			if (pRecord != null && pSlots[i].hash == hash)
+			{
+				const __BinaryRegistryRecordHeader* pOther = GetRecord(pSlots[i].offset);
+				if (pOther->sectionLength == pRecord->sectionLength && pOther->entryLength == pRecord->entryLength
+					&& memcmp(GetSectionName(pOther), GetSectionName(pRecord), pRecord->sectionLength + 1 + pRecord->entryLength) == 0)
+				{
+					pSlots[i].offset = offset;
+					return false;
+				}
+			}
+		}
+
+		pSlots[i].hash = hash;
+		pSlots[i].offset = offset;
+		return true;
+	}
+
+	// Grows the overlay, so that it is at most half full with the specified number of keys
+	result ReserveOverlay(unsigned int count)
+	{
+		if (count * 2 <= __overlaySlotCount)
+		{
+			return E_SUCCESS;
+		}
+
+		unsigned int slotCount = (__overlaySlotCount > 0) ? __overlaySlotCount * 2 : MIN_OVERLAY_SLOT_COUNT;
+		while (count * 2 > slotCount)
+		{
+			slotCount *= 2;
+		}
+
+		__BinaryRegistrySlot* pSlots = new (std::nothrow) __BinaryRegistrySlot[slotCount];
+		TryReturn(pSlots != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		memset(pSlots, 0, slotCount * sizeof(__BinaryRegistrySlot));
+
+		// The keys are unique, so that they are placed without comparing them
+		unsigned int mask = slotCount - 1;
+		for (unsigned int i = 0; i < __overlaySlotCount; i++)
+		{
+			if (__pOverlay[i].offset != 0)
+			{
+				unsigned int j = __pOverlay[i].hash & mask;
+				while (pSlots[j].offset != 0)
+				{
+					j = (j + 1) & mask;
+				}
+				pSlots[j] = __pOverlay[i];
+			}
+		}
+
+		delete[] __pOverlay;
+		__pOverlay = pSlots;
+		__overlaySlotCount = slotCount;
+		return E_SUCCESS;
+	}
+
+	// Collects the offsets of the latest records of all the keys that are not removed
+	result CollectLiveRecords(Tizen::Base::Collection::ArrayListT< unsigned int >& offsets) const
+	{
+		result r = offsets.Construct(__overlayCount + __indexSlotCount / 2);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (unsigned int i = 0; i < __overlaySlotCount; i++)
+		{
+			unsigned int offset = __pOverlay[i].offset;
+			if (offset != 0 && GetRecord(offset)->operation != OPERATION_REMOVAL)
+			{
+				r = offsets.Add(offset);
+				TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+			}
+		}
+
+		const __BinaryRegistrySlot* pSlots = reinterpret_cast< const __BinaryRegistrySlot* >(__pMap + __indexOffset);
+		for (unsigned int i = 0; i < __indexSlotCount; i++)
+		{
+			unsigned int offset = pSlots[i].offset;
+			if (offset == 0)
+			{
+				continue;
+			}
+
+			const __BinaryRegistryRecordHeader* pRecord = GetRecord(offset);
+			if (offset < sizeof(__BinaryRegistryFileHeader) || offset >= __indexOffset || !IsValidRecord(pRecord, __indexOffset - offset, false))
+			{
+				AppLog("The index of the registry file has an invalid offset(%u).", offset);
+				continue;
+			}
+
+			// A key in the overlay has been changed or removed after the snapshot
+			__BinaryRegistryKey key;
+			r = key.Construct(GetSectionName(pRecord), pRecord->sectionLength, GetEntryName(pRecord), pRecord->entryLength);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+			if (ProbeOverlay(key) == 0)
+			{
+				r = offsets.Add(offset);
+				TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+			}
+		}
+
+		return E_SUCCESS;
+	}
+
+	// The names of the sections if pSectionName is null, or the names of the entries of the section
+	Tizen::Base::Collection::IList* GetNamesN(const Tizen::Base::String* pSectionName) const
+	{
+		result r = E_SUCCESS;
+		Tizen::Base::Collection::ArrayListT< unsigned int > offsets;
+		Tizen::Base::Collection::ArrayList* pList = null;
+		__BinaryRegistryKey sectionKey;
+
+		TryCatch(__fd >= 0, r = E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		if (pSectionName != null)
+		{
+			r = sectionKey.Construct(*pSectionName, null);
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+			TryCatch(FindLive(sectionKey) != 0, r = E_SECTION_NOT_FOUND, "[%s] The section(%ls) is not found.",
+				GetErrorMessage(E_SECTION_NOT_FOUND), pSectionName->GetPointer());
+		}
+
+		r = CollectLiveRecords(offsets);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		pList = new (std::nothrow) Tizen::Base::Collection::ArrayList();
+		TryCatch(pList != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pList->Construct();
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int i = 0; i < offsets.GetCount(); i++)
+		{
+			unsigned int offset = 0;
+			offsets.GetAt(i, offset);
+
+			const __BinaryRegistryRecordHeader* pRecord = GetRecord(offset);
+			if (pSectionName == null && pRecord->operation != OPERATION_SECTION)
+			{
+				continue;
+			}
+			if (pSectionName != null && (pRecord->operation != OPERATION_VALUE || !IsInSection(pRecord, sectionKey)))
+			{
+				continue;
+			}
+
+			Tizen::Base::String* pName = new (std::nothrow) Tizen::Base::String();
+			TryCatch(pName != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			// The names are null-terminated in the record
+			const byte* pUtf8 = (pSectionName == null) ? GetSectionName(pRecord) : GetEntryName(pRecord);
+			r = Tizen::Base::Utility::StringUtil::Utf8ToString(reinterpret_cast< const char* >(pUtf8), *pName);
+			if (r == E_SUCCESS)
+			{
+				r = pList->Add(pName);
+			}
+			if (r != E_SUCCESS)
+			{
+				delete pName;
+				AppLogException("[%s] Propagating.", GetErrorMessage(r));
+				goto CATCH;
+			}
+		}
+
+		SetLastResult(E_SUCCESS);
+		return pList;
+
+CATCH:
+		if (pList != null)
+		{
+			pList->RemoveAll(true);
+			delete pList;
+		}
+		SetLastResult(r);
+		return null;
+	}
+
+	static result Open(const Tizen::Base::String& path, int flags, int& fd)
+	{
+		Tizen::Base::ByteBuffer* pPath = Tizen::Base::Utility::StringUtil::StringToUtf8N(path);
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Failed to convert the path.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		fd = open64(reinterpret_cast< const char* >(pPath->GetPointer()), flags | O_CLOEXEC, FILE_MODE);
+		int error = errno;
+		delete pPath;
+
+		return (fd >= 0) ? E_SUCCESS : ConvertError(error);
+	}
+
+	static result Rename(const Tizen::Base::String& oldPath, const Tizen::Base::String& newPath)
+	{
+		Tizen::Base::ByteBuffer* pOldPath = Tizen::Base::Utility::StringUtil::StringToUtf8N(oldPath);
+		Tizen::Base::ByteBuffer* pNewPath = Tizen::Base::Utility::StringUtil::StringToUtf8N(newPath);
+
+		result r = E_OUT_OF_MEMORY;
+		if (pOldPath != null && pNewPath != null)
+		{
+			int ret = rename(reinterpret_cast< const char* >(pOldPath->GetPointer()), reinterpret_cast< const char* >(pNewPath->GetPointer()));
+			r = (ret == 0) ? E_SUCCESS : ConvertError(errno);
+		}
+
+		delete pOldPath;
+		delete pNewPath;
+
+		TryReturn(r == E_SUCCESS, r, "[%s] Failed to rename the file(%ls).", GetErrorMessage(r), oldPath.GetPointer());
+		return E_SUCCESS;
+	}
+
+	static result WriteFully(int fd, const byte* pData, unsigned int length, unsigned int offset)
+	{
+		while (length > 0)
+		{
+			ssize_t written = pwrite64(fd, pData, length, offset);
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				result r = ConvertError(errno);
+				AppLogException("[%s] Failed to write the file.", GetErrorMessage(r));
+				return r;
+			}
+
+			pData += written;
+			length -= written;
+			offset += written;
+		}
+		return E_SUCCESS;
+	}
+
+	static int GetOpenFlags(const char* pOpenMode)
+	{
+		static const char* const MODES[] = { "r", "r+", "w", "w+", "a", "a+" };
+		static const int FLAGS[] =
+		{
+			O_RDONLY,
+			O_RDWR,
+			O_RDWR | O_CREAT | O_TRUNC,
+			O_RDWR | O_CREAT | O_TRUNC,
+			O_RDWR | O_CREAT,
+			O_RDWR | O_CREAT
+		};
+
+		if (pOpenMode == null)
+		{
+			return -1;
+		}
+
+		for (unsigned int i = 0; i < sizeof(MODES) / sizeof(MODES[0]); i++)
+		{
+			if (strcmp(pOpenMode, MODES[i]) == 0)
+			{
+				return FLAGS[i];
+			}
+		}
+
+		return -1;
+	}
+
+	static result ConvertError(int error)
+	{
+		switch (error)
+		{
+		case ENOENT:
+			return E_FILE_NOT_FOUND;
+
+		case EACCES:
+			// Falls through
+		case EPERM:
+			// Falls through
+		case EROFS:
+			// Falls through
+		case EBADF:
+			return E_ILLEGAL_ACCESS;
+
+		case ENOSPC:
+			return E_STORAGE_FULL;
+
+		case EINVAL:
+			return E_INVALID_ARG;
+
+		case ENOMEM:
+			return E_OUT_OF_MEMORY;
+
+		default:
+			return E_IO;
+		}
+	}
+
+	static const unsigned int MAGIC = 0x47525442; // "BTRG"
+	static const unsigned short VERSION = 1;
+	static const byte OPERATION_SECTION = 1;
+	static const byte OPERATION_VALUE = 2;
+	static const byte OPERATION_REMOVAL = 3;
+	static const byte VALUE_TYPE_INT = 1;
+	static const byte VALUE_TYPE_DOUBLE = 2;
+	static const byte VALUE_TYPE_FLOAT = 3;
+	static const byte VALUE_TYPE_STRING = 4;
+	static const byte VALUE_TYPE_UUID = 5;
+	static const byte VALUE_TYPE_BYTES = 6;
+	static const unsigned int CHECKSUM_START = 8;
+	static const unsigned int MAX_VALUE_LENGTH = 0x3FFFFFFF;
+	static const unsigned int MAX_FILE_SIZE = 0x7FFFFFFF;
+	static const unsigned int MIN_INDEX_SLOT_COUNT = 16;
+	static const unsigned int MIN_OVERLAY_SLOT_COUNT = 64;
+	static const unsigned int MIN_COMPACTION_LOG_SIZE = 64 * 1024;
+	static const unsigned int DEFAULT_PENDING_CAPACITY = 4096;
+	static const int FILE_MODE = 0666;
+
+	int __fd;
+	bool __writable;
+	Tizen::Base::String __path;
+
+	// The file is mapped up to its size, which may be beyond the valid end if the last record is torn
+	const byte* __pMap;
+	unsigned int __fileSize;
+	unsigned int __validEnd;
+
+	// The hashed index of the snapshot, which is in the mapping
+	unsigned int __indexOffset;
+	unsigned int __indexSlotCount;
+	unsigned int __logOffset;
+
+	// The hashed index of the records in the log and the pending records, which shadows the index of the snapshot
+	__BinaryRegistrySlot* __pOverlay;
+	unsigned int __overlaySlotCount;
+	unsigned int __overlayCount;
+
+	// The records that have not been flushed, whose offsets continue from the valid end of the file
+	byte* __pPending;
+	unsigned int __pendingLength;
+	unsigned int __pendingCapacity;
+
+}; // BinaryRegistry
+
+}} // Tizen::Io
+
+#endif // _FIO_BINARY_REGISTRY_H_
@@ -0,0 +1,437 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoDbBatch.h
+ * @brief	This is the header file for the %DbBatch class.
+ *
+ * This header file contains the declarations of the %DbBatch class.
+ */
+
+#ifndef _FIO_DB_BATCH_H_
+#define _FIO_DB_BATCH_H_
+
+#include <FBaseObject.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayListT.h>
+#include <FIoDatabase.h>
+#include <FIoDbStatement.h>
+#include <FIoDbEnumerator.h>
+#include <FIoDbStatementCache.h>
+
+namespace Tizen { namespace Io
+{
+
+//
+// @class	__DbBatchColumn
+// @brief	This class is a column array bound to a parameter of %DbBatch.
+// @since 2.1
+//
+struct __DbBatchColumn
+{
+	enum Type
+	{
+		TYPE_NULL,
+		TYPE_INT,
+		TYPE_INT64,
+		TYPE_DOUBLE,
+		TYPE_STRING
+	};
+
+	__DbBatchColumn(void)
+		: type(TYPE_NULL)
+		, pValues(null)
+	{
+	}
+
+	__DbBatchColumn(Type columnType, const void* pColumnValues)
+		: type(columnType)
+		, pValues(pColumnValues)
+	{
+	}
+
+	// Required by ArrayListT
+	bool operator ==(const __DbBatchColumn& rhs) const
+	{
+		return type == rhs.type && pValues == rhs.pValues;
+	}
+
+	bool operator !=(const __DbBatchColumn& rhs) const
+	{
+		return !operator ==(rhs);
+	}
+
+	Type type;
+	const void* pValues;
+
+}; // __DbBatchColumn
+
+/**
+ * @class	DbBatch
+ * @brief	This class executes a prepared statement for many rows bound from column arrays in one transaction.
+ *
+ * @since	2.1
+ *
+ * The %DbBatch class executes an INSERT, UPDATE, or DELETE statement once for each row of the arrays bound to its parameters.
+ * The statement is compiled once, each row costs a bind per column and a step, and all the rows are written in one transaction,
+ * so that the rows are not synced to the storage one by one. @n
+ * The arrays are not copied. They must be valid until Execute() returns.
+ *
+ * The following example demonstrates how to use the %DbBatch class.
+ *
+ * @code
+ *	result
+ *	MySync::InsertItems(Database& database, const int* pIds, const double* pPrices, const String* pNames, int count)
+ *	{
+ *		DbBatch batch;
+ *
+ *		result r = batch.Construct(database, L"INSERT INTO items (id, price, name) VALUES (?, ?, ?)");
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		batch.SetColumn(0, pIds);
+ *		batch.SetColumn(1, pPrices);
+ *		batch.SetColumn(2, pNames);
+ *
+ *		return batch.Execute(count);
+ *	}
+ * @endcode
+ *
+ * @see	DbStatementCache
+ */
+class DbBatch
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	DbBatch(void)
+		: __pDatabase(null)
+		, __pStatement(null)
+		, __pCache(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since	2.1
+	 */
+	virtual ~DbBatch(void)
+	{
+		delete __pStatement;
+	}
+
+	/**
+	 * Initializes this instance of %DbBatch with the specified statement, which is compiled for this instance.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	database			The database to execute the statement in
+	 * @param[in]	sqlStatement		The INSERT, UPDATE, or DELETE statement with parameters
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c sqlStatement is invalid SQL.
+	 * @exception	E_OBJECT_LOCKED		The database instance is locked.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The method cannot proceed due to a severe system error.
+	 * @remarks		The database must outlive this instance.
+	 */
+	result Construct(Database& database, const Tizen::Base::String& sqlStatement)
+	{
+		TryReturn(__pDatabase == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		result r = __columns.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pStatement = database.CreateStatementN(sqlStatement);
+		r = GetLastResult();
+		TryReturn(__pStatement != null, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pDatabase = &database;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Initializes this instance of %DbBatch with the specified statement, which is taken from the specified statement cache.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	cache				The statement cache to get the statement from
+	 * @param[in]	sqlStatement		The INSERT, UPDATE, or DELETE statement with parameters
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_STATE		The specified @c cache has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c sqlStatement is invalid SQL.
+	 * @exception	E_OBJECT_LOCKED		The database instance is locked.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The method cannot proceed due to a severe system error.
+	 * @remarks		The cache must outlive this instance. @n
+	 *				The statement belongs to the cache and may be evicted by other users of the cache,
+	 *				so that it is taken from the cache again each time Execute() is called.
+	 */
+	result Construct(DbStatementCache& cache, const Tizen::Base::String& sqlStatement)
+	{
+		TryReturn(__pDatabase == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		result r = __columns.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// Compiles the statement now, so that invalid SQL is reported here rather than by Execute()
+		DbStatement* pStatement = cache.GetStatement(sqlStatement);
+		r = GetLastResult();
+		TryReturn(pStatement != null, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__sqlStatement = sqlStatement;
+		__pCache = &cache;
+		__pDatabase = cache.GetDatabase();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Binds an array of integer values to the specified parameter.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	columnIndex			The index of the parameter, starting from @c 0
+	 * @param[in]	pValues				The value of the parameter for each row
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c columnIndex is negative.
+	 * @exception	E_INVALID_ARG		The specified @c pValues is @c null.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result SetColumn(int columnIndex, const int* pValues)
+	{
+		return SetColumn(columnIndex, __DbBatchColumn::TYPE_INT, pValues);
+	}
+
+	/**
+	 * Binds an array of 64-bit integer values to the specified parameter.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	columnIndex			The index of the parameter, starting from @c 0
+	 * @param[in]	pValues				The value of the parameter for each row
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c columnIndex is negative.
+	 * @exception	E_INVALID_ARG		The specified @c pValues is @c null.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result SetColumn(int columnIndex, const long long* pValues)
+	{
+		return SetColumn(columnIndex, __DbBatchColumn::TYPE_INT64, pValues);
+	}
+
+	/**
+	 * Binds an array of double values to the specified parameter.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	columnIndex			The index of the parameter, starting from @c 0
+	 * @param[in]	pValues				The value of the parameter for each row
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c columnIndex is negative.
+	 * @exception	E_INVALID_ARG		The specified @c pValues is @c null.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result SetColumn(int columnIndex, const double* pValues)
+	{
+		return SetColumn(columnIndex, __DbBatchColumn::TYPE_DOUBLE, pValues);
+	}
+
+	/**
+	 * Binds an array of string values to the specified parameter.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	columnIndex			The index of the parameter, starting from @c 0
+	 * @param[in]	pValues				The value of the parameter for each row
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_OUT_OF_RANGE		The specified @c columnIndex is negative.
+	 * @exception	E_INVALID_ARG		The specified @c pValues is @c null.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 */
+	result SetColumn(int columnIndex, const Tizen::Base::String* pValues)
+	{
+		return SetColumn(columnIndex, __DbBatchColumn::TYPE_STRING, pValues);
+	}
+
+	/**
+	 * Removes all the arrays bound to the parameters.
+	 *
+	 * @since	2.1
+	 */
+	void ClearColumns(void)
+	{
+		__columns.RemoveAll();
+	}
+
+	/**
+	 * Executes the statement for the specified number of rows in one transaction.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	rowCount			The number of rows, which is the number of elements of each bound array
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or no array has been bound.
+	 * @exception	E_INVALID_ARG		The specified @c rowCount is negative.
+	 * @exception	E_OBJECT_LOCKED		The database instance is locked.
+	 * @exception	E_INVALID_FORMAT 	The database file is malformed.
+	 * @exception	E_STORAGE_FULL		The disk space or database image is full.
+	 * @exception	E_IO				Either of the following conditions has occurred: @n
+	 *									- An unexpected device failure has occurred as the media ejected suddenly. @n
+	 *									- %File corruption is detected.
+	 * @exception	E_SYSTEM			The method cannot proceed due to a severe system error.
+	 * @remarks		If a row fails, the transaction is rolled back and none of the rows are written. @n
+	 *				If a transaction has already begun on the database, the rows are executed in that transaction,
+	 *				and committing or rolling it back is left to the caller. @n
+	 *				A parameter that no array is bound to is set to @c NULL.
+	 */
+	result Execute(int rowCount)
+	{
+		TryReturn(__pDatabase != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(__columns.GetCount() > 0, E_INVALID_STATE, "[%s] No array has been bound.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(rowCount >= 0, E_INVALID_ARG, "[%s] The rowCount(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_INVALID_ARG), rowCount);
+
+		if (rowCount == 0)
+		{
+			return E_SUCCESS;
+		}
+
+		DbStatement* pStatement = __pStatement;
+		if (__pCache != null)
+		{
+			pStatement = __pCache->GetStatement(__sqlStatement);
+			result r = GetLastResult();
+			TryReturn(pStatement != null, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		// Joins the transaction of the caller if there is one
+		result r = __pDatabase->BeginTransaction();
+		bool ownsTransaction = (r == E_SUCCESS);
+		TryReturn(ownsTransaction || r == E_INVALID_STATE, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int row = 0; row < rowCount; row++)
+		{
+			r = BindRow(*pStatement, row);
+			TryCatch(r == E_SUCCESS, , "[%s] Failed to bind the row(%d).", GetErrorMessage(r), row);
+
+			DbEnumerator* pEnum = __pDatabase->ExecuteStatementN(*pStatement);
+			r = GetLastResult();
+			delete pEnum;
+			TryCatch(r == E_SUCCESS, , "[%s] Failed to execute the row(%d).", GetErrorMessage(r), row);
+		}
+
+		if (ownsTransaction)
+		{
+			r = __pDatabase->CommitTransaction();
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		return E_SUCCESS;
+
+CATCH:
+		if (ownsTransaction)
+		{
+			__pDatabase->RollbackTransaction();
+		}
+		return r;
+	}
+
+private:
+	DbBatch(const DbBatch& rhs);
+	DbBatch& operator =(const DbBatch& rhs);
+
+	result SetColumn(int columnIndex, __DbBatchColumn::Type type, const void* pValues)
+	{
+		TryReturn(__pDatabase != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(columnIndex >= 0, E_OUT_OF_RANGE, "[%s] The columnIndex(%d) MUST be greater than or equal to 0.", GetErrorMessage(E_OUT_OF_RANGE), columnIndex);
+		TryReturn(pValues != null, E_INVALID_ARG, "[%s] The pValues is null.", GetErrorMessage(E_INVALID_ARG));
+
+		while (__columns.GetCount() <= columnIndex)
+		{
+			result r = __columns.Add(__DbBatchColumn());
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		return __columns.SetAt(__DbBatchColumn(type, pValues), columnIndex);
+	}
+
+	result BindRow(DbStatement& statement, int row)
+	{
+		result r = E_SUCCESS;
+		int columnCount = __columns.GetCount();
+
+		for (int i = 0; i < columnCount && r == E_SUCCESS; i++)
+		{
+			__DbBatchColumn column;
+			__columns.GetAt(i, column);
+
+			switch (column.type)
+			{
+			case __DbBatchColumn::TYPE_INT:
+				r = statement.BindInt(i, static_cast< const int* >(column.pValues)[row]);
+				break;
+
+			case __DbBatchColumn::TYPE_INT64:
+				r = statement.BindInt64(i, static_cast< const long long* >(column.pValues)[row]);
+				break;
+
+			case __DbBatchColumn::TYPE_DOUBLE:
+				r = statement.BindDouble(i, static_cast< const double* >(column.pValues)[row]);
+				break;
+
+			case __DbBatchColumn::TYPE_STRING:
+				r = statement.BindString(i, static_cast< const Tizen::Base::String* >(column.pValues)[row]);
+				break;
+
+			default:
+				r = statement.BindNull(i);
+				break;
+			}
+		}
+
+		return r;
+	}
+
+	Database* __pDatabase;
+	DbStatement* __pStatement;
+	DbStatementCache* __pCache;
+	Tizen::Base::String __sqlStatement;
+	Tizen::Base::Collection::ArrayListT< __DbBatchColumn > __columns;
+
+}; // DbBatch
+
+}} // Tizen::Io
+
+#endif // _FIO_DB_BATCH_H_
@@ -0,0 +1,406 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoDbBlockReader.h
+ * @brief	This is the header file for the %DbBlockReader class.
+ *
+ * This header file contains the declarations of the %DbBlockReader class.
+ */
+
+#ifndef _FIO_DB_BLOCK_READER_H_
+#define _FIO_DB_BLOCK_READER_H_
+
+#include <FBaseObject.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseRtIRunnable.h>
+#include <FBaseRtMonitor.h>
+#include <FBaseRtThread.h>
+#include <FIoDbEnumerator.h>
+#include <FIoDbColumnBlock.h>
+
+namespace Tizen { namespace Io
+{
+
+/**
+ * @class	DbBlockReader
+ * @brief	This class reads the rows of a query result in blocks.
+ *
+ * @since	2.1
+ *
+ * The %DbBlockReader class moves a DbEnumerator over many rows at once and stores them in a DbColumnBlock,
+ * so that the caller reads the cells from typed arrays instead of calling the getters of the enumerator for each cell. @n
+ * The text is converted to UTF-8 straight into the arena of the block, reusing one Tizen::Base::String for all the text cells. @n
+ * If the prefetching is enabled, a background thread reads the next block while the caller processes the current one.
+ *
+ * The following example demonstrates how to use the %DbBlockReader class.
+ *
+ * @code
+ *	result
+ *	MyList::LoadItems(Database& database)
+ *	{
+ *		DbEnumerator* pEnum = database.QueryN(L"SELECT id, price, name FROM items");
+ *		TryReturn(pEnum != null, GetLastResult(), "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+ *
+ *		DbBlockReader reader;
+ *		DbColumnBlock block;
+ *		result r = reader.Construct(*pEnum, true);
+ *
+ *		while (r == E_SUCCESS && (r = reader.FetchBlock(256, block)) == E_SUCCESS)
+ *		{
+ *			const long long* pIds = block.GetInt64Column(0);
+ *			const double* pPrices = block.GetDoubleColumn(1);
+ *
+ *			for (int i = 0; i < block.GetRowCount(); i++)
+ *			{
+ *				const char* pName = null;
+ *				int length = 0;
+ *				block.GetTextAt(2, i, pName, length);
+ *
+ *				// Adds the item ...
+ *			}
+ *		}
+ *
+ *		delete pEnum;
+ *		return (r == E_OUT_OF_RANGE) ? E_SUCCESS : r;
+ *	}
+ * @endcode
+ *
+ * @see	DbColumnBlock
+ */
+class DbBlockReader
+	: public Tizen::Base::Object
+	, private Tizen::Base::Runtime::IRunnable
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	DbBlockReader(void)
+		: __pEnumerator(null)
+		, __pThread(null)
+		, __isEnd(false)
+		, __isPrefetchRequested(false)
+		, __isPrefetchDone(false)
+		, __isStopping(false)
+		, __prefetchRowCount(0)
+		, __prefetchResult(E_SUCCESS)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The prefetching thread is stopped after it finishes the block that it is reading.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~DbBlockReader(void)
+	{
+		if (__pThread != null)
+		{
+			__monitor.Enter();
+			__isStopping = true;
+			__monitor.NotifyAll();
+			__monitor.Exit();
+
+			__pThread->Join();
+			delete __pThread;
+		}
+	}
+
+	/**
+	 * Initializes this instance of %DbBlockReader with the specified enumerator.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	enumerator			The enumerator of the result of a SELECT query, which has not been moved yet
+	 * @param[in]	prefetch			Set to @c true to read the next block on a background thread, @n
+	 *									else @c false
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The prefetching thread cannot be started.
+	 * @remarks		The enumerator must outlive this instance, and must not be used by the caller while this instance is used. @n
+	 *				If the prefetching is enabled, the enumerator is read on another thread, so that its database must not be shared
+	 *				with another thread either.
+	 */
+	result Construct(DbEnumerator& enumerator, bool prefetch = false)
+	{
+		TryReturn(__pEnumerator == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		result r = E_SUCCESS;
+
+		if (prefetch)
+		{
+			r = __monitor.Construct();
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+			__pThread = new (std::nothrow) Tizen::Base::Runtime::Thread();
+			TryReturn(__pThread != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			r = __pThread->Construct(*this);
+			if (r == E_SUCCESS)
+			{
+				r = __pThread->Start();
+			}
+			TryCatch(r == E_SUCCESS, , "[%s] Failed to start the prefetching thread.", GetErrorMessage(r));
+		}
+
+		__pEnumerator = &enumerator;
+
+		return E_SUCCESS;
+
+CATCH:
+		delete __pThread;
+		__pThread = null;
+		return r;
+	}
+
+	/**
+	 * Reads the next rows into the specified block.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	maxRows				The maximum number of rows to read
+	 * @param[out]	block				The block to store the rows, whose previous contents are discarded
+	 * @exception	E_SUCCESS			The method is successful, and at least one row is read.
+	 * @exception	E_OUT_OF_RANGE		There are no more rows.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		Either of the following conditions has occurred: @n
+	 *									- The specified @c maxRows is less than @c 1 or greater than @c 65536. @n
+	 *									- The prefetching is enabled and the specified @c maxRows differs from the previous call.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_OBJECT_LOCKED		The database instance is locked.
+	 * @exception	E_IO				An I/O error has occurred.
+	 * @exception	E_SYSTEM			The method cannot proceed due to a severe system error.
+	 * @remarks		The block has fewer than @c maxRows rows if the end of the result is reached. @n
+	 *				If the prefetching is enabled, the block takes over the memory of the prefetched block, and gives its own memory
+	 *				to the prefetching thread for the next block.
+	 */
+	result FetchBlock(int maxRows, DbColumnBlock& block)
+	{
+		TryReturn(__pEnumerator != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(maxRows > 0 && maxRows <= MAX_ROWS, E_INVALID_ARG,
+			"[%s] The maxRows(%d) MUST be between 1 and %d.", GetErrorMessage(E_INVALID_ARG), maxRows, MAX_ROWS);
+
+		if (__pThread == null)
+		{
+			if (__isEnd)
+			{
+				return E_OUT_OF_RANGE;
+			}
+			return Fill(maxRows, block);
+		}
+
+		TryReturn(__prefetchRowCount == 0 || __prefetchRowCount == maxRows, E_INVALID_ARG,
+			"[%s] The maxRows(%d) MUST be the same as the previous call(%d) while prefetching.", GetErrorMessage(E_INVALID_ARG), maxRows, __prefetchRowCount);
+
+		result r = E_SUCCESS;
+
+		__monitor.Enter();
+
+		if (!__isPrefetchRequested)
+		{
+			// The first block is read on the caller thread, since nothing has been prefetched yet
+			__monitor.Exit();
+
+			r = Fill(maxRows, block);
+
+			__monitor.Enter();
+		}
+		else
+		{
+			while (!__isPrefetchDone)
+			{
+				__monitor.Wait();
+			}
+
+			r = __prefetchResult;
+			block.Swap(__prefetchBlock);
+		}
+
+		__prefetchRowCount = maxRows;
+		__isPrefetchDone = false;
+		__isPrefetchRequested = (r == E_SUCCESS && !__isEnd);
+		if (__isPrefetchRequested)
+		{
+			__monitor.NotifyAll();
+		}
+
+		__monitor.Exit();
+
+		return r;
+	}
+
+private:
+	DbBlockReader(const DbBlockReader& rhs);
+	DbBlockReader& operator =(const DbBlockReader& rhs);
+
+	// Reads up to maxRows rows, and sets __isEnd if the enumerator has reached the end
+	result Fill(int maxRows, DbColumnBlock& block)
+	{
+		if (__isEnd)
+		{
+			block.SetRowCount(0);
+			return E_OUT_OF_RANGE;
+		}
+
+		int columnCount = __pEnumerator->GetColumnCount();
+		int row = 0;
+
+		result r = block.Prepare(maxRows, columnCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (; row < maxRows; row++)
+		{
+			r = __pEnumerator->MoveNext();
+			if (r == E_OUT_OF_RANGE)
+			{
+				__isEnd = true;
+				break;
+			}
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+			for (int column = 0; column < columnCount; column++)
+			{
+				r = ReadCell(column, row, block);
+				TryCatch(r == E_SUCCESS, , "[%s] Failed to read the column(%d).", GetErrorMessage(r), column);
+			}
+		}
+
+		block.SetRowCount(row);
+
+		return (row > 0) ? E_SUCCESS : E_OUT_OF_RANGE;
+
+CATCH:
+		block.SetRowCount(0);
+		return r;
+	}
+
+	result ReadCell(int column, int row, DbColumnBlock& block)
+	{
+		result r = E_SUCCESS;
+		DbColumnType type = __pEnumerator->GetColumnType(column);
+
+		switch (type)
+		{
+		case DB_COLUMNTYPE_INT:
+			// Falls through
+		case DB_COLUMNTYPE_INT64:
+		{
+			long long value = 0;
+			r = __pEnumerator->GetInt64At(column, value);
+			block.SetInteger(column, row, type, value);
+			break;
+		}
+
+		case DB_COLUMNTYPE_DOUBLE:
+		{
+			double value = 0;
+			r = __pEnumerator->GetDoubleAt(column, value);
+			block.SetDouble(column, row, value);
+			break;
+		}
+
+		case DB_COLUMNTYPE_TEXT:
+			// The buffer of __text is reused for all the text cells
+			r = __pEnumerator->GetStringAt(column, __text);
+			if (r == E_SUCCESS)
+			{
+				r = block.SetText(column, row, __text.GetPointer(), __text.GetLength());
+			}
+			break;
+
+		case DB_COLUMNTYPE_BLOB:
+		{
+			byte* pData = null;
+			int size = __pEnumerator->GetColumnSize(column);
+
+			r = block.Reserve(column, row, DB_COLUMNTYPE_BLOB, (size > 0) ? size : 0, pData);
+			if (r == E_SUCCESS && size > 0)
+			{
+				r = __pEnumerator->GetBlobAt(column, pData, size);
+			}
+			break;
+		}
+
+		default:
+			block.SetNull(column, row);
+			break;
+		}
+
+		return r;
+	}
+
+	// Runs on the prefetching thread
+	virtual Tizen::Base::Object* Run(void)
+	{
+		__monitor.Enter();
+
+		while (true)
+		{
+			while (!__isStopping && (!__isPrefetchRequested || __isPrefetchDone))
+			{
+				__monitor.Wait();
+			}
+
+			if (__isStopping)
+			{
+				break;
+			}
+
+			int maxRows = __prefetchRowCount;
+			__monitor.Exit();
+
+			result r = Fill(maxRows, __prefetchBlock);
+
+			__monitor.Enter();
+			__prefetchResult = r;
+			__isPrefetchDone = true;
+			__monitor.NotifyAll();
+		}
+
+		__monitor.Exit();
+
+		return null;
+	}
+
+	static const int MAX_ROWS = 65536;
+
+	DbEnumerator* __pEnumerator;
+	Tizen::Base::String __text;
+
+	Tizen::Base::Runtime::Thread* __pThread;
+	Tizen::Base::Runtime::Monitor __monitor;
+	DbColumnBlock __prefetchBlock;
+	bool __isEnd;
+	bool __isPrefetchRequested;
+	bool __isPrefetchDone;
+	bool __isStopping;
+	int __prefetchRowCount;
+	result __prefetchResult;
+
+}; // DbBlockReader
+
+}} // Tizen::Io
+
+#endif // _FIO_DB_BLOCK_READER_H_
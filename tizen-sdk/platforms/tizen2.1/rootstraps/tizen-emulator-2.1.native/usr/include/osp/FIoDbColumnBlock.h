@@ -0,0 +1,478 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoDbColumnBlock.h
+ * @brief	This is the header file for the %DbColumnBlock class.
+ *
+ * This header file contains the declarations of the %DbColumnBlock class.
+ */
+
+#ifndef _FIO_DB_COLUMN_BLOCK_H_
+#define _FIO_DB_COLUMN_BLOCK_H_
+
+#include <string.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseTypes.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FIoDbTypes.h>
+
+namespace Tizen { namespace Io
+{
+
+class DbBlockReader;
+
+//
+// @class	__DbCellSlice
+// @brief	This class is the location of a text or blob cell in the arena of %DbColumnBlock.
+// @since 2.1
+//
+struct __DbCellSlice
+{
+	int offset;
+	int length;
+
+}; // __DbCellSlice
+
+/**
+ * @class	DbColumnBlock
+ * @brief	This class holds a block of rows of a query result, column by column.
+ *
+ * @since	2.1
+ *
+ * The %DbColumnBlock class holds the rows fetched by DbBlockReader::FetchBlock() in typed column arrays.
+ * The integer and the real values of a column are read from plain arrays, and the text and the blob values are slices of one arena,
+ * so that reading a cell does not make a virtual call or construct a Tizen::Base::String. @n
+ * The text is encoded in UTF-8 and terminated by a null character, which is not counted in its length. @n
+ * An instance is reused for the next block, and its memory grows only if the next block is larger.
+ *
+ * @see	DbBlockReader
+ */
+class DbColumnBlock
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * This is the default constructor for this class. The instance is an empty block.
+	 *
+	 * @since	2.1
+	 */
+	DbColumnBlock(void)
+		: __rowCount(0)
+		, __columnCount(0)
+		, __rowCapacity(0)
+		, __cellCapacity(0)
+		, __pTypes(null)
+		, __pIntegers(null)
+		, __pDoubles(null)
+		, __pSlices(null)
+		, __pArena(null)
+		, __arenaLength(0)
+		, __arenaCapacity(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since	2.1
+	 */
+	virtual ~DbColumnBlock(void)
+	{
+		delete[] __pTypes;
+		delete[] __pIntegers;
+		delete[] __pDoubles;
+		delete[] __pSlices;
+		delete[] __pArena;
+	}
+
+	/**
+	 * Gets the number of rows in this block.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of rows
+	 */
+	int GetRowCount(void) const
+	{
+		return __rowCount;
+	}
+
+	/**
+	 * Gets the number of columns in this block.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of columns
+	 */
+	int GetColumnCount(void) const
+	{
+		return __columnCount;
+	}
+
+	/**
+	 * Gets the type of the specified cell.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The type of the cell, @n
+	 *				else @c DB_COLUMNTYPE_UNDEFINED if the specified @c columnIndex or @c rowIndex is out of range
+	 * @param[in]	columnIndex		The index of the column
+	 * @param[in]	rowIndex		The index of the row in this block
+	 */
+	DbColumnType GetTypeAt(int columnIndex, int rowIndex) const
+	{
+		if (!IsValidCell(columnIndex, rowIndex))
+		{
+			return DB_COLUMNTYPE_UNDEFINED;
+		}
+
+		return static_cast< DbColumnType >(__pTypes[GetCellIndex(columnIndex, rowIndex)]);
+	}
+
+	/**
+	 * Gets the integer values of the specified column.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the array of GetRowCount() values, @n
+	 *				else @c null if the specified @c columnIndex is out of range
+	 * @param[in]	columnIndex		The index of the column
+	 * @remarks		A real value is truncated to an integer, and a text, blob, or @c null value is @c 0. @n
+	 *				The array is valid until this block is filled again.
+	 */
+	const long long* GetInt64Column(int columnIndex) const
+	{
+		if (columnIndex < 0 || columnIndex >= __columnCount)
+		{
+			return null;
+		}
+
+		return __pIntegers + columnIndex * __rowCapacity;
+	}
+
+	/**
+	 * Gets the real values of the specified column.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the array of GetRowCount() values, @n
+	 *				else @c null if the specified @c columnIndex is out of range
+	 * @param[in]	columnIndex		The index of the column
+	 * @remarks		An integer value is converted to a real value, and a text, blob, or @c null value is @c 0. @n
+	 *				The array is valid until this block is filled again.
+	 */
+	const double* GetDoubleColumn(int columnIndex) const
+	{
+		if (columnIndex < 0 || columnIndex >= __columnCount)
+		{
+			return null;
+		}
+
+		return __pDoubles + columnIndex * __rowCapacity;
+	}
+
+	/**
+	 * Gets the text value of the specified cell.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	columnIndex			The index of the column
+	 * @param[in]	rowIndex			The index of the row in this block
+	 * @param[out]	pUtf8				The null-terminated UTF-8 text, which is valid until this block is filled again
+	 * @param[out]	length				The length of the text in bytes
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c columnIndex or @c rowIndex is out of range.
+	 * @exception	E_TYPE_MISMATCH		The cell is not a text value.
+	 */
+	result GetTextAt(int columnIndex, int rowIndex, const char*& pUtf8, int& length) const
+	{
+		const __DbCellSlice* pSlice = null;
+
+		result r = GetSlice(columnIndex, rowIndex, DB_COLUMNTYPE_TEXT, pSlice);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		pUtf8 = reinterpret_cast< const char* >(__pArena + pSlice->offset);
+		length = pSlice->length;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the blob value of the specified cell.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	columnIndex			The index of the column
+	 * @param[in]	rowIndex			The index of the row in this block
+	 * @param[out]	pData				The data of the blob, which is valid until this block is filled again
+	 * @param[out]	size				The size of the blob in bytes
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c columnIndex or @c rowIndex is out of range.
+	 * @exception	E_TYPE_MISMATCH		The cell is not a blob value.
+	 */
+	result GetBlobAt(int columnIndex, int rowIndex, const byte*& pData, int& size) const
+	{
+		const __DbCellSlice* pSlice = null;
+
+		result r = GetSlice(columnIndex, rowIndex, DB_COLUMNTYPE_BLOB, pSlice);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		pData = __pArena + pSlice->offset;
+		size = pSlice->length;
+
+		return E_SUCCESS;
+	}
+
+private:
+	DbColumnBlock(const DbColumnBlock& rhs);
+	DbColumnBlock& operator =(const DbColumnBlock& rhs);
+
+	bool IsValidCell(int columnIndex, int rowIndex) const
+	{
+		return columnIndex >= 0 && columnIndex < __columnCount && rowIndex >= 0 && rowIndex < __rowCount;
+	}
+
+	int GetCellIndex(int columnIndex, int rowIndex) const
+	{
+		return columnIndex * __rowCapacity + rowIndex;
+	}
+
+	result GetSlice(int columnIndex, int rowIndex, DbColumnType type, const __DbCellSlice*& pSlice) const
+	{
+		TryReturn(IsValidCell(columnIndex, rowIndex), E_OUT_OF_RANGE,
+			"[%s] The cell(%d, %d) is out of the block of %d columns and %d rows.", GetErrorMessage(E_OUT_OF_RANGE), columnIndex, rowIndex, __columnCount, __rowCount);
+
+		int index = GetCellIndex(columnIndex, rowIndex);
+		TryReturn(__pTypes[index] == type, E_TYPE_MISMATCH, "[%s] The type of the cell(%d, %d) is %d.", GetErrorMessage(E_TYPE_MISMATCH), columnIndex, rowIndex, __pTypes[index]);
+
+		pSlice = &__pSlices[index];
+
+		return E_SUCCESS;
+	}
+
+	// Called by DbBlockReader before filling the block
+	result Prepare(int rowCapacity, int columnCount)
+	{
+		int cellCount = rowCapacity * columnCount;
+
+		if (cellCount > __cellCapacity)
+		{
+			byte* pTypes = new (std::nothrow) byte[cellCount];
+			long long* pIntegers = new (std::nothrow) long long[cellCount];
+			double* pDoubles = new (std::nothrow) double[cellCount];
+			__DbCellSlice* pSlices = new (std::nothrow) __DbCellSlice[cellCount];
+
+			if (pTypes == null || pIntegers == null || pDoubles == null || pSlices == null)
+			{
+				delete[] pTypes;
+				delete[] pIntegers;
+				delete[] pDoubles;
+				delete[] pSlices;
+
+				AppLogException("[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+				return E_OUT_OF_MEMORY;
+			}
+
+			delete[] __pTypes;
+			delete[] __pIntegers;
+			delete[] __pDoubles;
+			delete[] __pSlices;
+
+			__pTypes = pTypes;
+			__pIntegers = pIntegers;
+			__pDoubles = pDoubles;
+			__pSlices = pSlices;
+			__cellCapacity = cellCount;
+		}
+
+		__rowCount = 0;
+		__columnCount = columnCount;
+		__rowCapacity = rowCapacity;
+		__arenaLength = 0;
+
+		return E_SUCCESS;
+	}
+
+	void SetRowCount(int rowCount)
+	{
+		__rowCount = rowCount;
+	}
+
+	void SetNull(int columnIndex, int rowIndex)
+	{
+		int index = GetCellIndex(columnIndex, rowIndex);
+
+		__pTypes[index] = DB_COLUMNTYPE_NULL;
+		__pIntegers[index] = 0;
+		__pDoubles[index] = 0;
+	}
+
+	void SetInteger(int columnIndex, int rowIndex, DbColumnType type, long long value)
+	{
+		int index = GetCellIndex(columnIndex, rowIndex);
+
+		__pTypes[index] = type;
+		__pIntegers[index] = value;
+		__pDoubles[index] = static_cast< double >(value);
+	}
+
+	void SetDouble(int columnIndex, int rowIndex, double value)
+	{
+		int index = GetCellIndex(columnIndex, rowIndex);
+
+		__pTypes[index] = DB_COLUMNTYPE_DOUBLE;
+		__pIntegers[index] = static_cast< long long >(value);
+		__pDoubles[index] = value;
+	}
+
+	// Encodes the text into the arena without an intermediate buffer
+	result SetText(int columnIndex, int rowIndex, const wchar_t* pText, int length)
+	{
+		// A UTF-32 character is at most 4 bytes in UTF-8
+		byte* pData = null;
+		result r = Reserve(columnIndex, rowIndex, DB_COLUMNTYPE_TEXT, length * 4 + 1, pData);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		byte* pOut = pData;
+		for (int i = 0; i < length; i++)
+		{
+			unsigned int ch = static_cast< unsigned int >(pText[i]);
+
+			if (ch < 0x80)
+			{
+				*pOut++ = static_cast< byte >(ch);
+			}
+			else if (ch < 0x800)
+			{
+				*pOut++ = static_cast< byte >(0xC0 | (ch >> 6));
+				*pOut++ = static_cast< byte >(0x80 | (ch & 0x3F));
+			}
+			else if (ch < 0x10000)
+			{
+				*pOut++ = static_cast< byte >(0xE0 | (ch >> 12));
+				*pOut++ = static_cast< byte >(0x80 | ((ch >> 6) & 0x3F));
+				*pOut++ = static_cast< byte >(0x80 | (ch & 0x3F));
+			}
+			else
+			{
+				*pOut++ = static_cast< byte >(0xF0 | ((ch >> 18) & 0x07));
+				*pOut++ = static_cast< byte >(0x80 | ((ch >> 12) & 0x3F));
+				*pOut++ = static_cast< byte >(0x80 | ((ch >> 6) & 0x3F));
+				*pOut++ = static_cast< byte >(0x80 | (ch & 0x3F));
+			}
+		}
+		*pOut = 0;
+
+		int encodedLength = static_cast< int >(pOut - pData);
+		__pSlices[GetCellIndex(columnIndex, rowIndex)].length = encodedLength;
+
+		// Gives back the part of the worst-case reservation that is not used
+		__arenaLength -= (length * 4 + 1) - (encodedLength + 1);
+
+		return E_SUCCESS;
+	}
+
+	// Reserves the space of a text or blob cell in the arena, which the caller writes to
+	result Reserve(int columnIndex, int rowIndex, DbColumnType type, int size, byte*& pData)
+	{
+		if (__arenaLength + size > __arenaCapacity)
+		{
+			int newCapacity = (__arenaCapacity > 0) ? __arenaCapacity : DEFAULT_ARENA_CAPACITY;
+			while (newCapacity < __arenaLength + size)
+			{
+				newCapacity *= 2;
+			}
+
+			byte* pArena = new (std::nothrow) byte[newCapacity];
+			TryReturn(pArena != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			// The slices are offsets, so that they remain valid after the move
+			if (__arenaLength > 0)
+			{
+				memcpy(pArena, __pArena, __arenaLength);
+			}
+			delete[] __pArena;
+			__pArena = pArena;
+			__arenaCapacity = newCapacity;
+		}
+
+		int index = GetCellIndex(columnIndex, rowIndex);
+
+		__pTypes[index] = type;
+		__pIntegers[index] = 0;
+		__pDoubles[index] = 0;
+		__pSlices[index].offset = __arenaLength;
+		__pSlices[index].length = size;
+
+		pData = __pArena + __arenaLength;
+		__arenaLength += size;
+
+		return E_SUCCESS;
+	}
+
+	// Exchanges the contents with a block filled in the background
+	void Swap(DbColumnBlock& other)
+	{
+		SwapValue(__rowCount, other.__rowCount);
+		SwapValue(__columnCount, other.__columnCount);
+		SwapValue(__rowCapacity, other.__rowCapacity);
+		SwapValue(__cellCapacity, other.__cellCapacity);
+		SwapValue(__pTypes, other.__pTypes);
+		SwapValue(__pIntegers, other.__pIntegers);
+		SwapValue(__pDoubles, other.__pDoubles);
+		SwapValue(__pSlices, other.__pSlices);
+		SwapValue(__pArena, other.__pArena);
+		SwapValue(__arenaLength, other.__arenaLength);
+		SwapValue(__arenaCapacity, other.__arenaCapacity);
+	}
+
+	template< class Type >
+	static void SwapValue(Type& value1, Type& value2)
+	{
+		Type temp = value1;
+		value1 = value2;
+		value2 = temp;
+	}
+
+	static const int DEFAULT_ARENA_CAPACITY = 4096;
+
+	int __rowCount;
+	int __columnCount;
+	int __rowCapacity;
+	int __cellCapacity;
+
+	// The cells are stored column by column
+	byte* __pTypes;
+	long long* __pIntegers;
+	double* __pDoubles;
+	__DbCellSlice* __pSlices;
+
+	byte* __pArena;
+	int __arenaLength;
+	int __arenaCapacity;
+
+	friend class DbBlockReader;
+
+}; // DbColumnBlock
+
+}} // Tizen::Io
+
+#endif // _FIO_DB_COLUMN_BLOCK_H_
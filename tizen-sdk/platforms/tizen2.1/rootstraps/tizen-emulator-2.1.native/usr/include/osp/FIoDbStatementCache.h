@@ -0,0 +1,331 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoDbStatementCache.h
+ * @brief	This is the header file for the %DbStatementCache class.
+ *
+ * This header file contains the declarations of the %DbStatementCache class.
+ */
+
+#ifndef _FIO_DB_STATEMENT_CACHE_H_
+#define _FIO_DB_STATEMENT_CACHE_H_
+
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseColFlatHashMapT.h>
+#include <FIoDatabase.h>
+#include <FIoDbStatement.h>
+
+namespace Tizen { namespace Io
+{
+
+//
+// @class	__DbCachedStatement
+// @brief	This class is an entry of %DbStatementCache.
+// @since 2.1
+//
+struct __DbCachedStatement
+{
+	DbStatement* pStatement;
+
+	// The value of the use counter of the cache when the statement was last returned
+	unsigned int lastUse;
+
+}; // __DbCachedStatement
+
+/**
+ * @class	DbStatementCache
+ * @brief	This class keeps the prepared statements of a database for reuse.
+ *
+ * @since	2.1
+ *
+ * The %DbStatementCache class keeps the DbStatement instances created from a Database instance, keyed by their SQL text,
+ * so that a statement executed repeatedly is compiled only once. @n
+ * When the cache is full, the statement that has not been used for the longest time is deleted.
+ *
+ * The following example demonstrates how to use the %DbStatementCache class.
+ *
+ * @code
+ *	result
+ *	MyStore::UpdateScore(int id, int score)
+ *	{
+ *		// __statements is constructed once with the database of this instance
+ *		DbStatement* pStmt = __statements.GetStatement(L"UPDATE scores SET score = ? WHERE id = ?");
+ *		TryReturn(pStmt != null, GetLastResult(), "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+ *
+ *		pStmt->BindInt(0, score);
+ *		pStmt->BindInt(1, id);
+ *
+ *		DbEnumerator* pEnum = __pDatabase->ExecuteStatementN(*pStmt);
+ *		delete pEnum;
+ *
+ *		return GetLastResult();
+ *	}
+ * @endcode
+ *
+ * @see	DbBatch
+ */
+class DbStatementCache
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	DbStatementCache(void)
+		: __pDatabase(null)
+		, __capacity(0)
+		, __useCount(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * All the cached statements are deleted.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~DbStatementCache(void)
+	{
+		Clear();
+	}
+
+	/**
+	 * Initializes this instance of %DbStatementCache for the specified database.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	database			The database to create the statements from
+	 * @param[in]	capacity			The maximum number of statements to keep
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c capacity is less than @c 1.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The database must outlive this instance.
+	 */
+	result Construct(Database& database, int capacity = DEFAULT_CAPACITY)
+	{
+		TryReturn(__pDatabase == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(capacity > 0, E_INVALID_ARG, "[%s] The capacity(%d) MUST be greater than 0.", GetErrorMessage(E_INVALID_ARG), capacity);
+
+		result r = __statements.Construct(capacity);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pDatabase = &database;
+		__capacity = capacity;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the prepared statement for the specified SQL text. @n
+	 * The statement is created and added to this cache if it is not cached yet.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the DbStatement instance owned by this cache, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	sqlStatement		The SQL statement to compile
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c sqlStatement is invalid SQL.
+	 * @exception	E_OBJECT_LOCKED		The database instance is locked.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			The method cannot proceed due to a severe system error.
+	 * @remarks		The specific error code can be accessed using the GetLastResult() method. @n
+	 *				The returned statement must not be deleted. It is valid until it is evicted by a later call of this method for another SQL text,
+	 *				or until Remove() or Clear() is called. @n
+	 *				The statement keeps the values bound by the previous user. Bind all the parameters before executing it.
+	 */
+	DbStatement* GetStatement(const Tizen::Base::String& sqlStatement)
+	{
+		TryReturnResult(__pDatabase != null, null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+
+		__DbCachedStatement* pEntry = null;
+		DbStatement* pStatement = null;
+		result r = E_SUCCESS;
+
+		if (__statements.GetValue(sqlStatement, pEntry) == E_SUCCESS)
+		{
+			pEntry->lastUse = ++__useCount;
+
+			SetLastResult(E_SUCCESS);
+			return pEntry->pStatement;
+		}
+
+		if (__statements.GetCount() >= __capacity)
+		{
+			EvictLeastRecentlyUsed();
+		}
+
+		pStatement = __pDatabase->CreateStatementN(sqlStatement);
+		r = GetLastResult();
+		TryCatch(pStatement != null, , "[%s] Propagating.", GetErrorMessage(r));
+
+		pEntry = new (std::nothrow) __DbCachedStatement;
+		TryCatch(pEntry != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		pEntry->pStatement = pStatement;
+		pEntry->lastUse = ++__useCount;
+
+		r = __statements.Add(sqlStatement, pEntry);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		SetLastResult(E_SUCCESS);
+		return pStatement;
+
+CATCH:
+		delete pEntry;
+		delete pStatement;
+		SetLastResult(r);
+		return null;
+	}
+
+	/**
+	 * Deletes the cached statement for the specified SQL text.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	sqlStatement		The SQL text of the statement
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OBJ_NOT_FOUND		The statement is not cached.
+	 */
+	result Remove(const Tizen::Base::String& sqlStatement)
+	{
+		__DbCachedStatement* pEntry = null;
+
+		result r = __statements.GetValue(sqlStatement, pEntry);
+		if (r != E_SUCCESS)
+		{
+			return E_OBJ_NOT_FOUND;
+		}
+
+		__statements.Remove(sqlStatement);
+		delete pEntry->pStatement;
+		delete pEntry;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Deletes all the cached statements.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		Call this method before the schema of the tables used by the cached statements is changed.
+	 */
+	void Clear(void)
+	{
+		typedef Tizen::Base::Collection::FlatHashMapT< Tizen::Base::String, __DbCachedStatement* > StatementMap;
+
+		for (StatementMap::ConstIterator i = __statements.begin(); i != __statements.end(); ++i)
+		{
+			delete i->GetValue()->pStatement;
+			delete i->GetValue();
+		}
+		__statements.RemoveAll();
+	}
+
+	/**
+	 * Gets the number of cached statements.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of cached statements
+	 */
+	int GetCount(void) const
+	{
+		return __statements.GetCount();
+	}
+
+	/**
+	 * Gets the maximum number of statements to keep.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The capacity of this cache
+	 */
+	int GetCapacity(void) const
+	{
+		return __capacity;
+	}
+
+	/**
+	 * Gets the database that the statements are created from.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the database, @n
+	 *				else @c null if this instance has not been constructed
+	 */
+	Database* GetDatabase(void) const
+	{
+		return __pDatabase;
+	}
+
+private:
+	DbStatementCache(const DbStatementCache& rhs);
+	DbStatementCache& operator =(const DbStatementCache& rhs);
+
+	// The cache is small, so a linear scan is cheaper than keeping a recency list for every hit
+	void EvictLeastRecentlyUsed(void)
+	{
+		typedef Tizen::Base::Collection::FlatHashMapT< Tizen::Base::String, __DbCachedStatement* > StatementMap;
+
+		StatementMap::ConstIterator victim = __statements.end();
+		unsigned int oldestAge = 0;
+
+		for (StatementMap::ConstIterator i = __statements.begin(); i != __statements.end(); ++i)
+		{
+			unsigned int age = __useCount - i->GetValue()->lastUse;
+			if (victim == __statements.end() || age > oldestAge)
+			{
+				victim = i;
+				oldestAge = age;
+			}
+		}
+
+		if (victim != __statements.end())
+		{
+			Tizen::Base::String key(victim->GetKey());
+			__DbCachedStatement* pEntry = victim->GetValue();
+
+			__statements.Remove(key);
+			delete pEntry->pStatement;
+			delete pEntry;
+		}
+	}
+
+	static const int DEFAULT_CAPACITY = 16;
+
+	Database* __pDatabase;
+	int __capacity;
+	unsigned int __useCount;
+	Tizen::Base::Collection::FlatHashMapT< Tizen::Base::String, __DbCachedStatement* > __statements;
+
+}; // DbStatementCache
+
+}} // Tizen::Io
+
+#endif // _FIO_DB_STATEMENT_CACHE_H_
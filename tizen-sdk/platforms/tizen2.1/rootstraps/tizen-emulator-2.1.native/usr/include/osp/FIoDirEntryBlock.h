@@ -0,0 +1,506 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoDirEntryBlock.h
+ * @brief	This is the header file for the %DirEntryBlock class.
+ *
+ * This header file contains the declarations of the %DirEntryBlock class.
+ */
+
+#ifndef _FIO_DIR_ENTRY_BLOCK_H_
+#define _FIO_DIR_ENTRY_BLOCK_H_
+
+#include <string.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseTypes.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseUtilStringUtil.h>
+
+namespace Tizen { namespace Io
+{
+
+class DirectoryWalker;
+
+//
+// @struct	__DirEntryBlockItem
+// @brief	This is an entry of %DirEntryBlock, whose name is a slice of the arena.
+// @since 2.1
+//
+struct __DirEntryBlockItem
+{
+	int nameOffset;
+	int nameLength;
+	int directoryIndex;
+	int flags;
+	long long size;
+	long long modifiedTime;
+
+}; // __DirEntryBlockItem
+
+//
+// @struct	__DirEntryBlockSlice
+// @brief	This is the location of the path of a directory in the arena of %DirEntryBlock.
+// @since 2.1
+//
+struct __DirEntryBlockSlice
+{
+	int offset;
+	int length;
+
+}; // __DirEntryBlockSlice
+
+/**
+ * @class	DirEntryBlock
+ * @brief	This class holds a block of the entries found by DirectoryWalker.
+ *
+ * @since	2.1
+ *
+ * The %DirEntryBlock class holds the entries fetched by DirectoryWalker::FetchBlock().
+ * The names of the entries and the paths of their directories are slices of one arena, and the other attributes are plain values,
+ * so that reading an entry does not make a virtual call or construct a Tizen::Base::String. @n
+ * The names and the paths are encoded in UTF-8 and terminated by a null character, which is not counted in their length. @n
+ * An instance is reused for the next block, and its memory grows only if the next block is larger.
+ *
+ * @see	DirectoryWalker
+ */
+class DirEntryBlock
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * This is the default constructor for this class. The instance is an empty block.
+	 *
+	 * @since	2.1
+	 */
+	DirEntryBlock(void)
+		: __pEntries(null)
+		, __entryCount(0)
+		, __entryCapacity(0)
+		, __pDirectories(null)
+		, __directoryCount(0)
+		, __directoryCapacity(0)
+		, __pArena(null)
+		, __arenaLength(0)
+		, __arenaCapacity(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since	2.1
+	 */
+	virtual ~DirEntryBlock(void)
+	{
+		delete[] __pEntries;
+		delete[] __pDirectories;
+		delete[] __pArena;
+	}
+
+	/**
+	 * Gets the number of entries in this block.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of entries
+	 */
+	int GetCount(void) const
+	{
+		return __entryCount;
+	}
+
+	/**
+	 * Gets the name of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	index				The index of the entry in this block
+	 * @param[out]	pUtf8				The null-terminated UTF-8 name, which is valid until this block is filled again
+	 * @param[out]	length				The length of the name in bytes
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is out of range.
+	 */
+	result GetNameAt(int index, const char*& pUtf8, int& length) const
+	{
+		TryReturn(index >= 0 && index < __entryCount, E_OUT_OF_RANGE,
+			"[%s] The index(%d) is out of the block of %d entries.", GetErrorMessage(E_OUT_OF_RANGE), index, __entryCount);
+
+		pUtf8 = reinterpret_cast< const char* >(__pArena + __pEntries[index].nameOffset);
+		length = __pEntries[index].nameLength;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the path of the directory of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	index				The index of the entry in this block
+	 * @param[out]	pUtf8				The null-terminated UTF-8 path, which is valid until this block is filled again @n
+	 *									It does not end with a slash unless it is the root directory.
+	 * @param[out]	length				The length of the path in bytes
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is out of range.
+	 * @remarks		The entries of a directory share one path in a block.
+	 */
+	result GetDirectoryAt(int index, const char*& pUtf8, int& length) const
+	{
+		TryReturn(index >= 0 && index < __entryCount, E_OUT_OF_RANGE,
+			"[%s] The index(%d) is out of the block of %d entries.", GetErrorMessage(E_OUT_OF_RANGE), index, __entryCount);
+
+		const __DirEntryBlockSlice& directory = __pDirectories[__pEntries[index].directoryIndex];
+		pUtf8 = reinterpret_cast< const char* >(__pArena + directory.offset);
+		length = directory.length;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the full path of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	index				The index of the entry in this block
+	 * @param[out]	path				The path of the entry
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_OUT_OF_RANGE		The specified @c index is out of range.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		This method converts the path to a Tizen::Base::String, so that GetDirectoryAt() and GetNameAt() are preferred in a loop over many entries.
+	 */
+	result GetPathAt(int index, Tizen::Base::String& path) const
+	{
+		const char* pDirectory = null;
+		int directoryLength = 0;
+
+		result r = GetDirectoryAt(index, pDirectory, directoryLength);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int nameLength = __pEntries[index].nameLength;
+		char* pPath = new (std::nothrow) char[directoryLength + 1 + nameLength + 1];
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		// The path of the root directory ends with a slash
+		int separatorLength = (directoryLength > 0 && pDirectory[directoryLength - 1] == '/') ? 0 : 1;
+
+		memcpy(pPath, pDirectory, directoryLength);
+		pPath[directoryLength] = '/';
+		memcpy(pPath + directoryLength + separatorLength, __pArena + __pEntries[index].nameOffset, nameLength + 1);
+
+		r = Tizen::Base::Utility::StringUtil::Utf8ToString(pPath, path);
+		delete[] pPath;
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Checks whether the specified entry is a directory.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the entry is a directory, @n
+	 *				else @c false if it is not a directory or the specified @c index is out of range
+	 * @param[in]	index		The index of the entry in this block
+	 */
+	bool IsDirectoryAt(int index) const
+	{
+		return HasFlag(index, FLAG_DIRECTORY);
+	}
+
+	/**
+	 * Checks whether the specified entry is hidden, which means that its name starts with a dot.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the entry is hidden, @n
+	 *				else @c false if it is not hidden or the specified @c index is out of range
+	 * @param[in]	index		The index of the entry in this block
+	 */
+	bool IsHiddenAt(int index) const
+	{
+		return HasFlag(index, FLAG_HIDDEN);
+	}
+
+	/**
+	 * Checks whether the specified entry is read-only.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c true if the entry is read-only, @n
+	 *				else @c false if it is writable, its status has not been read, or the specified @c index is out of range
+	 * @param[in]	index		The index of the entry in this block
+	 * @remarks		The status of an entry is read only if DirectoryWalker::SetStatusRequired() has been called with @c true.
+	 */
+	bool IsReadOnlyAt(int index) const
+	{
+		return HasFlag(index, FLAG_READ_ONLY);
+	}
+
+	/**
+	 * Gets the size of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The size of the entry in bytes, @n
+	 *				else @c -1 if its status has not been read or the specified @c index is out of range
+	 * @param[in]	index		The index of the entry in this block
+	 * @remarks		The status of an entry is read only if DirectoryWalker::SetStatusRequired() has been called with @c true.
+	 */
+	long long GetFileSizeAt(int index) const
+	{
+		if (!HasFlag(index, FLAG_STATUS))
+		{
+			return -1;
+		}
+
+		return __pEntries[index].size;
+	}
+
+	/**
+	 * Gets the time of the last modification of the specified entry.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The time in seconds since 1970-01-01 00:00:00 UTC, @n
+	 *				else @c -1 if its status has not been read or the specified @c index is out of range
+	 * @param[in]	index		The index of the entry in this block
+	 * @remarks		The status of an entry is read only if DirectoryWalker::SetStatusRequired() has been called with @c true.
+	 */
+	long long GetModifiedTimeAt(int index) const
+	{
+		if (!HasFlag(index, FLAG_STATUS))
+		{
+			return -1;
+		}
+
+		return __pEntries[index].modifiedTime;
+	}
+
+private:
+	DirEntryBlock(const DirEntryBlock& rhs);
+	DirEntryBlock& operator =(const DirEntryBlock& rhs);
+
+	bool HasFlag(int index, int flag) const
+	{
+		return index >= 0 && index < __entryCount && (__pEntries[index].flags & flag) != 0;
+	}
+
+	// Called by DirectoryWalker before filling the block
+	void Clear(void)
+	{
+		__entryCount = 0;
+		__directoryCount = 0;
+		__arenaLength = 0;
+	}
+
+	// Adds the path of a directory, which the entries added after it belong to
+	result AddDirectory(const char* pPath, int length)
+	{
+		if (__directoryCount == __directoryCapacity)
+		{
+			result r = Grow(__pDirectories, __directoryCount, __directoryCapacity, __directoryCount + 1);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		int offset = 0;
+		result r = Store(pPath, length, offset);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pDirectories[__directoryCount].offset = offset;
+		__pDirectories[__directoryCount].length = length;
+		__directoryCount++;
+
+		return E_SUCCESS;
+	}
+
+	result AddEntry(const char* pName, int length, int flags, long long size, long long modifiedTime)
+	{
+		if (__entryCount == __entryCapacity)
+		{
+			result r = Grow(__pEntries, __entryCount, __entryCapacity, __entryCount + 1);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		int offset = 0;
+		result r = Store(pName, length, offset);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__DirEntryBlockItem& entry = __pEntries[__entryCount];
+		entry.nameOffset = offset;
+		entry.nameLength = length;
+		entry.directoryIndex = __directoryCount - 1;
+		entry.flags = flags;
+		entry.size = size;
+		entry.modifiedTime = modifiedTime;
+		__entryCount++;
+
+		return E_SUCCESS;
+	}
+
+	// Appends the entries of the other block, so that small blocks are merged before they are fetched
+	result Append(const DirEntryBlock& other)
+	{
+		if (other.__entryCount == 0)
+		{
+			return E_SUCCESS;
+		}
+
+		result r = Grow(__pEntries, __entryCount, __entryCapacity, __entryCount + other.__entryCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = Grow(__pDirectories, __directoryCount, __directoryCapacity, __directoryCount + other.__directoryCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int offset = 0;
+		r = Store(reinterpret_cast< const char* >(other.__pArena), other.__arenaLength - 1, offset);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// The slices of the other block are moved by the offset of its arena in this block
+		for (int i = 0; i < other.__directoryCount; i++)
+		{
+			__pDirectories[__directoryCount + i].offset = other.__pDirectories[i].offset + offset;
+			__pDirectories[__directoryCount + i].length = other.__pDirectories[i].length;
+		}
+
+		for (int i = 0; i < other.__entryCount; i++)
+		{
+			__DirEntryBlockItem& entry = __pEntries[__entryCount + i];
+			entry = other.__pEntries[i];
+			entry.nameOffset += offset;
+			entry.directoryIndex += __directoryCount;
+		}
+
+		__directoryCount += other.__directoryCount;
+		__entryCount += other.__entryCount;
+
+		return E_SUCCESS;
+	}
+
+	// Copies the string and its null character to the arena
+	result Store(const char* pString, int length, int& offset)
+	{
+		if (__arenaLength + length + 1 > __arenaCapacity)
+		{
+			int newCapacity = (__arenaCapacity > 0) ? __arenaCapacity : DEFAULT_ARENA_CAPACITY;
+			while (newCapacity < __arenaLength + length + 1)
+			{
+				newCapacity *= 2;
+			}
+
+			byte* pArena = new (std::nothrow) byte[newCapacity];
+			TryReturn(pArena != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			// The slices are offsets, so that they remain valid after the move
+			if (__arenaLength > 0)
+			{
+				memcpy(pArena, __pArena, __arenaLength);
+			}
+			delete[] __pArena;
+			__pArena = pArena;
+			__arenaCapacity = newCapacity;
+		}
+
+		offset = __arenaLength;
+		memcpy(__pArena + __arenaLength, pString, length);
+		__pArena[__arenaLength + length] = 0;
+		__arenaLength += length + 1;
+
+		return E_SUCCESS;
+	}
+
+	template< class Type >
+	static result Grow(Type*& pArray, int count, int& capacity, int minCapacity)
+	{
+		if (minCapacity <= capacity)
+		{
+			return E_SUCCESS;
+		}
+
+		int newCapacity = (capacity > 0) ? capacity : DEFAULT_CAPACITY;
+		while (newCapacity < minCapacity)
+		{
+			newCapacity *= 2;
+		}
+
+		Type* pNewArray = new (std::nothrow) Type[newCapacity];
+		TryReturn(pNewArray != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		if (count > 0)
+		{
+			memcpy(pNewArray, pArray, count * sizeof(Type));
+		}
+		delete[] pArray;
+		pArray = pNewArray;
+		capacity = newCapacity;
+
+		return E_SUCCESS;
+	}
+
+	// Exchanges the contents with a block filled by a worker
+	void Swap(DirEntryBlock& other)
+	{
+		SwapValue(__pEntries, other.__pEntries);
+		SwapValue(__entryCount, other.__entryCount);
+		SwapValue(__entryCapacity, other.__entryCapacity);
+		SwapValue(__pDirectories, other.__pDirectories);
+		SwapValue(__directoryCount, other.__directoryCount);
+		SwapValue(__directoryCapacity, other.__directoryCapacity);
+		SwapValue(__pArena, other.__pArena);
+		SwapValue(__arenaLength, other.__arenaLength);
+		SwapValue(__arenaCapacity, other.__arenaCapacity);
+	}
+
+	template< class Type >
+	static void SwapValue(Type& value1, Type& value2)
+	{
+		Type temp = value1;
+		value1 = value2;
+		value2 = temp;
+	}
+
+	static const int FLAG_DIRECTORY = 0x01;
+	static const int FLAG_HIDDEN = 0x02;
+	static const int FLAG_READ_ONLY = 0x04;
+	static const int FLAG_STATUS = 0x08;
+	static const int DEFAULT_CAPACITY = 64;
+	static const int DEFAULT_ARENA_CAPACITY = 4096;
+
+	__DirEntryBlockItem* __pEntries;
+	int __entryCount;
+	int __entryCapacity;
+
+	__DirEntryBlockSlice* __pDirectories;
+	int __directoryCount;
+	int __directoryCapacity;
+
+	byte* __pArena;
+	int __arenaLength;
+	int __arenaCapacity;
+
+	friend class DirectoryWalker;
+
+}; // DirEntryBlock
+
+}} // Tizen::Io
+
+#endif // _FIO_DIR_ENTRY_BLOCK_H_
@@ -0,0 +1,913 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoDirectoryWalker.h
+ * @brief	This is the header file for the %DirectoryWalker class.
+ *
+ * This header file contains the declarations of the %DirectoryWalker class.
+ */
+
+#ifndef _FIO_DIRECTORY_WALKER_H_
+#define _FIO_DIRECTORY_WALKER_H_
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseString.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseLog.h>
+#include <FBaseColArrayListT.h>
+#include <FBaseRtMonitor.h>
+#include <FBaseRtThreadPool.h>
+#include <FBaseUtilStringUtil.h>
+#include <FIoDirEntryBlock.h>
+
+namespace Tizen { namespace Io
+{
+
+/**
+ * @enum	DirectoryWalkerFilter
+ *
+ * Defines the kinds of the entries which DirectoryWalker returns. The values can be combined with the bitwise OR operator.
+ *
+ * @since	2.1
+ */
+enum DirectoryWalkerFilter
+{
+	DIRECTORY_WALKER_FILTER_FILE = 0x01,		/**< The entries which are not directories */
+	DIRECTORY_WALKER_FILTER_DIRECTORY = 0x02,	/**< The directories */
+	DIRECTORY_WALKER_FILTER_HIDDEN = 0x04,		/**< The hidden entries, whose names start with a dot, and the contents of the hidden directories */
+	DIRECTORY_WALKER_FILTER_ALL = 0x07			/**< All the entries */
+};
+
+class DirectoryWalker;
+
+//
+// @struct	__LinuxDirent64
+// @brief	This is the record of an entry returned by the getdents64 system call.
+// @since 2.1
+//
+struct __LinuxDirent64
+{
+	unsigned long long d_ino;
+	long long d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[1];
+
+}; // __LinuxDirent64
+
+//
+// @struct	__DirectoryWalkerScan
+// @brief	This is the task of %DirectoryWalker which scans a directory on a worker thread of the pool.
+// @since 2.1
+//
+struct __DirectoryWalkerScan
+{
+	__DirectoryWalkerScan(DirectoryWalker& walker, char* pPath, int length)
+		: pWalker(&walker)
+		, pPath(pPath)
+		, length(length)
+	{
+	}
+
+	void operator ()(void) const;
+
+	DirectoryWalker* pWalker;
+
+	// The path is deleted by the scan
+	char* pPath;
+	int length;
+
+}; // __DirectoryWalkerScan
+
+/**
+ * @class	DirectoryWalker
+ * @brief	This class traverses a directory tree on several threads, and returns the entries in blocks.
+ *
+ * @since	2.1
+ *
+ * The %DirectoryWalker class traverses a directory and all its subdirectories on the worker threads of a Tizen::Base::Runtime::ThreadPool,
+ * so that the latency of the storage, such as an external memory card, is overlapped. @n
+ * Each directory is read with the getdents64 system call into a large buffer, instead of an entry at a time.
+ * The entries are filtered by kind and by name pattern before their status is read,
+ * and the status is read only if SetStatusRequired() has been called with @c true. @n
+ * The entries are collected into a DirEntryBlock, which is fetched by FetchBlock() on the calling thread.
+ * The entries of the small directories are merged into one block, and the order of the entries is not defined. @n
+ * The symbolic links to directories are returned as files, and are not followed.
+ *
+ * This header is not included from FIo.h, because it needs the system call numbers of sys/syscall.h,
+ * which the SDK does not provide. The application must include this header directly, and must be built with them.
+ *
+ * The following example demonstrates how to use the %DirectoryWalker class.
+ *
+ * @code
+ *	result
+ *	MyIndexer::IndexImages(const String& rootPath)
+ *	{
+ *		DirectoryWalker walker;
+ *		DirEntryBlock block;
+ *
+ *		result r = walker.Construct(rootPath);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		walker.SetNamePattern(L"*.jpg");
+ *		walker.SetFilter(DIRECTORY_WALKER_FILTER_FILE);
+ *		walker.SetStatusRequired(true);
+ *
+ *		r = walker.Start();
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		while (walker.FetchBlock(block) == E_SUCCESS)
+ *		{
+ *			for (int i = 0; i < block.GetCount(); i++)
+ *			{
+ *				const char* pDirectory = null;
+ *				const char* pName = null;
+ *				int directoryLength = 0;
+ *				int nameLength = 0;
+ *
+ *				block.GetDirectoryAt(i, pDirectory, directoryLength);
+ *				block.GetNameAt(i, pName, nameLength);
+ *				AddToIndex(pDirectory, pName, block.GetFileSizeAt(i));
+ *			}
+ *		}
+ *
+ *		AppLog("%d images, %lld bytes", walker.GetFileCount(), walker.GetTotalFileSize());
+ *		return E_SUCCESS;
+ *	}
+ * @endcode
+ */
+class DirectoryWalker
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	DirectoryWalker(void)
+		: __pRootPath(null)
+		, __rootPathLength(0)
+		, __pPattern(null)
+		, __filter(DIRECTORY_WALKER_FILTER_FILE | DIRECTORY_WALKER_FILTER_DIRECTORY)
+		, __isStatusRequired(false)
+		, __isStarted(false)
+		, __isCanceled(false)
+		, __outstandingCount(0)
+		, __fileCount(0)
+		, __directoryCount(0)
+		, __failedDirectoryCount(0)
+		, __totalFileSize(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The traversal is canceled, and the destructor waits until the directories being read are closed.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~DirectoryWalker(void)
+	{
+		if (__pRootPath != null)
+		{
+			Cancel();
+		}
+		__pool.Shutdown();
+
+		DeleteBlocks(__readyBlocks);
+		DeleteBlocks(__freeBlocks);
+
+		delete[] __pRootPath;
+		delete[] __pPattern;
+	}
+
+	/**
+	 * Initializes this instance of %DirectoryWalker with the specified root directory.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	rootPath			The path of the directory to traverse
+	 * @param[in]	threadCount			The number of the threads which read the directories in parallel
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c rootPath is empty, or the specified @c threadCount is not between @c 1 and @c 64.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks		The directory is not opened until Start() is called. @n
+	 *				The reading of a directory waits mostly for the storage, so that more threads than processors can be used.
+	 */
+	result Construct(const Tizen::Base::String& rootPath, int threadCount = DEFAULT_THREAD_COUNT)
+	{
+		TryReturn(__pRootPath == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(!rootPath.IsEmpty(), E_INVALID_ARG, "[%s] The rootPath is empty.", GetErrorMessage(E_INVALID_ARG));
+		TryReturn(threadCount >= 1 && threadCount <= MAX_THREAD_COUNT, E_INVALID_ARG,
+			"[%s] The threadCount(%d) MUST be between 1 and %d.", GetErrorMessage(E_INVALID_ARG), threadCount, MAX_THREAD_COUNT);
+
+		result r = __monitor.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __readyBlocks.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __freeBlocks.Construct();
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		int length = 0;
+		char* pRootPath = ConvertToUtf8N(rootPath, length);
+		r = GetLastResult();
+		TryReturn(pRootPath != null, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// The trailing slashes are removed, except the one of the root directory
+		while (length > 1 && pRootPath[length - 1] == '/')
+		{
+			pRootPath[--length] = '\0';
+		}
+
+		r = __pool.Construct(threadCount);
+		if (r != E_SUCCESS)
+		{
+			delete[] pRootPath;
+			AppLogException("[%s] Propagating.", GetErrorMessage(r));
+			return r;
+		}
+
+		__pRootPath = pRootPath;
+		__rootPathLength = length;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Sets the pattern which the names of the returned entries match.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pattern				The shell wildcard pattern, such as "*.jpg" @n
+	 *									If it is empty, all the names match.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Start() has already been called.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The pattern is matched against the name of an entry, not its path, and is case-sensitive. @n
+	 *				All the directories are traversed, whether their names match or not.
+	 */
+	result SetNamePattern(const Tizen::Base::String& pattern)
+	{
+		TryReturn(__pRootPath != null && !__isStarted, E_INVALID_STATE,
+			"[%s] This instance has not been constructed, or has been started.", GetErrorMessage(E_INVALID_STATE));
+
+		char* pPattern = null;
+		if (!pattern.IsEmpty())
+		{
+			int length = 0;
+			pPattern = ConvertToUtf8N(pattern, length);
+			result r = GetLastResult();
+			TryReturn(pPattern != null, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		delete[] __pPattern;
+		__pPattern = pPattern;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Sets the kinds of the entries to return.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filter				The combination of the values of DirectoryWalkerFilter @n
+	 *									The default value is DIRECTORY_WALKER_FILTER_FILE | DIRECTORY_WALKER_FILTER_DIRECTORY.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Start() has already been called.
+	 * @exception	E_INVALID_ARG		The specified @c filter includes neither the files nor the directories.
+	 * @remarks		If DIRECTORY_WALKER_FILTER_HIDDEN is not included, the hidden directories are not traversed either.
+	 */
+	result SetFilter(int filter)
+	{
+		TryReturn(__pRootPath != null && !__isStarted, E_INVALID_STATE,
+			"[%s] This instance has not been constructed, or has been started.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn((filter & (DIRECTORY_WALKER_FILTER_FILE | DIRECTORY_WALKER_FILTER_DIRECTORY)) != 0, E_INVALID_ARG,
+			"[%s] The filter(0x%x) MUST include the files or the directories.", GetErrorMessage(E_INVALID_ARG), filter);
+
+		__filter = filter;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Sets whether the status of the returned entries, which is the size, the time of the last modification, and the read-only attribute, is read.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	required			Set to @c true to read the status of the returned entries, @n
+	 *									else @c false
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or Start() has already been called.
+	 * @remarks		Reading the status costs a system call for each returned entry, so that it is not read by default. @n
+	 *				GetTotalFileSize() is counted only if the status is read.
+	 */
+	result SetStatusRequired(bool required)
+	{
+		TryReturn(__pRootPath != null && !__isStarted, E_INVALID_STATE,
+			"[%s] This instance has not been constructed, or has been started.", GetErrorMessage(E_INVALID_STATE));
+
+		__isStatusRequired = required;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Starts the traversal in the background.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed, or this method has already been called.
+	 * @exception	E_FILE_NOT_FOUND	The root directory does not exist.
+	 * @exception	E_ILLEGAL_ACCESS	The access to the root directory is denied.
+	 * @exception	E_INVALID_ARG		The root path is not a directory.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				An I/O error has occurred.
+	 */
+	result Start(void)
+	{
+		TryReturn(__pRootPath != null && !__isStarted, E_INVALID_STATE,
+			"[%s] This instance has not been constructed, or has been started.", GetErrorMessage(E_INVALID_STATE));
+
+		struct stat64 status;
+		if (stat64(__pRootPath, &status) != 0)
+		{
+			result r = ConvertError(errno);
+			AppLogException("[%s] Failed to get the status of the root directory(%s).", GetErrorMessage(r), __pRootPath);
+			return r;
+		}
+		TryReturn(S_ISDIR(status.st_mode), E_INVALID_ARG, "[%s] The root path(%s) is not a directory.", GetErrorMessage(E_INVALID_ARG), __pRootPath);
+
+		char* pPath = new (std::nothrow) char[__rootPathLength + 1];
+		TryReturn(pPath != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		memcpy(pPath, __pRootPath, __rootPathLength + 1);
+
+		__outstandingCount = 1;
+		__isStarted = true;
+
+		result r = __pool.SubmitFunctor(__DirectoryWalkerScan(*this, pPath, __rootPathLength));
+		if (r != E_SUCCESS)
+		{
+			delete[] pPath;
+			__outstandingCount = 0;
+			__isStarted = false;
+			AppLogException("[%s] Propagating.", GetErrorMessage(r));
+			return r;
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Fetches the next block of entries, and waits until it is ready.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[out]	block				The block to fill @n
+	 *									Its previous contents are discarded, and its memory is reused by the walker.
+	 * @exception	E_SUCCESS			The method is successful, and the block has at least one entry.
+	 * @exception	E_INVALID_STATE		Start() has not been called.
+	 * @exception	E_OUT_OF_RANGE		All the entries have been fetched, or the traversal has been canceled.
+	 */
+	result FetchBlock(DirEntryBlock& block)
+	{
+		TryReturn(__isStarted, E_INVALID_STATE, "[%s] The traversal has not been started.", GetErrorMessage(E_INVALID_STATE));
+
+		__monitor.Enter();
+
+		while (__readyBlocks.GetCount() == 0 && __outstandingCount > 0 && !__isCanceled)
+		{
+			__monitor.Wait();
+		}
+
+		if (__readyBlocks.GetCount() == 0 || __isCanceled)
+		{
+			__monitor.Exit();
+			return E_OUT_OF_RANGE;
+		}
+
+		DirEntryBlock* pReady = null;
+		__readyBlocks.GetAt(0, pReady);
+		__readyBlocks.RemoveAt(0);
+
+		// The memory of the previous contents of the block is given to the workers
+		block.Swap(*pReady);
+		RecycleBlock(pReady);
+
+		// Wakes up the workers waiting for room in the queue
+		__monitor.NotifyAll();
+		__monitor.Exit();
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Cancels the traversal. The directories which are being read are closed in the background.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		After this method is called, FetchBlock() returns E_OUT_OF_RANGE.
+	 */
+	void Cancel(void)
+	{
+		__monitor.Enter();
+		__isCanceled = true;
+		__monitor.NotifyAll();
+		__monitor.Exit();
+	}
+
+	/**
+	 * Gets the number of the returned entries which are not directories.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of files
+	 * @remarks		The value is final after FetchBlock() has returned E_OUT_OF_RANGE, and is the count so far before then.
+	 */
+	int GetFileCount(void) const
+	{
+		__monitor.Enter();
+		int count = __fileCount;
+		__monitor.Exit();
+
+		return count;
+	}
+
+	/**
+	 * Gets the number of the returned entries which are directories.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of directories
+	 * @remarks		The value is final after FetchBlock() has returned E_OUT_OF_RANGE, and is the count so far before then.
+	 */
+	int GetDirectoryCount(void) const
+	{
+		__monitor.Enter();
+		int count = __directoryCount;
+		__monitor.Exit();
+
+		return count;
+	}
+
+	/**
+	 * Gets the total size of the returned entries which are not directories.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The total size in bytes, @n
+	 *				else @c 0 if SetStatusRequired() has not been called with @c true
+	 * @remarks		The value is final after FetchBlock() has returned E_OUT_OF_RANGE, and is the total so far before then.
+	 */
+	long long GetTotalFileSize(void) const
+	{
+		__monitor.Enter();
+		long long size = __totalFileSize;
+		__monitor.Exit();
+
+		return size;
+	}
+
+	/**
+	 * Gets the number of the directories which have not been read because of an error, such as a denied access.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of directories
+	 * @remarks		The entries of such a directory are skipped, and the traversal continues.
+	 */
+	int GetFailedDirectoryCount(void) const
+	{
+		__monitor.Enter();
+		int count = __failedDirectoryCount;
+		__monitor.Exit();
+
+		return count;
+	}
+
+private:
+	DirectoryWalker(const DirectoryWalker& rhs);
+	DirectoryWalker& operator =(const DirectoryWalker& rhs);
+
+	// Called on a worker thread with the path allocated by the submitter
+	void ScanDirectory(char* pPath, int length)
+	{
+		if (!__isCanceled)
+		{
+			Scan(pPath, length);
+		}
+		delete[] pPath;
+
+		__monitor.Enter();
+		if (--__outstandingCount == 0)
+		{
+			__monitor.NotifyAll();
+		}
+		__monitor.Exit();
+	}
+
+	void Scan(const char* pPath, int length)
+	{
+		int fd = open64(pPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (fd < 0)
+		{
+			AppLog("Failed to open the directory(%s): %d", pPath, errno);
+			AddFailedDirectory();
+			return;
+		}
+
+		char* pBuffer = new (std::nothrow) char[DIRENT_BUFFER_SIZE];
+		DirEntryBlock* pBlock = AcquireBlock();
+		if (pBuffer == null || pBlock == null)
+		{
+			AppLogException("[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+			delete[] pBuffer;
+			delete pBlock;
+			close(fd);
+			AddFailedDirectory();
+			return;
+		}
+
+		int fileCount = 0;
+		int directoryCount = 0;
+		long long totalFileSize = 0;
+		bool isDirectoryAdded = false;
+		bool isFailed = false;
+
+		while (!isFailed && !__isCanceled)
+		{
+			long readLength = syscall(SYS_getdents64, fd, pBuffer, DIRENT_BUFFER_SIZE);
+			if (readLength <= 0)
+			{
+				if (readLength < 0)
+				{
+					AppLog("Failed to read the directory(%s): %d", pPath, errno);
+					isFailed = true;
+				}
+				break;
+			}
+
+			for (long offset = 0; offset < readLength; )
+			{
+				const __LinuxDirent64* pEntry = reinterpret_cast< const __LinuxDirent64* >(pBuffer + offset);
+				offset += pEntry->d_reclen;
+
+				const char* pName = pEntry->d_name;
+				if (pName[0] == '.' && (pName[1] == '\0' || (pName[1] == '.' && pName[2] == '\0')))
+				{
+					continue;
+				}
+
+				bool isHidden = (pName[0] == '.');
+				if (isHidden && (__filter & DIRECTORY_WALKER_FILTER_HIDDEN) == 0)
+				{
+					continue;
+				}
+
+				// Some file systems do not report the type, which is read from the status then
+				struct stat64 status;
+				bool hasStatus = false;
+				unsigned char type = pEntry->d_type;
+				if (type == DT_UNKNOWN && fstatat64(fd, pName, &status, AT_SYMLINK_NOFOLLOW) == 0)
+				{
+					hasStatus = true;
+					type = S_ISDIR(status.st_mode) ? DT_DIR : DT_REG;
+				}
+
+				int nameLength = strlen(pName);
+				bool isDirectory = (type == DT_DIR);
+				if (isDirectory)
+				{
+					SubmitDirectory(pPath, length, pName, nameLength);
+				}
+
+				int kind = isDirectory ? DIRECTORY_WALKER_FILTER_DIRECTORY : DIRECTORY_WALKER_FILTER_FILE;
+				if ((__filter & kind) == 0 || (__pPattern != null && fnmatch(__pPattern, pName, 0) != 0))
+				{
+					continue;
+				}
+
+				int flags = (isDirectory ? DirEntryBlock::FLAG_DIRECTORY : 0) | (isHidden ? DirEntryBlock::FLAG_HIDDEN : 0);
+				if (__isStatusRequired && !hasStatus)
+				{
+					hasStatus = (fstatat64(fd, pName, &status, AT_SYMLINK_NOFOLLOW) == 0);
+				}
+
+				long long size = 0;
+				long long modifiedTime = 0;
+				if (__isStatusRequired && hasStatus)
+				{
+					flags |= DirEntryBlock::FLAG_STATUS | (((status.st_mode & S_IWUSR) == 0) ? DirEntryBlock::FLAG_READ_ONLY : 0);
+					size = status.st_size;
+					modifiedTime = status.st_mtime;
+				}
+
+				// A block which is full is published, so that the caller can process it while this directory is read
+				if (pBlock->GetCount() >= BLOCK_ENTRY_COUNT)
+				{
+					Publish(pBlock, false, fileCount, directoryCount, totalFileSize);
+					fileCount = 0;
+					directoryCount = 0;
+					totalFileSize = 0;
+					isDirectoryAdded = false;
+
+					pBlock = AcquireBlock();
+					if (pBlock == null)
+					{
+						AppLogException("[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+						isFailed = true;
+						break;
+					}
+				}
+
+				result r = E_SUCCESS;
+				if (!isDirectoryAdded)
+				{
+					r = pBlock->AddDirectory(pPath, length);
+					isDirectoryAdded = (r == E_SUCCESS);
+				}
+				if (r == E_SUCCESS)
+				{
+					r = pBlock->AddEntry(pName, nameLength, flags, size, modifiedTime);
+				}
+				if (r != E_SUCCESS)
+				{
+					AppLogException("[%s] Propagating.", GetErrorMessage(r));
+					isFailed = true;
+					break;
+				}
+
+				if (isDirectory)
+				{
+					directoryCount++;
+				}
+				else
+				{
+					fileCount++;
+					totalFileSize += size;
+				}
+			}
+		}
+
+		close(fd);
+		delete[] pBuffer;
+
+		if (pBlock != null)
+		{
+			Publish(pBlock, true, fileCount, directoryCount, totalFileSize);
+		}
+
+		if (isFailed)
+		{
+			AddFailedDirectory();
+		}
+	}
+
+	void SubmitDirectory(const char* pParentPath, int parentLength, const char* pName, int nameLength)
+	{
+		if (__isCanceled)
+		{
+			return;
+		}
+
+		// The path of the root directory ends with a slash
+		int separatorLength = (pParentPath[parentLength - 1] == '/') ? 0 : 1;
+		int length = parentLength + separatorLength + nameLength;
+
+		char* pPath = new (std::nothrow) char[length + 1];
+		if (pPath == null)
+		{
+			AppLogException("[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+			AddFailedDirectory();
+			return;
+		}
+
+		memcpy(pPath, pParentPath, parentLength);
+		pPath[parentLength] = '/';
+		memcpy(pPath + parentLength + separatorLength, pName, nameLength + 1);
+
+		// The count is held by the directory being read, so that it does not reach 0 here
+		__monitor.Enter();
+		__outstandingCount++;
+		__monitor.Exit();
+
+		result r = __pool.SubmitFunctor(__DirectoryWalkerScan(*this, pPath, length));
+		if (r != E_SUCCESS)
+		{
+			AppLogException("[%s] Failed to submit the directory(%s).", GetErrorMessage(r), pPath);
+			delete[] pPath;
+
+			__monitor.Enter();
+			__outstandingCount--;
+			__failedDirectoryCount++;
+			__monitor.Exit();
+		}
+	}
+
+	// Queues the block, or merges it into the last queued block if it is the last part of a directory and both are small
+	void Publish(DirEntryBlock* pBlock, bool isLast, int fileCount, int directoryCount, long long totalFileSize)
+	{
+		__monitor.Enter();
+
+		__fileCount += fileCount;
+		__directoryCount += directoryCount;
+		__totalFileSize += totalFileSize;
+
+		// A full block waits for room, so that the blocks do not pile up when the caller is slower than the storage
+		while (!isLast && __readyBlocks.GetCount() >= MAX_READY_BLOCK_COUNT && !__isCanceled)
+		{
+			__monitor.Wait();
+		}
+
+		int readyCount = __readyBlocks.GetCount();
+		DirEntryBlock* pLast = null;
+		if (isLast && readyCount > 0)
+		{
+			__readyBlocks.GetAt(readyCount - 1, pLast);
+		}
+
+		if (__isCanceled || pBlock->GetCount() == 0)
+		{
+			RecycleBlock(pBlock);
+		}
+		else if (pLast != null && pLast->GetCount() + pBlock->GetCount() <= BLOCK_ENTRY_COUNT && pLast->Append(*pBlock) == E_SUCCESS)
+		{
+			RecycleBlock(pBlock);
+		}
+		else if (__readyBlocks.Add(pBlock) != E_SUCCESS)
+		{
+			AppLogException("[%s] Failed to queue a block of %d entries.", GetErrorMessage(E_OUT_OF_MEMORY), pBlock->GetCount());
+			delete pBlock;
+		}
+
+		__monitor.NotifyAll();
+		__monitor.Exit();
+	}
+
+	DirEntryBlock* AcquireBlock(void)
+	{
+		DirEntryBlock* pBlock = null;
+
+		__monitor.Enter();
+		int count = __freeBlocks.GetCount();
+		if (count > 0)
+		{
+			__freeBlocks.GetAt(count - 1, pBlock);
+			__freeBlocks.RemoveAt(count - 1);
+		}
+		__monitor.Exit();
+
+		if (pBlock == null)
+		{
+			pBlock = new (std::nothrow) DirEntryBlock();
+		}
+
+		return pBlock;
+	}
+
+	// Called with the monitor entered
+	void RecycleBlock(DirEntryBlock* pBlock)
+	{
+		pBlock->Clear();
+		if (__freeBlocks.GetCount() >= MAX_FREE_BLOCK_COUNT || __freeBlocks.Add(pBlock) != E_SUCCESS)
+		{
+			delete pBlock;
+		}
+	}
+
+	void AddFailedDirectory(void)
+	{
+		__monitor.Enter();
+		__failedDirectoryCount++;
+		__monitor.Exit();
+	}
+
+	static void DeleteBlocks(Tizen::Base::Collection::ArrayListT< DirEntryBlock* >& blocks)
+	{
+		for (int i = 0; i < blocks.GetCount(); i++)
+		{
+			DirEntryBlock* pBlock = null;
+			blocks.GetAt(i, pBlock);
+			delete pBlock;
+		}
+		blocks.RemoveAll();
+	}
+
+	static char* ConvertToUtf8N(const Tizen::Base::String& string, int& length)
+	{
+		Tizen::Base::ByteBuffer* pBuffer = Tizen::Base::Utility::StringUtil::StringToUtf8N(string);
+		TryReturnResult(pBuffer != null, null, E_OUT_OF_MEMORY, "[%s] Failed to convert the string.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		// The buffer is null-terminated, and its limit includes the null character
+		length = strlen(reinterpret_cast< const char* >(pBuffer->GetPointer()));
+
+		char* pString = new (std::nothrow) char[length + 1];
+		if (pString != null)
+		{
+			memcpy(pString, pBuffer->GetPointer(), length + 1);
+		}
+		delete pBuffer;
+		TryReturnResult(pString != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		SetLastResult(E_SUCCESS);
+		return pString;
+	}
+
+	static result ConvertError(int error)
+	{
+		switch (error)
+		{
+		case ENOENT:
+			// Falls through
+		case ENOTDIR:
+			return E_FILE_NOT_FOUND;
+
+		case EACCES:
+			// Falls through
+		case EPERM:
+			return E_ILLEGAL_ACCESS;
+
+		case ENOMEM:
+			return E_OUT_OF_MEMORY;
+
+		default:
+			return E_IO;
+		}
+	}
+
+	static const int DEFAULT_THREAD_COUNT = 4;
+	static const int MAX_THREAD_COUNT = 64;
+	static const int DIRENT_BUFFER_SIZE = 32 * 1024;
+	static const int BLOCK_ENTRY_COUNT = 512;
+	static const int MAX_READY_BLOCK_COUNT = 64;
+	static const int MAX_FREE_BLOCK_COUNT = 16;
+
+	char* __pRootPath;
+	int __rootPathLength;
+	char* __pPattern;
+	int __filter;
+	bool __isStatusRequired;
+	bool __isStarted;
+	volatile bool __isCanceled;
+
+	// Guards the members below, and is notified when a block is queued or fetched, and when the traversal ends
+	mutable Tizen::Base::Runtime::Monitor __monitor;
+	Tizen::Base::Collection::ArrayListT< DirEntryBlock* > __readyBlocks;
+	Tizen::Base::Collection::ArrayListT< DirEntryBlock* > __freeBlocks;
+	int __outstandingCount;
+	int __fileCount;
+	int __directoryCount;
+	int __failedDirectoryCount;
+	long long __totalFileSize;
+
+	Tizen::Base::Runtime::ThreadPool __pool;
+
+	friend struct __DirectoryWalkerScan;
+
+}; // DirectoryWalker
+
+inline void
+__DirectoryWalkerScan::operator ()(void) const
+{
+	pWalker->ScanDirectory(pPath, length);
+}
+
+}} // Tizen::Io
+
+#endif // _FIO_DIRECTORY_WALKER_H_
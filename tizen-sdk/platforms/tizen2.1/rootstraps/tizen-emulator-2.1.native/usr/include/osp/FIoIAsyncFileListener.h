@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoIAsyncFileListener.h
+ * @brief	This is the header file for the %IAsyncFileListener interface.
+ *
+ * This header file contains the declarations of the %IAsyncFileListener interface.
+ */
+
+#ifndef _FIO_IASYNC_FILE_LISTENER_H_
+#define _FIO_IASYNC_FILE_LISTENER_H_
+
+#include <FBaseDataType.h>
+#include <FBaseResult.h>
+#include <FBaseRtIEventListener.h>
+
+namespace Tizen { namespace Io
+{
+
+class AsyncFile;
+
+/**
+ * @interface	IAsyncFileListener
+ * @brief		This interface is the listener of the completions of the requests of an AsyncFile.
+ *
+ * @since	2.1
+ *
+ * The %IAsyncFileListener interface is the listener of the completions of the read and write requests of an AsyncFile.
+ * The methods are called on the thread that has constructed the %AsyncFile.
+ *
+ * @see	AsyncFile
+ */
+class IAsyncFileListener
+	: virtual public Tizen::Base::Runtime::IEventListener
+{
+public:
+	/**
+	 * This is the destructor for this class.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~IAsyncFileListener(void) {}
+
+	/**
+	 * Called when a read request is completed.
+	 *
+	 * @since	2.1
+	 *
+	 * @param[in]	file			The file that the request was made to
+	 * @param[in]	requestId		The ID of the request
+	 * @param[in]	length			The number of bytes read, which is less than requested if the end of the file is reached
+	 * @param[in]	r				The result of the request @n
+	 *								E_SUCCESS if it is successful, or the error code of the failure
+	 * @remarks		The buffers of the request can be reused or deleted in this method.
+	 */
+	virtual void OnAsyncFileReadCompleted(AsyncFile& file, RequestId requestId, int length, result r) = 0;
+
+	/**
+	 * Called when a write request is completed.
+	 *
+	 * @since	2.1
+	 *
+	 * @param[in]	file			The file that the request was made to
+	 * @param[in]	requestId		The ID of the request
+	 * @param[in]	length			The number of bytes written
+	 * @param[in]	r				The result of the request @n
+	 *								E_SUCCESS if it is successful, or the error code of the failure
+	 * @remarks		The buffers of the request can be reused or deleted in this method.
+	 */
+	virtual void OnAsyncFileWriteCompleted(AsyncFile& file, RequestId requestId, int length, result r) = 0;
+
+}; // IAsyncFileListener
+
+}} // Tizen::Io
+
+#endif // _FIO_IASYNC_FILE_LISTENER_H_
@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FIoMappedByteBuffer.h
+ * @brief	This is the header file for the %MappedByteBuffer class.
+ *
+ * This header file contains the declarations of the %MappedByteBuffer class.
+ */
+
+#ifndef _FIO_MAPPED_BYTE_BUFFER_H_
+#define _FIO_MAPPED_BYTE_BUFFER_H_
+
+#include <unistd.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseString.h>
+#include <FBaseLog.h>
+#include <FBaseRtMemoryManager.h>
+#include <FIoFile.h>
+#include <FIoFileAttributes.h>
+#include <FIoMemoryMappedFile.h>
+
+namespace Tizen { namespace Io
+{
+
+/**
+ * @class	MappedByteBuffer
+ * @brief	This class represents a %ByteBuffer whose contents are a file mapped into memory.
+ *
+ * @since	2.1
+ *
+ * The %MappedByteBuffer class maps a file, or a region of it, with MemoryMappedFile and shares the mapping as the contents of a Tizen::Base::ByteBuffer,
+ * so that the file can be passed to any method that takes a %ByteBuffer without being read into a heap buffer.
+ * The pages are loaded on demand and are shared with the page cache. @n
+ * The mapping is private, so that writing to the buffer changes only a copy of the page in this process and never the file. @n
+ * The file is unmapped when the instance is deleted.
+ *
+ * The following example demonstrates how to use the %MappedByteBuffer class.
+ *
+ * @code
+ *	result
+ *	MyApp::LoadSettings(const String& filePath)
+ *	{
+ *		MappedByteBuffer buffer;
+ *
+ *		result r = buffer.Construct(filePath);
+ *		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+ *
+ *		IJsonValue* pJson = JsonParser::ParseN(buffer);
+ *		// ...
+ *	}
+ * @endcode
+ */
+class MappedByteBuffer
+	: public Tizen::Base::ByteBuffer
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	MappedByteBuffer(void)
+		: __pMapAddress(null)
+		, __mapLength(0)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::ByteBuffer::~ByteBuffer(). @n
+	 * The file is unmapped.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~MappedByteBuffer(void)
+	{
+		if (__pMapAddress != null)
+		{
+			__mappedFile.Unmap(__pMapAddress, __mapLength);
+		}
+	}
+
+	/**
+	 * Initializes this instance of %MappedByteBuffer with the whole contents of the specified file.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filePath			The path of the file to map
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The file is empty or larger than @c 2 GB.
+	 * @exception	E_FILE_NOT_FOUND	The file does not exist.
+	 * @exception	E_ILLEGAL_ACCESS	The access to the file is denied.
+	 * @exception	E_MAX_EXCEEDED		The number of mapped regions has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				The file system does not support memory mapping, or an I/O error has occurred.
+	 * @remarks		The position of the buffer is @c 0, and its limit and capacity are the size of the file.
+	 */
+	result Construct(const Tizen::Base::String& filePath)
+	{
+		FileAttributes attributes;
+
+		result r = File::GetAttributes(filePath, attributes);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		long long fileSize = attributes.GetFileSize();
+		TryReturn(fileSize > 0 && fileSize <= MAX_LENGTH, E_INVALID_ARG,
+			"[%s] The size of the file(%lld) MUST be between 1 and %d.", GetErrorMessage(E_INVALID_ARG), fileSize, MAX_LENGTH);
+
+		return Construct(filePath, 0, static_cast< int >(fileSize));
+	}
+
+	/**
+	 * Initializes this instance of %MappedByteBuffer with the specified region of the specified file.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	filePath			The path of the file to map
+	 * @param[in]	offset				The offset of the region in the file @n
+	 *									It need not be a multiple of the page size.
+	 * @param[in]	length				The length of the region
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c offset is negative, or the specified @c length is not positive.
+	 * @exception	E_OUT_OF_RANGE		The region exceeds the end of the file.
+	 * @exception	E_FILE_NOT_FOUND	The file does not exist.
+	 * @exception	E_ILLEGAL_ACCESS	The access to the file is denied.
+	 * @exception	E_MAX_EXCEEDED		The number of mapped regions has exceeded the maximum limit.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_IO				The file system does not support memory mapping, or an I/O error has occurred.
+	 * @remarks		The position of the buffer is @c 0, and its limit and capacity are @c length. @n
+	 *				If the file is truncated while it is mapped, reading the part of the region beyond the new end causes a bus error.
+	 */
+	result Construct(const Tizen::Base::String& filePath, long long offset, int length)
+	{
+		TryReturn(__pMapAddress == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(offset >= 0 && length > 0, E_INVALID_ARG,
+			"[%s] The offset(%lld) MUST be greater than or equal to 0, and the length(%d) MUST be greater than 0.", GetErrorMessage(E_INVALID_ARG), offset, length);
+
+		// The pages beyond the end of the file cannot be read, so that the region must lie within the file
+		FileAttributes attributes;
+
+		result r = File::GetAttributes(filePath, attributes);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		long long fileSize = attributes.GetFileSize();
+		TryReturn(offset <= fileSize && length <= fileSize - offset, E_OUT_OF_RANGE,
+			"[%s] The region(offset %lld, length %d) exceeds the size of the file(%lld).", GetErrorMessage(E_OUT_OF_RANGE), offset, length, fileSize);
+
+		r = __file.Construct(filePath, "r");
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = __mappedFile.Construct(__file);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		// The mapping starts on a page boundary
+		long long pageSize = sysconf(_SC_PAGESIZE);
+		long long mapOffset = offset - offset % pageSize;
+		long long delta = offset - mapOffset;
+
+		// Writable but private, so that a write through ByteBuffer copies the page instead of faulting
+		void* pAddress = __mappedFile.Map(null, delta + length,
+			Tizen::Base::Runtime::MEMORY_PROTECTION_MODE_READ | Tizen::Base::Runtime::MEMORY_PROTECTION_MODE_WRITE, MEMORY_MAPPED_FILE_FLAG_PRIVATE, mapOffset);
+		r = GetLastResult();
+		TryReturn(pAddress != null, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		r = Tizen::Base::ByteBuffer::Construct(static_cast< const byte* >(pAddress) + static_cast< int >(delta), 0, length, length);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		__pMapAddress = pAddress;
+		__mapLength = delta + length;
+
+		return E_SUCCESS;
+
+CATCH:
+		__mappedFile.Unmap(pAddress, delta + length);
+		return r;
+	}
+
+private:
+	MappedByteBuffer(const MappedByteBuffer& rhs);
+	MappedByteBuffer& operator =(const MappedByteBuffer& rhs);
+
+	static const int MAX_LENGTH = 0x7FFFFFFF;
+
+	File __file;
+	MemoryMappedFile __mappedFile;
+	void* __pMapAddress;
+	long long __mapLength;
+
+}; // MappedByteBuffer
+
+}} // Tizen::Io
+
+#endif // _FIO_MAPPED_BYTE_BUFFER_H_
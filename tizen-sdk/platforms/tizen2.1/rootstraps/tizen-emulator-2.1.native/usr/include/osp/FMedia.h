@@ -58,6 +58,10 @@
 
 #include "FMediaImageUtil.h"
 
+#include "FMediaTiledImageUtil.h"
+
+#include "FMediaThumbnailDecoder.h"
+
 #include "FMediaIVideoStreamFilter.h"
 
 #include "FMediaMediaStreamInfo.h"
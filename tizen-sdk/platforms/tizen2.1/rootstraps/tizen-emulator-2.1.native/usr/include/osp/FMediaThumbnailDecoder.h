@@ -0,0 +1,792 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FMediaThumbnailDecoder.h
+ * @brief	This is the header file for the %ThumbnailDecoder and %ThumbnailBuffer classes.
+ *
+ * This header file contains the declarations of the %ThumbnailDecoder and %ThumbnailBuffer classes.
+ */
+
+#ifndef _FMEDIA_THUMBNAIL_DECODER_H_
+#define _FMEDIA_THUMBNAIL_DECODER_H_
+
+#include <string.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseString.h>
+#include <FBaseByteBuffer.h>
+#include <FBaseColIList.h>
+#include <FBaseColArrayList.h>
+#include <FBaseRtMutex.h>
+#include <FBaseRtMutexGuard.h>
+#include <FBaseRtThreadPool.h>
+#include <FGrpDimension.h>
+#include <FMediaImageTypes.h>
+#include <FMediaImageBuffer.h>
+#include <FMediaTiledImageUtil.h>
+
+
+namespace Tizen { namespace Media
+{
+
+//
+// @class	__ThumbnailBufferPool
+// @brief	This class keeps the freed pixel buffers of one size, so that the next thumbnails reuse them.
+// @since 2.1
+//
+// The pool is reference counted, because a ThumbnailBuffer can be deleted after its ThumbnailDecoder.
+//
+class __ThumbnailBufferPool
+{
+public:
+	__ThumbnailBufferPool(void)
+		: __ppBuffers(null)
+		, __count(0)
+		, __maxCount(0)
+		, __bufferSize(0)
+		, __refCount(1)
+	{
+	}
+
+	result Construct(int maxCount)
+	{
+		__ppBuffers = new (std::nothrow) byte*[maxCount];
+		TryReturn(__ppBuffers != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		__maxCount = maxCount;
+
+		return __mutex.Create();
+	}
+
+	void AddRef(void)
+	{
+		__sync_add_and_fetch(&__refCount, 1);
+	}
+
+	// Deletes this instance when the last reference is released
+	void Release(void)
+	{
+		if (__sync_sub_and_fetch(&__refCount, 1) == 0)
+		{
+			delete this;
+		}
+	}
+
+	// Takes a free buffer of the specified size, or allocates one. The free buffers of another size are deleted.
+	byte* AcquireN(int size)
+	{
+		{
+			Tizen::Base::Runtime::MutexGuard lock(__mutex);
+			if (size != __bufferSize)
+			{
+				RemoveAll();
+				__bufferSize = size;
+			}
+
+			if (__count > 0)
+			{
+				return __ppBuffers[--__count];
+			}
+		}
+
+		return new (std::nothrow) byte[size];
+	}
+
+	// Keeps the specified buffer for reuse if it has the current size and the pool is not full, or deletes it
+	void Recycle(byte* pBuffer, int size)
+	{
+		{
+			Tizen::Base::Runtime::MutexGuard lock(__mutex);
+			if (size == __bufferSize && __count < __maxCount)
+			{
+				__ppBuffers[__count++] = pBuffer;
+				return;
+			}
+		}
+
+		delete[] pBuffer;
+	}
+
+	void RemoveAllBuffers(void)
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+		RemoveAll();
+	}
+
+	int GetBufferCount(void)
+	{
+		Tizen::Base::Runtime::MutexGuard lock(__mutex);
+		return __count;
+	}
+
+private:
+	__ThumbnailBufferPool(const __ThumbnailBufferPool& rhs);
+	__ThumbnailBufferPool& operator =(const __ThumbnailBufferPool& rhs);
+
+	~__ThumbnailBufferPool(void)
+	{
+		RemoveAll();
+		delete[] __ppBuffers;
+	}
+
+	void RemoveAll(void)
+	{
+		for (int i = 0; i < __count; i++)
+		{
+			delete[] __ppBuffers[i];
+		}
+		__count = 0;
+	}
+
+	byte** __ppBuffers;
+	int __count;
+	int __maxCount;
+	int __bufferSize;
+	volatile int __refCount;
+	Tizen::Base::Runtime::Mutex __mutex;
+
+}; // __ThumbnailBufferPool
+
+class __ThumbnailDecoderKernel;
+
+/**
+ * @class	ThumbnailBuffer
+ * @brief	This class holds the pixels of a thumbnail which ThumbnailDecoder has decoded.
+ *
+ * @since	2.1
+ *
+ * The %ThumbnailBuffer class holds the pixels of a thumbnail in the @c MEDIA_PIXEL_FORMAT_BGRA8888 pixel format,
+ * or the error which has occurred while the image has been decoded.
+ * When an instance is deleted, its pixel buffer is returned to the ThumbnailDecoder which has created it, for the next thumbnails.
+ */
+class ThumbnailBuffer
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object().
+	 *
+	 * @since	2.1
+	 */
+	virtual ~ThumbnailBuffer(void)
+	{
+		if (__pBuffer != null)
+		{
+			__pPool->Recycle(__pBuffer, GetLength());
+		}
+		__pPool->Release();
+	}
+
+	/**
+	 * Gets the result of the decoding of the image.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @exception	E_SUCCESS			The image has been decoded.
+	 * @exception	E_FILE_NOT_FOUND	The file cannot be found or accessed.
+	 * @exception	E_UNSUPPORTED_FORMAT	The format of the image is not supported.
+	 * @exception	E_INVALID_DATA		The image is corrupted.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result GetResult(void) const
+	{
+		return __result;
+	}
+
+	/**
+	 * Gets the pixels of the thumbnail.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the pixels, whose rows are tightly packed, @n
+	 *				else @c null if the image has not been decoded
+	 */
+	const byte* GetPointer(void) const
+	{
+		return __pBuffer;
+	}
+
+	/**
+	 * Gets the width of the thumbnail.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The width of the thumbnail, which is the requested width
+	 */
+	int GetWidth(void) const
+	{
+		return __width;
+	}
+
+	/**
+	 * Gets the height of the thumbnail.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The height of the thumbnail, which is the requested height
+	 */
+	int GetHeight(void) const
+	{
+		return __height;
+	}
+
+	/**
+	 * Gets the number of bytes of the pixels.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of bytes of the pixels
+	 */
+	int GetLength(void) const
+	{
+		return __width * __height * 4;
+	}
+
+	/**
+	 * Gets the pixel format of the thumbnail.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		@c MEDIA_PIXEL_FORMAT_BGRA8888
+	 */
+	MediaPixelFormat GetPixelFormat(void) const
+	{
+		return MEDIA_PIXEL_FORMAT_BGRA8888;
+	}
+
+private:
+	ThumbnailBuffer(__ThumbnailBufferPool& pool, int width, int height)
+		: __pPool(&pool)
+		, __pBuffer(null)
+		, __width(width)
+		, __height(height)
+		, __result(E_SUCCESS)
+	{
+		__pPool->AddRef();
+	}
+
+	ThumbnailBuffer(const ThumbnailBuffer& rhs);
+	ThumbnailBuffer& operator =(const ThumbnailBuffer& rhs);
+
+	__ThumbnailBufferPool* __pPool;
+	byte* __pBuffer;
+	int __width;
+	int __height;
+	result __result;
+
+	friend class ThumbnailDecoder;
+	friend class __ThumbnailDecoderKernel;
+
+}; // ThumbnailBuffer
+
+//
+// @class	__ThumbnailDecoderKernel
+// @brief	This class decodes a batch of thumbnails, one image per row.
+// @since 2.1
+//
+class __ThumbnailDecoderKernel
+	: public __TiledImageKernel
+{
+public:
+	__ThumbnailDecoderKernel(const Tizen::Base::String* pPaths, ThumbnailBuffer** ppThumbnails, __ThumbnailBufferPool& pool, TiledImageUtil& imageUtil)
+		: __pPaths(pPaths)
+		, __ppThumbnails(ppThumbnails)
+		, __pPool(&pool)
+		, __pImageUtil(&imageUtil)
+	{
+	}
+
+	virtual bool Process(int top, int bottom, unsigned char*)
+	{
+		for (int i = top; i < bottom; i++)
+		{
+			ThumbnailBuffer& thumbnail = *__ppThumbnails[i];
+			thumbnail.__result = Decode(__pPaths[i], thumbnail);
+			if (thumbnail.__result != E_SUCCESS)
+			{
+				AppLogException("[%s] Failed to decode the thumbnail of %ls.", GetErrorMessage(thumbnail.__result), __pPaths[i].GetPointer());
+			}
+		}
+
+		// The errors are kept by each thumbnail, so that the other thumbnails of the batch are still returned
+		return true;
+	}
+
+	// Returns the largest JPEG scaling denominator, so that the decoded image still covers the thumbnail in either orientation
+	static int GetScaleDenominator(ImageFormat format, int width, int height, int thumbnailWidth, int thumbnailHeight)
+	{
+		if (format != IMG_FORMAT_JPG)
+		{
+			return 1;
+		}
+
+		int shortSide = (width < height) ? width : height;
+		int longSide = (thumbnailWidth > thumbnailHeight) ? thumbnailWidth : thumbnailHeight;
+		int denominator = MAX_SCALE_DENOMINATOR;
+		while (denominator > 1 && shortSide / denominator < longSide)
+		{
+			denominator /= 2;
+		}
+
+		return denominator;
+	}
+
+private:
+	__ThumbnailDecoderKernel(const __ThumbnailDecoderKernel& rhs);
+	__ThumbnailDecoderKernel& operator =(const __ThumbnailDecoderKernel& rhs);
+
+	// Decodes the image at a reduced size, crops the center which has the aspect ratio of the thumbnail, and scales it into a pooled buffer
+	result Decode(const Tizen::Base::String& path, ThumbnailBuffer& thumbnail)
+	{
+		ImageFormat format = IMG_FORMAT_NONE;
+		int width = 0;
+		int height = 0;
+		result r = ImageBuffer::GetImageInfo(path, format, width, height);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		TryReturn(width > 0 && height > 0, E_INVALID_DATA, "[%s] The size(%d, %d) of the image is invalid.", GetErrorMessage(E_INVALID_DATA), width, height);
+
+		// The JPEG decoder scales by 1/2, 1/4, or 1/8 while decoding, which only the exact scaled size selects
+		int denominator = GetScaleDenominator(format, width, height, thumbnail.__width, thumbnail.__height);
+		ImageBuffer image;
+		r = image.Construct(path, (width + denominator - 1) / denominator, (height + denominator - 1) / denominator, IMAGE_SCALING_METHOD_FAST_BILINEAR);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		ExifOrientation orientation = image.GetExifOrientation();
+		bool isTransposed = (orientation >= EXIF_ORIENTATION_LEFT_TOP && orientation <= EXIF_ORIENTATION_LEFT_BOTTOM);
+		int decodedWidth = image.GetWidth();
+		int decodedHeight = image.GetHeight();
+		int scaledWidth = isTransposed ? thumbnail.__height : thumbnail.__width;
+		int scaledHeight = isTransposed ? thumbnail.__width : thumbnail.__height;
+
+		Tizen::Base::ByteBuffer* pPixels = image.GetByteBufferN(MEDIA_PIXEL_FORMAT_BGRA8888);
+		TryReturn(pPixels != null, GetLastResult(), "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+
+		byte* pOut = null;
+		byte* pScaled = null;
+		int cropWidth = decodedWidth;
+		int cropHeight = decodedHeight;
+		int cropX = 0;
+		int cropY = 0;
+		byte* pCrop = pPixels->GetPointer();
+
+		if (static_cast< long long >(decodedWidth) * scaledHeight > static_cast< long long >(decodedHeight) * scaledWidth)
+		{
+			cropWidth = static_cast< int >(static_cast< long long >(decodedHeight) * scaledWidth / scaledHeight);
+			cropWidth = (cropWidth > 0) ? cropWidth : 1;
+			cropX = (decodedWidth - cropWidth) / 2;
+		}
+		else
+		{
+			cropHeight = static_cast< int >(static_cast< long long >(decodedWidth) * scaledHeight / scaledWidth);
+			cropHeight = (cropHeight > 0) ? cropHeight : 1;
+			cropY = (decodedHeight - cropHeight) / 2;
+		}
+
+		// The rows of the crop are packed in place, because they only move toward the start of the pixels
+		for (int y = 0; y < cropHeight; y++)
+		{
+			memmove(pCrop + static_cast< long >(y) * cropWidth * 4, pCrop + (static_cast< long >(cropY + y) * decodedWidth + cropX) * 4, cropWidth * 4);
+		}
+
+		pOut = __pPool->AcquireN(thumbnail.GetLength());
+		TryCatch(pOut != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		if (isTransposed)
+		{
+			pScaled = __pPool->AcquireN(thumbnail.GetLength());
+			TryCatch(pScaled != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+		}
+
+		r = __pImageUtil->Resize(pCrop, Tizen::Graphics::Dimension(cropWidth, cropHeight), isTransposed ? pScaled : pOut,
+			Tizen::Graphics::Dimension(scaledWidth, scaledHeight), MEDIA_PIXEL_FORMAT_BGRA8888, IMAGE_SCALING_METHOD_BILINEAR);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		r = Orient(pScaled, pOut, scaledWidth, scaledHeight, orientation);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		if (pScaled != null)
+		{
+			__pPool->Recycle(pScaled, thumbnail.GetLength());
+		}
+		delete pPixels;
+
+		thumbnail.__pBuffer = pOut;
+
+		return E_SUCCESS;
+
+CATCH:
+		if (pOut != null)
+		{
+			__pPool->Recycle(pOut, thumbnail.GetLength());
+		}
+		if (pScaled != null)
+		{
+			__pPool->Recycle(pScaled, thumbnail.GetLength());
+		}
+		delete pPixels;
+
+		return r;
+	}
+
+	// Turns the scaled image upright. The image is in pOut unless the orientation exchanges the rows and the columns.
+	result Orient(const byte* pScaled, byte* pOut, int width, int height, ExifOrientation orientation)
+	{
+		Tizen::Graphics::Dimension dim(width, height);
+		Tizen::Graphics::Dimension rotatedDim(height, width);
+
+		switch (orientation)
+		{
+		case EXIF_ORIENTATION_TOP_RIGHT:
+			return __pImageUtil->Flip(pOut, pOut, dim, IMAGE_FLIP_HORIZONTAL, MEDIA_PIXEL_FORMAT_BGRA8888);
+
+		case EXIF_ORIENTATION_BOTTOM_RIGHT:
+			return __pImageUtil->Rotate(pOut, pOut, dim, IMAGE_ROTATION_180, MEDIA_PIXEL_FORMAT_BGRA8888);
+
+		case EXIF_ORIENTATION_BOTTOM_LEFT:
+			return __pImageUtil->Flip(pOut, pOut, dim, IMAGE_FLIP_VERTICAL, MEDIA_PIXEL_FORMAT_BGRA8888);
+
+		case EXIF_ORIENTATION_LEFT_TOP:
+			{
+				// The transpose is the rotation by 90 degrees followed by the horizontal flip
+				result r = __pImageUtil->Rotate(pScaled, pOut, dim, IMAGE_ROTATION_90, MEDIA_PIXEL_FORMAT_BGRA8888);
+				TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+				return __pImageUtil->Flip(pOut, pOut, rotatedDim, IMAGE_FLIP_HORIZONTAL, MEDIA_PIXEL_FORMAT_BGRA8888);
+			}
+
+		case EXIF_ORIENTATION_RIGHT_TOP:
+			return __pImageUtil->Rotate(pScaled, pOut, dim, IMAGE_ROTATION_90, MEDIA_PIXEL_FORMAT_BGRA8888);
+
+		case EXIF_ORIENTATION_RIGHT_BOTTOM:
+			{
+				// The transverse is the rotation by 270 degrees followed by the horizontal flip
+				result r = __pImageUtil->Rotate(pScaled, pOut, dim, IMAGE_ROTATION_270, MEDIA_PIXEL_FORMAT_BGRA8888);
+				TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+				return __pImageUtil->Flip(pOut, pOut, rotatedDim, IMAGE_FLIP_HORIZONTAL, MEDIA_PIXEL_FORMAT_BGRA8888);
+			}
+
+		case EXIF_ORIENTATION_LEFT_BOTTOM:
+			return __pImageUtil->Rotate(pScaled, pOut, dim, IMAGE_ROTATION_270, MEDIA_PIXEL_FORMAT_BGRA8888);
+
+		default:
+			return E_SUCCESS;
+		}
+	}
+
+	static const int MAX_SCALE_DENOMINATOR = 8;
+
+	const Tizen::Base::String* __pPaths;
+	ThumbnailBuffer** __ppThumbnails;
+	__ThumbnailBufferPool* __pPool;
+	TiledImageUtil* __pImageUtil;
+
+}; // __ThumbnailDecoderKernel
+
+/**
+ * @class	ThumbnailDecoder
+ * @brief	This class decodes the thumbnails of a batch of images on the workers of a thread pool.
+ *
+ * @since	2.1
+ *
+ * The %ThumbnailDecoder class decodes the thumbnails of a list of image files, such as the visible cells of a gallery.
+ * The images are decoded in parallel by the calling thread and the workers of a ThreadPool. @n
+ * A JPEG image is decoded at 1/2, 1/4, or 1/8 of its size when the thumbnail allows it, so that the decoder skips most of the work
+ * and a large photo does not need a full-size buffer.
+ * The center of the image which has the aspect ratio of the thumbnail is then scaled with area averaging,
+ * and turned upright according to its Exif orientation. @n
+ * The pixel buffers of the thumbnails are returned to the decoder when the ThumbnailBuffer instances are deleted,
+ * and are reused for the next thumbnails of the same size.
+ *
+ * The following example demonstrates how to use the %ThumbnailDecoder class.
+ *
+ * @code
+ *	void
+ *	MyGalleryForm::LoadThumbnails(const Tizen::Base::Collection::IList& paths)
+ *	{
+ *		// __thumbnailDecoder.Construct() is called when the form is initialized
+ *		Tizen::Base::Collection::IList* pThumbnails = __thumbnailDecoder.DecodeThumbnailsN(paths, Dimension(96, 96));
+ *		TryReturnVoid(pThumbnails != null, "[%s] Propagating.", GetErrorMessage(GetLastResult()));
+ *
+ *		for (int i = 0; i < pThumbnails->GetCount(); i++)
+ *		{
+ *			const ThumbnailBuffer* pThumbnail = static_cast< const ThumbnailBuffer* >(pThumbnails->GetAt(i));
+ *			if (pThumbnail->GetResult() == E_SUCCESS)
+ *			{
+ *				UpdateCell(i, pThumbnail->GetPointer());
+ *			}
+ *		}
+ *
+ *		// The pixel buffers are kept by the decoder for the next thumbnails
+ *		delete pThumbnails;
+ *	}
+ * @endcode
+ */
+class ThumbnailDecoder
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	ThumbnailDecoder(void)
+		: __pPool(null)
+		, __pOwnedPool(null)
+		, __pBufferPool(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The thread pool is shut down if this instance has created it.
+	 *
+	 * @since	2.1
+	 *
+	 * @remarks		The ThumbnailBuffer instances which have been returned remain valid.
+	 */
+	virtual ~ThumbnailDecoder(void)
+	{
+		if (__pBufferPool != null)
+		{
+			__pBufferPool->Release();
+		}
+		delete __pOwnedPool;
+	}
+
+	/**
+	 * Initializes this instance of %ThumbnailDecoder with a new thread pool.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	workerCount			The number of worker threads @n
+	 *									If it is @c 0, the number of online processors is used.
+	 * @param[in]	maxBufferCount		The maximum number of the free pixel buffers which are kept for reuse
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c workerCount is negative or greater than @c 64, or the specified @c maxBufferCount is negative.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(int workerCount = 0, int maxBufferCount = DEFAULT_MAX_BUFFER_COUNT)
+	{
+		TryReturn(__pPool == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(maxBufferCount >= 0, E_INVALID_ARG, "[%s] The maxBufferCount(%d) MUST be 0 or greater.", GetErrorMessage(E_INVALID_ARG), maxBufferCount);
+
+		Tizen::Base::Runtime::ThreadPool* pPool = new (std::nothrow) Tizen::Base::Runtime::ThreadPool();
+		TryReturn(pPool != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pPool->Construct(workerCount);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		r = Construct(*pPool, maxBufferCount);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		__pOwnedPool = pPool;
+
+		return E_SUCCESS;
+
+CATCH:
+		delete pPool;
+
+		return r;
+	}
+
+	/**
+	 * Initializes this instance of %ThumbnailDecoder with the specified thread pool, which is shared with other work.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pool				The constructed thread pool @n
+	 *									It must be valid until this instance is deleted.
+	 * @param[in]	maxBufferCount		The maximum number of the free pixel buffers which are kept for reuse
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pool has not been constructed, or the specified @c maxBufferCount is negative.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(Tizen::Base::Runtime::ThreadPool& pool, int maxBufferCount = DEFAULT_MAX_BUFFER_COUNT)
+	{
+		TryReturn(__pPool == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(maxBufferCount >= 0, E_INVALID_ARG, "[%s] The maxBufferCount(%d) MUST be 0 or greater.", GetErrorMessage(E_INVALID_ARG), maxBufferCount);
+
+		TryReturn(pool.GetWorkerCount() > 0, E_INVALID_ARG, "[%s] The pool has not been constructed.", GetErrorMessage(E_INVALID_ARG));
+
+		__ThumbnailBufferPool* pBufferPool = new (std::nothrow) __ThumbnailBufferPool();
+		TryReturn(pBufferPool != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pBufferPool->Construct(maxBufferCount);
+		if (r == E_SUCCESS)
+		{
+			r = __imageUtil.Construct(pool);
+		}
+
+		if (r != E_SUCCESS)
+		{
+			pBufferPool->Release();
+		}
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pPool = &pool;
+		__pBufferPool = pBufferPool;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Decodes the thumbnails of the specified image files.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		A pointer to the list of the ThumbnailBuffer instances, in the order of the paths, @n
+	 *				else @c null if an exception occurs
+	 * @param[in]	paths				The list of the Tizen::Base::String instances of the image paths
+	 * @param[in]	dim					The width and height of the thumbnails
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		The width or height of the specified @c dim is less than @c 1 or greater than @c 4096.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 * @remarks
+	 *				- The specific error code can be accessed using the GetLastResult() method.
+	 *				- The list owns its elements, which are deleted with it. @n
+	 *				An image which cannot be decoded does not fail the method. Instead, its ThumbnailBuffer::GetResult() returns the error.
+	 *				- The thumbnails fill the specified size, and the image is cropped equally on both sides of the longer dimension.
+	 *				- This method returns when all the thumbnails are decoded. It can be called on a worker thread to keep the UI responsive,
+	 *				and it can be called on several threads at the same time.
+	 */
+	Tizen::Base::Collection::IList* DecodeThumbnailsN(const Tizen::Base::Collection::IList& paths, const Tizen::Graphics::Dimension& dim)
+	{
+		TryReturnResult(__pPool != null, null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturnResult(dim.width >= 1 && dim.height >= 1 && dim.width <= MAX_THUMBNAIL_SIZE && dim.height <= MAX_THUMBNAIL_SIZE, null, E_INVALID_ARG,
+			"[%s] The dim(%d, %d) is invalid.", GetErrorMessage(E_INVALID_ARG), dim.width, dim.height);
+
+		int count = paths.GetCount();
+		result r = E_SUCCESS;
+		Tizen::Base::String* pPaths = null;
+		ThumbnailBuffer** ppThumbnails = null;
+
+		Tizen::Base::Collection::ArrayList* pList = new (std::nothrow) Tizen::Base::Collection::ArrayList(Tizen::Base::Collection::SingleObjectDeleter);
+		TryReturnResult(pList != null, null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		r = pList->Construct(count);
+		TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+		if (count > 0)
+		{
+			// The paths are copied, so that the workers do not share the strings of the caller
+			pPaths = new (std::nothrow) Tizen::Base::String[count];
+			ppThumbnails = new (std::nothrow) ThumbnailBuffer*[count];
+			TryCatch(pPaths != null && ppThumbnails != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			for (int i = 0; i < count; i++)
+			{
+				const Tizen::Base::String* pPath = dynamic_cast< const Tizen::Base::String* >(paths.GetAt(i));
+				if (pPath != null)
+				{
+					pPaths[i] = *pPath;
+				}
+
+				ppThumbnails[i] = new (std::nothrow) ThumbnailBuffer(*__pBufferPool, dim.width, dim.height);
+				TryCatch(ppThumbnails[i] != null, r = E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+				// The list owns the thumbnail from now on
+				r = pList->Add(ppThumbnails[i]);
+				if (r != E_SUCCESS)
+				{
+					delete ppThumbnails[i];
+				}
+				TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+			}
+
+			// Each image is a strip, which the calling thread and the workers take in turn
+			{
+				__ThumbnailDecoderKernel kernel(pPaths, ppThumbnails, *__pBufferPool, __imageUtil);
+				int workerCount = __pPool->GetWorkerCount();
+				r = __TiledImageJob::Execute(*__pPool, kernel, count, 1, (count - 1 < workerCount) ? count - 1 : workerCount);
+			}
+			TryCatch(r == E_SUCCESS, , "[%s] Propagating.", GetErrorMessage(r));
+
+			delete[] pPaths;
+			delete[] ppThumbnails;
+		}
+
+		SetLastResult(E_SUCCESS);
+
+		return pList;
+
+CATCH:
+		delete[] pPaths;
+		delete[] ppThumbnails;
+		delete pList;
+
+		SetLastResult(r);
+
+		return null;
+	}
+
+	/**
+	 * Gets the number of the free pixel buffers which are kept for reuse.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of the free pixel buffers
+	 */
+	int GetFreeBufferCount(void) const
+	{
+		return (__pBufferPool != null) ? __pBufferPool->GetBufferCount() : 0;
+	}
+
+	/**
+	 * Deletes the free pixel buffers, for example when the gallery is hidden or the memory is low.
+	 *
+	 * @since	2.1
+	 */
+	void RemoveFreeBuffers(void)
+	{
+		if (__pBufferPool != null)
+		{
+			__pBufferPool->RemoveAllBuffers();
+		}
+	}
+
+private:
+	ThumbnailDecoder(const ThumbnailDecoder& rhs);
+	ThumbnailDecoder& operator =(const ThumbnailDecoder& rhs);
+
+	static const int DEFAULT_MAX_BUFFER_COUNT = 64;
+	static const int MAX_THUMBNAIL_SIZE = 4096;
+
+	Tizen::Base::Runtime::ThreadPool* __pPool;
+	Tizen::Base::Runtime::ThreadPool* __pOwnedPool;
+	__ThumbnailBufferPool* __pBufferPool;
+	TiledImageUtil __imageUtil;
+
+}; // ThumbnailDecoder
+
+}} // Tizen::Media
+
+#endif // _FMEDIA_THUMBNAIL_DECODER_H_
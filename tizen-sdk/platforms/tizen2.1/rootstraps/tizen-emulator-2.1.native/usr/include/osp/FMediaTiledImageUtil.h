@@ -0,0 +1,1764 @@
+//
+// Copyright (c) 2012 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+/**
+ * @file	FMediaTiledImageUtil.h
+ * @brief	This is the header file for the %TiledImageUtil class.
+ *
+ * This header file contains the declarations of the %TiledImageUtil class.
+ */
+
+#ifndef _FMEDIA_TILED_IMAGE_UTIL_H_
+#define _FMEDIA_TILED_IMAGE_UTIL_H_
+
+#include <string.h>
+#include <new>
+#include <FBaseObject.h>
+#include <FBaseResult.h>
+#include <FBaseLog.h>
+#include <FBaseDataType.h>
+#include <FBaseRtMonitor.h>
+#include <FBaseRtThreadPool.h>
+#include <FGrpDimension.h>
+#include <FMediaImageTypes.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define _FMEDIA_TILED_IMAGE_UTIL_AVX2_
+#define _FMEDIA_TILED_IMAGE_UTIL_SSE2_
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define _FMEDIA_TILED_IMAGE_UTIL_SSE2_
+#endif
+
+
+namespace Tizen { namespace Media
+{
+
+//
+// @struct	__TiledImageSpan
+// @brief	This struct contains the kernels which convert and filter a row of pixels.
+// @since 2.1
+//
+// The kernels use AVX2 or SSE2, depending on the target of the compilation, and scalar code for the remaining pixels.
+// The scalar and the vector code compute the same values, with the same fixed-point arithmetic.
+//
+struct __TiledImageSpan
+{
+	// Converts a row of YUV420 to BGRA8888 or RGB565LE with the BT.601 video range coefficients in 6-bit fixed point.
+	// The chroma samples are pChromaStep bytes apart, which is 2 for the interleaved chroma of NV12 and NV21.
+	static void ConvertYuvRow(const unsigned char* pY, const unsigned char* pU, const unsigned char* pV, int chromaStep,
+		unsigned char* pDestination, int width, bool isRgb565)
+	{
+		int x = 0;
+
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_AVX2_)
+		{
+			const unsigned char* pChroma = (pU < pV) ? pU : pV;
+			__m256i zero = _mm256_setzero_si256();
+			__m256i mask = _mm256_set1_epi16(0x00FF);
+
+			for (; x + 32 <= width; x += 32)
+			{
+				__m256i u;
+				__m256i v;
+				if (chromaStep == 1)
+				{
+					u = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pU + x / 2)));
+					v = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pV + x / 2)));
+				}
+				else
+				{
+					__m256i chroma = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(pChroma + x));
+					__m256i first = _mm256_and_si256(chroma, mask);
+					__m256i second = _mm256_srli_epi16(chroma, 8);
+					u = (pU < pV) ? first : second;
+					v = (pU < pV) ? second : first;
+				}
+
+				__m256i red;
+				__m256i green;
+				__m256i blue;
+				{
+					__m256i d = _mm256_sub_epi16(u, _mm256_set1_epi16(128));
+					__m256i e = _mm256_sub_epi16(v, _mm256_set1_epi16(128));
+					__m256i rounding = _mm256_set1_epi16(32);
+
+					// The chroma terms are reordered, so that each one is repeated for two neighboring pixels in order
+					__m256i redTerm = _mm256_permute4x64_epi64(_mm256_add_epi16(_mm256_mullo_epi16(e, _mm256_set1_epi16(102)), rounding), 0xD8);
+					__m256i greenTerm = _mm256_permute4x64_epi64(_mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(d, _mm256_set1_epi16(-25)),
+						_mm256_mullo_epi16(e, _mm256_set1_epi16(-52))), rounding), 0xD8);
+					__m256i blueTerm = _mm256_permute4x64_epi64(_mm256_add_epi16(_mm256_mullo_epi16(d, _mm256_set1_epi16(129)), rounding), 0xD8);
+
+					__m256i luma0 = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pY + x))),
+						_mm256_set1_epi16(16)), _mm256_set1_epi16(74));
+					__m256i luma1 = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pY + x + 16))),
+						_mm256_set1_epi16(16)), _mm256_set1_epi16(74));
+
+					red = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+						_mm256_srai_epi16(_mm256_adds_epi16(luma0, _mm256_unpacklo_epi16(redTerm, redTerm)), 6),
+						_mm256_srai_epi16(_mm256_adds_epi16(luma1, _mm256_unpackhi_epi16(redTerm, redTerm)), 6)), 0xD8);
+					green = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+						_mm256_srai_epi16(_mm256_adds_epi16(luma0, _mm256_unpacklo_epi16(greenTerm, greenTerm)), 6),
+						_mm256_srai_epi16(_mm256_adds_epi16(luma1, _mm256_unpackhi_epi16(greenTerm, greenTerm)), 6)), 0xD8);
+					blue = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+						_mm256_srai_epi16(_mm256_adds_epi16(luma0, _mm256_unpacklo_epi16(blueTerm, blueTerm)), 6),
+						_mm256_srai_epi16(_mm256_adds_epi16(luma1, _mm256_unpackhi_epi16(blueTerm, blueTerm)), 6)), 0xD8);
+				}
+
+				// The unpacking works in 128-bit lanes, so that the lanes are exchanged before the stores
+				if (isRgb565)
+				{
+					__m256i low = Pack565(_mm256_unpacklo_epi8(red, zero), _mm256_unpacklo_epi8(green, zero), _mm256_unpacklo_epi8(blue, zero));
+					__m256i high = Pack565(_mm256_unpackhi_epi8(red, zero), _mm256_unpackhi_epi8(green, zero), _mm256_unpackhi_epi8(blue, zero));
+					__m256i* pOut = reinterpret_cast< __m256i* >(pDestination + x * 2);
+					_mm256_storeu_si256(pOut, _mm256_permute2x128_si256(low, high, 0x20));
+					_mm256_storeu_si256(pOut + 1, _mm256_permute2x128_si256(low, high, 0x31));
+				}
+				else
+				{
+					__m256i alpha = _mm256_set1_epi8(-1);
+					__m256i blueGreenLow = _mm256_unpacklo_epi8(blue, green);
+					__m256i blueGreenHigh = _mm256_unpackhi_epi8(blue, green);
+					__m256i redAlphaLow = _mm256_unpacklo_epi8(red, alpha);
+					__m256i redAlphaHigh = _mm256_unpackhi_epi8(red, alpha);
+					__m256i pixels0 = _mm256_unpacklo_epi16(blueGreenLow, redAlphaLow);
+					__m256i pixels1 = _mm256_unpackhi_epi16(blueGreenLow, redAlphaLow);
+					__m256i pixels2 = _mm256_unpacklo_epi16(blueGreenHigh, redAlphaHigh);
+					__m256i pixels3 = _mm256_unpackhi_epi16(blueGreenHigh, redAlphaHigh);
+					__m256i* pOut = reinterpret_cast< __m256i* >(pDestination + x * 4);
+					_mm256_storeu_si256(pOut, _mm256_permute2x128_si256(pixels0, pixels1, 0x20));
+					_mm256_storeu_si256(pOut + 1, _mm256_permute2x128_si256(pixels2, pixels3, 0x20));
+					_mm256_storeu_si256(pOut + 2, _mm256_permute2x128_si256(pixels0, pixels1, 0x31));
+					_mm256_storeu_si256(pOut + 3, _mm256_permute2x128_si256(pixels2, pixels3, 0x31));
+				}
+			}
+		}
+#endif
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_SSE2_)
+		{
+			const unsigned char* pChroma = (pU < pV) ? pU : pV;
+			__m128i zero = _mm_setzero_si128();
+			__m128i mask = _mm_set1_epi16(0x00FF);
+
+			for (; x + 16 <= width; x += 16)
+			{
+				__m128i u;
+				__m128i v;
+				if (chromaStep == 1)
+				{
+					u = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast< const __m128i* >(pU + x / 2)), zero);
+					v = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast< const __m128i* >(pV + x / 2)), zero);
+				}
+				else
+				{
+					__m128i chroma = _mm_loadu_si128(reinterpret_cast< const __m128i* >(pChroma + x));
+					__m128i first = _mm_and_si128(chroma, mask);
+					__m128i second = _mm_srli_epi16(chroma, 8);
+					u = (pU < pV) ? first : second;
+					v = (pU < pV) ? second : first;
+				}
+
+				__m128i d = _mm_sub_epi16(u, _mm_set1_epi16(128));
+				__m128i e = _mm_sub_epi16(v, _mm_set1_epi16(128));
+				__m128i rounding = _mm_set1_epi16(32);
+				__m128i redTerm = _mm_add_epi16(_mm_mullo_epi16(e, _mm_set1_epi16(102)), rounding);
+				__m128i greenTerm = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(d, _mm_set1_epi16(-25)), _mm_mullo_epi16(e, _mm_set1_epi16(-52))), rounding);
+				__m128i blueTerm = _mm_add_epi16(_mm_mullo_epi16(d, _mm_set1_epi16(129)), rounding);
+
+				__m128i luma = _mm_loadu_si128(reinterpret_cast< const __m128i* >(pY + x));
+				__m128i luma0 = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(luma, zero), _mm_set1_epi16(16)), _mm_set1_epi16(74));
+				__m128i luma1 = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(luma, zero), _mm_set1_epi16(16)), _mm_set1_epi16(74));
+
+				__m128i red = _mm_packus_epi16(_mm_srai_epi16(_mm_adds_epi16(luma0, _mm_unpacklo_epi16(redTerm, redTerm)), 6),
+					_mm_srai_epi16(_mm_adds_epi16(luma1, _mm_unpackhi_epi16(redTerm, redTerm)), 6));
+				__m128i green = _mm_packus_epi16(_mm_srai_epi16(_mm_adds_epi16(luma0, _mm_unpacklo_epi16(greenTerm, greenTerm)), 6),
+					_mm_srai_epi16(_mm_adds_epi16(luma1, _mm_unpackhi_epi16(greenTerm, greenTerm)), 6));
+				__m128i blue = _mm_packus_epi16(_mm_srai_epi16(_mm_adds_epi16(luma0, _mm_unpacklo_epi16(blueTerm, blueTerm)), 6),
+					_mm_srai_epi16(_mm_adds_epi16(luma1, _mm_unpackhi_epi16(blueTerm, blueTerm)), 6));
+
+				if (isRgb565)
+				{
+					__m128i* pOut = reinterpret_cast< __m128i* >(pDestination + x * 2);
+					_mm_storeu_si128(pOut, Pack565(_mm_unpacklo_epi8(red, zero), _mm_unpacklo_epi8(green, zero), _mm_unpacklo_epi8(blue, zero)));
+					_mm_storeu_si128(pOut + 1, Pack565(_mm_unpackhi_epi8(red, zero), _mm_unpackhi_epi8(green, zero), _mm_unpackhi_epi8(blue, zero)));
+				}
+				else
+				{
+					__m128i alpha = _mm_set1_epi8(-1);
+					__m128i blueGreenLow = _mm_unpacklo_epi8(blue, green);
+					__m128i blueGreenHigh = _mm_unpackhi_epi8(blue, green);
+					__m128i redAlphaLow = _mm_unpacklo_epi8(red, alpha);
+					__m128i redAlphaHigh = _mm_unpackhi_epi8(red, alpha);
+					__m128i* pOut = reinterpret_cast< __m128i* >(pDestination + x * 4);
+					_mm_storeu_si128(pOut, _mm_unpacklo_epi16(blueGreenLow, redAlphaLow));
+					_mm_storeu_si128(pOut + 1, _mm_unpackhi_epi16(blueGreenLow, redAlphaLow));
+					_mm_storeu_si128(pOut + 2, _mm_unpacklo_epi16(blueGreenHigh, redAlphaHigh));
+					_mm_storeu_si128(pOut + 3, _mm_unpackhi_epi16(blueGreenHigh, redAlphaHigh));
+				}
+			}
+		}
+#endif
+
+		for (; x < width; x++)
+		{
+			int offset = (x / 2) * chromaStep;
+			int luma = (pY[x] - 16) * 74;
+			int d = pU[offset] - 128;
+			int e = pV[offset] - 128;
+			int red = Clamp((luma + 102 * e + 32) >> 6);
+			int green = Clamp((luma - 25 * d - 52 * e + 32) >> 6);
+			int blue = Clamp((luma + 129 * d + 32) >> 6);
+
+			if (isRgb565)
+			{
+				unsigned short pixel = static_cast< unsigned short >(((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3));
+				pDestination[x * 2] = static_cast< unsigned char >(pixel);
+				pDestination[x * 2 + 1] = static_cast< unsigned char >(pixel >> 8);
+			}
+			else
+			{
+				pDestination[x * 4] = static_cast< unsigned char >(blue);
+				pDestination[x * 4 + 1] = static_cast< unsigned char >(green);
+				pDestination[x * 4 + 2] = static_cast< unsigned char >(red);
+				pDestination[x * 4 + 3] = 0xFF;
+			}
+		}
+	}
+
+	// Computes the luma of a row of BGRA8888 with the BT.601 video range coefficients in 8-bit fixed point
+	static void ConvertBgraToLumaRow(const unsigned char* pSource, unsigned char* pY, int width)
+	{
+		int x = 0;
+
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_SSE2_)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i coefficients = _mm_set_epi16(0, 66, 129, 25, 0, 66, 129, 25);
+			__m128i rounding = _mm_set1_epi32(128);
+			__m128i offset = _mm_set1_epi16(16);
+
+			for (; x + 16 <= width; x += 16)
+			{
+				const __m128i* pIn = reinterpret_cast< const __m128i* >(pSource + x * 4);
+				__m128i luma0 = _mm_srai_epi32(_mm_add_epi32(GetLuma4(_mm_loadu_si128(pIn), coefficients, zero), rounding), 8);
+				__m128i luma1 = _mm_srai_epi32(_mm_add_epi32(GetLuma4(_mm_loadu_si128(pIn + 1), coefficients, zero), rounding), 8);
+				__m128i luma2 = _mm_srai_epi32(_mm_add_epi32(GetLuma4(_mm_loadu_si128(pIn + 2), coefficients, zero), rounding), 8);
+				__m128i luma3 = _mm_srai_epi32(_mm_add_epi32(GetLuma4(_mm_loadu_si128(pIn + 3), coefficients, zero), rounding), 8);
+
+				__m128i low = _mm_add_epi16(_mm_packs_epi32(luma0, luma1), offset);
+				__m128i high = _mm_add_epi16(_mm_packs_epi32(luma2, luma3), offset);
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(pY + x), _mm_packus_epi16(low, high));
+			}
+		}
+#endif
+
+		for (; x < width; x++)
+		{
+			const unsigned char* pPixel = pSource + x * 4;
+			pY[x] = static_cast< unsigned char >(((66 * pPixel[2] + 129 * pPixel[1] + 25 * pPixel[0] + 128) >> 8) + 16);
+		}
+	}
+
+	// Computes the weighted sum of the rows for each byte, in 7-bit fixed point. The weights of a filter sum to 1 << 14.
+	static void FilterColumns(const unsigned char* const* ppRows, const short* pWeights, int tapCount, int length, short* pOut)
+	{
+		int i = 0;
+
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_AVX2_)
+		{
+			__m256i rounding = _mm256_set1_epi32(64);
+			for (; i + 32 <= length; i += 32)
+			{
+				__m256i sum0 = _mm256_setzero_si256();
+				__m256i sum1 = _mm256_setzero_si256();
+				__m256i sum2 = _mm256_setzero_si256();
+				__m256i sum3 = _mm256_setzero_si256();
+
+				// The taps are taken in pairs, whose bytes are interleaved and multiplied by the pair of weights
+				for (int k = 0; k < tapCount; k += 2)
+				{
+					bool hasPair = (k + 1 < tapCount);
+					__m256i weights = _mm256_set1_epi32(GetWeightPair(pWeights[k], hasPair ? pWeights[k + 1] : 0));
+					const unsigned char* pRow0 = ppRows[k] + i;
+					const unsigned char* pRow1 = hasPair ? ppRows[k + 1] + i : pRow0;
+
+					__m256i row00 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pRow0)));
+					__m256i row01 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pRow0 + 16)));
+					__m256i row10 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pRow1)));
+					__m256i row11 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast< const __m128i* >(pRow1 + 16)));
+
+					sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(_mm256_unpacklo_epi16(row00, row10), weights));
+					sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(_mm256_unpackhi_epi16(row00, row10), weights));
+					sum2 = _mm256_add_epi32(sum2, _mm256_madd_epi16(_mm256_unpacklo_epi16(row01, row11), weights));
+					sum3 = _mm256_add_epi32(sum3, _mm256_madd_epi16(_mm256_unpackhi_epi16(row01, row11), weights));
+				}
+
+				sum0 = _mm256_srai_epi32(_mm256_add_epi32(sum0, rounding), 7);
+				sum1 = _mm256_srai_epi32(_mm256_add_epi32(sum1, rounding), 7);
+				sum2 = _mm256_srai_epi32(_mm256_add_epi32(sum2, rounding), 7);
+				sum3 = _mm256_srai_epi32(_mm256_add_epi32(sum3, rounding), 7);
+				_mm256_storeu_si256(reinterpret_cast< __m256i* >(pOut + i), _mm256_packs_epi32(sum0, sum1));
+				_mm256_storeu_si256(reinterpret_cast< __m256i* >(pOut + i + 16), _mm256_packs_epi32(sum2, sum3));
+			}
+		}
+#endif
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_SSE2_)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i rounding = _mm_set1_epi32(64);
+			for (; i + 16 <= length; i += 16)
+			{
+				__m128i sum0 = _mm_setzero_si128();
+				__m128i sum1 = _mm_setzero_si128();
+				__m128i sum2 = _mm_setzero_si128();
+				__m128i sum3 = _mm_setzero_si128();
+
+				for (int k = 0; k < tapCount; k += 2)
+				{
+					bool hasPair = (k + 1 < tapCount);
+					__m128i weights = _mm_set1_epi32(GetWeightPair(pWeights[k], hasPair ? pWeights[k + 1] : 0));
+					__m128i row0 = _mm_loadu_si128(reinterpret_cast< const __m128i* >(ppRows[k] + i));
+					__m128i row1 = hasPair ? _mm_loadu_si128(reinterpret_cast< const __m128i* >(ppRows[k + 1] + i)) : zero;
+
+					__m128i row0Low = _mm_unpacklo_epi8(row0, zero);
+					__m128i row0High = _mm_unpackhi_epi8(row0, zero);
+					__m128i row1Low = _mm_unpacklo_epi8(row1, zero);
+					__m128i row1High = _mm_unpackhi_epi8(row1, zero);
+
+					sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(row0Low, row1Low), weights));
+					sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(row0Low, row1Low), weights));
+					sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi16(row0High, row1High), weights));
+					sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi16(row0High, row1High), weights));
+				}
+
+				sum0 = _mm_srai_epi32(_mm_add_epi32(sum0, rounding), 7);
+				sum1 = _mm_srai_epi32(_mm_add_epi32(sum1, rounding), 7);
+				sum2 = _mm_srai_epi32(_mm_add_epi32(sum2, rounding), 7);
+				sum3 = _mm_srai_epi32(_mm_add_epi32(sum3, rounding), 7);
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(pOut + i), _mm_packs_epi32(sum0, sum1));
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(pOut + i + 8), _mm_packs_epi32(sum2, sum3));
+			}
+		}
+#endif
+
+		for (; i < length; i++)
+		{
+			int sum = 0;
+			for (int k = 0; k < tapCount; k++)
+			{
+				sum += pWeights[k] * ppRows[k][i];
+			}
+			pOut[i] = static_cast< short >((sum + 64) >> 7);
+		}
+	}
+
+	// Computes each output pixel as the weighted sum of the columns of the filter, and removes the fixed point
+	static void FilterRow(const short* pColumns, int channelCount, const int* pStarts, const int* pCounts, const short* pWeights, int maxTapCount,
+		unsigned char* pOut, int width)
+	{
+		int x = 0;
+
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_SSE2_)
+		if (channelCount == 4)
+		{
+			__m128i rounding = _mm_set1_epi32(1 << 20);
+			for (; x < width; x++)
+			{
+				const short* pColumn = pColumns + pStarts[x] * 4;
+				const short* pWeight = pWeights + x * maxTapCount;
+				int tapCount = pCounts[x];
+				__m128i sum = _mm_setzero_si128();
+
+				for (int k = 0; k < tapCount; k += 2)
+				{
+					bool hasPair = (k + 1 < tapCount);
+					__m128i column0 = _mm_loadl_epi64(reinterpret_cast< const __m128i* >(pColumn + k * 4));
+					__m128i column1 = hasPair ? _mm_loadl_epi64(reinterpret_cast< const __m128i* >(pColumn + k * 4 + 4)) : _mm_setzero_si128();
+					__m128i weights = _mm_set1_epi32(GetWeightPair(pWeight[k], hasPair ? pWeight[k + 1] : 0));
+					sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(column0, column1), weights));
+				}
+
+				sum = _mm_srai_epi32(_mm_add_epi32(sum, rounding), 21);
+				sum = _mm_packs_epi32(sum, sum);
+				int pixel = _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+				memcpy(pOut + x * 4, &pixel, 4);
+			}
+		}
+#endif
+
+		for (; x < width; x++)
+		{
+			const short* pColumn = pColumns + pStarts[x] * channelCount;
+			const short* pWeight = pWeights + x * maxTapCount;
+			for (int c = 0; c < channelCount; c++)
+			{
+				int sum = 0;
+				for (int k = 0; k < pCounts[x]; k++)
+				{
+					sum += pWeight[k] * pColumn[k * channelCount + c];
+				}
+				pOut[x * channelCount + c] = static_cast< unsigned char >((sum + (1 << 20)) >> 21);
+			}
+		}
+	}
+
+	static int GetWeightPair(short weight0, short weight1)
+	{
+		return static_cast< int >((static_cast< unsigned int >(static_cast< unsigned short >(weight1)) << 16) | static_cast< unsigned short >(weight0));
+	}
+
+	static int Clamp(int value)
+	{
+		return (value < 0) ? 0 : ((value > 255) ? 255 : value);
+	}
+
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_AVX2_)
+	static __m256i Pack565(__m256i red, __m256i green, __m256i blue)
+	{
+		return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(red, _mm256_set1_epi16(0xF8)), 8),
+			_mm256_slli_epi16(_mm256_and_si256(green, _mm256_set1_epi16(0xFC)), 3)), _mm256_srli_epi16(blue, 3));
+	}
+#endif
+#if defined(_FMEDIA_TILED_IMAGE_UTIL_SSE2_)
+	static __m128i Pack565(__m128i red, __m128i green, __m128i blue)
+	{
+		return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_and_si128(red, _mm_set1_epi16(0xF8)), 8),
+			_mm_slli_epi16(_mm_and_si128(green, _mm_set1_epi16(0xFC)), 3)), _mm_srli_epi16(blue, 3));
+	}
+
+	// Returns the unrounded luma sums of 4 BGRA8888 pixels
+	static __m128i GetLuma4(__m128i pixels, __m128i coefficients, __m128i zero)
+	{
+		__m128i low = _mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), coefficients);
+		__m128i high = _mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), coefficients);
+		low = _mm_add_epi32(low, _mm_srli_epi64(low, 32));
+		high = _mm_add_epi32(high, _mm_srli_epi64(high, 32));
+
+		return _mm_unpacklo_epi64(_mm_shuffle_epi32(low, 0x08), _mm_shuffle_epi32(high, 0x08));
+	}
+#endif
+
+}; // __TiledImageSpan
+
+//
+// @class	__TiledImageKernel
+// @brief	This class is an operation which processes the rows of the output independently.
+// @since 2.1
+//
+class __TiledImageKernel
+{
+public:
+	virtual ~__TiledImageKernel(void)
+	{
+	}
+
+	// Processes the rows [top, bottom) of the output, and returns false if it has failed
+	virtual bool Process(int top, int bottom, unsigned char* pScratch) = 0;
+
+	// Returns the number of bytes of the scratch buffer, which each thread allocates once per operation
+	virtual int GetScratchSize(void) const
+	{
+		return 0;
+	}
+
+}; // __TiledImageKernel
+
+//
+// @class	__TiledImageJob
+// @brief	This class hands out the strips of an operation to the calling thread and the workers, and counts the processed strips.
+// @since 2.1
+//
+// The job is reference counted, so that a worker which starts after the operation has completed finds no strip
+// and does not access the kernel, which belongs to the caller.
+//
+class __TiledImageJob
+{
+public:
+	__TiledImageJob(__TiledImageKernel& kernel, int rowCount, int stripHeight, int refCount)
+		: __pKernel(&kernel)
+		, __rowCount(rowCount)
+		, __stripHeight(stripHeight)
+		, __stripCount((rowCount + stripHeight - 1) / stripHeight)
+		, __nextStrip(0)
+		, __doneStripCount(0)
+		, __isFailed(false)
+		, __refCount(refCount)
+	{
+	}
+
+	result Construct(void)
+	{
+		return __monitor.Construct();
+	}
+
+	// Deletes this instance when the last reference is released
+	void Release(void)
+	{
+		if (__sync_sub_and_fetch(&__refCount, 1) == 0)
+		{
+			delete this;
+		}
+	}
+
+	// Processes the rows in strips of stripHeight on the calling thread and helperCount workers of the pool, and waits until all the strips are processed
+	static result Execute(Tizen::Base::Runtime::ThreadPool& pool, __TiledImageKernel& kernel, int rowCount, int stripHeight, int helperCount);
+
+	// Processes the strips until none is left
+	void Run(void)
+	{
+		unsigned char* pScratch = null;
+		int scratchSize = -1;
+
+		for (;;)
+		{
+			int strip = __sync_fetch_and_add(&__nextStrip, 1);
+			if (strip >= __stripCount)
+			{
+				break;
+			}
+
+			if (scratchSize < 0)
+			{
+				scratchSize = __pKernel->GetScratchSize();
+				pScratch = (scratchSize > 0) ? new (std::nothrow) unsigned char[scratchSize] : null;
+			}
+
+			int top = strip * __stripHeight;
+			int bottom = (top + __stripHeight < __rowCount) ? top + __stripHeight : __rowCount;
+			bool isDone = (scratchSize == 0 || pScratch != null) && __pKernel->Process(top, bottom, pScratch);
+
+			__monitor.Enter();
+			__isFailed = __isFailed || !isDone;
+			__doneStripCount++;
+			if (__doneStripCount == __stripCount)
+			{
+				__monitor.NotifyAll();
+			}
+			__monitor.Exit();
+		}
+
+		delete[] pScratch;
+	}
+
+	// Waits until all the strips have been processed, and returns false if any of them has failed
+	bool Wait(void)
+	{
+		__monitor.Enter();
+		while (__doneStripCount < __stripCount)
+		{
+			__monitor.Wait();
+		}
+		__monitor.Exit();
+
+		return !__isFailed;
+	}
+
+private:
+	__TiledImageJob(const __TiledImageJob& rhs);
+	__TiledImageJob& operator =(const __TiledImageJob& rhs);
+
+	~__TiledImageJob(void)
+	{
+	}
+
+	__TiledImageKernel* __pKernel;
+	int __rowCount;
+	int __stripHeight;
+	int __stripCount;
+	volatile int __nextStrip;
+	int __doneStripCount;
+	bool __isFailed;
+	volatile int __refCount;
+	Tizen::Base::Runtime::Monitor __monitor;
+
+}; // __TiledImageJob
+
+//
+// @struct	__TiledImageTask
+// @brief	This struct is the functor which a worker runs for a job.
+// @since 2.1
+//
+struct __TiledImageTask
+{
+	explicit __TiledImageTask(__TiledImageJob* pJob)
+		: pJob(pJob)
+	{
+	}
+
+	void operator ()(void)
+	{
+		pJob->Run();
+		pJob->Release();
+	}
+
+	__TiledImageJob* pJob;
+
+}; // __TiledImageTask
+
+inline result
+__TiledImageJob::Execute(Tizen::Base::Runtime::ThreadPool& pool, __TiledImageKernel& kernel, int rowCount, int stripHeight, int helperCount)
+{
+	__TiledImageJob* pJob = new (std::nothrow) __TiledImageJob(kernel, rowCount, stripHeight, helperCount + 1);
+	TryReturn(pJob != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+	result r = pJob->Construct();
+	if (r != E_SUCCESS)
+	{
+		// The job is released by each reference which would have been given to a worker
+		for (int i = 0; i <= helperCount; i++)
+		{
+			pJob->Release();
+		}
+	}
+	TryReturn(r == E_SUCCESS, E_SYSTEM, "[%s] Failed to create the monitor.", GetErrorMessage(E_SYSTEM));
+
+	for (int i = 0; i < helperCount; i++)
+	{
+		// The strips of a worker which cannot be submitted are processed by the other participants
+		if (pool.SubmitFunctor(__TiledImageTask(pJob)) != E_SUCCESS)
+		{
+			pJob->Release();
+		}
+	}
+
+	pJob->Run();
+	bool isDone = pJob->Wait();
+	pJob->Release();
+	TryReturn(isDone, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+	return E_SUCCESS;
+}
+
+//
+// @class	__TiledImageFilter
+// @brief	This class holds the taps of a one-dimensional resampling, whose weights sum to 1 << 14 for each output sample.
+// @since 2.1
+//
+class __TiledImageFilter
+{
+public:
+	__TiledImageFilter(void)
+		: pStarts(null)
+		, pCounts(null)
+		, pWeights(null)
+		, maxTapCount(0)
+	{
+	}
+
+	~__TiledImageFilter(void)
+	{
+		delete[] pStarts;
+		delete[] pCounts;
+		delete[] pWeights;
+	}
+
+	// Builds the bilinear taps, or the area-average taps if isArea is true and the source is larger
+	result Construct(int sourceLength, int destinationLength, bool isArea)
+	{
+		isArea = isArea && sourceLength > destinationLength;
+		maxTapCount = isArea ? (sourceLength + destinationLength - 1) / destinationLength + 1 : 2;
+
+		pStarts = new (std::nothrow) int[destinationLength];
+		pCounts = new (std::nothrow) int[destinationLength];
+		pWeights = new (std::nothrow) short[destinationLength * maxTapCount];
+		TryReturn(pStarts != null && pCounts != null && pWeights != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		for (int i = 0; i < destinationLength; i++)
+		{
+			if (isArea)
+			{
+				SetAreaTaps(i, sourceLength, destinationLength);
+			}
+			else
+			{
+				SetBilinearTaps(i, sourceLength, destinationLength);
+			}
+		}
+
+		return E_SUCCESS;
+	}
+
+	int* pStarts;
+	int* pCounts;
+	short* pWeights;
+	int maxTapCount;
+
+private:
+	__TiledImageFilter(const __TiledImageFilter& rhs);
+	__TiledImageFilter& operator =(const __TiledImageFilter& rhs);
+
+	// Samples the two source pixels around the center of the output pixel, in 16.16 fixed point
+	void SetBilinearTaps(int index, int sourceLength, int destinationLength)
+	{
+		long long step = (static_cast< long long >(sourceLength) << 16) / destinationLength;
+		long long position = ((index * 2LL + 1) * step) / 2 - 0x8000;
+		short* pWeight = pWeights + index * maxTapCount;
+
+		int start = static_cast< int >(position >> 16);
+		if (position <= 0 || start >= sourceLength - 1)
+		{
+			pStarts[index] = (position <= 0) ? 0 : sourceLength - 1;
+			pCounts[index] = 1;
+			pWeight[0] = WEIGHT_ONE;
+			return;
+		}
+
+		short weight = static_cast< short >((position & 0xFFFF) >> 2);
+		pStarts[index] = start;
+		pCounts[index] = 2;
+		pWeight[0] = static_cast< short >(WEIGHT_ONE - weight);
+		pWeight[1] = weight;
+	}
+
+	// Weights each source pixel by the part of it which the output pixel covers, in 16.16 fixed point
+	void SetAreaTaps(int index, int sourceLength, int destinationLength)
+	{
+		long long begin = (static_cast< long long >(index) * sourceLength << 16) / destinationLength;
+		long long end = (static_cast< long long >(index + 1) * sourceLength << 16) / destinationLength;
+		int first = static_cast< int >(begin >> 16);
+		int last = static_cast< int >((end - 1) >> 16);
+		short* pWeight = pWeights + index * maxTapCount;
+
+		int total = 0;
+		int largest = 0;
+		for (int i = first; i <= last; i++)
+		{
+			long long left = (static_cast< long long >(i) << 16 > begin) ? static_cast< long long >(i) << 16 : begin;
+			long long right = (static_cast< long long >(i + 1) << 16 < end) ? static_cast< long long >(i + 1) << 16 : end;
+			short weight = static_cast< short >(((right - left) * WEIGHT_ONE) / (end - begin));
+
+			pWeight[i - first] = weight;
+			total += weight;
+			largest = (weight > pWeight[largest]) ? i - first : largest;
+		}
+
+		// The rounding error is given to the largest weight, so that a flat image stays flat
+		pWeight[largest] = static_cast< short >(pWeight[largest] + WEIGHT_ONE - total);
+		pStarts[index] = first;
+		pCounts[index] = last - first + 1;
+	}
+
+	static const short WEIGHT_ONE = 1 << 14;
+
+}; // __TiledImageFilter
+
+//
+// @class	__TiledImageConvertKernel
+// @brief	This class converts the pixel format of the rows.
+// @since 2.1
+//
+class __TiledImageConvertKernel
+	: public __TiledImageKernel
+{
+public:
+	__TiledImageConvertKernel(const unsigned char* pSource, MediaPixelFormat sourceFormat, unsigned char* pDestination, MediaPixelFormat destinationFormat,
+		int width, int height)
+		: __pSource(pSource)
+		, __sourceFormat(sourceFormat)
+		, __pDestination(pDestination)
+		, __destinationFormat(destinationFormat)
+		, __width(width)
+		, __height(height)
+		, __chromaWidth((width + 1) / 2)
+		, __chromaHeight((height + 1) / 2)
+	{
+	}
+
+	virtual bool Process(int top, int bottom, unsigned char* pScratch)
+	{
+		if (__destinationFormat == MEDIA_PIXEL_FORMAT_YUV420P)
+		{
+			ConvertToYuv(top, bottom, pScratch);
+		}
+		else if (__sourceFormat == MEDIA_PIXEL_FORMAT_RGB565LE || __sourceFormat == MEDIA_PIXEL_FORMAT_BGRA8888)
+		{
+			for (int y = top; y < bottom; y++)
+			{
+				if (__sourceFormat == MEDIA_PIXEL_FORMAT_RGB565LE)
+				{
+					ExpandRgb565Row(__pSource + static_cast< long >(y) * __width * 2, __pDestination + static_cast< long >(y) * __width * 4, __width);
+				}
+				else
+				{
+					PackRgb565Row(__pSource + static_cast< long >(y) * __width * 4, __pDestination + static_cast< long >(y) * __width * 2, __width);
+				}
+			}
+		}
+		else
+		{
+			ConvertFromYuv(top, bottom);
+		}
+
+		return true;
+	}
+
+	virtual int GetScratchSize(void) const
+	{
+		return (__sourceFormat == MEDIA_PIXEL_FORMAT_RGB565LE && __destinationFormat == MEDIA_PIXEL_FORMAT_YUV420P) ? __width * 8 : 0;
+	}
+
+	static void ExpandRgb565Row(const unsigned char* pSource, unsigned char* pDestination, int width)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			unsigned int pixel = pSource[x * 2] | (pSource[x * 2 + 1] << 8);
+			unsigned int red = (pixel >> 11) & 0x1F;
+			unsigned int green = (pixel >> 5) & 0x3F;
+			unsigned int blue = pixel & 0x1F;
+			pDestination[x * 4] = static_cast< unsigned char >((blue << 3) | (blue >> 2));
+			pDestination[x * 4 + 1] = static_cast< unsigned char >((green << 2) | (green >> 4));
+			pDestination[x * 4 + 2] = static_cast< unsigned char >((red << 3) | (red >> 2));
+			pDestination[x * 4 + 3] = 0xFF;
+		}
+	}
+
+	static void PackRgb565Row(const unsigned char* pSource, unsigned char* pDestination, int width)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			unsigned int pixel = ((pSource[x * 4 + 2] & 0xF8) << 8) | ((pSource[x * 4 + 1] & 0xFC) << 3) | (pSource[x * 4] >> 3);
+			pDestination[x * 2] = static_cast< unsigned char >(pixel);
+			pDestination[x * 2 + 1] = static_cast< unsigned char >(pixel >> 8);
+		}
+	}
+
+private:
+	__TiledImageConvertKernel(const __TiledImageConvertKernel& rhs);
+	__TiledImageConvertKernel& operator =(const __TiledImageConvertKernel& rhs);
+
+	void ConvertFromYuv(int top, int bottom)
+	{
+		long lumaSize = static_cast< long >(__width) * __height;
+		long chromaSize = static_cast< long >(__chromaWidth) * __chromaHeight;
+		bool isRgb565 = (__destinationFormat == MEDIA_PIXEL_FORMAT_RGB565LE);
+		int bytesPerPixel = isRgb565 ? 2 : 4;
+
+		for (int y = top; y < bottom; y++)
+		{
+			const unsigned char* pU = null;
+			const unsigned char* pV = null;
+			int chromaStep = 1;
+
+			if (__sourceFormat == MEDIA_PIXEL_FORMAT_YUV420P)
+			{
+				pU = __pSource + lumaSize + static_cast< long >(y / 2) * __chromaWidth;
+				pV = pU + chromaSize;
+			}
+			else
+			{
+				const unsigned char* pChroma = __pSource + lumaSize + static_cast< long >(y / 2) * __chromaWidth * 2;
+				pU = (__sourceFormat == MEDIA_PIXEL_FORMAT_NV12) ? pChroma : pChroma + 1;
+				pV = (__sourceFormat == MEDIA_PIXEL_FORMAT_NV12) ? pChroma + 1 : pChroma;
+				chromaStep = 2;
+			}
+
+			__TiledImageSpan::ConvertYuvRow(__pSource + static_cast< long >(y) * __width, pU, pV, chromaStep,
+				__pDestination + static_cast< long >(y) * __width * bytesPerPixel, __width, isRgb565);
+		}
+	}
+
+	// Converts the pairs of rows, whose chroma is the average of each 2x2 block
+	void ConvertToYuv(int top, int bottom, unsigned char* pScratch)
+	{
+		long lumaSize = static_cast< long >(__width) * __height;
+		long chromaSize = static_cast< long >(__chromaWidth) * __chromaHeight;
+		bool isRgb565 = (__sourceFormat == MEDIA_PIXEL_FORMAT_RGB565LE);
+
+		for (int y = top; y < bottom; y += 2)
+		{
+			int nextY = (y + 1 < __height) ? y + 1 : y;
+			const unsigned char* pRow0 = null;
+			const unsigned char* pRow1 = null;
+			if (isRgb565)
+			{
+				ExpandRgb565Row(__pSource + static_cast< long >(y) * __width * 2, pScratch, __width);
+				ExpandRgb565Row(__pSource + static_cast< long >(nextY) * __width * 2, pScratch + __width * 4, __width);
+				pRow0 = pScratch;
+				pRow1 = pScratch + __width * 4;
+			}
+			else
+			{
+				pRow0 = __pSource + static_cast< long >(y) * __width * 4;
+				pRow1 = __pSource + static_cast< long >(nextY) * __width * 4;
+			}
+
+			__TiledImageSpan::ConvertBgraToLumaRow(pRow0, __pDestination + static_cast< long >(y) * __width, __width);
+			if (nextY != y)
+			{
+				__TiledImageSpan::ConvertBgraToLumaRow(pRow1, __pDestination + static_cast< long >(nextY) * __width, __width);
+			}
+
+			unsigned char* pU = __pDestination + lumaSize + static_cast< long >(y / 2) * __chromaWidth;
+			unsigned char* pV = pU + chromaSize;
+			for (int x = 0; x < __chromaWidth; x++)
+			{
+				int left = x * 8;
+				int right = (x * 2 + 1 < __width) ? left + 4 : left;
+				int blue = (pRow0[left] + pRow0[right] + pRow1[left] + pRow1[right] + 2) >> 2;
+				int green = (pRow0[left + 1] + pRow0[right + 1] + pRow1[left + 1] + pRow1[right + 1] + 2) >> 2;
+				int red = (pRow0[left + 2] + pRow0[right + 2] + pRow1[left + 2] + pRow1[right + 2] + 2) >> 2;
+
+				// The offset keeps the sums positive, so that the shift rounds in the same way as for the luma
+				pU[x] = static_cast< unsigned char >((-38 * red - 74 * green + 112 * blue + 32896) >> 8);
+				pV[x] = static_cast< unsigned char >((112 * red - 94 * green - 18 * blue + 32896) >> 8);
+			}
+		}
+	}
+
+	const unsigned char* __pSource;
+	MediaPixelFormat __sourceFormat;
+	unsigned char* __pDestination;
+	MediaPixelFormat __destinationFormat;
+	int __width;
+	int __height;
+	int __chromaWidth;
+	int __chromaHeight;
+
+}; // __TiledImageConvertKernel
+
+//
+// @class	__TiledImageResizeKernel
+// @brief	This class resamples a plane of 8-bit channels or of RGB565LE pixels, first vertically and then horizontally.
+// @since 2.1
+//
+class __TiledImageResizeKernel
+	: public __TiledImageKernel
+{
+public:
+	__TiledImageResizeKernel(const unsigned char* pSource, int sourceWidth, unsigned char* pDestination, int destinationWidth,
+		int channelCount, bool isRgb565, const __TiledImageFilter& verticalFilter, const __TiledImageFilter& horizontalFilter)
+		: __pSource(pSource)
+		, __sourceWidth(sourceWidth)
+		, __pDestination(pDestination)
+		, __destinationWidth(destinationWidth)
+		, __channelCount(channelCount)
+		, __isRgb565(isRgb565)
+		, __verticalFilter(verticalFilter)
+		, __horizontalFilter(horizontalFilter)
+	{
+	}
+
+	virtual bool Process(int top, int bottom, unsigned char* pScratch)
+	{
+		int length = __sourceWidth * __channelCount;
+		short* pColumns = reinterpret_cast< short* >(pScratch);
+		const unsigned char** ppRows = reinterpret_cast< const unsigned char** >(pScratch + GetColumnSize());
+		unsigned char* pExpanded = pScratch + GetColumnSize() + GetRowPointerSize();
+		unsigned char* pOut = pExpanded + __verticalFilter.maxTapCount * length;
+
+		for (int y = top; y < bottom; y++)
+		{
+			int start = __verticalFilter.pStarts[y];
+			int tapCount = __verticalFilter.pCounts[y];
+			for (int k = 0; k < tapCount; k++)
+			{
+				if (__isRgb565)
+				{
+					ExpandRow(__pSource + static_cast< long >(start + k) * __sourceWidth * 2, pExpanded + k * length);
+					ppRows[k] = pExpanded + k * length;
+				}
+				else
+				{
+					ppRows[k] = __pSource + static_cast< long >(start + k) * length;
+				}
+			}
+
+			__TiledImageSpan::FilterColumns(ppRows, __verticalFilter.pWeights + y * __verticalFilter.maxTapCount, tapCount, length, pColumns);
+
+			if (__isRgb565)
+			{
+				__TiledImageSpan::FilterRow(pColumns, 3, __horizontalFilter.pStarts, __horizontalFilter.pCounts, __horizontalFilter.pWeights,
+					__horizontalFilter.maxTapCount, pOut, __destinationWidth);
+				PackRow(pOut, __pDestination + static_cast< long >(y) * __destinationWidth * 2);
+			}
+			else
+			{
+				__TiledImageSpan::FilterRow(pColumns, __channelCount, __horizontalFilter.pStarts, __horizontalFilter.pCounts, __horizontalFilter.pWeights,
+					__horizontalFilter.maxTapCount, __pDestination + static_cast< long >(y) * __destinationWidth * __channelCount, __destinationWidth);
+			}
+		}
+
+		return true;
+	}
+
+	virtual int GetScratchSize(void) const
+	{
+		int size = GetColumnSize() + GetRowPointerSize();
+		if (__isRgb565)
+		{
+			size += __verticalFilter.maxTapCount * __sourceWidth * 3 + __destinationWidth * 3;
+		}
+
+		return size;
+	}
+
+private:
+	__TiledImageResizeKernel(const __TiledImageResizeKernel& rhs);
+	__TiledImageResizeKernel& operator =(const __TiledImageResizeKernel& rhs);
+
+	// The filtered columns, with room for a 4-channel load past the last one, rounded up for the alignment of the row pointers
+	int GetColumnSize(void) const
+	{
+		return ((__sourceWidth * __channelCount + 4) * static_cast< int >(sizeof(short)) + 15) & ~15;
+	}
+
+	int GetRowPointerSize(void) const
+	{
+		return (__verticalFilter.maxTapCount * static_cast< int >(sizeof(unsigned char*)) + 15) & ~15;
+	}
+
+	void ExpandRow(const unsigned char* pSource, unsigned char* pDestination) const
+	{
+		for (int x = 0; x < __sourceWidth; x++)
+		{
+			unsigned int pixel = pSource[x * 2] | (pSource[x * 2 + 1] << 8);
+			unsigned int red = (pixel >> 11) & 0x1F;
+			unsigned int green = (pixel >> 5) & 0x3F;
+			unsigned int blue = pixel & 0x1F;
+			pDestination[x * 3] = static_cast< unsigned char >((red << 3) | (red >> 2));
+			pDestination[x * 3 + 1] = static_cast< unsigned char >((green << 2) | (green >> 4));
+			pDestination[x * 3 + 2] = static_cast< unsigned char >((blue << 3) | (blue >> 2));
+		}
+	}
+
+	void PackRow(const unsigned char* pSource, unsigned char* pDestination) const
+	{
+		for (int x = 0; x < __destinationWidth; x++)
+		{
+			unsigned int pixel = ((pSource[x * 3] & 0xF8) << 8) | ((pSource[x * 3 + 1] & 0xFC) << 3) | (pSource[x * 3 + 2] >> 3);
+			pDestination[x * 2] = static_cast< unsigned char >(pixel);
+			pDestination[x * 2 + 1] = static_cast< unsigned char >(pixel >> 8);
+		}
+	}
+
+	const unsigned char* __pSource;
+	int __sourceWidth;
+	unsigned char* __pDestination;
+	int __destinationWidth;
+	int __channelCount;
+	bool __isRgb565;
+	const __TiledImageFilter& __verticalFilter;
+	const __TiledImageFilter& __horizontalFilter;
+
+}; // __TiledImageResizeKernel
+
+//
+// @class	__TiledImageTransformKernelT
+// @brief	This class rotates or flips a plane of pixels of the specified type, or flips it in place.
+// @since 2.1
+//
+template< class Type >
+class __TiledImageTransformKernelT
+	: public __TiledImageKernel
+{
+public:
+	__TiledImageTransformKernelT(const Type* pSource, Type* pDestination, int width, int height, int transform)
+		: __pSource(pSource)
+		, __pDestination(pDestination)
+		, __width(width)
+		, __height(height)
+		, __transform(transform)
+	{
+	}
+
+	// Returns the number of rows of the output, or the number of the pairs of rows which are swapped in place
+	int GetRowCount(void) const
+	{
+		bool isRotated = (__transform == TRANSFORM_ROTATE_90 || __transform == TRANSFORM_ROTATE_270);
+		if (__pSource != __pDestination)
+		{
+			return isRotated ? __width : __height;
+		}
+
+		if (__transform == TRANSFORM_FLIP_VERTICAL)
+		{
+			return __height / 2;
+		}
+
+		return (__transform == TRANSFORM_ROTATE_180) ? (__height + 1) / 2 : __height;
+	}
+
+	int GetRowSize(void) const
+	{
+		bool isRotated = (__transform == TRANSFORM_ROTATE_90 || __transform == TRANSFORM_ROTATE_270);
+		return (isRotated ? __height : __width) * static_cast< int >(sizeof(Type));
+	}
+
+	virtual bool Process(int top, int bottom, unsigned char*)
+	{
+		if (__pSource == __pDestination)
+		{
+			TransformInPlace(top, bottom);
+			return true;
+		}
+
+		switch (__transform)
+		{
+		case TRANSFORM_ROTATE_90:
+			// Falls through
+		case TRANSFORM_ROTATE_270:
+			Rotate(top, bottom);
+			break;
+
+		case TRANSFORM_ROTATE_180:
+			for (int y = top; y < bottom; y++)
+			{
+				Reverse(GetSourceRow(__height - 1 - y), GetDestinationRow(y));
+			}
+			break;
+
+		case TRANSFORM_FLIP_HORIZONTAL:
+			for (int y = top; y < bottom; y++)
+			{
+				Reverse(GetSourceRow(y), GetDestinationRow(y));
+			}
+			break;
+
+		case TRANSFORM_FLIP_VERTICAL:
+			for (int y = top; y < bottom; y++)
+			{
+				memcpy(GetDestinationRow(y), GetSourceRow(__height - 1 - y), __width * sizeof(Type));
+			}
+			break;
+
+		default:
+			for (int y = top; y < bottom; y++)
+			{
+				memcpy(GetDestinationRow(y), GetSourceRow(y), __width * sizeof(Type));
+			}
+			break;
+		}
+
+		return true;
+	}
+
+	static const int TRANSFORM_NONE = 0;
+	static const int TRANSFORM_ROTATE_90 = 1;
+	static const int TRANSFORM_ROTATE_180 = 2;
+	static const int TRANSFORM_ROTATE_270 = 3;
+	static const int TRANSFORM_FLIP_HORIZONTAL = 4;
+	static const int TRANSFORM_FLIP_VERTICAL = 5;
+
+private:
+	__TiledImageTransformKernelT(const __TiledImageTransformKernelT& rhs);
+	__TiledImageTransformKernelT& operator =(const __TiledImageTransformKernelT& rhs);
+
+	const Type* GetSourceRow(int y) const
+	{
+		return __pSource + static_cast< long >(y) * __width;
+	}
+
+	Type* GetDestinationRow(int y) const
+	{
+		return __pDestination + static_cast< long >(y) * __width;
+	}
+
+	void Reverse(const Type* pSource, Type* pDestination) const
+	{
+		for (int x = 0; x < __width; x++)
+		{
+			pDestination[x] = pSource[__width - 1 - x];
+		}
+	}
+
+	// Writes the output in blocks of columns, so that the source rows which the block reads stay in the cache
+	void Rotate(int top, int bottom)
+	{
+		int destinationWidth = __height;
+		for (int left = 0; left < destinationWidth; left += ROTATION_BLOCK_SIZE)
+		{
+			int right = (left + ROTATION_BLOCK_SIZE < destinationWidth) ? left + ROTATION_BLOCK_SIZE : destinationWidth;
+			for (int y = top; y < bottom; y++)
+			{
+				Type* pDestination = __pDestination + static_cast< long >(y) * destinationWidth;
+				if (__transform == TRANSFORM_ROTATE_90)
+				{
+					for (int x = left; x < right; x++)
+					{
+						pDestination[x] = __pSource[static_cast< long >(__height - 1 - x) * __width + y];
+					}
+				}
+				else
+				{
+					for (int x = left; x < right; x++)
+					{
+						pDestination[x] = __pSource[static_cast< long >(x) * __width + (__width - 1 - y)];
+					}
+				}
+			}
+		}
+	}
+
+	void TransformInPlace(int top, int bottom)
+	{
+		for (int y = top; y < bottom; y++)
+		{
+			Type* pRow = __pDestination + static_cast< long >(y) * __width;
+			Type* pMirror = __pDestination + static_cast< long >(__height - 1 - y) * __width;
+
+			if (__transform == TRANSFORM_FLIP_VERTICAL)
+			{
+				for (int x = 0; x < __width; x++)
+				{
+					Type pixel = pRow[x];
+					pRow[x] = pMirror[x];
+					pMirror[x] = pixel;
+				}
+			}
+			else if (__transform == TRANSFORM_FLIP_HORIZONTAL || pRow == pMirror)
+			{
+				for (int x = 0; x < __width / 2; x++)
+				{
+					Type pixel = pRow[x];
+					pRow[x] = pRow[__width - 1 - x];
+					pRow[__width - 1 - x] = pixel;
+				}
+			}
+			else
+			{
+				for (int x = 0; x < __width; x++)
+				{
+					Type pixel = pRow[x];
+					pRow[x] = pMirror[__width - 1 - x];
+					pMirror[__width - 1 - x] = pixel;
+				}
+			}
+		}
+	}
+
+	static const int ROTATION_BLOCK_SIZE = 64;
+
+	const Type* __pSource;
+	Type* __pDestination;
+	int __width;
+	int __height;
+	int __transform;
+
+}; // __TiledImageTransformKernelT
+
+/**
+ * @class	TiledImageUtil
+ * @brief	This class converts, resizes, rotates, and flips images in strips, on the calling thread and the workers of a thread pool.
+ *
+ * @since	2.1
+ *
+ * The %TiledImageUtil class provides the operations of ImageUtil on the buffers of the application, such as a camera preview frame,
+ * without copying them into a ByteBuffer. An image is split into strips of rows which fit in the cache, and the strips are processed
+ * by the calling thread and the workers of a ThreadPool together, so that the calling thread does not wait for busy workers. @n
+ * The conversion between YUV420 and RGB and the resampling use AVX2 or SSE2 when the target supports them.
+ * The results do not depend on the target or on the number of the workers.
+ *
+ * The buffers are tightly packed, and the chroma planes of YUV420 have (width + 1) / 2 x (height + 1) / 2 samples.
+ * GetBufferSize() returns the size of a buffer.
+ *
+ * The following example demonstrates how to use the %TiledImageUtil class.
+ *
+ * @code
+ *	void
+ *	MyCameraForm::OnCameraPreviewed(Tizen::Base::ByteBuffer& previewedData, result r)
+ *	{
+ *		// __tiledImageUtil.Construct() is called when the form is initialized
+ *		__tiledImageUtil.ConvertPixelFormat(previewedData.GetPointer(), MEDIA_PIXEL_FORMAT_NV12, __pFrame, MEDIA_PIXEL_FORMAT_BGRA8888, __previewSize);
+ *		__tiledImageUtil.Resize(__pFrame, __previewSize, __pThumbnail, Dimension(160, 120), MEDIA_PIXEL_FORMAT_BGRA8888);
+ *	}
+ * @endcode
+ */
+class TiledImageUtil
+	: public Tizen::Base::Object
+{
+public:
+	/**
+	 * The object is not fully constructed after this constructor is called. For full construction, @n
+	 * the Construct() method must be called right after calling this constructor.
+	 *
+	 * @since	2.1
+	 */
+	TiledImageUtil(void)
+		: __pPool(null)
+		, __pOwnedPool(null)
+	{
+	}
+
+	/**
+	 * This destructor overrides Tizen::Base::Object::~Object(). @n
+	 * The thread pool is shut down if this instance has created it.
+	 *
+	 * @since	2.1
+	 */
+	virtual ~TiledImageUtil(void)
+	{
+		delete __pOwnedPool;
+	}
+
+	/**
+	 * Initializes this instance of %TiledImageUtil with a new thread pool.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	workerCount			The number of worker threads @n
+	 *									If it is @c 0, the number of online processors is used.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c workerCount is negative or greater than @c 64.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @exception	E_SYSTEM			A system error has occurred.
+	 */
+	result Construct(int workerCount = 0)
+	{
+		TryReturn(__pPool == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+
+		Tizen::Base::Runtime::ThreadPool* pPool = new (std::nothrow) Tizen::Base::Runtime::ThreadPool();
+		TryReturn(pPool != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+		result r = pPool->Construct(workerCount);
+		if (r != E_SUCCESS)
+		{
+			delete pPool;
+		}
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__pPool = pPool;
+		__pOwnedPool = pPool;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Initializes this instance of %TiledImageUtil with the specified thread pool, which is shared with other work.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pool				The constructed thread pool @n
+	 *									It must be valid until this instance is deleted.
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_OPERATION	This instance has already been constructed.
+	 * @exception	E_INVALID_ARG		The specified @c pool has not been constructed.
+	 */
+	result Construct(Tizen::Base::Runtime::ThreadPool& pool)
+	{
+		TryReturn(__pPool == null, E_INVALID_OPERATION, "[%s] This instance has already been constructed.", GetErrorMessage(E_INVALID_OPERATION));
+		TryReturn(pool.GetWorkerCount() > 0, E_INVALID_ARG, "[%s] The pool has not been constructed.", GetErrorMessage(E_INVALID_ARG));
+
+		__pPool = &pool;
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Gets the number of bytes of an image of the specified pixel format and size.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		The number of bytes of the image, @n
+	 *				else @c -1 if the pixel format is not supported by this class or the size is invalid
+	 * @param[in]	pixelFormat			The pixel format
+	 * @param[in]	dim					The width and height of the image
+	 */
+	static long long GetBufferSize(MediaPixelFormat pixelFormat, const Tizen::Graphics::Dimension& dim)
+	{
+		if (dim.width < 1 || dim.height < 1)
+		{
+			return -1;
+		}
+
+		long long pixelCount = static_cast< long long >(dim.width) * dim.height;
+		long long chromaCount = static_cast< long long >((dim.width + 1) / 2) * ((dim.height + 1) / 2);
+
+		switch (pixelFormat)
+		{
+		case MEDIA_PIXEL_FORMAT_GRAY:
+			return pixelCount;
+
+		case MEDIA_PIXEL_FORMAT_RGB565LE:
+			// Falls through
+		case MEDIA_PIXEL_FORMAT_RGB565BE:
+			return pixelCount * 2;
+
+		case MEDIA_PIXEL_FORMAT_RGBA8888:
+			// Falls through
+		case MEDIA_PIXEL_FORMAT_BGRA8888:
+			return pixelCount * 4;
+
+		case MEDIA_PIXEL_FORMAT_YUV420P:
+			// Falls through
+		case MEDIA_PIXEL_FORMAT_NV12:
+			// Falls through
+		case MEDIA_PIXEL_FORMAT_NV21:
+			return pixelCount + chromaCount * 2;
+
+		default:
+			return -1;
+		}
+	}
+
+	/**
+	 * Converts the pixel format of an image.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pSrc				The source image
+	 * @param[in]	srcPixelFormat		The pixel format of the source image
+	 * @param[out]	pDest				The destination image, which must not overlap the source image
+	 * @param[in]	destPixelFormat		The pixel format of the destination image
+	 * @param[in]	dim					The width and height of the images
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		A specified pointer is @c null, the images are the same, or the width or height is less than @c 1.
+	 * @exception	E_UNSUPPORTED_FORMAT	The conversion is not supported.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The supported conversions are:
+	 *				- From @c MEDIA_PIXEL_FORMAT_YUV420P, @c MEDIA_PIXEL_FORMAT_NV12, and @c MEDIA_PIXEL_FORMAT_NV21
+	 *				to @c MEDIA_PIXEL_FORMAT_RGB565LE and @c MEDIA_PIXEL_FORMAT_BGRA8888.
+	 *				- From @c MEDIA_PIXEL_FORMAT_RGB565LE and @c MEDIA_PIXEL_FORMAT_BGRA8888 to @c MEDIA_PIXEL_FORMAT_YUV420P.
+	 *				- Between @c MEDIA_PIXEL_FORMAT_RGB565LE and @c MEDIA_PIXEL_FORMAT_BGRA8888.
+	 *				.
+	 *				The YUV420 formats use the BT.601 video range, which the camera preview uses.
+	 */
+	result ConvertPixelFormat(const byte* pSrc, MediaPixelFormat srcPixelFormat, byte* pDest, MediaPixelFormat destPixelFormat,
+		const Tizen::Graphics::Dimension& dim)
+	{
+		TryReturn(__pPool != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(pSrc != null && pDest != null && pSrc != pDest, E_INVALID_ARG, "[%s] The pSrc or pDest is null, or they are the same.",
+			GetErrorMessage(E_INVALID_ARG));
+		TryReturn(dim.width >= 1 && dim.height >= 1, E_INVALID_ARG, "[%s] The dim(%d, %d) is invalid.", GetErrorMessage(E_INVALID_ARG), dim.width, dim.height);
+
+		bool isRgbSource = (srcPixelFormat == MEDIA_PIXEL_FORMAT_RGB565LE || srcPixelFormat == MEDIA_PIXEL_FORMAT_BGRA8888);
+		bool isRgbDestination = (destPixelFormat == MEDIA_PIXEL_FORMAT_RGB565LE || destPixelFormat == MEDIA_PIXEL_FORMAT_BGRA8888);
+		bool isYuvSource = (srcPixelFormat == MEDIA_PIXEL_FORMAT_YUV420P || srcPixelFormat == MEDIA_PIXEL_FORMAT_NV12
+			|| srcPixelFormat == MEDIA_PIXEL_FORMAT_NV21);
+		bool isSupported = (isYuvSource && isRgbDestination) || (isRgbSource && destPixelFormat == MEDIA_PIXEL_FORMAT_YUV420P)
+			|| (isRgbSource && isRgbDestination && srcPixelFormat != destPixelFormat);
+		TryReturn(isSupported, E_UNSUPPORTED_FORMAT, "[%s] The conversion from %d to %d is not supported.",
+			GetErrorMessage(E_UNSUPPORTED_FORMAT), srcPixelFormat, destPixelFormat);
+
+		__TiledImageConvertKernel kernel(pSrc, srcPixelFormat, pDest, destPixelFormat, dim.width, dim.height);
+		int rowSize = static_cast< int >(GetBufferSize(destPixelFormat, Tizen::Graphics::Dimension(dim.width, 1)));
+
+		// The rows of YUV420 are processed in pairs, which share a row of chroma
+		return Run(kernel, dim.height, rowSize, (isYuvSource || destPixelFormat == MEDIA_PIXEL_FORMAT_YUV420P) ? 2 : 1);
+	}
+
+	/**
+	 * Resizes an image.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pSrc				The source image
+	 * @param[in]	srcDim				The width and height of the source image
+	 * @param[out]	pDest				The destination image, which must not overlap the source image
+	 * @param[in]	destDim				The width and height of the destination image
+	 * @param[in]	pixelFormat			The pixel format of the images
+	 * @param[in]	scalingMethod		The scaling method
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		A specified pointer is @c null, the images are the same, or a width or height is less than @c 1.
+	 * @exception	E_UNSUPPORTED_FORMAT	The specified @c pixelFormat is not supported.
+	 * @exception	E_UNSUPPORTED_OPERATION	The specified @c scalingMethod is not supported.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks
+	 *				- The supported pixel formats are @c MEDIA_PIXEL_FORMAT_RGB565LE, @c MEDIA_PIXEL_FORMAT_BGRA8888,
+	 *				@c MEDIA_PIXEL_FORMAT_YUV420P, and @c MEDIA_PIXEL_FORMAT_GRAY.
+	 *				- With @c IMAGE_SCALING_METHOD_BILINEAR, a dimension which is reduced is averaged over the area of each destination pixel,
+	 *				so that a large reduction does not alias, and a dimension which is enlarged is interpolated.
+	 *				With @c IMAGE_SCALING_METHOD_FAST_BILINEAR, both are interpolated from the nearest two pixels.
+	 *				@c IMAGE_SCALING_METHOD_BICUBIC is not supported.
+	 */
+	result Resize(const byte* pSrc, const Tizen::Graphics::Dimension& srcDim, byte* pDest, const Tizen::Graphics::Dimension& destDim,
+		MediaPixelFormat pixelFormat, ImageScalingMethod scalingMethod = IMAGE_SCALING_METHOD_BILINEAR)
+	{
+		TryReturn(__pPool != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(pSrc != null && pDest != null && pSrc != pDest, E_INVALID_ARG, "[%s] The pSrc or pDest is null, or they are the same.",
+			GetErrorMessage(E_INVALID_ARG));
+		TryReturn(srcDim.width >= 1 && srcDim.height >= 1 && destDim.width >= 1 && destDim.height >= 1, E_INVALID_ARG,
+			"[%s] The srcDim(%d, %d) or destDim(%d, %d) is invalid.", GetErrorMessage(E_INVALID_ARG), srcDim.width, srcDim.height, destDim.width, destDim.height);
+		TryReturn(pixelFormat == MEDIA_PIXEL_FORMAT_RGB565LE || pixelFormat == MEDIA_PIXEL_FORMAT_BGRA8888 || pixelFormat == MEDIA_PIXEL_FORMAT_YUV420P
+			|| pixelFormat == MEDIA_PIXEL_FORMAT_GRAY, E_UNSUPPORTED_FORMAT,
+			"[%s] The pixelFormat(%d) is not supported.", GetErrorMessage(E_UNSUPPORTED_FORMAT), pixelFormat);
+		TryReturn(scalingMethod == IMAGE_SCALING_METHOD_BILINEAR || scalingMethod == IMAGE_SCALING_METHOD_FAST_BILINEAR, E_UNSUPPORTED_OPERATION,
+			"[%s] The scalingMethod(%d) is not supported.", GetErrorMessage(E_UNSUPPORTED_OPERATION), scalingMethod);
+
+		bool isArea = (scalingMethod == IMAGE_SCALING_METHOD_BILINEAR);
+		if (pixelFormat != MEDIA_PIXEL_FORMAT_YUV420P)
+		{
+			int channelCount = (pixelFormat == MEDIA_PIXEL_FORMAT_BGRA8888) ? 4 : ((pixelFormat == MEDIA_PIXEL_FORMAT_RGB565LE) ? 3 : 1);
+			result r = ResizePlane(pSrc, srcDim.width, srcDim.height, pDest, destDim.width, destDim.height, channelCount,
+				pixelFormat == MEDIA_PIXEL_FORMAT_RGB565LE, isArea);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+			return E_SUCCESS;
+		}
+
+		int srcChromaWidth = (srcDim.width + 1) / 2;
+		int srcChromaHeight = (srcDim.height + 1) / 2;
+		int destChromaWidth = (destDim.width + 1) / 2;
+		int destChromaHeight = (destDim.height + 1) / 2;
+		long srcLumaSize = static_cast< long >(srcDim.width) * srcDim.height;
+		long srcChromaSize = static_cast< long >(srcChromaWidth) * srcChromaHeight;
+		long destLumaSize = static_cast< long >(destDim.width) * destDim.height;
+		long destChromaSize = static_cast< long >(destChromaWidth) * destChromaHeight;
+
+		result r = ResizePlane(pSrc, srcDim.width, srcDim.height, pDest, destDim.width, destDim.height, 1, false, isArea);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		for (int i = 0; i < 2; i++)
+		{
+			r = ResizePlane(pSrc + srcLumaSize + srcChromaSize * i, srcChromaWidth, srcChromaHeight,
+				pDest + destLumaSize + destChromaSize * i, destChromaWidth, destChromaHeight, 1, false, isArea);
+			TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+		}
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Rotates an image clockwise.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pSrc				The source image
+	 * @param[out]	pDest				The destination image @n
+	 *									It can be the same as @c pSrc for @c IMAGE_ROTATION_0 and @c IMAGE_ROTATION_180, to rotate the image in place.
+	 *									Otherwise, it must not overlap the source image.
+	 * @param[in]	dim					The width and height of the source image
+	 * @param[in]	rotate				The rotation
+	 * @param[in]	pixelFormat			The pixel format of the images
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		A specified pointer is @c null, the images are the same for a rotation by 90 or 270 degrees,
+	 *									the specified @c rotate is invalid, or the width or height is less than @c 1.
+	 * @exception	E_UNSUPPORTED_FORMAT	The specified @c pixelFormat is not supported.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The supported pixel formats are @c MEDIA_PIXEL_FORMAT_RGB565LE, @c MEDIA_PIXEL_FORMAT_RGB565BE, @c MEDIA_PIXEL_FORMAT_RGBA8888,
+	 *				@c MEDIA_PIXEL_FORMAT_BGRA8888, @c MEDIA_PIXEL_FORMAT_YUV420P, and @c MEDIA_PIXEL_FORMAT_GRAY. @n
+	 *				The width and height of the destination image are exchanged for a rotation by 90 or 270 degrees.
+	 */
+	result Rotate(const byte* pSrc, byte* pDest, const Tizen::Graphics::Dimension& dim, ImageRotationType rotate, MediaPixelFormat pixelFormat)
+	{
+		int transform = __TiledImageTransformKernelT< byte >::TRANSFORM_NONE;
+		switch (rotate)
+		{
+		case IMAGE_ROTATION_0:
+			break;
+
+		case IMAGE_ROTATION_90:
+			transform = __TiledImageTransformKernelT< byte >::TRANSFORM_ROTATE_90;
+			break;
+
+		case IMAGE_ROTATION_180:
+			transform = __TiledImageTransformKernelT< byte >::TRANSFORM_ROTATE_180;
+			break;
+
+		case IMAGE_ROTATION_270:
+			transform = __TiledImageTransformKernelT< byte >::TRANSFORM_ROTATE_270;
+			break;
+
+		default:
+			TryReturn(false, E_INVALID_ARG, "[%s] The rotate(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), rotate);
+		}
+
+		result r = Transform(pSrc, pDest, dim, transform, pixelFormat);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	/**
+	 * Flips an image.
+	 *
+	 * @since	2.1
+	 *
+	 * @return		An error code
+	 * @param[in]	pSrc				The source image
+	 * @param[out]	pDest				The destination image @n
+	 *									It can be the same as @c pSrc, to flip the image in place. Otherwise, it must not overlap the source image.
+	 * @param[in]	dim					The width and height of the images
+	 * @param[in]	flip				The flip
+	 * @param[in]	pixelFormat			The pixel format of the images
+	 * @exception	E_SUCCESS			The method is successful.
+	 * @exception	E_INVALID_STATE		This instance has not been constructed.
+	 * @exception	E_INVALID_ARG		A specified pointer is @c null, the specified @c flip is invalid, or the width or height is less than @c 1.
+	 * @exception	E_UNSUPPORTED_FORMAT	The specified @c pixelFormat is not supported.
+	 * @exception	E_OUT_OF_MEMORY		The memory is insufficient.
+	 * @remarks		The supported pixel formats are the same as those of Rotate().
+	 */
+	result Flip(const byte* pSrc, byte* pDest, const Tizen::Graphics::Dimension& dim, ImageFlipType flip, MediaPixelFormat pixelFormat)
+	{
+		int transform = __TiledImageTransformKernelT< byte >::TRANSFORM_NONE;
+		switch (flip)
+		{
+		case IMAGE_FLIP_NONE:
+			break;
+
+		case IMAGE_FLIP_HORIZONTAL:
+			transform = __TiledImageTransformKernelT< byte >::TRANSFORM_FLIP_HORIZONTAL;
+			break;
+
+		case IMAGE_FLIP_VERTICAL:
+			transform = __TiledImageTransformKernelT< byte >::TRANSFORM_FLIP_VERTICAL;
+			break;
+
+		default:
+			TryReturn(false, E_INVALID_ARG, "[%s] The flip(%d) is invalid.", GetErrorMessage(E_INVALID_ARG), flip);
+		}
+
+		result r = Transform(pSrc, pDest, dim, transform, pixelFormat);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+private:
+	TiledImageUtil(const TiledImageUtil& rhs);
+	TiledImageUtil& operator =(const TiledImageUtil& rhs);
+
+	// Processes the rows in strips on the calling thread and the workers, and waits until all the strips are processed
+	result Run(__TiledImageKernel& kernel, int rowCount, int rowSize, int alignment)
+	{
+		if (rowCount <= 0)
+		{
+			return E_SUCCESS;
+		}
+
+		int workerCount = __pPool->GetWorkerCount();
+
+		// Each participant gets at least two strips of at most STRIP_SIZE bytes, which balances the load when a worker is busy
+		int stripHeight = STRIP_SIZE / ((rowSize > 0) ? rowSize : 1);
+		int balancedHeight = (rowCount + (workerCount + 1) * 2 - 1) / ((workerCount + 1) * 2);
+		stripHeight = (balancedHeight < stripHeight) ? balancedHeight : stripHeight;
+		stripHeight = ((stripHeight > 0 ? stripHeight : 1) + alignment - 1) / alignment * alignment;
+
+		int stripCount = (rowCount + stripHeight - 1) / stripHeight;
+		int helperCount = (stripCount - 1 < workerCount) ? stripCount - 1 : workerCount;
+		if (static_cast< long long >(rowCount) * rowSize < MIN_PARALLEL_SIZE)
+		{
+			helperCount = 0;
+		}
+
+		if (helperCount == 0)
+		{
+			int scratchSize = kernel.GetScratchSize();
+			unsigned char* pScratch = (scratchSize > 0) ? new (std::nothrow) unsigned char[scratchSize] : null;
+			TryReturn(scratchSize == 0 || pScratch != null, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			bool isDone = kernel.Process(0, rowCount, pScratch);
+			delete[] pScratch;
+			TryReturn(isDone, E_OUT_OF_MEMORY, "[%s] Memory allocation failed.", GetErrorMessage(E_OUT_OF_MEMORY));
+
+			return E_SUCCESS;
+		}
+
+		result r = __TiledImageJob::Execute(*__pPool, kernel, rowCount, stripHeight, helperCount);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	result ResizePlane(const byte* pSrc, int srcWidth, int srcHeight, byte* pDest, int destWidth, int destHeight, int channelCount, bool isRgb565, bool isArea)
+	{
+		__TiledImageFilter verticalFilter;
+		result r = verticalFilter.Construct(srcHeight, destHeight, isArea);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__TiledImageFilter horizontalFilter;
+		r = horizontalFilter.Construct(srcWidth, destWidth, isArea);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		__TiledImageResizeKernel kernel(pSrc, srcWidth, pDest, destWidth, channelCount, isRgb565, verticalFilter, horizontalFilter);
+		r = Run(kernel, destHeight, destWidth * (isRgb565 ? 2 : channelCount), 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	result Transform(const byte* pSrc, byte* pDest, const Tizen::Graphics::Dimension& dim, int transform, MediaPixelFormat pixelFormat)
+	{
+		TryReturn(__pPool != null, E_INVALID_STATE, "[%s] This instance has not been constructed.", GetErrorMessage(E_INVALID_STATE));
+		TryReturn(pSrc != null && pDest != null, E_INVALID_ARG, "[%s] The pSrc or pDest is null.", GetErrorMessage(E_INVALID_ARG));
+		TryReturn(dim.width >= 1 && dim.height >= 1, E_INVALID_ARG, "[%s] The dim(%d, %d) is invalid.", GetErrorMessage(E_INVALID_ARG), dim.width, dim.height);
+		TryReturn(pSrc != pDest || (transform != __TiledImageTransformKernelT< byte >::TRANSFORM_ROTATE_90
+			&& transform != __TiledImageTransformKernelT< byte >::TRANSFORM_ROTATE_270), E_INVALID_ARG,
+			"[%s] The image cannot be rotated by 90 or 270 degrees in place.", GetErrorMessage(E_INVALID_ARG));
+
+		if (pSrc == pDest && transform == __TiledImageTransformKernelT< byte >::TRANSFORM_NONE)
+		{
+			return GetBufferSize(pixelFormat, dim) > 0 ? E_SUCCESS : E_UNSUPPORTED_FORMAT;
+		}
+
+		switch (pixelFormat)
+		{
+		case MEDIA_PIXEL_FORMAT_GRAY:
+			return TransformPlane(pSrc, pDest, dim.width, dim.height, transform);
+
+		case MEDIA_PIXEL_FORMAT_RGB565LE:
+			// Falls through
+		case MEDIA_PIXEL_FORMAT_RGB565BE:
+			return TransformPlane(reinterpret_cast< const unsigned short* >(pSrc), reinterpret_cast< unsigned short* >(pDest), dim.width, dim.height, transform);
+
+		case MEDIA_PIXEL_FORMAT_RGBA8888:
+			// Falls through
+		case MEDIA_PIXEL_FORMAT_BGRA8888:
+			return TransformPlane(reinterpret_cast< const unsigned int* >(pSrc), reinterpret_cast< unsigned int* >(pDest), dim.width, dim.height, transform);
+
+		case MEDIA_PIXEL_FORMAT_YUV420P:
+			{
+				int chromaWidth = (dim.width + 1) / 2;
+				int chromaHeight = (dim.height + 1) / 2;
+				long lumaSize = static_cast< long >(dim.width) * dim.height;
+				long chromaSize = static_cast< long >(chromaWidth) * chromaHeight;
+
+				result r = TransformPlane(pSrc, pDest, dim.width, dim.height, transform);
+				for (int i = 0; i < 2 && r == E_SUCCESS; i++)
+				{
+					r = TransformPlane(pSrc + lumaSize + chromaSize * i, pDest + lumaSize + chromaSize * i, chromaWidth, chromaHeight, transform);
+				}
+				TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+				return E_SUCCESS;
+			}
+
+		default:
+			TryReturn(false, E_UNSUPPORTED_FORMAT, "[%s] The pixelFormat(%d) is not supported.", GetErrorMessage(E_UNSUPPORTED_FORMAT), pixelFormat);
+		}
+	}
+
+	template< class Type >
+	result TransformPlane(const Type* pSrc, Type* pDest, int width, int height, int transform)
+	{
+		__TiledImageTransformKernelT< Type > kernel(pSrc, pDest, width, height, transform);
+
+		result r = Run(kernel, kernel.GetRowCount(), kernel.GetRowSize(), 1);
+		TryReturn(r == E_SUCCESS, r, "[%s] Propagating.", GetErrorMessage(r));
+
+		return E_SUCCESS;
+	}
+
+	static const int STRIP_SIZE = 64 * 1024;
+	static const int MIN_PARALLEL_SIZE = 64 * 1024;
+
+	Tizen::Base::Runtime::ThreadPool* __pPool;
+	Tizen::Base::Runtime::ThreadPool* __pOwnedPool;
+
+}; // TiledImageUtil
+
+}} // Tizen::Media
+
+#endif // _FMEDIA_TILED_IMAGE_UTIL_H_